@@ -63,6 +63,7 @@ private:
 	OffsetType m_dataLenPtr;
 	OffsetType m_dataBegin;
 	T_STREAMING_SERIALIZER m_ss;
+	SortedOffsetIndexPrivate::CreationMode m_offsetsCreationMode{SortedOffsetIndexPrivate::CM_REGLINE};
 public:
 	///create a new Array at tellPutPtr()
 	ArrayCreator(UByteArrayAdapter & destination, const T_STREAMING_SERIALIZER & ss = T_STREAMING_SERIALIZER(), const OffsetContainer & ofs = OffsetContainer()) :
@@ -102,7 +103,8 @@ public:
 	m_offsets(std::move(other.m_offsets)),
 	m_dataLenPtr(std::move(other.m_dataLenPtr)),
 	m_dataBegin(std::move(other.m_dataBegin)),
-	m_ss(std::move(other.m_ss))
+	m_ss(std::move(other.m_ss)),
+	m_offsetsCreationMode(other.m_offsetsCreationMode)
 	{}
 	virtual ~ArrayCreator() {}
 	ArrayCreator & operator=(ArrayCreator && other) {
@@ -112,6 +114,7 @@ public:
 		m_dataBegin = std::move(other.m_dataBegin);
 		m_offsets = std::move(other.m_offsets);
 		m_ss = std::move(other.m_ss);
+		m_offsetsCreationMode = other.m_offsetsCreationMode;
 		return *this;
 	}
 	void clear() {
@@ -122,6 +125,9 @@ public:
 	const OffsetContainer & offsets() const { return m_offsets; }
 	void reserveOffsets(SizeType size) { m_offsets.reserve(size); }
 	void reserve(SizeType size) { reserveOffsets(size); }
+	///Encoding of the offset index written by flush(), default is CM_REGLINE
+	void setOffsetsCreationMode(SortedOffsetIndexPrivate::CreationMode mode) { m_offsetsCreationMode = mode; }
+	SortedOffsetIndexPrivate::CreationMode offsetsCreationMode() const { return m_offsetsCreationMode; }
 	void put(const TValue & value) {
 		beginRawPut();
 		m_ss(rawPut(), value);
@@ -165,7 +171,7 @@ public:
 			}
 		}
 		else {
-			if (!sserialize::Static::SortedOffsetIndexPrivate::create(m_offsets, *m_dest)) {
+			if (!sserialize::Static::SortedOffsetIndexPrivate::create(m_offsets, *m_dest, m_offsetsCreationMode)) {
 				throw sserialize::CreationException("Array::flush: Creating the offset");
 			}
 			#if defined(SSERIALIZE_EXPENSIVE_ASSERT_ENABLED)
@@ -225,7 +231,7 @@ public:
 private:
 	SizeType m_size;
 public:
-	ArrayOffsetIndex() {}
+	ArrayOffsetIndex() : m_size(0) {}
 	ArrayOffsetIndex(const MyType & other) : m_size(other.m_size) {}
 	ArrayOffsetIndex(sserialize::UByteArrayAdapter::OffsetType dataSize, const sserialize::UByteArrayAdapter & d) :
 	m_size((SizeType)(dataSize/sserialize::SerializationInfo<TValue>::length))
@@ -317,6 +323,8 @@ public:
 	TValue at(SizeType pos) const;
 	TValue operator[](SizeType pos) const;
 	UByteArrayAdapter::OffsetType dataSize(SizeType pos) const;
+	///offset of the element at pos in data(), pos has to be valid
+	inline UByteArrayAdapter::OffsetType dataOffset(SizeType pos) const { return m_index.at(pos); }
 	UByteArrayAdapter dataAt(SizeType pos) const;
 	SizeType find(const TValue & value) const;
 	TValue front() const;
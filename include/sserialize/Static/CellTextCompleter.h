@@ -12,6 +12,8 @@
 #include <sserialize/containers/RLEStream.h>
 #include <sserialize/spatial/GeoPoint.h>
 #include <sserialize/Static/TriangulationGeoHierarchyArrangement.h>
+#include <sserialize/strings/LevenshteinAutomaton.h>
+#include <sserialize/algorithm/utilfunctional.h>
 
 #ifndef SSERIALIZE_CELL_TEXT_COMPLETER_TAG_COMPLETION_PREFIX
 	#define SSERIALIZE_CELL_TEXT_COMPLETER_TAG_COMPLETION_PREFIX '@'
@@ -33,10 +35,10 @@ namespace Static {
   * }
   * 
   * struct CellTextCompleter::Payload {
-  *   uint<8> types;
+  *   uint<8> types; //lower 4 bits: available query types, bit 5: ptrs have checkpoints
   *   //The first offset is always 0 and will not be stored, offsets are stored in relative distance
   *   vuint<32> offsets;
-  *   RLEStream ptrs; // in order fmPtr, pPtr, pItemsPtr
+  *   RLEStream ptrs; // in order fmPtr, pPtr, pItemsPtr, with checkpoint table if bit 5 of types is set
   * }
   * 
   */
@@ -59,6 +61,8 @@ public:
 	public:
 		using QuerryType = sserialize::StringCompleter::QuerryType;
 		using indexid_type = sserialize::Static::ItemIndexStore::IdType;
+		///set in types if the ptrs streams have a checkpoint table
+		static constexpr uint32_t CheckpointsFlag = 0x10;
 		class Type {
 		public:
 			typedef sserialize::RLEStream const_iterator;
@@ -86,6 +90,12 @@ public:
 			inline const_iterator pItemsPtrBegin() const {
 				return m_data;
 			}
+			///@return iterator at the pos-th pItemsPtr, skips entries with the checkpoints of the stream if available
+			inline const_iterator pItemsPtr(uint32_t pos) const {
+				const_iterator it(m_data);
+				it.seek(pos+2);
+				return it;
+			}
 		};
 	private:
 		uint32_t m_types;
@@ -98,6 +108,7 @@ public:
 		inline QuerryType types() const {
 			return (QuerryType) (m_types & 0xF);
 		}
+		inline bool hasCheckpoints() const { return m_types & CheckpointsFlag; }
 		Type type(int qt) const;
 		UByteArrayAdapter typeData(int qt) const;
 	public:
@@ -118,6 +129,9 @@ private:
 	sserialize::Static::spatial::GeoHierarchy m_gh;
 	CellInfo m_ci;
 	sserialize::Static::spatial::TriangulationGeoHierarchyArrangement m_ra;
+private:
+	///selects the type of @param p that answers a query of type @param qt, @return false if there is none
+	static bool typeFromPayload(const Payload & p, const sserialize::StringCompleter::QuerryType qt, Payload::Type & t);
 public:
 	CellTextCompleter();
 	CellTextCompleter(const sserialize::UByteArrayAdapter & d, const sserialize::Static::ItemIndexStore & idxStore, const sserialize::Static::spatial::GeoHierarchy & gh, const sserialize::Static::spatial::TriangulationGeoHierarchyArrangement & ra);
@@ -135,12 +149,27 @@ public:
 	
 	bool count(const std::string::const_iterator& begin, const std::string::const_iterator& end) const;
 	Payload::Type typeFromCompletion(const std::string & qstr, const sserialize::StringCompleter::QuerryType qt) const;
+	///Batched typeFromCompletion(), types[i] is invalid if qstrs[i] has no match
+	void typesFromCompletion(const std::vector<std::string> & qstrs, const sserialize::StringCompleter::QuerryType qt, std::vector<Payload::Type> & types) const;
+	///Types of all strings within @param maxDistance edits of @param qstr
+	void typesFromFuzzyCompletion(const std::string & qstr, const sserialize::StringCompleter::QuerryType qt, uint32_t maxDistance, std::vector<Payload::Type> & types) const;
 	sserialize::StringCompleter::SupportedQuerries getSupportedQuerries() const;
 	std::ostream & printStats(std::ostream & out) const;
 	
+	///If qt contains QT_FUZZY this is completeFuzzy() with LevenshteinAutomaton::defaultMaxDistance()
 	template<typename T_CQR_TYPE>
 	T_CQR_TYPE complete(const std::string & qstr, const sserialize::StringCompleter::QuerryType qt) const;
 	
+	///Union of the results of all strings within @param maxDistance edits of @param qstr
+	template<typename T_CQR_TYPE>
+	T_CQR_TYPE completeFuzzy(const std::string & qstr, const sserialize::StringCompleter::QuerryType qt, uint32_t maxDistance) const;
+	
+	/** Result of complete() restricted to the cell @param cellId
+	  * Only the ptr of this cell is decoded from the payload, which skips most of it if the payload has checkpoints
+	  */
+	template<typename T_CQR_TYPE>
+	T_CQR_TYPE completeInCell(const std::string & qstr, const sserialize::StringCompleter::QuerryType qt, cellid_type cellId) const;
+	
 	template<typename T_CQR_TYPE>
 	T_CQR_TYPE regions(const std::string & qstr, const sserialize::StringCompleter::QuerryType qt) const;
 	
@@ -180,6 +209,9 @@ public:
 
 template<typename T_CQR_TYPE>
 T_CQR_TYPE CellTextCompleter::complete(const std::string& qstr, const sserialize::StringCompleter::QuerryType qt) const {
+	if (qt & sserialize::StringCompleter::QT_FUZZY) {
+		return completeFuzzy<T_CQR_TYPE>(qstr, qt, sserialize::LevenshteinAutomaton::defaultMaxDistance(qstr));
+	}
 	Payload::Type t;
 	try {
 		t = typeFromCompletion(qstr, qt);
@@ -190,6 +222,41 @@ T_CQR_TYPE CellTextCompleter::complete(const std::string& qstr, const sserialize
 	return T_CQR_TYPE(m_idxStore.at( t.fmPtr() ), m_idxStore.at( t.pPtr() ), t.pItemsPtrBegin(), m_ci, m_idxStore, flags());
 }
 
+template<typename T_CQR_TYPE>
+T_CQR_TYPE CellTextCompleter::completeFuzzy(const std::string& qstr, const sserialize::StringCompleter::QuerryType qt, uint32_t maxDistance) const {
+	std::vector<Payload::Type> types;
+	typesFromFuzzyCompletion(qstr, qt, maxDistance, types);
+	if (!types.size()) {
+		return T_CQR_TYPE(m_ci, m_idxStore, flags());
+	}
+	typedef std::vector<Payload::Type>::const_iterator TypesIterator;
+	auto redFunc = [](const T_CQR_TYPE & a, const T_CQR_TYPE & b) { return a + b; };
+	auto mapFunc = [this](const Payload::Type & t) {
+		return T_CQR_TYPE(m_idxStore.at( t.fmPtr() ), m_idxStore.at( t.pPtr() ), t.pItemsPtrBegin(), m_ci, m_idxStore, flags());
+	};
+	return sserialize::treeReduceMap<TypesIterator, T_CQR_TYPE>(types.cbegin(), types.cend(), redFunc, mapFunc);
+}
+
+template<typename T_CQR_TYPE>
+T_CQR_TYPE CellTextCompleter::completeInCell(const std::string& qstr, const sserialize::StringCompleter::QuerryType qt, cellid_type cellId) const {
+	Payload::Type t;
+	try {
+		t = typeFromCompletion(qstr, qt);
+	}
+	catch (const sserialize::OutOfBoundsException & e) {
+		return T_CQR_TYPE(m_ci, m_idxStore, flags());
+	}
+	sserialize::ItemIndex cellIdx(std::vector<uint32_t>(1, cellId));
+	if (m_idxStore.at( t.fmPtr() ).count(cellId)) {
+		return T_CQR_TYPE(cellIdx, m_ci, m_idxStore, flags());
+	}
+	uint32_t pos = m_idxStore.at( t.pPtr() ).find(cellId);
+	if (pos == sserialize::ItemIndex::npos) {
+		return T_CQR_TYPE(m_ci, m_idxStore, flags());
+	}
+	return T_CQR_TYPE(sserialize::ItemIndex(), cellIdx, t.pItemsPtr(pos), m_ci, m_idxStore, flags());
+}
+
 template<typename T_CQR_TYPE>
 T_CQR_TYPE CellTextCompleter::regions(const std::string& qstr, const sserialize::StringCompleter::QuerryType qt) const {
 	Payload::Type t;
@@ -371,6 +438,11 @@ public:
 		return priv()->typeFromCompletion(qstr, qt);
 	}
 	
+	///Batched typeFromCompletion(), types[i] is invalid if qstrs[i] has no match
+	inline void typesFromCompletion(const std::vector<std::string> & qstrs, const sserialize::StringCompleter::QuerryType qt, std::vector<Payload::Type> & types) const {
+		priv()->typesFromCompletion(qstrs, qt, types);
+	}
+	
 	inline int flags() const {
 		return priv()->flags();
 	}
@@ -384,6 +456,16 @@ public:
 		return priv()->complete<T_CQR_TYPE>(qstr, qt);
 	}
 	
+	template<typename T_CQR_TYPE = sserialize::CellQueryResult>
+	inline T_CQR_TYPE completeInCell(const std::string & qstr, const sserialize::StringCompleter::QuerryType qt, cellid_type cellId) const {
+		return priv()->completeInCell<T_CQR_TYPE>(qstr, qt, cellId);
+	}
+	
+	template<typename T_CQR_TYPE = sserialize::CellQueryResult>
+	inline T_CQR_TYPE completeFuzzy(const std::string & qstr, const sserialize::StringCompleter::QuerryType qt, uint32_t maxDistance) const {
+		return priv()->completeFuzzy<T_CQR_TYPE>(qstr, qt, maxDistance);
+	}
+	
 	template<typename T_CQR_TYPE = sserialize::CellQueryResult>
 	inline T_CQR_TYPE regions(const std::string & qstr, const sserialize::StringCompleter::QuerryType qt) const {
 		return priv()->regions<T_CQR_TYPE>(qstr, qt);
@@ -0,0 +1,296 @@
+#ifndef SSERIALIZE_STATIC_COLUMN_ARRAY_H
+#define SSERIALIZE_STATIC_COLUMN_ARRAY_H
+#include <sserialize/containers/CompactUintArray.h>
+#include <sserialize/utility/exceptions.h>
+#include <sserialize/utility/VersionChecker.h>
+#include <sserialize/utility/checks.h>
+#include <array>
+#include <tuple>
+#include <vector>
+#include <limits>
+#include <type_traits>
+#define SSERIALIZE_STATIC_COLUMN_ARRAY_VERSION 1
+
+namespace sserialize {
+namespace Static {
+namespace detail {
+namespace ColumnArray {
+
+///Order preserving mapping of integral values to uint64_t
+template<typename T, typename T_ENABLE = void>
+struct ValueMapper;
+
+template<typename T>
+struct ValueMapper<T, typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value>::type> {
+	static inline uint64_t encode(T v) { return static_cast<uint64_t>(v); }
+	static inline T decode(uint64_t v) { return static_cast<T>(v); }
+};
+
+template<typename T>
+struct ValueMapper<T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type> {
+	static constexpr uint64_t SignBit = static_cast<uint64_t>(1) << 63;
+	static inline uint64_t encode(T v) { return static_cast<uint64_t>(static_cast<int64_t>(v)) ^ SignBit; }
+	static inline T decode(uint64_t v) { return static_cast<T>(static_cast<int64_t>(v ^ SignBit)); }
+};
+
+template<typename T>
+struct ValueMapper<T, typename std::enable_if<std::is_enum<T>::value>::type> {
+	using underlying_type = typename std::underlying_type<T>::type;
+	static inline uint64_t encode(T v) { return ValueMapper<underlying_type>::encode(static_cast<underlying_type>(v)); }
+	static inline T decode(uint64_t v) { return static_cast<T>(ValueMapper<underlying_type>::decode(v)); }
+};
+
+}}//end namespace detail::ColumnArray
+
+/** A read-only array of fixed-length tuples that is stored column by column (struct of arrays).
+  * Every column is bit-packed on its own: the minimum of a column is stored once
+  * and the entries store their distance to it with as many bits as the largest distance needs.
+  * Scans over a single column only touch the data of that column and decode it in chunks.
+  * All types have to be integral or enums.
+  *
+  * struct ColumnArray {
+  *   uint<8> version{1};
+  *   v<uint32> columnCount;
+  *   v<uint64> size;
+  *   Column columns[columnCount];
+  * };
+  *
+  * struct Column {
+  *   v<uint64> base; //smallest encoded value of the column, signed values are mapped order preserving
+  *   BoundedCompactUintArray values; //value - base
+  * };
+  */
+template<typename... TArgs>
+class ColumnArray final {
+public:
+	typedef sserialize::SizeType SizeType;
+	typedef std::tuple<TArgs...> value_type;
+	static constexpr std::size_t ColumnCount = sizeof...(TArgs);
+	static constexpr uint32_t ChunkSize = 64;
+	template<std::size_t I>
+	using column_type = typename std::tuple_element<I, value_type>::type;
+private:
+	template<std::size_t I>
+	using Mapper = detail::ColumnArray::ValueMapper< column_type<I> >;
+	struct Column {
+		uint64_t base;
+		BoundedCompactUintArray values;
+	};
+public:
+	ColumnArray() : m_size(0), m_dataSize(0) {}
+	ColumnArray(const UByteArrayAdapter & d);
+	ColumnArray(UByteArrayAdapter & d, UByteArrayAdapter::ConsumeTag) : ColumnArray(d) {
+		d += getSizeInBytes();
+	}
+	ColumnArray(UByteArrayAdapter const & d, UByteArrayAdapter::NoConsumeTag) : ColumnArray(d) {}
+	~ColumnArray() {}
+	inline SizeType size() const { return m_size; }
+	inline UByteArrayAdapter::OffsetType getSizeInBytes() const { return m_dataSize; }
+	///value of column I at pos
+	template<std::size_t I>
+	column_type<I> get(SizeType pos) const;
+	value_type at(SizeType pos) const;
+	///Calls f(pos, value) for the values of column I in [begin, end)
+	template<std::size_t I, typename T_FUNC>
+	void scan(SizeType begin, SizeType end, T_FUNC f) const;
+	///Writes the positions in [begin, end) whose value in column I fulfills pred(value) to out
+	template<std::size_t I, typename T_PREDICATE, typename T_OUTPUT_ITERATOR>
+	T_OUTPUT_ITERATOR filter(SizeType begin, SizeType end, T_PREDICATE pred, T_OUTPUT_ITERATOR out) const;
+	/** Writes the positions in [begin, end) with lower <= value <= upper in column I to out.
+	  * The comparison is done on the packed values and does not need to decode them.
+	  */
+	template<std::size_t I, typename T_OUTPUT_ITERATOR>
+	T_OUTPUT_ITERATOR filterRange(SizeType begin, SizeType end, column_type<I> lower, column_type<I> upper, T_OUTPUT_ITERATOR out) const;
+	///number of positions whose value in column I fulfills pred(value)
+	template<std::size_t I, typename T_PREDICATE>
+	SizeType count(T_PREDICATE pred) const;
+public:
+	/** Creates a ColumnArray at dest.tellPutPtr()
+	  * @param src container of tuple-like values which support std::get<I>, i.e. std::tuple or std::pair
+	  */
+	template<typename T_CONTAINER>
+	static UByteArrayAdapter & create(const T_CONTAINER & src, UByteArrayAdapter & dest);
+private:
+	template<std::size_t I, typename T_FUNC>
+	void scanPacked(SizeType begin, SizeType end, T_FUNC f) const;
+	template<std::size_t... I>
+	value_type at(SizeType pos, std::index_sequence<I...>) const;
+	template<typename T_CONTAINER, std::size_t... I>
+	static void createColumns(const T_CONTAINER & src, UByteArrayAdapter & dest, std::index_sequence<I...>);
+	template<std::size_t I, typename T_CONTAINER>
+	static void createColumn(const T_CONTAINER & src, UByteArrayAdapter & dest);
+private:
+	SizeType m_size;
+	UByteArrayAdapter::OffsetType m_dataSize;
+	std::array<Column, ColumnCount> m_columns;
+};
+
+template<typename... TArgs>
+ColumnArray<TArgs...>::ColumnArray(const UByteArrayAdapter & d) :
+m_size(0),
+m_dataSize(0)
+{
+	SSERIALIZE_VERSION_MISSMATCH_CHECK(SSERIALIZE_STATIC_COLUMN_ARRAY_VERSION, d.at(0), "Static::ColumnArray");
+	UByteArrayAdapter data(d, 1);
+	data.resetGetPtr();
+	uint32_t columnCount = data.getVlPackedUint32();
+	if (columnCount != ColumnCount) {
+		throw sserialize::TypeMissMatchException("Static::ColumnArray: data has " + std::to_string(columnCount) + " columns, expected " + std::to_string(ColumnCount));
+	}
+	m_size = narrow_check<SizeType>(data.getVlPackedUint64());
+	for(Column & c : m_columns) {
+		c.base = data.getVlPackedUint64();
+		c.values = BoundedCompactUintArray(data+data.tellGetPtr());
+		if (c.values.size() != m_size) {
+			throw sserialize::CorruptDataException("Static::ColumnArray: column size does not match array size");
+		}
+		data.incGetPtr(c.values.getSizeInBytes());
+	}
+	m_dataSize = 1 + data.tellGetPtr();
+}
+
+template<typename... TArgs>
+template<std::size_t I>
+typename ColumnArray<TArgs...>::template column_type<I>
+ColumnArray<TArgs...>::get(SizeType pos) const {
+	if (pos >= size()) {
+		throw sserialize::OutOfBoundsException(pos, size());
+	}
+	const Column & c = std::get<I>(m_columns);
+	return Mapper<I>::decode(c.base + c.values.at64(pos));
+}
+
+template<typename... TArgs>
+template<std::size_t... I>
+typename ColumnArray<TArgs...>::value_type
+ColumnArray<TArgs...>::at(SizeType pos, std::index_sequence<I...>) const {
+	return value_type(get<I>(pos)...);
+}
+
+template<typename... TArgs>
+typename ColumnArray<TArgs...>::value_type
+ColumnArray<TArgs...>::at(SizeType pos) const {
+	return at(pos, std::index_sequence_for<TArgs...>());
+}
+
+template<typename... TArgs>
+template<std::size_t I, typename T_FUNC>
+void ColumnArray<TArgs...>::scanPacked(SizeType begin, SizeType end, T_FUNC f) const {
+	if (end > size() || begin > end) {
+		throw sserialize::OutOfBoundsException("Static::ColumnArray::scan: invalid range");
+	}
+	const Column & c = std::get<I>(m_columns);
+	std::array<CompactUintArray::value_type, ChunkSize> buffer;
+	while (begin < end) {
+		uint32_t chunk = uint32_t(std::min<SizeType>(end-begin, ChunkSize));
+		c.values.getRange(begin, chunk, buffer.data());
+		f(begin, buffer.data(), chunk);
+		begin += chunk;
+	}
+}
+
+template<typename... TArgs>
+template<std::size_t I, typename T_FUNC>
+void ColumnArray<TArgs...>::scan(SizeType begin, SizeType end, T_FUNC f) const {
+	uint64_t base = std::get<I>(m_columns).base;
+	scanPacked<I>(begin, end, [base, &f](SizeType chunkBegin, const CompactUintArray::value_type * values, uint32_t chunk) {
+		for(uint32_t i(0); i < chunk; ++i) {
+			f(chunkBegin+i, Mapper<I>::decode(base + values[i]));
+		}
+	});
+}
+
+template<typename... TArgs>
+template<std::size_t I, typename T_PREDICATE, typename T_OUTPUT_ITERATOR>
+T_OUTPUT_ITERATOR
+ColumnArray<TArgs...>::filter(SizeType begin, SizeType end, T_PREDICATE pred, T_OUTPUT_ITERATOR out) const {
+	uint64_t base = std::get<I>(m_columns).base;
+	std::array<SizeType, ChunkSize> matches;
+	scanPacked<I>(begin, end, [base, &pred, &out, &matches](SizeType chunkBegin, const CompactUintArray::value_type * values, uint32_t chunk) {
+		//branch free selection of the matching positions
+		uint32_t matchCount = 0;
+		for(uint32_t i(0); i < chunk; ++i) {
+			matches[matchCount] = chunkBegin+i;
+			matchCount += uint32_t(bool(pred(Mapper<I>::decode(base + values[i]))));
+		}
+		out = std::copy(matches.begin(), matches.begin()+matchCount, out);
+	});
+	return out;
+}
+
+template<typename... TArgs>
+template<std::size_t I, typename T_OUTPUT_ITERATOR>
+T_OUTPUT_ITERATOR
+ColumnArray<TArgs...>::filterRange(SizeType begin, SizeType end, column_type<I> lower, column_type<I> upper, T_OUTPUT_ITERATOR out) const {
+	uint64_t base = std::get<I>(m_columns).base;
+	uint64_t lowerEnc = Mapper<I>::encode(lower);
+	uint64_t upperEnc = Mapper<I>::encode(upper);
+	if (lowerEnc > upperEnc || upperEnc < base) {
+		return out;
+	}
+	//packed values are value-base, all packed values are >= 0
+	uint64_t lowerPacked = (lowerEnc > base ? lowerEnc - base : 0);
+	uint64_t rangeWidth = upperEnc - base - lowerPacked;
+	std::array<SizeType, ChunkSize> matches;
+	scanPacked<I>(begin, end, [lowerPacked, rangeWidth, &out, &matches](SizeType chunkBegin, const CompactUintArray::value_type * values, uint32_t chunk) {
+		uint32_t matchCount = 0;
+		for(uint32_t i(0); i < chunk; ++i) {
+			matches[matchCount] = chunkBegin+i;
+			//values below lowerPacked wrap around and are larger than rangeWidth
+			matchCount += uint32_t(values[i] - lowerPacked <= rangeWidth);
+		}
+		out = std::copy(matches.begin(), matches.begin()+matchCount, out);
+	});
+	return out;
+}
+
+template<typename... TArgs>
+template<std::size_t I, typename T_PREDICATE>
+typename ColumnArray<TArgs...>::SizeType
+ColumnArray<TArgs...>::count(T_PREDICATE pred) const {
+	uint64_t base = std::get<I>(m_columns).base;
+	SizeType result = 0;
+	scanPacked<I>(0, size(), [base, &pred, &result](SizeType, const CompactUintArray::value_type * values, uint32_t chunk) {
+		for(uint32_t i(0); i < chunk; ++i) {
+			result += SizeType(bool(pred(Mapper<I>::decode(base + values[i]))));
+		}
+	});
+	return result;
+}
+
+template<typename... TArgs>
+template<std::size_t I, typename T_CONTAINER>
+void ColumnArray<TArgs...>::createColumn(const T_CONTAINER & src, UByteArrayAdapter & dest) {
+	std::vector<uint64_t> values;
+	values.reserve(src.size());
+	for(const auto & x : src) {
+		values.push_back( Mapper<I>::encode(std::get<I>(x)) );
+	}
+	uint64_t base = (values.size() ? *std::min_element(values.begin(), values.end()) : 0);
+	for(uint64_t & v : values) {
+		v -= base;
+	}
+	dest.putVlPackedUint64(base);
+	BoundedCompactUintArray::create(values, dest);
+}
+
+template<typename... TArgs>
+template<typename T_CONTAINER, std::size_t... I>
+void ColumnArray<TArgs...>::createColumns(const T_CONTAINER & src, UByteArrayAdapter & dest, std::index_sequence<I...>) {
+	(createColumn<I>(src, dest), ...);
+}
+
+template<typename... TArgs>
+template<typename T_CONTAINER>
+UByteArrayAdapter &
+ColumnArray<TArgs...>::create(const T_CONTAINER & src, UByteArrayAdapter & dest) {
+	dest.putUint8(SSERIALIZE_STATIC_COLUMN_ARRAY_VERSION);
+	dest.putVlPackedUint32(narrow_check<uint32_t>(ColumnCount));
+	dest.putVlPackedUint64(src.size());
+	createColumns(src, dest, std::index_sequence_for<TArgs...>());
+	return dest;
+}
+
+}}//end namespace sserialize::Static
+
+#endif
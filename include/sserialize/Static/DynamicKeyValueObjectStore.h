@@ -63,7 +63,8 @@ public:
 	inline Item at(uint32_t pos) const { return Item(this, m_items.dataAt(pos)); }
 	///You have to call finalizeStringTables() and reserve() before adding items
 	void push_back(const std::vector< std::pair< std::string, std::string > > & extItem);
-	UByteArrayAdapter::OffsetType serialize(sserialize::UByteArrayAdapter & dest) const;
+	///@param frontCoded store the key and value strings as Static::FrontCodedStringTable
+	UByteArrayAdapter::OffsetType serialize(sserialize::UByteArrayAdapter & dest, bool frontCoded = false) const;
 	std::pair<std::string, std::string> keyValue(uint32_t keyId, uint32_t valueId) const;
 };
 
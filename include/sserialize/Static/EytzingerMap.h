@@ -0,0 +1,317 @@
+#ifndef SSERIALIZE_STATIC_EYTZINGER_MAP_H
+#define SSERIALIZE_STATIC_EYTZINGER_MAP_H
+#include <sserialize/Static/Array.h>
+#include <sserialize/utility/exceptions.h>
+#include <bit>
+#include <map>
+#include <vector>
+#define SSERIALIZE_STATIC_EYTZINGER_MAP_VERSION 1
+
+/** FileFormat
+ *
+ * struct EytzingerMap {
+ *   uint<8> version{1};
+ *   Static::Array<TKey> keys;
+ *   Static::Array<TValue> values;
+ * };
+ *
+ * struct EytzingerSet {
+ *   uint<8> version{1};
+ *   Static::Array<TKey> keys;
+ * };
+ *
+ * The keys are stored in Eytzinger (BFS) order of the implicit search tree:
+ * The children of the key at position i are at positions 2*i+1 and 2*i+2.
+ * The first probes of every search therefore hit the first few bytes of the key array.
+ * Keys are stored separately from the values so that searching never touches the values.
+ * Positions returned by findPosition() are positions in this order and not sorted ranks.
+ *
+ */
+
+namespace sserialize {
+namespace Static {
+namespace detail {
+namespace Eytzinger {
+
+///@return rank2pos[i] is the position of the i-th smallest key in Eytzinger order
+inline std::vector<SizeType> rank2pos(SizeType size) {
+	std::vector<SizeType> result(size);
+	std::vector<SizeType> stack;
+	SizeType rank = 0;
+	SizeType pos = 0;
+	//iterative in-order traversal of the implicit tree
+	while (pos < size || stack.size()) {
+		while (pos < size) {
+			stack.push_back(pos);
+			pos = 2*pos+1;
+		}
+		pos = stack.back();
+		stack.pop_back();
+		result[rank] = pos;
+		++rank;
+		pos = 2*pos+2;
+	}
+	return result;
+}
+
+///@param less less(pos) returns true if the key at pos is smaller than the searched key
+///@return position of the first key not smaller than the searched key or size if there is none
+template<typename T_LESS>
+SizeType lowerBound(SizeType size, T_LESS less) {
+	SizeType k = 1;
+	while (k <= size) {
+		k = 2*k + SizeType(less(k-1));
+	}
+	//drop all right turns and the final left turn
+	k >>= std::countr_one(k) + 1;
+	return k ? k-1 : size;
+}
+
+///@return pos2rank[i] is the sorted rank of the key at position i in Eytzinger order
+template<typename T_RANDOM_ACCESS_ITERATOR, typename T_KEY_ACCESS>
+std::vector<SizeType> pos2rank(T_RANDOM_ACCESS_ITERATOR begin, T_RANDOM_ACCESS_ITERATOR end, T_KEY_ACCESS keyAccess) {
+	SizeType size = SizeType(end-begin);
+	for(SizeType i(1); i < size; ++i) {
+		if (!(keyAccess(*(begin+(i-1))) < keyAccess(*(begin+i)))) {
+			throw sserialize::CreationException("Static::EytzingerMap: keys need to be sorted and unique");
+		}
+	}
+	std::vector<SizeType> r2p( rank2pos(size) );
+	std::vector<SizeType> result(size);
+	for(SizeType i(0); i < size; ++i) {
+		result[r2p[i]] = i;
+	}
+	return result;
+}
+
+}}//end namespace detail::Eytzinger
+
+template<typename TKey>
+class EytzingerSet {
+public:
+	typedef TKey key_type;
+	typedef TKey value_type;
+	typedef sserialize::SizeType size_type;
+	static constexpr size_type npos = std::numeric_limits<size_type>::max();
+private:
+	sserialize::Static::Array<TKey> m_keys;
+public:
+	EytzingerSet() {}
+	EytzingerSet(const UByteArrayAdapter & data);
+	EytzingerSet(UByteArrayAdapter & data, UByteArrayAdapter::ConsumeTag);
+	EytzingerSet(UByteArrayAdapter const & data, UByteArrayAdapter::NoConsumeTag);
+	~EytzingerSet() {}
+	inline sserialize::UByteArrayAdapter::OffsetType getSizeInBytes() const { return 1+m_keys.getSizeInBytes(); }
+	inline size_type size() const { return m_keys.size(); }
+	inline size_type count(const key_type & key) const { return contains(key); }
+	inline bool contains(const key_type & key) const { return findPosition(key) != npos; }
+	///@return position in Eytzinger order or npos
+	size_type findPosition(const key_type & key) const;
+	///@return position in Eytzinger order of the first key not smaller than key or size()
+	size_type lowerBound(const key_type & key) const;
+	inline key_type keyAt(size_type pos) const { return m_keys.at(pos); }
+	inline const sserialize::Static::Array<TKey> & keys() const { return m_keys; }
+public:
+	///@param begin, end sorted and unique keys with random access
+	template<typename T_RANDOM_ACCESS_ITERATOR>
+	static UByteArrayAdapter & create(T_RANDOM_ACCESS_ITERATOR begin, T_RANDOM_ACCESS_ITERATOR end, UByteArrayAdapter & dest);
+};
+
+template<typename TKey, typename TValue>
+class EytzingerMap {
+public:
+	typedef EytzingerMap<TKey, TValue> type;
+	typedef TKey key_type;
+	typedef TValue mapped_type;
+	typedef sserialize::SizeType size_type;
+	static constexpr size_type npos = std::numeric_limits<size_type>::max();
+private:
+	sserialize::Static::Array<TKey> m_keys;
+	sserialize::Static::Array<TValue> m_values;
+public:
+	EytzingerMap() {}
+	EytzingerMap(const UByteArrayAdapter & data);
+	EytzingerMap(UByteArrayAdapter & data, UByteArrayAdapter::ConsumeTag);
+	EytzingerMap(UByteArrayAdapter const & data, UByteArrayAdapter::NoConsumeTag);
+	~EytzingerMap() {}
+	inline sserialize::UByteArrayAdapter::OffsetType getSizeInBytes() const { return 1+m_keys.getSizeInBytes()+m_values.getSizeInBytes(); }
+	inline size_type size() const { return m_keys.size(); }
+	inline size_type count(const key_type & key) const { return contains(key); }
+	inline bool contains(const key_type & key) const { return findPosition(key) != npos; }
+	///@throws sserialize::OutOfBoundsException if key is not in the map
+	mapped_type at(const key_type & key) const;
+	///@return position in Eytzinger order or npos
+	size_type findPosition(const key_type & key) const;
+	///@return position in Eytzinger order of the first key not smaller than key or size()
+	size_type lowerBound(const key_type & key) const;
+	inline key_type keyAt(size_type pos) const { return m_keys.at(pos); }
+	inline mapped_type valueAt(size_type pos) const { return m_values.at(pos); }
+	inline const sserialize::Static::Array<TKey> & keys() const { return m_keys; }
+	inline const sserialize::Static::Array<TValue> & values() const { return m_values; }
+public:
+	///@param begin, end std::pair<TKey, TValue> sorted by unique keys with random access, e.g. std::vector
+	template<typename T_RANDOM_ACCESS_ITERATOR>
+	static UByteArrayAdapter & create(T_RANDOM_ACCESS_ITERATOR begin, T_RANDOM_ACCESS_ITERATOR end, UByteArrayAdapter & dest);
+	static UByteArrayAdapter & create(const std::map<TKey, TValue> & src, UByteArrayAdapter & dest);
+};
+
+//BEGIN EytzingerSet
+
+template<typename TKey>
+EytzingerSet<TKey>::EytzingerSet(const UByteArrayAdapter & data) :
+m_keys(data+1)
+{
+	SSERIALIZE_VERSION_MISSMATCH_CHECK(SSERIALIZE_STATIC_EYTZINGER_MAP_VERSION, data.at(0), "Static::EytzingerSet");
+}
+
+template<typename TKey>
+EytzingerSet<TKey>::EytzingerSet(UByteArrayAdapter & data, UByteArrayAdapter::ConsumeTag) :
+EytzingerSet(data)
+{
+	data += getSizeInBytes();
+}
+
+template<typename TKey>
+EytzingerSet<TKey>::EytzingerSet(UByteArrayAdapter const & data, UByteArrayAdapter::NoConsumeTag) :
+EytzingerSet(data)
+{}
+
+template<typename TKey>
+typename EytzingerSet<TKey>::size_type
+EytzingerSet<TKey>::lowerBound(const key_type & key) const {
+	return detail::Eytzinger::lowerBound(m_keys.size(), [this, &key](size_type pos) {
+		return m_keys[pos] < key;
+	});
+}
+
+template<typename TKey>
+typename EytzingerSet<TKey>::size_type
+EytzingerSet<TKey>::findPosition(const key_type & key) const {
+	size_type pos = lowerBound(key);
+	return (pos < size() && m_keys[pos] == key ? pos : npos);
+}
+
+template<typename TKey>
+template<typename T_RANDOM_ACCESS_ITERATOR>
+UByteArrayAdapter &
+EytzingerSet<TKey>::create(T_RANDOM_ACCESS_ITERATOR begin, T_RANDOM_ACCESS_ITERATOR end, UByteArrayAdapter & dest) {
+	auto keyAccess = [](const TKey & v) -> const TKey & { return v; };
+	std::vector<SizeType> p2r( detail::Eytzinger::pos2rank(begin, end, keyAccess) );
+	dest.putUint8(SSERIALIZE_STATIC_EYTZINGER_MAP_VERSION);
+	sserialize::Static::ArrayCreator<TKey> ac(dest);
+	ac.reserveOffsets(p2r.size());
+	for(SizeType rank : p2r) {
+		ac.put(*(begin+rank));
+	}
+	ac.flush();
+	return dest;
+}
+
+//END EytzingerSet
+//BEGIN EytzingerMap
+
+template<typename TKey, typename TValue>
+EytzingerMap<TKey, TValue>::EytzingerMap(const UByteArrayAdapter & data) :
+m_keys(data+1),
+m_values(data+(1+m_keys.getSizeInBytes()))
+{
+	SSERIALIZE_VERSION_MISSMATCH_CHECK(SSERIALIZE_STATIC_EYTZINGER_MAP_VERSION, data.at(0), "Static::EytzingerMap");
+	if (m_keys.size() != m_values.size()) {
+		throw sserialize::CorruptDataException("Static::EytzingerMap: number of keys and values differ");
+	}
+}
+
+template<typename TKey, typename TValue>
+EytzingerMap<TKey, TValue>::EytzingerMap(UByteArrayAdapter & data, UByteArrayAdapter::ConsumeTag) :
+EytzingerMap(data)
+{
+	data += getSizeInBytes();
+}
+
+template<typename TKey, typename TValue>
+EytzingerMap<TKey, TValue>::EytzingerMap(UByteArrayAdapter const & data, UByteArrayAdapter::NoConsumeTag) :
+EytzingerMap(data)
+{}
+
+template<typename TKey, typename TValue>
+typename EytzingerMap<TKey, TValue>::size_type
+EytzingerMap<TKey, TValue>::lowerBound(const key_type & key) const {
+	return detail::Eytzinger::lowerBound(m_keys.size(), [this, &key](size_type pos) {
+		return m_keys[pos] < key;
+	});
+}
+
+template<typename TKey, typename TValue>
+typename EytzingerMap<TKey, TValue>::size_type
+EytzingerMap<TKey, TValue>::findPosition(const key_type & key) const {
+	size_type pos = lowerBound(key);
+	return (pos < size() && m_keys[pos] == key ? pos : npos);
+}
+
+template<typename TKey, typename TValue>
+typename EytzingerMap<TKey, TValue>::mapped_type
+EytzingerMap<TKey, TValue>::at(const key_type & key) const {
+	size_type pos = findPosition(key);
+	if (pos == npos) {
+		throw sserialize::OutOfBoundsException("EytzingerMap does not contain the requested key");
+	}
+	return m_values[pos];
+}
+
+template<typename TKey, typename TValue>
+template<typename T_RANDOM_ACCESS_ITERATOR>
+UByteArrayAdapter &
+EytzingerMap<TKey, TValue>::create(T_RANDOM_ACCESS_ITERATOR begin, T_RANDOM_ACCESS_ITERATOR end, UByteArrayAdapter & dest) {
+	using value_type = typename std::iterator_traits<T_RANDOM_ACCESS_ITERATOR>::value_type;
+	auto keyAccess = [](const value_type & v) -> const TKey & { return v.first; };
+	std::vector<SizeType> p2r( detail::Eytzinger::pos2rank(begin, end, keyAccess) );
+	dest.putUint8(SSERIALIZE_STATIC_EYTZINGER_MAP_VERSION);
+	{
+		sserialize::Static::ArrayCreator<TKey> ac(dest);
+		ac.reserveOffsets(p2r.size());
+		for(SizeType rank : p2r) {
+			ac.put((begin+rank)->first);
+		}
+		ac.flush();
+	}
+	{
+		sserialize::Static::ArrayCreator<TValue> ac(dest);
+		ac.reserveOffsets(p2r.size());
+		for(SizeType rank : p2r) {
+			ac.put((begin+rank)->second);
+		}
+		ac.flush();
+	}
+	return dest;
+}
+
+template<typename TKey, typename TValue>
+UByteArrayAdapter &
+EytzingerMap<TKey, TValue>::create(const std::map<TKey, TValue> & src, UByteArrayAdapter & dest) {
+	std::vector< std::pair<TKey, TValue> > tmp(src.begin(), src.end());
+	return create(tmp.begin(), tmp.end(), dest);
+}
+
+//END EytzingerMap
+
+template<typename TKey>
+sserialize::UByteArrayAdapter& operator>>(sserialize::UByteArrayAdapter & source, sserialize::Static::EytzingerSet<TKey> & destination) {
+	sserialize::UByteArrayAdapter d(source);
+	d.shrinkToGetPtr();
+	destination = sserialize::Static::EytzingerSet<TKey>(d);
+	source.incGetPtr(destination.getSizeInBytes());
+	return source;
+}
+
+template<typename TKey, typename TValue>
+sserialize::UByteArrayAdapter& operator>>(sserialize::UByteArrayAdapter & source, sserialize::Static::EytzingerMap<TKey, TValue> & destination) {
+	sserialize::UByteArrayAdapter d(source);
+	d.shrinkToGetPtr();
+	destination = sserialize::Static::EytzingerMap<TKey, TValue>(d);
+	source.incGetPtr(destination.getSizeInBytes());
+	return source;
+}
+
+}}//end namespace sserialize::Static
+
+#endif
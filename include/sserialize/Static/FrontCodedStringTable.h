@@ -0,0 +1,134 @@
+#ifndef SSERIALIZE_STATIC_FRONT_CODED_STRING_TABLE_H
+#define SSERIALIZE_STATIC_FRONT_CODED_STRING_TABLE_H
+#include <sserialize/Static/Array.h>
+#include <sserialize/storage/pack_unpack_functions.h>
+#include <sserialize/utility/exceptions.h>
+#include <string>
+#define SSERIALIZE_STATIC_FRONT_CODED_STRING_TABLE_TAG 0xFC
+#define SSERIALIZE_STATIC_FRONT_CODED_STRING_TABLE_VERSION 1
+
+namespace sserialize {
+namespace Static {
+
+/** A table of sorted strings with front coding.
+  * The strings are split into blocks of blockSize strings.
+  * The first string of every block is stored verbatim,
+  * every other string stores the length of the common prefix with its predecessor and the remaining suffix.
+  * Random access decodes at most blockSize strings, find() and range() do a binary search on the first strings of the blocks.
+  *
+  * The first byte is a tag that is not a valid Static::Array version, see isFrontCoded()
+  *
+  * struct FrontCodedStringTable {
+  *   uint<8> tag{0xFC};
+  *   uint<8> version{1};
+  *   v<uint32> blockSize;
+  *   v<uint64> size;
+  *   Static::Array<Block> blocks;
+  * };
+  *
+  * struct Block {
+  *   std::string first;
+  *   (v<uint32> prefixLength, std::string suffix)[blockSize-1];
+  * };
+  *
+  * The strings have to be sorted with respect to sserialize::unicodeIsSmaller
+  */
+class FrontCodedStringTable final {
+public:
+	typedef sserialize::SizeType SizeType;
+	static constexpr SizeType npos = std::numeric_limits<SizeType>::max();
+	static constexpr uint32_t DefaultBlockSize = 16;
+public:
+	FrontCodedStringTable();
+	FrontCodedStringTable(const UByteArrayAdapter & data);
+	FrontCodedStringTable(UByteArrayAdapter & data, UByteArrayAdapter::ConsumeTag);
+	FrontCodedStringTable(UByteArrayAdapter const & data, UByteArrayAdapter::NoConsumeTag);
+	~FrontCodedStringTable();
+	inline SizeType size() const { return m_size; }
+	inline uint32_t blockSize() const { return m_blockSize; }
+	UByteArrayAdapter::OffsetType getSizeInBytes() const;
+	std::string at(SizeType pos) const;
+	///Decodes the string at @param pos into @param dest, the memory of @param dest is reused
+	void at(SizeType pos, std::string & dest) const;
+	///@return position of value or npos
+	SizeType find(const std::string & value) const;
+	///@return [first, last) of all strings with the given prefix
+	std::pair<SizeType, SizeType> range(const std::string & prefix) const;
+	std::ostream & printStats(std::ostream & out) const;
+	///Calls f(pos, str) for all strings in ascending order, decoding every block only once
+	template<typename T_FUNC>
+	void visit(T_FUNC f) const;
+public:
+	static bool isFrontCoded(const UByteArrayAdapter & data);
+	///@param begin, end strings sorted with respect to sserialize::unicodeIsSmaller
+	template<typename T_ITERATOR>
+	static UByteArrayAdapter & create(T_ITERATOR begin, T_ITERATOR end, UByteArrayAdapter & dest, uint32_t blockSize = DefaultBlockSize);
+private:
+	std::string head(SizeType block) const;
+	///@param pred true for a prefix of the strings
+	///@return position of the first string with pred(str) == false or size()
+	template<typename T_PREDICATE>
+	SizeType partitionPoint(T_PREDICATE pred) const;
+private:
+	uint32_t m_blockSize;
+	SizeType m_size;
+	Static::Array<UByteArrayAdapter> m_blocks;
+};
+
+template<typename T_FUNC>
+void FrontCodedStringTable::visit(T_FUNC f) const {
+	for(SizeType block(0), blockCount(m_blocks.size()); block < blockCount; ++block) {
+		UByteArrayAdapter d( m_blocks.at(block) );
+		d.resetGetPtr();
+		std::string str( d.getString() );
+		SizeType pos = block*m_blockSize;
+		f(pos, const_cast<const std::string &>(str));
+		for(SizeType end(std::min<SizeType>(pos+m_blockSize, size())), i(pos+1); i < end; ++i) {
+			str.resize(d.getVlPackedUint32());
+			str += d.getString();
+			f(i, const_cast<const std::string &>(str));
+		}
+	}
+}
+
+template<typename T_ITERATOR>
+UByteArrayAdapter &
+FrontCodedStringTable::create(T_ITERATOR begin, T_ITERATOR end, UByteArrayAdapter & dest, uint32_t blockSize) {
+	if (!blockSize) {
+		throw sserialize::ConfigurationException("FrontCodedStringTable::create", "blockSize has to be larger than 0");
+	}
+	dest.putUint8(SSERIALIZE_STATIC_FRONT_CODED_STRING_TABLE_TAG);
+	dest.putUint8(SSERIALIZE_STATIC_FRONT_CODED_STRING_TABLE_VERSION);
+	dest.putVlPackedUint32(blockSize);
+	dest.putVlPackedUint64(std::distance(begin, end));
+	Static::ArrayCreator<UByteArrayAdapter> ac(dest);
+	std::string prev;
+	bool blockOpen = false;
+	for(SizeType i(0); begin != end; ++begin, ++i) {
+		const std::string & str = *begin;
+		if (i % blockSize == 0) {
+			if (blockOpen) {
+				ac.endRawPut();
+			}
+			ac.beginRawPut();
+			blockOpen = true;
+			ac.rawPut().putString(str);
+		}
+		else {
+			std::string::size_type prefixLength = 0;
+			for(std::string::size_type s(std::min(prev.size(), str.size())); prefixLength < s && prev[prefixLength] == str[prefixLength]; ++prefixLength) {}
+			ac.rawPut().putVlPackedUint32(narrow_check<uint32_t>(prefixLength));
+			ac.rawPut().putString(str.substr(prefixLength));
+		}
+		prev = str;
+	}
+	if (blockOpen) {
+		ac.endRawPut();
+	}
+	ac.flush();
+	return dest;
+}
+
+}}//end namespace sserialize::Static
+
+#endif
@@ -3,6 +3,8 @@
 #include <sserialize/storage/UByteArrayAdapter.h>
 #include <sserialize/Static/Array.h>
 #include <sserialize/storage/SerializationInfo.h>
+#include <sserialize/iterator/MultiBitIterator.h>
+#include <vector>
 
 /** This is a tablebased huffman decoder.
   * Essentialy its a tree with branching factor B and different child nodes
@@ -20,6 +22,9 @@
   *--------------------------------------------------------------
   *      uint8    | vl32       |(uint32:uint32)
   *
+  * On load the tree is lifted into a flat table indexed by the next TableBits bits.
+  * An entry holds all (up to MaxTableSymbols) symbols whose codes fit completely into these bits.
+  * Only codes longer than TableBits need to walk the tree.
   *
   */
 
@@ -28,6 +33,9 @@ namespace sserialize {
 namespace Static {
 
 class HuffmanDecoder: public RefCountObject {
+public:
+	static constexpr uint32_t TableBits = 11;
+	static constexpr uint32_t MaxTableSymbols = 3;
 public:
 	class HuffmanCodePointInfo {
 		uint32_t m_value;
@@ -69,9 +77,18 @@ private:
 		bool valid() const { return m_data.size(); }
 	};
 	
+	struct TableEntry {
+		uint32_t values[MaxTableSymbols];
+		uint8_t lengths[MaxTableSymbols];
+		///number of symbols, 0 if the first code is longer than TableBits
+		uint8_t count;
+	};
+	
 	Static::Array<StaticNode> m_nodes;
 	StaticNode m_root;
+	std::vector<TableEntry> m_table;
 private:
+	void buildTable();
 
 	///selects the @length upper bits
 	template<typename T_UINT_TYPE>
@@ -112,6 +129,16 @@ private:
 		}
 		return -1;
 	}
+	
+	template<typename T_UINT_TYPE>
+	inline int decodeTableImp(T_UINT_TYPE src, uint32_t & decodedValue) const {
+		const TableEntry & e = m_table[selectBits(src, TableBits)];
+		if (e.count) {
+			decodedValue = e.values[0];
+			return e.lengths[0];
+		}
+		return decodeImp<T_UINT_TYPE>(src, decodedValue);
+	}
 
 public:
 	HuffmanDecoder();
@@ -122,18 +149,24 @@ public:
 	
 	///@return on success  the bit length, on error -1
 	inline int decode(uint16_t src, uint32_t & decodedValue) const {
-		return decodeImp<uint16_t>(src, decodedValue);
+		return decodeTableImp<uint16_t>(src, decodedValue);
 	};
 	
 	///@return on success  the bit length, on error -1
 	inline int decode(uint32_t src, uint32_t & decodedValue) const {
-		return decodeImp<uint32_t>(src, decodedValue);
+		return decodeTableImp<uint32_t>(src, decodedValue);
 	};
 	
 	///@return on success  the bit length, on error -1
 	inline int decode(uint64_t src, uint32_t & decodedValue) const {
-		return decodeImp<uint64_t>(src, decodedValue);
+		return decodeTableImp<uint64_t>(src, decodedValue);
 	}
+	
+	/** Decodes up to count symbols into dest and advances it past them.
+	  * Several symbols are decoded per table lookup if their codes are short.
+	  * @return number of decoded symbols, less than count if the data of it ends
+	  */
+	uint32_t decode(MultiBitIterator & it, uint32_t * dest, uint32_t count) const;
 };
 }} //end namespace
 
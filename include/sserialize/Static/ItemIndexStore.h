@@ -2,14 +2,16 @@
 #define SSERIALIZE_STATIC_ITEM_INDEX_STORE
 #include <sserialize/containers/SortedOffsetIndex.h>
 #include <sserialize/containers/ItemIndex.h>
+#include <sserialize/containers/ItemIndexSummary.h>
 #include "HuffmanDecoder.h"
 #include <unordered_set>
-#define SSERIALIZE_STATIC_ITEM_INDEX_STORE_VERSION 6
+#include <mutex>
+#define SSERIALIZE_STATIC_ITEM_INDEX_STORE_VERSION 8
 
-/*Version 6
+/*Version 8
  *
  * struct ItemIndexStore {
- *   uint<8> version{6};
+ *   uint<8> version{8};
  *   uint<16> indexTypes;
  *   uint<8> indexCompressionType;
  *   OffsetType dataLength;
@@ -18,15 +20,34 @@
  *   Array< uint<32>, offsets.size> indexSizes;
  *   HuffmanDecoder huffmanDecodeTable;
  *   BoundedCompactUintArray decompressionSizeTable;
+ *   LZOGroupInfo lzoGroupInfo;
  *   CompactUintArray<log2(indexTypes)> indexTypeInfo;
+ *   Summaries summaries;
  * };
  * 
+ * struct Summaries { //either both arrays are empty or both have offsets.size entries
+ *   Array< uint<64> > ranges; //first id << 32 | last id, 0xFFFFFFFF << 32 for empty indexes
+ *   Array< uint<64> > signatures; //see ItemIndexSummary
+ * };
+ * 
+ * struct LZOGroupInfo {
+ *   OffsetType uncompressedDataLength;
+ *   BoundedCompactUintArray groupBegin; //first index id of each group followed by the number of indexes
+ *   SortedOffsetIndex groupOffsets; //offsets of the compressed groups in data
+ * };
  * 
- * There are 3 different compression modes which can be partialy mixed wit the following decompression order
- * [LZO][VARUINT32|HUFFMAN]
+ * There are 4 different compression modes which can be partialy mixed wit the following decompression order
+ * [LZO|LZO_GROUPED][VARUINT32|HUFFMAN]
+ * 
+ * LZO compresses every index on its own.
+ * LZO_GROUPED compresses runs of consecutive indexes together so that small indexes share their context.
+ * In this case the offsets point into the uncompressed data of all indexes.
+ * The decompressionSizeTable is only present with LZO, the lzoGroupInfo only with LZO_GROUPED (needs version 7).
  * 
  * If indexTypes has more than one index active (popCount(indexTypes) > 1)
  * then the indexTypeInfo array is present and indicates for each entry the type
+ * 
+ * The summaries are only present with version 8 and are optional even then.
  *
  *
  */
@@ -55,6 +76,9 @@ public:
 	virtual const UByteArrayAdapter & getData() const = 0;
 	virtual RCPtrWrapper<HuffmanDecoder> getHuffmanTree() const = 0;
 	virtual UByteArrayAdapter getHuffmanTreeData() const = 0;
+	virtual bool hasSummaries() const = 0;
+	///@return the empty summary if !hasSummaries()
+	virtual ItemIndexSummary summary(uint32_t pos) const = 0;
 };
 
 }//end namespace interfaces
@@ -98,7 +122,7 @@ sserialize::UByteArrayAdapter::OffsetType ItemIndexStoreId::getSizeInBytes(ItemI
 
 class ItemIndexStore {
 public:
-	typedef enum {IC_NONE=0, IC_VARUINT32=1, IC_HUFFMAN=2, IC_LZO=4} IndexCompressionType;
+	typedef enum {IC_NONE=0, IC_VARUINT32=1, IC_HUFFMAN=2, IC_LZO=4, IC_LZO_GROUPED=8} IndexCompressionType;
 	typedef uint32_t SizeType;
 	typedef SizeType IdType;
 	static constexpr IdType npos = std::numeric_limits<IdType>::max();
@@ -130,6 +154,10 @@ public:
 	inline const UByteArrayAdapter & getData() const { return priv()->getData(); }
 	inline RCPtrWrapper<HuffmanDecoder> getHuffmanTree() const { return priv()->getHuffmanTree(); }
 	inline UByteArrayAdapter getHuffmanTreeData() const { return priv()->getHuffmanTreeData();}
+	inline bool hasSummaries() const { return priv()->hasSummaries(); }
+	inline ItemIndexSummary summary(uint32_t pos) const { return priv()->summary(pos); }
+	///@return true if the store has summaries and the indexes are disjoint for sure
+	inline bool disjoint(uint32_t first, uint32_t second) const { return hasSummaries() && summary(first).disjoint(summary(second)); }
 };
 
 namespace detail {
@@ -149,6 +177,29 @@ private:
 	private:
 		BoundedCompactUintArray m_data;
 	};
+	class LZOGroupDecompressor: public RefCountObject {
+	public:
+		LZOGroupDecompressor();
+		LZOGroupDecompressor(const sserialize::UByteArrayAdapter & data);
+		virtual ~LZOGroupDecompressor();
+		OffsetType getSizeInBytes() const;
+		inline OffsetType uncompressedSize() const { return m_uncompressedSize; }
+		inline uint32_t groupCount() const { return m_groupOffsets.size(); }
+		///@return the group containing the index with the given id
+		uint32_t group(uint32_t id) const;
+		inline uint32_t groupBegin(uint32_t group) const { return narrow_check<uint32_t>(m_groupBegin.at(group)); }
+		inline uint32_t groupEnd(uint32_t group) const { return narrow_check<uint32_t>(m_groupBegin.at(group+1)); }
+		///The last decompressed group is cached since consecutive index ids are usually accessed together
+		///@param data the data section of the store
+		UByteArrayAdapter decompress(uint32_t group, const sserialize::UByteArrayAdapter & data, OffsetType uncompressedGroupSize) const;
+	private:
+		OffsetType m_uncompressedSize;
+		BoundedCompactUintArray m_groupBegin;
+		SortedOffsetIndex m_groupOffsets;
+		mutable std::mutex m_cacheLock;
+		mutable uint32_t m_cachedGroup;
+		mutable UByteArrayAdapter m_cachedGroupData;
+	};
 private:
 	uint8_t m_version;
 	int m_type;
@@ -158,7 +209,14 @@ private:
 	Static::Array<uint32_t> m_idxSizes;
 	RCPtrWrapper<HuffmanDecoder> m_hd;
 	RCPtrWrapper<LZODecompressor> m_lzod;
+	RCPtrWrapper<LZOGroupDecompressor> m_lzogd;
 	CompactUintArray m_idxTypeInfo;
+	Static::Array<uint64_t> m_summaryRanges;
+	Static::Array<uint64_t> m_summarySignatures;
+private:
+	///offset of the index in the (uncompressed) data
+	UByteArrayAdapter::OffsetType dataBegin(uint32_t pos) const;
+	UByteArrayAdapter::OffsetType dataEnd(uint32_t pos) const;
 public:
 	ItemIndexStore();
 	ItemIndexStore(sserialize::UByteArrayAdapter data);
@@ -170,7 +228,9 @@ public:
 	virtual int indexTypes() const override;
 	virtual ItemIndex::Types indexType(uint32_t pos) const override;
 	virtual uint32_t compressionType() const  override { return m_compression; }
+	///with IC_LZO_GROUPED this is the size of the uncompressed data
 	virtual UByteArrayAdapter::OffsetType dataSize(uint32_t pos) const override;
+	///with IC_LZO_GROUPED this returns the data after lzo decompression
 	virtual UByteArrayAdapter rawDataAt(uint32_t pos) const override;
 	virtual ItemIndex at(uint32_t pos) const override;
 	virtual inline uint32_t idxSize(uint32_t pos) const override { return m_idxSizes.at(pos); }
@@ -180,6 +240,8 @@ public:
 	virtual inline const UByteArrayAdapter & getData() const override { return m_data; }
 	virtual inline RCPtrWrapper<HuffmanDecoder> getHuffmanTree() const override { return m_hd; }
 	virtual UByteArrayAdapter getHuffmanTreeData() const override;
+	virtual inline bool hasSummaries() const override { return m_summaryRanges.size(); }
+	virtual ItemIndexSummary summary(uint32_t pos) const override;
 };
 
 }//end namespace detail
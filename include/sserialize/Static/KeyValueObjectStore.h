@@ -18,6 +18,8 @@ class KeyValueObjectStorePrivate;
   *----------------------------------------------------------
   * 1 Byte|SortedStringTable|SortedStringTable |*
   *
+  * The string tables are either plain or front coded, see SortedStringTable
+  *
   * Layout of a single Item
   *----------------------------------------------------
   *count |bpk|bpv|KeyBegin|ValueBegin|KeyValuePairs
@@ -0,0 +1,72 @@
+#ifndef SSERIALIZE_STATIC_KEY_VALUE_OBJECT_STORE_INVERTED_INDEX_H
+#define SSERIALIZE_STATIC_KEY_VALUE_OBJECT_STORE_INVERTED_INDEX_H
+#include <sserialize/Static/KeyValueObjectStore.h>
+#include <sserialize/Static/ItemIndexStore.h>
+#include <sserialize/containers/CompactUintArray.h>
+#define SSERIALIZE_STATIC_KEY_VALUE_OBJECTSTORE_INVERTED_INDEX_VERSION 1
+
+namespace sserialize {
+
+class ItemIndexFactory;
+
+namespace Static {
+
+/** Maps key ids and (key id, value id) pairs of a KeyValueObjectStore to the ItemIndex of all items having them.
+  * The item indexes are stored in an external ItemIndexStore, this class only holds their ids.
+  *
+  * File layout
+  *--------------------------------------------------------------------------------------------------------------
+  *VERSION|KeyOffsets             |KeyIndexIds            |ValueIds               |ValueIndexIds
+  *--------------------------------------------------------------------------------------------------------------
+  * 1 Byte|BoundedCompactUintArray|BoundedCompactUintArray|BoundedCompactUintArray|BoundedCompactUintArray
+  *
+  * KeyOffsets has keyCount()+1 entries, the pairs of key k are in [KeyOffsets[k], KeyOffsets[k+1]).
+  * KeyIndexIds holds the index id of the items having key k.
+  * The value ids of a key are sorted in ascending order, ValueIndexIds[i] is the index id of the pair (k, ValueIds[i]).
+  *
+  */
+
+class KeyValueObjectStoreInvertedIndex {
+public:
+	static constexpr uint32_t npos = std::numeric_limits<uint32_t>::max();
+private:
+	BoundedCompactUintArray m_keyOffsets;
+	BoundedCompactUintArray m_keyIndexIds;
+	BoundedCompactUintArray m_valueIds;
+	BoundedCompactUintArray m_valueIndexIds;
+	Static::ItemIndexStore m_idxStore;
+public:
+	KeyValueObjectStoreInvertedIndex();
+	KeyValueObjectStoreInvertedIndex(const sserialize::UByteArrayAdapter & data, const Static::ItemIndexStore & idxStore);
+	KeyValueObjectStoreInvertedIndex(sserialize::UByteArrayAdapter & data, const Static::ItemIndexStore & idxStore, UByteArrayAdapter::ConsumeTag);
+	~KeyValueObjectStoreInvertedIndex();
+	UByteArrayAdapter::OffsetType getSizeInBytes() const;
+	inline const Static::ItemIndexStore & idxStore() const { return m_idxStore; }
+	///number of keys including those without any items
+	uint32_t keyCount() const;
+	///number of distinct (key, value) pairs
+	uint32_t size() const;
+	///number of distinct values of key @param keyId
+	uint32_t valueCount(uint32_t keyId) const;
+	///@return id of the index with all items having key @param keyId, npos if there is no such key
+	uint32_t indexId(uint32_t keyId) const;
+	///@return id of the index with all items having the pair (@param keyId, @param valueId), npos if there is no such pair
+	uint32_t indexId(uint32_t keyId, uint32_t valueId) const;
+	///@return all items having key @param keyId
+	ItemIndex items(uint32_t keyId) const;
+	///@return all items having the pair (@param keyId, @param valueId)
+	ItemIndex items(uint32_t keyId, uint32_t valueId) const;
+	///Resolves the strings with @param store and returns all items having the pair (@param key, @param value)
+	ItemIndex items(const KeyValueObjectStore & store, const std::string & key, const std::string & value) const;
+
+	/** Creates the inverted index of @param store in a parallel pass over all items.
+	  * The item indexes are added to @param idxFactory.
+	  * @param threadCount number of threads to use, 0 for one per hardware thread
+	  * @return number of bytes written to dest
+	  */
+	static UByteArrayAdapter::OffsetType create(const KeyValueObjectStore & store, sserialize::ItemIndexFactory & idxFactory, UByteArrayAdapter & dest, uint32_t threadCount = 0);
+};
+
+}}//end namespace
+
+#endif
@@ -49,6 +49,8 @@ public:
 	bool contains(const key_type & key) const;
 	mapped_type at(const key_type & key) const;
 	value_type atPosition(const size_type pos) const;
+	///Only deserializes the key at pos
+	key_type keyAt(const size_type pos) const;
 	value_type find(const key_type & key) const;
 	size_type
 	findPosition(const key_type & key) const;
@@ -57,30 +59,37 @@ public:
 	static UByteArrayAdapter & create(T_ITERATOR begin, T_ITERATOR end, UByteArrayAdapter & dest);
 };
 
+template<typename TKey, typename TValue>
+typename Map<TKey, TValue>::key_type
+Map<TKey, TValue>::keyAt(const size_type pos) const {
+	if constexpr (UByteArrayAdapter::SerializationSupport<TKey>::value) {
+		return m_data.data().template get<TKey>(m_data.dataOffset(pos));
+	}
+	else {
+		UByteArrayAdapter tmp(m_data.data(), m_data.dataOffset(pos));
+		TKey key;
+		tmp >> key;
+		return key;
+	}
+}
+
 template<typename TKey, typename TValue>
 typename Map<TKey, TValue>::size_type
 Map<TKey, TValue>::findPosition(const TKey & key) const {
-	if (! size())
-		return npos;
-	int64_t len = m_data.size()-1;
-	int64_t left = 0;
-	int64_t right = len;
-	int64_t mid = (right-left)/2+left;
-	while( left < right ) {
-		Pair<TKey, TValue> pair(atPosition(mid));
-		int8_t cmp = pair.compareWithFirst(key);
-		if (cmp == 0)
-			return mid;
-		if (cmp < 0) { // key should be to the right
-			left = mid+1;
+	//lower bound on the keys only, the values are never deserialized
+	size_type left = 0;
+	size_type count = m_data.size();
+	while (count > 0) {
+		size_type step = count/2;
+		if (keyAt(left+step) < key) {
+			left += step+1;
+			count -= step+1;
 		}
-		else { // key should be to the left of mid
-			right = mid-1;
+		else {
+			count = step;
 		}
-		mid = (right-left)/2+left;
 	}
-	Pair<TKey, TValue> pair(atPosition(mid));
-	return (pair.compareWithFirst(key) == 0 ? mid : npos);
+	return (left < m_data.size() && keyAt(left) == key ? left : npos);
 }
 
 template<typename TKey, typename TValue>
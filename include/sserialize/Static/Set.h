@@ -58,25 +58,20 @@ public:
 template<typename TValue>
 int32_t
 Set<TValue>::find(const TValue & value) const {
-	if (! size() )
-		return -1;
-	int32_t len = size()-1;
-	int32_t left = 0;
-	int32_t right = len;
-	int32_t mid = (right-left)/2+left;
-	while( left < right ) {
-		TValue tmpV(at(mid));
-		if (tmpV == value)
-			return mid;
-		if (tmpV < value) { // key should be to the right
-			left = mid+1;
+	//lower bound, every probe deserializes exactly one value
+	uint32_t left = 0;
+	uint32_t count = size();
+	while (count > 0) {
+		uint32_t step = count/2;
+		if (at(left+step) < value) {
+			left += step+1;
+			count -= step+1;
 		}
-		else { // key should be to the left of mid
-			right = mid-1;
+		else {
+			count = step;
 		}
-		mid = (right-left)/2+left;
 	}
-	return (at(mid) == value ? mid : -1);
+	return (left < size() && at(left) == value ? int32_t(left) : -1);
 }
 
 template<typename TValue>
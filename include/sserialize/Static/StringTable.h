@@ -2,6 +2,8 @@
 #define SSERIALIZE_STATIC_STRING_TABLE_H
 #include <unordered_set>
 #include <sserialize/Static/Array.h>
+#include <sserialize/Static/StringTablePrivate.h>
+#include <sserialize/Static/StringTableHashIndex.h>
 #include <sserialize/search/StringCompleter.h>
 
 namespace sserialize {
@@ -10,22 +12,21 @@ namespace Static {
 /** Abstracts access to a string table,
  * strings should be in the order of most usage,
  * so that the smallest ids are most frequently used
+ *
+ * The data is either a Static::Array<std::string> or a FrontCodedStringTable, see FrontCodedStringTable::isFrontCoded().
  */
-class StringTable: public RCWrapper< sserialize::Static::Array<std::string> > {
+class StringTable: public RCWrapper< StringTablePrivate > {
 public:
-	typedef sserialize::Static::Array<std::string>::const_iterator const_iterator;
-	typedef sserialize::Static::Array<std::string>::const_reference const_reference;
-	typedef sserialize::Static::Array<std::string>::SizeType SizeType;
-	static constexpr SizeType npos = sserialize::Static::Array<std::string>::npos;
-protected:
-	inline UByteArrayAdapter & data() { return priv()->data();}
-	inline const UByteArrayAdapter & data() const { return priv()->data(); }
+	typedef sserialize::ReadOnlyAtStlIterator<const StringTable*, std::string> const_iterator;
+	typedef std::string const_reference;
+	typedef StringTablePrivate::SizeType SizeType;
+	static constexpr SizeType npos = StringTablePrivate::npos;
 public:
     StringTable();
     StringTable(const UByteArrayAdapter& data);
     StringTable(UByteArrayAdapter & data, UByteArrayAdapter::ConsumeTag);
     StringTable(UByteArrayAdapter const & data, UByteArrayAdapter::NoConsumeTag);
-    StringTable(Static::Array< std::string > * data);
+    StringTable(StringTablePrivate * priv);
     StringTable(const StringTable & other);
 	virtual ~StringTable();
 	StringTable & operator=(const StringTable & other);
@@ -34,18 +35,21 @@ public:
 	void find(std::unordered_set< uint32_t >& ret, std::string searchStr, sserialize::StringCompleter::QuerryType qtype) const;
 	bool match(uint32_t stringId, const std::string & searchStr, sserialize::StringCompleter::QuerryType qtype) const;
 	std::ostream& printStats(std::ostream & out) const;
+	///@return true if str matches searchStr, searchStr has to be lower case for case insensitive queries
+	static bool match(const std::string & searchStr, const UByteArrayAdapter & str, sserialize::StringCompleter::QuerryType qtype);
 	
+	inline bool frontCoded() const { return priv()->frontCoded(); }
 	inline SizeType size() const { return priv()->size();}
 	inline UByteArrayAdapter::OffsetType getSizeInBytes() const { return priv()->getSizeInBytes();}
 	inline std::string at(SizeType pos) const { return priv()->at(pos); }
-	inline UByteArrayAdapter strDataAt(SizeType pos) const { return priv()->dataAt(pos).getStringData(0);}
-	inline uint32_t strSize(SizeType pos) const { return priv()->dataAt(pos).getStringLength(0); }
-	inline std::string front() const { return priv()->front();}
-	inline std::string back() const { return priv()->back();}
-	inline const_iterator cbegin() const { return priv()->cbegin();}
-	inline const_iterator begin() const { return priv()->cbegin();}
-	inline const_iterator end() const { return priv()->cend();}
-	inline const_iterator cend() const { return priv()->cend();}
+	inline UByteArrayAdapter strDataAt(SizeType pos) const { return priv()->strDataAt(pos);}
+	inline uint32_t strSize(SizeType pos) const { return priv()->strSize(pos); }
+	inline std::string front() const { return at(0);}
+	inline std::string back() const { return at(size()-1);}
+	inline const_iterator cbegin() const { return const_iterator(0, this);}
+	inline const_iterator begin() const { return cbegin();}
+	inline const_iterator end() const { return cend();}
+	inline const_iterator cend() const { return const_iterator(size(), this);}
 
 	///The order of the strings impacts the type	
 	template<typename T_RANDOM_ACCESS_ITERATOR, typename T_VALUE_TYPE = typename T_RANDOM_ACCESS_ITERATOR::value_type>
@@ -76,10 +80,18 @@ public:
 	FrequencyStringTable(const FrequencyStringTable & other);
 	FrequencyStringTable & operator=(const FrequencyStringTable & other);
 	virtual ~FrequencyStringTable();
-	inline SizeType find(const std::string & value) const { return priv()->find(value);}
+	///Use idx in find() instead of a linear scan, idx has to be created from this table
+	void setHashIndex(const StringTableHashIndex & idx);
+	inline const StringTableHashIndex & hashIndex() const { return m_hashIndex; }
+	SizeType find(const std::string & value) const;
 	inline bool count(const std::string & value) const { return find(value) != npos; }
+private:
+	StringTableHashIndex m_hashIndex;
 };
 
+/** A table of strings sorted with respect to sserialize::unicodeIsSmaller
+  * The table is either a plain StringTable or a FrontCodedStringTable
+  */
 class SortedStringTable: public StringTable {
 public:
 	SortedStringTable();
@@ -89,9 +101,15 @@ public:
 	SortedStringTable(const SortedStringTable & other);
 	virtual ~SortedStringTable();
 	SortedStringTable & operator=(SortedStringTable const &) = default;
+	///Use idx in find() instead of a binary search, idx has to be created from this table
+	void setHashIndex(const StringTableHashIndex & idx);
+	inline const StringTableHashIndex & hashIndex() const { return m_hashIndex; }
+	using StringTable::find;
 	SizeType find(const std::string & value) const;
 	std::pair<SizeType, SizeType> range(const std::string & prefix) const;
 	inline bool count(const std::string & value) const { return find(value) != npos; }
+private:
+	StringTableHashIndex m_hashIndex;
 };
 
 }}//end namespace
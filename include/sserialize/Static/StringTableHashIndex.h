@@ -0,0 +1,89 @@
+#ifndef SSERIALIZE_STATIC_STRING_TABLE_HASH_INDEX_H
+#define SSERIALIZE_STATIC_STRING_TABLE_HASH_INDEX_H
+#include <sserialize/Static/Array.h>
+#include <sserialize/containers/CompactUintArray.h>
+#include <sserialize/utility/exceptions.h>
+#include <string>
+#include <vector>
+#define SSERIALIZE_STATIC_STRING_TABLE_HASH_INDEX_VERSION 1
+
+namespace sserialize {
+namespace Static {
+
+/** Minimal perfect hash over the strings of a string table (BBHash).
+  * It resolves a string to its id with a constant number of memory accesses instead of a binary search or a scan.
+  * Every level is a bit array with Gamma bits per remaining string.
+  * A string goes to the first level where its hash position does not collide with any other string.
+  * The rank of that bit is the slot of the string, the slot stores the string id and an 8 bit fingerprint.
+  * Strings that are not in the table are mostly rejected by the fingerprint,
+  * the remaining ones are rejected by comparing with the string in the table.
+  * The index does not store the strings, it has to be used together with the table it was created from.
+  *
+  * struct StringTableHashIndex {
+  *   uint<8> version{1};
+  *   Static::Array<uint32_t> levelSizes; //in 64 bit words
+  *   Static::Array<uint64_t> words; //bits of all levels
+  *   Static::Array<uint32_t> ranks; //number of set bits before every RankSampleWords words
+  *   BoundedCompactUintArray ids; //string id of a slot
+  *   BoundedCompactUintArray fingerprints; //fingerprint of a slot
+  * };
+  */
+class StringTableHashIndex final {
+public:
+	typedef sserialize::SizeType SizeType;
+	static constexpr SizeType npos = std::numeric_limits<SizeType>::max();
+	static constexpr uint32_t Gamma = 2;
+	static constexpr uint32_t RankSampleWords = 8;
+	static constexpr uint32_t MaxLevels = 64;
+public:
+	StringTableHashIndex();
+	StringTableHashIndex(const UByteArrayAdapter & data);
+	StringTableHashIndex(UByteArrayAdapter & data, UByteArrayAdapter::ConsumeTag);
+	~StringTableHashIndex();
+	UByteArrayAdapter::OffsetType getSizeInBytes() const;
+	///number of strings
+	inline SizeType size() const { return m_ids.size(); }
+	///@return the id str would have if it is in the table or npos, the caller has to verify the id
+	SizeType candidate(const std::string & str) const;
+	///@param table the table this index was created from, needs to provide at(id)
+	///@return id of str in table or npos
+	template<typename T_TABLE>
+	SizeType find(const T_TABLE & table, const std::string & str) const {
+		SizeType id = candidate(str);
+		if (id != npos && table.at(id) == str) {
+			return id;
+		}
+		return npos;
+	}
+public:
+	static uint64_t hash(const std::string & str);
+	/** Creates the index for all strings of table at dest.tellPutPtr()
+	  * @param table needs to provide size() and at(id), the strings have to be unique
+	  */
+	template<typename T_TABLE>
+	static UByteArrayAdapter & create(const T_TABLE & table, UByteArrayAdapter & dest) {
+		std::vector<uint64_t> hashes;
+		hashes.reserve(table.size());
+		for(SizeType i(0), s(table.size()); i < s; ++i) {
+			hashes.push_back( hash(table.at(i)) );
+		}
+		return create(hashes, dest);
+	}
+	///@param hashes hash() of the string with the id i at position i
+	static UByteArrayAdapter & create(const std::vector<uint64_t> & hashes, UByteArrayAdapter & dest);
+private:
+	static uint64_t levelHash(uint64_t hash, uint32_t level);
+	static inline uint8_t fingerprint(uint64_t hash) { return static_cast<uint8_t>(hash >> 56); }
+	SizeType rank(SizeType word) const;
+private:
+	std::vector<uint32_t> m_levelSizes;
+	UByteArrayAdapter::OffsetType m_levelSizesDataSize;
+	Static::Array<uint64_t> m_words;
+	Static::Array<uint32_t> m_ranks;
+	BoundedCompactUintArray m_ids;
+	BoundedCompactUintArray m_fingerprints;
+};
+
+}}//end namespace sserialize::Static
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef SSERIALIZE_STATIC_STRING_TABLE_PRIVATE_H
+#define SSERIALIZE_STATIC_STRING_TABLE_PRIVATE_H
+#include <unordered_set>
+#include <sserialize/Static/Array.h>
+#include <sserialize/Static/FrontCodedStringTable.h>
+#include <sserialize/search/StringCompleter.h>
+
+namespace sserialize {
+namespace Static {
+
+/** Storage backend of a StringTable
+  * The default implementations of the virtual functions only use size(), at() and strDataAt().
+  */
+class StringTablePrivate: public RefCountObject {
+public:
+	typedef sserialize::SizeType SizeType;
+	static constexpr SizeType npos = std::numeric_limits<SizeType>::max();
+public:
+	StringTablePrivate();
+	virtual ~StringTablePrivate();
+	virtual SizeType size() const = 0;
+	virtual UByteArrayAdapter::OffsetType getSizeInBytes() const = 0;
+	virtual std::string at(SizeType pos) const = 0;
+	///utf-8 data of the string at pos
+	virtual UByteArrayAdapter strDataAt(SizeType pos) const = 0;
+	virtual uint32_t strSize(SizeType pos) const;
+	///@return true if the string at @param pos matches @param searchStr, see StringTable::match
+	virtual bool match(SizeType pos, const std::string & searchStr, sserialize::StringCompleter::QuerryType qtype) const;
+	virtual bool frontCoded() const { return false; }
+	///@return position of the first string equal to value or npos
+	virtual SizeType find(const std::string & value) const;
+	///Same as find() for tables sorted with respect to sserialize::unicodeIsSmaller
+	virtual SizeType sortedFind(const std::string & value) const;
+	///@return [first, last) of all strings with the given prefix for tables sorted with respect to sserialize::unicodeIsSmaller
+	virtual std::pair<SizeType, SizeType> sortedRange(const std::string & prefix) const;
+	///adds all strings matching searchStr to ret, searchStr has to be lower case for case insensitive queries
+	virtual void find(std::unordered_set<uint32_t> & ret, const std::string & searchStr, sserialize::StringCompleter::QuerryType qtype) const;
+	virtual std::ostream & printStats(std::ostream & out) const;
+};
+
+class StringTablePrivateArray: public StringTablePrivate {
+public:
+	StringTablePrivateArray();
+	StringTablePrivateArray(const UByteArrayAdapter & data);
+	virtual ~StringTablePrivateArray();
+	virtual SizeType size() const override;
+	virtual UByteArrayAdapter::OffsetType getSizeInBytes() const override;
+	virtual std::string at(SizeType pos) const override;
+	virtual UByteArrayAdapter strDataAt(SizeType pos) const override;
+	virtual uint32_t strSize(SizeType pos) const override;
+	virtual SizeType find(const std::string & value) const override;
+	virtual SizeType sortedFind(const std::string & value) const override;
+	virtual void find(std::unordered_set<uint32_t> & ret, const std::string & searchStr, sserialize::StringCompleter::QuerryType qtype) const override;
+private:
+	Static::Array<std::string> m_data;
+};
+
+///strDataAt() decodes the string into a new buffer, strSize() and match() decode into a per-thread buffer
+class StringTablePrivateFrontCoded: public StringTablePrivate {
+public:
+	StringTablePrivateFrontCoded(const UByteArrayAdapter & data);
+	virtual ~StringTablePrivateFrontCoded();
+	virtual SizeType size() const override;
+	virtual UByteArrayAdapter::OffsetType getSizeInBytes() const override;
+	virtual std::string at(SizeType pos) const override;
+	virtual UByteArrayAdapter strDataAt(SizeType pos) const override;
+	virtual uint32_t strSize(SizeType pos) const override;
+	virtual bool match(SizeType pos, const std::string & searchStr, sserialize::StringCompleter::QuerryType qtype) const override;
+	virtual bool frontCoded() const override { return true; }
+	virtual SizeType find(const std::string & value) const override;
+	virtual SizeType sortedFind(const std::string & value) const override;
+	virtual std::pair<SizeType, SizeType> sortedRange(const std::string & prefix) const override;
+	virtual void find(std::unordered_set<uint32_t> & ret, const std::string & searchStr, sserialize::StringCompleter::QuerryType qtype) const override;
+	virtual std::ostream & printStats(std::ostream & out) const override;
+private:
+	FrontCodedStringTable m_fc;
+};
+
+}}//end namespace
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef SSERIALIZE_STATIC_STRING_TABLE_SUFFIX_INDEX_H
+#define SSERIALIZE_STATIC_STRING_TABLE_SUFFIX_INDEX_H
+#include <sserialize/Static/StringTable.h>
+#include <sserialize/containers/CompactUintArray.h>
+#include <unordered_set>
+#define SSERIALIZE_STATIC_STRING_TABLE_SUFFIX_INDEX_VERSION 1
+
+namespace sserialize {
+namespace Static {
+
+/** Suffix array over all strings of a StringTable.
+  * It answers QT_SUBSTRING and QT_SUFFIX queries (and QT_PREFIX, QT_EXACT) with a binary search
+  * instead of a scan over all strings. Suffixes start at every code point of every string.
+  * A case insensitive index sorts the suffixes by their lower case representation
+  * and can only answer case insensitive queries, a case sensitive index only case sensitive ones.
+  * The index does not store the strings, it has to be used together with the table it was created from.
+  *
+  * struct StringTableSuffixIndex {
+  *   uint<8> version{1};
+  *   uint<8> flags; //1 -> case insensitive
+  *   BoundedCompactUintArray stringIds; //string id of the suffix
+  *   BoundedCompactUintArray offsets; //byte offset of the suffix in the string
+  * };
+  */
+class StringTableSuffixIndex final {
+public:
+	typedef sserialize::SizeType SizeType;
+	typedef enum {F_NONE=0x0, F_CASE_INSENSITIVE=0x1} Flags;
+public:
+	StringTableSuffixIndex();
+	StringTableSuffixIndex(const UByteArrayAdapter & data, const StringTable & table);
+	StringTableSuffixIndex(UByteArrayAdapter & data, UByteArrayAdapter::ConsumeTag, const StringTable & table);
+	~StringTableSuffixIndex();
+	UByteArrayAdapter::OffsetType getSizeInBytes() const;
+	///number of suffixes
+	inline SizeType size() const { return m_stringIds.size(); }
+	inline bool caseSensitive() const { return !(m_flags & F_CASE_INSENSITIVE); }
+	inline const StringTable & table() const { return m_table; }
+	///@return true if find() is able to answer queries of type qtype
+	bool supports(sserialize::StringCompleter::QuerryType qtype) const;
+	///Same semantics as StringTable::find()
+	///@throws sserialize::UnsupportedFeatureException if !supports(qtype)
+	std::unordered_set<uint32_t> find(const std::string & searchStr, sserialize::StringCompleter::QuerryType qtype) const;
+	void find(std::unordered_set<uint32_t> & ret, const std::string & searchStr, sserialize::StringCompleter::QuerryType qtype) const;
+	///@return [first, last) range of suffixes that have searchStr as prefix
+	std::pair<SizeType, SizeType> range(const std::string & searchStr) const;
+	inline uint32_t stringId(SizeType pos) const { return narrow_check<uint32_t>(m_stringIds.at(pos)); }
+	inline uint32_t offset(SizeType pos) const { return narrow_check<uint32_t>(m_offsets.at(pos)); }
+public:
+	/** Creates the index for all strings of table at dest.tellPutPtr()
+	  * The suffixes are sorted in parallel with threadCount threads, 0 uses all cores.
+	  * A case insensitive index needs valid utf-8 strings.
+	  */
+	static UByteArrayAdapter & create(const StringTable & table, UByteArrayAdapter & dest, bool caseSensitive, uint32_t threadCount = 0);
+private:
+	///@return -1 if the suffix is smaller than searchStr, 0 if searchStr is a prefix of the suffix, 1 if it is larger
+	int compare(SizeType pos, const std::string & searchStr) const;
+	///@return true if the suffix equals searchStr
+	bool equal(SizeType pos, const std::string & searchStr) const;
+private:
+	StringTable m_table;
+	uint8_t m_flags;
+	BoundedCompactUintArray m_stringIds;
+	BoundedCompactUintArray m_offsets;
+};
+
+}}//end namespace sserialize::Static
+
+#endif
@@ -0,0 +1,104 @@
+#ifndef SSERIALIZE_STATIC_TIERED_ITEM_INDEX_STORE_H
+#define SSERIALIZE_STATIC_TIERED_ITEM_INDEX_STORE_H
+#include <sserialize/Static/ItemIndexStore.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <istream>
+#include <ostream>
+
+namespace sserialize {
+namespace Static {
+namespace detail {
+
+/** An ItemIndexStore that keeps hot indexes decoded in memory.
+  * Indexes are promoted to the hot tier if they are small (idxSize <= Config::maxSmallIdxSize),
+  * if they were accessed at least Config::promotionThreshold times
+  * or if they are listed in a profile written by writeProfile().
+  * The hot tier stores the indexes in their serialized form without any store compression in a chunked arena.
+  * All other indexes are retrieved from the backing store.
+  *
+  * Access to hot indexes is lock-free. Promotion is serialized by a mutex.
+  * The arena is never shrunk, the number of hot indexes and the arena size are bounded by the Config.
+  */
+class TieredItemIndexStore: public interfaces::ItemIndexStore {
+public:
+	struct Config {
+		///number of accesses after which an index is promoted, 0 disables runtime promotion
+		uint32_t promotionThreshold{64};
+		///indexes with at most this many items are promoted on construction, 0 disables this
+		uint32_t maxSmallIdxSize{0};
+		///maximum number of hot indexes
+		uint32_t maxHotCount{1 << 16};
+		///maximum size of the arena in bytes
+		UByteArrayAdapter::SizeType maxArenaSize{256*1024*1024};
+		///size of a single arena chunk in bytes, larger indexes get their own chunk
+		UByteArrayAdapter::SizeType chunkSize{4*1024*1024};
+	};
+public:
+	///every HotHitSampleRate-th access of a hot index by a thread is counted with weight HotHitSampleRate
+	static constexpr uint32_t HotHitSampleRate = 16;
+public:
+	TieredItemIndexStore(const sserialize::Static::ItemIndexStore & backend);
+	TieredItemIndexStore(const sserialize::Static::ItemIndexStore & backend, const Config & cfg);
+	virtual ~TieredItemIndexStore();
+	virtual OffsetType getSizeInBytes() const override;
+	virtual uint32_t size() const override;
+	virtual int indexTypes() const override;
+	virtual ItemIndex::Types indexType(uint32_t pos) const override;
+	virtual uint32_t compressionType() const override;
+	virtual UByteArrayAdapter::OffsetType dataSize(uint32_t pos) const override;
+	virtual UByteArrayAdapter rawDataAt(uint32_t pos) const override;
+	virtual ItemIndex at(uint32_t pos) const override;
+	virtual uint32_t idxSize(uint32_t pos) const override;
+	virtual std::ostream& printStats(std::ostream& out) const override;
+	virtual std::ostream& printStats(std::ostream& out, std::function<bool(uint32_t)> filter) const override;
+	virtual SortedOffsetIndex & getIndex() override;
+	virtual const UByteArrayAdapter & getData() const override;
+	virtual RCPtrWrapper<HuffmanDecoder> getHuffmanTree() const override;
+	virtual UByteArrayAdapter getHuffmanTreeData() const override;
+	virtual bool hasSummaries() const override;
+	virtual ItemIndexSummary summary(uint32_t pos) const override;
+public:
+	const sserialize::Static::ItemIndexStore & backend() const { return m_backend; }
+	const Config & config() const { return m_cfg; }
+	bool isHot(uint32_t pos) const;
+	uint32_t hotCount() const;
+	///number of bytes used in the arena
+	UByteArrayAdapter::SizeType arenaSize() const;
+	///Accesses of hot indexes are sampled, their count is an estimate with a granularity of HotHitSampleRate
+	uint32_t accessCount(uint32_t pos) const;
+	///@return false if the hot tier is full
+	bool promote(uint32_t pos);
+	///Writes "id count" lines for every index that was accessed
+	void writeProfile(std::ostream & out) const;
+	///Reads a profile written by writeProfile and promotes all indexes with count >= promotionThreshold (any if it is 0)
+	///in the order of decreasing count until the hot tier is full
+	///@return number of promoted indexes
+	uint32_t loadProfile(std::istream & in);
+private:
+	struct HotEntry {
+		UByteArrayAdapter data;
+		ItemIndex::Types type;
+	};
+	static constexpr uint32_t NotHot = std::numeric_limits<uint32_t>::max();
+private:
+	bool doPromote(uint32_t pos, const ItemIndex & idx) const;
+private:
+	sserialize::Static::ItemIndexStore m_backend;
+	Config m_cfg;
+	std::unique_ptr<std::atomic<uint32_t>[]> m_hotSlot;
+	std::unique_ptr<std::atomic<uint32_t>[]> m_accessCount;
+	//only entries [0, m_hotCount) are valid, the vector is never resized after construction
+	mutable std::vector<HotEntry> m_hot;
+	mutable std::atomic<uint32_t> m_hotCount;
+	//arena, chunks are kept alive by the entries referencing them
+	mutable std::mutex m_promotionLock;
+	mutable UByteArrayAdapter m_chunk;
+	mutable UByteArrayAdapter::SizeType m_chunkUsage;
+	mutable UByteArrayAdapter::SizeType m_arenaSize;
+};
+
+}}}//end namespace sserialize::Static::detail
+
+#endif
@@ -4,9 +4,10 @@
 #include <sserialize/Static/Array.h>
 #include <sserialize/Static/Version.h>
 #include <sserialize/containers/UnicodeStringMap.h>
+#include <sserialize/strings/LevenshteinAutomaton.h>
 #include <sserialize/vendor/utf8.h>
 #include <sserialize/iterator/Iterator.h>
-#define SSERIALIZE_STATIC_UNICODE_TRIE_FLAT_TRIE_BASE_VERSION 1
+#define SSERIALIZE_STATIC_UNICODE_TRIE_FLAT_TRIE_BASE_VERSION 2
 #define SSERIALIZE_STATIC_UNICODE_TRIE_FLAT_TRIE_VERSION 1
 
 namespace sserialize {
@@ -124,23 +125,30 @@ public:
 
 /** Layout:
   *
-  *-------------------------------------------------------------------
-  *VERSION|StringDataSize|    StringData   |StaticStrings(offset, len)|
-  *--------------------------------------------------------------------
-  *uin8t  |OffsetType    |UByteArrayAdapter|MultiVarBitArray         
+  *---------------------------------------------------------------------------------------------
+  *VERSION|StringDataSize|    StringData   |StaticStrings(offset, len)|DirectorySampleRate|Directory
+  *---------------------------------------------------------------------------------------------
+  *uin8t  |OffsetType    |UByteArrayAdapter|MultiVarBitArray          |v32                |*
   *
+  * DirectorySampleRate and Directory are only present in version 2, version 1 is still supported.
+  * The Directory holds an entry for every DirectorySampleRate-th string (starting with the first).
+  * An entry has DirectoryEntrySize bytes: the length of the stored prefix (uint8_t) followed by
+  * the first DirectoryPrefixLength bytes of the string padded with zeros.
+  * find() first searches the contiguous directory and then only the strings between two samples.
   *
   */
   
-class FlatTrieBase: sserialize::Static::SimpleVersion<1, FlatTrieBase> {
+class FlatTrieBase {
 public:
-	using Version = sserialize::Static::SimpleVersion<1, FlatTrieBase>;
 	using SizeType = sserialize::MultiVarBitArray::SizeType;
 	typedef enum {TA_STR_OFFSET=0, TA_STR_LEN=1} TrieAccessors;
 	static constexpr SizeType npos = std::numeric_limits<SizeType>::max();
 	typedef detail::FlatTrie::StaticString StaticString;
 	using StringSizeType = StaticString::SizeType;
 	typedef detail::FlatTrie::Node Node;
+	static constexpr uint32_t DirectoryEntrySize = 8;
+	static constexpr uint32_t DirectoryPrefixLength = DirectoryEntrySize-1;
+	static constexpr uint32_t DefaultDirectorySampleRate = 32;
 	class StaticStringsIterator: public sserialize::StaticIterator<std::forward_iterator_tag, detail::FlatTrie::StaticString>  {
 	private:
 		const FlatTrieBase * m_trie;
@@ -159,7 +167,19 @@ public:
 private:
 	sserialize::UByteArrayAdapter m_strData;
 	sserialize::MultiVarBitArray m_trie;
+	uint32_t m_dirSampleRate;
+	SizeType m_dirSize;
+	UByteArrayAdapter::MemoryView m_dir;
 private:
+	///compares the prefix stored in the directory entry at @param pos with the prefix of @param str
+	int dirCompare(SizeType pos, const std::string & str) const;
+	///restricts [left, right] to the strings between the two samples enclosing @param str
+	void dirRange(const std::string & str, SizeType & left, SizeType & right) const;
+	///find() that starts the search at @param lowerBound which has to point to a string smaller than @param str
+	///@param lowerBound is set to the largest position known to be smaller than or equal to @param str
+	SizeType find(const std::string & str, bool prefixMatch, SizeType & lowerBound) const;
+	template<typename T_FUNC>
+	void fuzzyFind(const Node & node, std::string::size_type parentStrLen, const LevenshteinAutomaton & la, const LevenshteinAutomaton::State & state, bool prefixMatch, T_FUNC & fn) const;
 	template<typename TVISITOR>
 	void visitDF(const Node & node, TVISITOR & visitor) {
 		visitor(node);
@@ -185,13 +205,77 @@ public:
 	inline StringSizeType strSize(const StaticString & str) const { return str.size(); }
 	inline StringSizeType strSize(SizeType pos) const { return strSize(sstr(pos)); }
 	SizeType find(const std::string & str, bool prefixMatch) const;
+	/** Looks up all strings of [@param begin, @param end) and writes their positions (or npos) to @param out.
+	  * If the strings are sorted, the search of each string starts where the search of its predecessor ended.
+	  * Unsorted input is handled correctly but does not benefit from this.
+	  */
+	template<typename T_STRING_ITERATOR, typename T_OUTPUT_ITERATOR>
+	void findMany(T_STRING_ITERATOR begin, const T_STRING_ITERATOR & end, bool prefixMatch, T_OUTPUT_ITERATOR out) const;
+	/** Intersects the trie with @param la and calls fn(SizeType pos, uint32_t distance) for every matching string.
+	  * With @param prefixMatch a string is reported if the query matches one of its prefixes,
+	  * the strings below it are then skipped and distance is that of the shortest matching prefix.
+	  */
+	template<typename T_FUNC>
+	void fuzzyFind(const LevenshteinAutomaton & la, bool prefixMatch, T_FUNC fn) const;
+	///0 if there is no directory
+	inline uint32_t directorySampleRate() const { return m_dirSampleRate; }
 	Node root() const;
 	std::ostream & printStats(std::ostream & out) const;
 	///visit all nodes in depth-first search
 	template<typename TVISITOR>
 	inline void visitDF(TVISITOR visitor) { visitDF(root(), visitor); }
+	///appends the directory entry of the string [@param str, @param str+@param size) to @param dest
+	static void putDirectoryEntry(UByteArrayAdapter & dest, const char * str, StringSizeType size);
 };
 
+template<typename T_STRING_ITERATOR, typename T_OUTPUT_ITERATOR>
+void FlatTrieBase::findMany(T_STRING_ITERATOR begin, const T_STRING_ITERATOR & end, bool prefixMatch, T_OUTPUT_ITERATOR out) const {
+	SizeType lowerBound = 0;
+	std::string prev;
+	for(; begin != end; ++begin, ++out) {
+		const std::string & str = *begin;
+		if (str < prev) {
+			lowerBound = 0;
+		}
+		*out = find(str, prefixMatch, lowerBound);
+		prev = str;
+	}
+}
+
+template<typename T_FUNC>
+void FlatTrieBase::fuzzyFind(const LevenshteinAutomaton & la, bool prefixMatch, T_FUNC fn) const {
+	if (size()) {
+		fuzzyFind(root(), 0, la, la.start(), prefixMatch, fn);
+	}
+}
+
+template<typename T_FUNC>
+void FlatTrieBase::fuzzyFind(const Node & node, std::string::size_type parentStrLen, const LevenshteinAutomaton & la, const LevenshteinAutomaton::State & state, bool prefixMatch, T_FUNC & fn) const {
+	if (prefixMatch && la.isMatch(state)) {
+		fn(node.id(), la.distance(state));
+		return;
+	}
+	LevenshteinAutomaton::State cur(state), next;
+	std::string nodeStr(node.str());
+	for(std::string::const_iterator it(nodeStr.cbegin()+parentStrLen), end(nodeStr.cend()); it != end;) {
+		la.step(cur, utf8::next(it, end), next);
+		cur.swap(next);
+		if (!la.canMatch(cur)) {
+			return;
+		}
+		if (prefixMatch && la.isMatch(cur)) {
+			fn(node.id(), la.distance(cur));
+			return;
+		}
+	}
+	if (la.isMatch(cur)) {
+		fn(node.id(), la.distance(cur));
+	}
+	for(Node child : node) {
+		fuzzyFind(child, nodeStr.size(), la, cur, prefixMatch, fn);
+	}
+}
+
 /** Layout:
   *
   *----------------------------------
@@ -246,6 +330,26 @@ public:
 	virtual bool count(const std::string::const_iterator & strBegin, const std::string::const_iterator & strEnd, bool prefixMatch) const override {
 		return count(std::string(strBegin, strEnd), prefixMatch);
 	}
+	virtual void findMany(const std::vector<std::string> & strs, bool prefixMatch, std::vector<TValue> & values, std::vector<bool> & found) const override {
+		std::vector<FlatTrieBase::SizeType> pos(strs.size());
+		m_trie.findMany(strs.cbegin(), strs.cend(), prefixMatch, pos.begin());
+		values.resize(strs.size());
+		found.resize(strs.size());
+		for(std::size_t i(0), s(strs.size()); i < s; ++i) {
+			found[i] = (pos[i] != FlatTrieBase::npos);
+			if (found[i]) {
+				values[i] = m_trie.at(pos[i]);
+			}
+		}
+	}
+	virtual void fuzzyFind(const LevenshteinAutomaton & la, bool prefixMatch, std::vector<TValue> & values, std::vector<uint32_t> & distances) const override {
+		values.clear();
+		distances.clear();
+		m_trie.fuzzyFind(la, prefixMatch, [this, &values, &distances](FlatTrieBase::SizeType pos, uint32_t distance) {
+			values.push_back(m_trie.at(pos));
+			distances.push_back(distance);
+		});
+	}
 	virtual std::ostream & printStats(std::ostream & out) const override {
 		return m_trie.printStats(out);
 	}
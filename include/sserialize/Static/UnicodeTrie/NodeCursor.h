@@ -0,0 +1,127 @@
+#ifndef SSERIALIZE_STATIC_UNICODE_TRIE_NODE_CURSOR_H
+#define SSERIALIZE_STATIC_UNICODE_TRIE_NODE_CURSOR_H
+#include <sserialize/Static/UnicodeTrie/Node.h>
+#include <sserialize/storage/UByteArrayAdapter.h>
+
+namespace sserialize {
+namespace Static {
+namespace UnicodeTrie {
+
+/** A NodeCursor is a light-weight value type pointing to a node of a serialized trie.
+  * In contrast to Node it does not allocate and does not use virtual dispatch.
+  * There is one specialization per node type, see Node::NodeTypes.
+  * The trie data passed to a cursor has to outlive it.
+  */
+template<uint32_t TNodeType>
+class NodeCursor;
+
+///Cursor for nodes of type Node::NT_SIMPLE, see detail::SimpleNode for the layout
+template<>
+class NodeCursor<Node::NT_SIMPLE> {
+public:
+	typedef UByteArrayAdapter::OffsetType OffsetType;
+	static constexpr uint32_t npos = Node::npos;
+	static constexpr uint32_t NodeType = Node::NT_SIMPLE;
+private:
+	const UByteArrayAdapter * m_d;
+	OffsetType m_childrenBegin;
+	OffsetType m_strBegin;
+	uint32_t m_childCount;
+	uint32_t m_payloadPtr;
+	uint32_t m_strLen;
+private:
+	inline uint32_t getVl(OffsetType & off) const {
+		int len;
+		uint32_t v = m_d->getVlPackedUint32(off, &len);
+		off += len;
+		return v;
+	}
+	inline void init(OffsetType off) {
+		m_childCount = getVl(off);
+		m_childrenBegin = off;
+		for(uint32_t i(0); i < 2*m_childCount; ++i) {
+			getVl(off);
+		}
+		m_payloadPtr = getVl(off);
+		m_strLen = getVl(off);
+		m_strBegin = off;
+	}
+	///offset of the child pointers are relative to
+	inline OffsetType nodeEnd() const { return m_strBegin + m_strLen; }
+public:
+	///invalid cursor
+	NodeCursor() : m_d(0), m_childrenBegin(0), m_strBegin(0), m_childCount(0), m_payloadPtr(0), m_strLen(0) {}
+	///@param d data of the trie nodes, @param offset begin of the node in @param d
+	NodeCursor(const UByteArrayAdapter & d, OffsetType offset) : m_d(&d) { init(offset); }
+	inline bool valid() const { return m_d; }
+	inline uint32_t strLen() const { return m_strLen; }
+	///the @param pos-th byte of the node string
+	inline uint8_t strAt(uint32_t pos) const { return m_d->at(m_strBegin+pos); }
+	inline UByteArrayAdapter strData() const { return UByteArrayAdapter(*m_d, m_strBegin, m_strLen); }
+	inline std::string str() const { return strData().toString(); }
+	inline uint32_t childSize() const { return m_childCount; }
+	inline uint32_t payloadPtr() const { return m_payloadPtr; }
+	uint32_t childKey(uint32_t pos) const {
+		OffsetType off = m_childrenBegin;
+		for(uint32_t i(0); i < pos; ++i) {
+			getVl(off);
+			getVl(off);
+		}
+		return getVl(off);
+	}
+	uint32_t childPtr(uint32_t pos) const {
+		OffsetType off = m_childrenBegin;
+		for(uint32_t i(0); i < pos; ++i) {
+			getVl(off);
+			getVl(off);
+		}
+		getVl(off);
+		return getVl(off);
+	}
+	///@return position of the child with key @param unicode_point or npos
+	uint32_t find(uint32_t unicode_point) const {
+		OffsetType off = m_childrenBegin;
+		for(uint32_t i(0); i < m_childCount; ++i) {
+			uint32_t key = getVl(off);
+			if (key >= unicode_point) {
+				return (key == unicode_point ? i : npos);
+			}
+			getVl(off);
+		}
+		return npos;
+	}
+	inline NodeCursor child(uint32_t pos) const {
+		return NodeCursor(*m_d, nodeEnd() + childPtr(pos));
+	}
+	///Calls @param fn(uint32_t key, const NodeCursor & child) for all children in a single pass over the child table
+	template<typename T_FUNC>
+	void forEachChild(T_FUNC fn) const {
+		OffsetType off = m_childrenBegin;
+		for(uint32_t i(0); i < m_childCount; ++i) {
+			uint32_t key = getVl(off);
+			uint32_t ptr = getVl(off);
+			fn(key, NodeCursor(*m_d, nodeEnd() + ptr));
+		}
+	}
+	///Moves this cursor to the child with key @param unicode_point
+	///@return false if there is no such child, the cursor is not changed in this case
+	bool descend(uint32_t unicode_point) {
+		OffsetType off = m_childrenBegin;
+		for(uint32_t i(0); i < m_childCount; ++i) {
+			uint32_t key = getVl(off);
+			uint32_t ptr = getVl(off);
+			if (key >= unicode_point) {
+				if (key != unicode_point) {
+					return false;
+				}
+				init(nodeEnd() + ptr);
+				return true;
+			}
+		}
+		return false;
+	}
+};
+
+}}}//end namespace
+
+#endif
@@ -1,9 +1,11 @@
 #ifndef SSERIALIZE_UNICODE_TRIE_TRIE_H
 #define SSERIALIZE_UNICODE_TRIE_TRIE_H
 #include <sserialize/Static/UnicodeTrie/Node.h>
+#include <sserialize/Static/UnicodeTrie/NodeCursor.h>
 #include <sserialize/Static/Array.h>
 #include <sserialize/vendor/utf8.h>
 #include <sserialize/containers/UnicodeStringMap.h>
+#include <sserialize/strings/LevenshteinAutomaton.h>
 #include <queue>
 #define SSERIALIZE_STATIC_UNICODE_TRIE_TRIE_VERSION 1
 
@@ -24,19 +26,60 @@ template<typename TValue>
 class Trie {
 public:
 	typedef sserialize::Static::UnicodeTrie::Node Node;
+	static constexpr uint32_t npos = Node::npos;
 private:
 	Node m_root;
 	sserialize::Static::Array<TValue> m_values;
+	uint32_t m_nodeType;
+	sserialize::UByteArrayAdapter m_nodeData;
+private:
+	template<typename T_CURSOR, typename T_OCTET_ITERATOR>
+	static bool find(T_CURSOR & node, T_OCTET_ITERATOR strIt, const T_OCTET_ITERATOR & strEnd, bool prefixMatch);
+	///calls @param fn(uint32_t key, child) for all children of @param node
+	template<typename T_FUNC>
+	static void forEachChild(const Node & node, T_FUNC fn);
+	template<uint32_t TNodeType, typename T_FUNC>
+	static void forEachChild(const NodeCursor<TNodeType> & node, T_FUNC fn) { node.forEachChild(fn); }
+	template<typename T_CURSOR, typename T_FUNC>
+	static void forEachPayloadPtr(const T_CURSOR & node, T_FUNC & fn);
+	template<typename T_CURSOR, typename T_FUNC>
+	static void fuzzyPayloadPtrs(const T_CURSOR & node, const LevenshteinAutomaton & la, const LevenshteinAutomaton::State & state, bool prefixMatch, T_FUNC & fn);
 public:
-	Trie() {}
+	Trie() : m_nodeType(0) {}
 	Trie(const sserialize::UByteArrayAdapter & d);
 	///@param rootNodeAllocator allocator for the root node: Node rootNodeAllocator(uint32_t nodeType, const UByteArrayAdapter & src), used once, not stored
 	template<typename T_ROOT_NODE_ALLOCATOR>
 	Trie(const sserialize::UByteArrayAdapter & d, T_ROOT_NODE_ALLOCATOR rootNodeAllocator);
 	Node getRootNode() const { return m_root; }
+	inline uint32_t nodeType() const { return m_nodeType; }
+	///Allocation-free cursor pointing to the root node, throws sserialize::TypeMissMatchException if the trie has a different node type
+	template<uint32_t TNodeType>
+	NodeCursor<TNodeType> rootCursor() const;
 
 	template<typename T_OCTET_ITERATOR>
 	Node find(T_OCTET_ITERATOR strIt, const T_OCTET_ITERATOR& strEnd, bool prefixMatch) const;
+	
+	///@return payload id of the end-node, npos on miss
+	template<typename T_OCTET_ITERATOR>
+	uint32_t findPayloadPtr(T_OCTET_ITERATOR strIt, const T_OCTET_ITERATOR& strEnd, bool prefixMatch) const;
+	
+	/** Writes the payload id (or npos) of every string in [@param begin, @param end) to @param out.
+	  * Nodes on the path of the previous string are reused for the common prefix,
+	  * hence sorted input only descends the trie once per shared prefix.
+	  */
+	template<typename T_STRING_ITERATOR, typename T_OUTPUT_ITERATOR>
+	void findPayloadPtrs(T_STRING_ITERATOR begin, const T_STRING_ITERATOR & end, bool prefixMatch, T_OUTPUT_ITERATOR out) const;
+	
+	///Calls fn(uint32_t payloadPtr) for the node of the prefix strIt->strEnd and all nodes below it in depth-first order
+	template<typename T_OCTET_ITERATOR, typename T_FUNC>
+	void forEachPayloadPtr(T_OCTET_ITERATOR strIt, const T_OCTET_ITERATOR& strEnd, T_FUNC fn) const;
+
+	/** Intersects the trie with @param la and calls fn(uint32_t payloadPtr, uint32_t distance) for every matching node.
+	  * With @param prefixMatch a node is reported if the query matches a prefix of its path,
+	  * its subtree is then skipped and distance is that of the shortest matching prefix.
+	  */
+	template<typename T_FUNC>
+	void fuzzyPayloadPtrs(const LevenshteinAutomaton & la, bool prefixMatch, T_FUNC fn) const;
 
 	///@param prefixMatch strIt->strEnd can be a prefix of the path
 	///throws sserialize::OutOfBoundsException on miss
@@ -68,10 +111,30 @@ public:
 		return m_trie.at(str.cbegin(), str.cend(), prefixMatch);
 	}
 	virtual bool count(const std::string::const_iterator & strBegin, const std::string::const_iterator & strEnd, bool prefixMatch) const override {
-		return m_trie.find(strBegin, strEnd, prefixMatch).valid();
+		return m_trie.findPayloadPtr(strBegin, strEnd, prefixMatch) != TrieType::npos;
 	}
 	virtual bool count(const std::string & str, bool prefixMatch) const override {
-		return m_trie.find(str.cbegin(), str.cend(), prefixMatch).valid();
+		return m_trie.findPayloadPtr(str.cbegin(), str.cend(), prefixMatch) != TrieType::npos;
+	}
+	virtual void findMany(const std::vector<std::string> & strs, bool prefixMatch, std::vector<TValue> & values, std::vector<bool> & found) const override {
+		std::vector<uint32_t> payloadPtrs(strs.size());
+		m_trie.findPayloadPtrs(strs.cbegin(), strs.cend(), prefixMatch, payloadPtrs.begin());
+		values.resize(strs.size());
+		found.resize(strs.size());
+		for(std::size_t i(0), s(strs.size()); i < s; ++i) {
+			found[i] = (payloadPtrs[i] != TrieType::npos);
+			if (found[i]) {
+				values[i] = m_trie.payload(payloadPtrs[i]);
+			}
+		}
+	}
+	virtual void fuzzyFind(const LevenshteinAutomaton & la, bool prefixMatch, std::vector<TValue> & values, std::vector<uint32_t> & distances) const override {
+		values.clear();
+		distances.clear();
+		m_trie.fuzzyPayloadPtrs(la, prefixMatch, [this, &values, &distances](uint32_t payloadPtr, uint32_t distance) {
+			values.push_back(m_trie.payload(payloadPtr));
+			distances.push_back(distance);
+		});
 	}
 	virtual std::ostream & printStats(std::ostream & out) const override {
 		return m_trie.printStats(out);
@@ -92,6 +155,8 @@ m_values(d+1)
 	uint32_t rootNodeType = d.getUint32(off);
 	off += sserialize::SerializationInfo< uint32_t >::length;
 	m_root = sserialize::Static::UnicodeTrie::RootNodeAllocator()(rootNodeType, d+off);
+	m_nodeType = rootNodeType;
+	m_nodeData = d+off;
 	SSERIALIZE_VERSION_MISSMATCH_CHECK(SSERIALIZE_STATIC_UNICODE_TRIE_TRIE_VERSION, d.at(0), "sserialize::Static::UnicodeTrie::Trie");
 }
 
@@ -106,6 +171,8 @@ m_values(d+1)
 	uint32_t rootNodeType = d.getUint32(off);
 	off += sserialize::SerializationInfo< uint32_t >::length;
 	m_root = rootNodeAllocator(rootNodeType, d+off);
+	m_nodeType = rootNodeType;
+	m_nodeData = d+off;
 	SSERIALIZE_VERSION_MISSMATCH_CHECK(SSERIALIZE_STATIC_UNICODE_TRIE_TRIE_VERSION, d.at(0), "sserialize::Static::UnicodeTrie::Trie");
 }
 
@@ -152,14 +219,204 @@ Trie<TValue>::find(T_OCTET_ITERATOR strIt, const T_OCTET_ITERATOR & strEnd, bool
 	return node;
 }
 
+template<typename TValue>
+template<uint32_t TNodeType>
+NodeCursor<TNodeType>
+Trie<TValue>::rootCursor() const {
+	if (m_nodeType != TNodeType) {
+		throw sserialize::TypeMissMatchException("sserialize::Static::UnicodeTrie::Trie::rootCursor");
+	}
+	return NodeCursor<TNodeType>(m_nodeData, 0);
+}
+
+template<typename TValue>
+template<typename T_CURSOR, typename T_OCTET_ITERATOR>
+bool
+Trie<TValue>::find(T_CURSOR & node, T_OCTET_ITERATOR strIt, const T_OCTET_ITERATOR & strEnd, bool prefixMatch) {
+	uint32_t nStrPos = 0;
+	uint32_t nStrLen = node.strLen();
+	while(strIt != strEnd) {
+		for(; strIt != strEnd && nStrPos < nStrLen; ++strIt, ++nStrPos) {
+			if (static_cast<uint8_t>(*strIt) != node.strAt(nStrPos)) {
+				return false;
+			}
+		}
+		if (nStrPos == nStrLen && strIt != strEnd) {
+			uint32_t key = utf8::next(strIt, strEnd);
+			if (!node.descend(key)) {
+				return false;
+			}
+			nStrPos = 0;
+			nStrLen = node.strLen();
+		}
+	}
+	return nStrPos == nStrLen || prefixMatch;
+}
+
 template<typename TValue>
 template<typename T_OCTET_ITERATOR>
-TValue Trie<TValue>::at(T_OCTET_ITERATOR strIt, const T_OCTET_ITERATOR & strEnd, bool prefixMatch) const {
+uint32_t
+Trie<TValue>::findPayloadPtr(T_OCTET_ITERATOR strIt, const T_OCTET_ITERATOR & strEnd, bool prefixMatch) const {
+	if (m_nodeType == Node::NT_SIMPLE) {
+		NodeCursor<Node::NT_SIMPLE> node(m_nodeData, 0);
+		if (find(node, strIt, strEnd, prefixMatch)) {
+			return node.payloadPtr();
+		}
+		return npos;
+	}
 	Node node = find(strIt, strEnd, prefixMatch);
 	if (!node.valid()) {
+		return npos;
+	}
+	return node.payloadPtr();
+}
+
+template<typename TValue>
+template<typename T_STRING_ITERATOR, typename T_OUTPUT_ITERATOR>
+void
+Trie<TValue>::findPayloadPtrs(T_STRING_ITERATOR begin, const T_STRING_ITERATOR & end, bool prefixMatch, T_OUTPUT_ITERATOR out) const {
+	if (m_nodeType != Node::NT_SIMPLE) {
+		for(; begin != end; ++begin, ++out) {
+			*out = findPayloadPtr(begin->cbegin(), begin->cend(), prefixMatch);
+		}
+		return;
+	}
+	typedef NodeCursor<Node::NT_SIMPLE> Cursor;
+	//nodes on the path of the previous string and the offset in that string at which their node string starts
+	std::vector< std::pair<Cursor, std::size_t> > path;
+	path.emplace_back(Cursor(m_nodeData, 0), 0);
+	std::string prev;
+	for(; begin != end; ++begin, ++out) {
+		const std::string & str = *begin;
+		std::size_t lcp = 0;
+		for(std::size_t s(std::min(str.size(), prev.size())); lcp < s && str[lcp] == prev[lcp]; ++lcp) {}
+		//the root node is never removed since it starts at offset 0
+		while (path.back().second > lcp) {
+			path.pop_back();
+		}
+		prev = str;
+		
+		uint32_t result = npos;
+		Cursor node = path.back().first;
+		std::string::const_iterator strIt(str.cbegin() + path.back().second);
+		std::string::const_iterator strEnd(str.cend());
+		uint32_t nStrPos = 0;
+		uint32_t nStrLen = node.strLen();
+		while(true) {
+			for(; strIt != strEnd && nStrPos < nStrLen; ++strIt, ++nStrPos) {
+				if (static_cast<uint8_t>(*strIt) != node.strAt(nStrPos)) {
+					break;
+				}
+			}
+			if (strIt == strEnd) {
+				if (nStrPos == nStrLen || prefixMatch) {
+					result = node.payloadPtr();
+				}
+				break;
+			}
+			if (nStrPos != nStrLen) { //mismatch
+				break;
+			}
+			uint32_t key = utf8::next(strIt, strEnd);
+			if (!node.descend(key)) {
+				break;
+			}
+			path.emplace_back(node, std::size_t(strIt - str.cbegin()));
+			nStrPos = 0;
+			nStrLen = node.strLen();
+		}
+		*out = result;
+	}
+}
+
+template<typename TValue>
+template<typename T_FUNC>
+void
+Trie<TValue>::forEachChild(const Node & node, T_FUNC fn) {
+	for(uint32_t i(0), s(node.childSize()); i < s; ++i) {
+		fn(node.childKey(i), node.child(i));
+	}
+}
+
+template<typename TValue>
+template<typename T_CURSOR, typename T_FUNC>
+void
+Trie<TValue>::forEachPayloadPtr(const T_CURSOR & node, T_FUNC & fn) {
+	fn(node.payloadPtr());
+	forEachChild(node, [&fn](uint32_t /*key*/, const T_CURSOR & child) {
+		forEachPayloadPtr(child, fn);
+	});
+}
+
+template<typename TValue>
+template<typename T_OCTET_ITERATOR, typename T_FUNC>
+void
+Trie<TValue>::forEachPayloadPtr(T_OCTET_ITERATOR strIt, const T_OCTET_ITERATOR & strEnd, T_FUNC fn) const {
+	if (m_nodeType == Node::NT_SIMPLE) {
+		NodeCursor<Node::NT_SIMPLE> node(m_nodeData, 0);
+		if (find(node, strIt, strEnd, true)) {
+			forEachPayloadPtr(node, fn);
+		}
+		return;
+	}
+	Node node = find(strIt, strEnd, true);
+	if (node.valid()) {
+		forEachPayloadPtr(node, fn);
+	}
+}
+
+template<typename TValue>
+template<typename T_CURSOR, typename T_FUNC>
+void
+Trie<TValue>::fuzzyPayloadPtrs(const T_CURSOR & node, const LevenshteinAutomaton & la, const LevenshteinAutomaton::State & state, bool prefixMatch, T_FUNC & fn) {
+	if (prefixMatch && la.isMatch(state)) {
+		fn(node.payloadPtr(), la.distance(state));
+		return;
+	}
+	LevenshteinAutomaton::State cur(state), next;
+	std::string nodeStr(node.str());
+	for(std::string::const_iterator it(nodeStr.cbegin()), end(nodeStr.cend()); it != end;) {
+		la.step(cur, utf8::next(it, end), next);
+		cur.swap(next);
+		if (!la.canMatch(cur)) {
+			return;
+		}
+		if (prefixMatch && la.isMatch(cur)) {
+			fn(node.payloadPtr(), la.distance(cur));
+			return;
+		}
+	}
+	if (la.isMatch(cur)) {
+		fn(node.payloadPtr(), la.distance(cur));
+	}
+	forEachChild(node, [&la, &cur, &next, prefixMatch, &fn](uint32_t key, const T_CURSOR & child) {
+		la.step(cur, key, next);
+		if (la.canMatch(next)) {
+			fuzzyPayloadPtrs(child, la, next, prefixMatch, fn);
+		}
+	});
+}
+
+template<typename TValue>
+template<typename T_FUNC>
+void
+Trie<TValue>::fuzzyPayloadPtrs(const LevenshteinAutomaton & la, bool prefixMatch, T_FUNC fn) const {
+	if (m_nodeType == Node::NT_SIMPLE) {
+		fuzzyPayloadPtrs(NodeCursor<Node::NT_SIMPLE>(m_nodeData, 0), la, la.start(), prefixMatch, fn);
+	}
+	else if (m_root.valid()) {
+		fuzzyPayloadPtrs(m_root, la, la.start(), prefixMatch, fn);
+	}
+}
+
+template<typename TValue>
+template<typename T_OCTET_ITERATOR>
+TValue Trie<TValue>::at(T_OCTET_ITERATOR strIt, const T_OCTET_ITERATOR & strEnd, bool prefixMatch) const {
+	uint32_t payloadPtr = findPayloadPtr(strIt, strEnd, prefixMatch);
+	if (payloadPtr == npos) {
 		throw sserialize::OutOfBoundsException("sserialize::Static::UnicodeTrie::Trie::at");
 	}
-	return m_values.at( node.payloadPtr() );
+	return m_values.at(payloadPtr);
 }
 
 template<typename TValue>
@@ -6,9 +6,23 @@
 #include <sserialize/storage/UByteArrayAdapter.h>
 
 namespace sserialize {
+namespace detail {
+namespace FindKeyInArray {
+
+///@return position of @param key in the packed array of @param len bytes starting at @param begin, -1 if there is none
+///Uses SSE2 or AVX2 depending on the cpu this runs on
+int32_t find_u8(const uint8_t * begin, uint32_t len, uint8_t key);
+///@return position of @param key in the packed array of @param len little-endian uint16_t starting at @param begin, -1 if there is none
+///Uses SSE2 or AVX2 depending on the cpu this runs on
+int32_t find_u16(const uint8_t * begin, uint32_t len, uint16_t key);
+
+}}//end namespace detail::FindKeyInArray
 
 template<int TSTRIDE>
 inline int16_t findKeyInArray(const UByteArrayAdapter & arrayStart, uint8_t len, uint8_t key) {
+	if (TSTRIDE == 1 && len && arrayStart.isContiguous()) {
+		return (int16_t) detail::FindKeyInArray::find_u8(&arrayStart[0], len, key);
+	}
 	for(int i = 0; i < len; i++) {
 		if (arrayStart.at(TSTRIDE*i) == key) return i;
 	}
@@ -17,6 +31,9 @@ inline int16_t findKeyInArray(const UByteArrayAdapter & arrayStart, uint8_t len,
 
 template<int TSTRIDE>
 inline int16_t findKeyInArray_uint16(const UByteArrayAdapter & arrayStart, uint16_t len, uint16_t key) {
+	if (TSTRIDE == 2 && len && arrayStart.isContiguous()) {
+		return (int16_t) detail::FindKeyInArray::find_u16(&arrayStart[0], len, key);
+	}
 	uint16_t srcKey;
 	for(int i = 0; i < len; i++) {
 		srcKey = arrayStart.getUint16(TSTRIDE*i);
@@ -27,12 +27,16 @@ public:
 	virtual Bits bpn() const;
 
 	virtual value_type at(SizeType pos) const = 0;
+	///Default implementation calls at() count times
+	virtual void getRange(SizeType pos, SizeType count, value_type * dest) const;
 	/** @param: returns the value set (i.e. if value is to large then it sets masked */
 	virtual value_type set(const SizeType pos, value_type value) = 0;
 protected:
 	UByteArrayAdapter m_data;
 protected:
 	void calcBegin(const SizeType pos, sserialize::UByteArrayAdapter::OffsetType& posStart, uint8_t& initShift, Bits bpn) const;
+	///Decodes a range of numbers stored with the least significant bit first in one pass
+	void getRangeLsb(SizeType pos, SizeType count, value_type * dest, Bits bpn) const;
 };
 
 class CompactUintArrayPrivateEmpty: public CompactUintArrayPrivate {
@@ -54,6 +58,7 @@ public:
 	virtual Bits bpn() const override;
 	
 	virtual value_type at(const SizeType pos) const override;
+	virtual void getRange(SizeType pos, SizeType count, value_type * dest) const override;
 	/** @param: returns the value set (i.e. if value is to large the nit ets masked */
 	virtual value_type set(const SizeType pos, value_type value) override;
 };
@@ -68,6 +73,7 @@ public:
 	virtual Bits bpn() const override;
 	
 	virtual value_type at(const SizeType pos) const override;
+	virtual void getRange(SizeType pos, SizeType count, value_type * dest) const override;
 	/** @param: returns the value set (i.e. if value is to large the nit ets masked */
 	virtual value_type set(const SizeType pos, value_type value) override;
 };
@@ -78,6 +84,7 @@ public:
 	virtual ~CompactUintArrayPrivateU8();
 	virtual Bits bpn() const override;
 	virtual value_type at(SizeType pos) const override;
+	virtual void getRange(SizeType pos, SizeType count, value_type * dest) const override;
 	/** @param: returns the value set (i.e. if value is to large the nit ets masked */
 	virtual value_type set(const SizeType pos, value_type value) override;
 };
@@ -152,6 +159,9 @@ public:
 	
 	value_type at(SizeType pos) const;
 	value_type at64(SizeType pos) const;
+	///Decodes the count numbers beginning at pos into dest
+	///This is considerably faster than calling at() count times
+	void getRange(SizeType pos, SizeType count, value_type * dest) const;
 	inline SizeType maxCount() const { return m_maxCount; }
 	bool reserve(SizeType newMaxCount);
 	UByteArrayAdapter & data();
@@ -19,6 +19,10 @@
 #include <sserialize/Static/DynamicVector.h>
 #include <sserialize/Static/UnicodeTrie/FlatTrie.h>
 #include <sserialize/utility/printers.h>
+#include <atomic>
+#include <mutex>
+#include <string_view>
+#include <unordered_set>
 
 ///WARNING: USING a hash of NodePtr need explicit initialization of the hash function (see bottom of this file)
 
@@ -45,7 +49,8 @@ public:
 	typedef StaticString key_type;
 	typedef MMVector<char> StringStorage;
 	typedef MMVector< std::pair<key_type, TValue> > HTValueStorage;
-	typedef MMVector<SizeType> HTStorage;
+	///32-bit handles into the node storage, hence the trie can have at most 2^32-2 nodes
+	typedef MMVector<uint32_t> HTStorage;
 	typedef typename HTValueStorage::const_iterator const_iterator;
 	typedef typename HTValueStorage::iterator iterator;
 private:
@@ -223,8 +228,23 @@ private:
 	mutable StringHandler m_strHandler;
 	mutable std::mutex m_specStrLock;
 	HashTable m_ht;
+	uint32_t m_directorySampleRate;
+	UByteArrayAdapter::SizeType m_spillThreshold;
+	sserialize::MmappedMemoryType m_spillMMT;
 private:
-	void finalize(uint64_t nodeBegin, uint64_t nodeEnd, StaticString::SizeType posInStr);
+	///appends the special string @param a to the string arena, spills the arena if it grows beyond the spill threshold
+	StaticString pushString(const StaticString & a);
+	///moves the string arena to m_spillMMT if it is larger than the spill threshold
+	void spillStrings();
+	///strings [begin, end) of the sorted hash table that belong to one node, the node string starts at posInStr
+	struct NodeRange {
+		uint64_t begin;
+		uint64_t end;
+		StaticString::SizeType posInStr;
+		NodeRange(uint64_t begin, uint64_t end, StaticString::SizeType posInStr) : begin(begin), end(end), posInStr(posInStr) {}
+	};
+	///Adds the string of @param node to @param missing if it is not part of the trie and appends its children to @param children
+	void finalize(const NodeRange & node, std::vector<StaticString> & missing, std::vector<NodeRange> & children) const;
 	uint32_t depth(const NodePtr & n) {
 		uint32_t mD = 0;
 		for(auto c : *n) {
@@ -235,7 +255,10 @@ private:
 public:
 	HashBasedFlatTrie(sserialize::MmappedMemoryType stringsMMT = sserialize::MM_SHARED_MEMORY, sserialize::MmappedMemoryType hashMMT = sserialize::MM_SHARED_MEMORY) :
 	m_stringData(stringsMMT),
-	m_ht(HTValueStorage(sserialize::MM_PROGRAM_MEMORY), HTStorage(sserialize::MM_PROGRAM_MEMORY))
+	m_ht(HTValueStorage(sserialize::MM_PROGRAM_MEMORY), HTStorage(sserialize::MM_PROGRAM_MEMORY)),
+	m_directorySampleRate(0),
+	m_spillThreshold(0),
+	m_spillMMT(sserialize::MM_FILEBASED)
 	{
 		m_strHandler.specialString = 0;
 		m_strHandler.strStorage = &m_stringData;
@@ -255,6 +278,9 @@ public:
 		m_strHandler.specialString = 0;
 		m_strHandler.strStorage = &m_stringData;
 		m_ht = std::move(o.m_ht);
+		m_directorySampleRate = o.m_directorySampleRate;
+		m_spillThreshold = o.m_spillThreshold;
+		m_spillMMT = o.m_spillMMT;
 		const StringHandler * strHandlerPtr = &m_strHandler;
 		m_ht.hash1() = HashFunc1(strHandlerPtr);
 		m_ht.hash2() = HashFunc2(strHandlerPtr);
@@ -263,6 +289,21 @@ public:
 	}
 	
 	UByteArrayAdapter::SizeType minStorageSize() const { return m_stringData.size() + m_ht.storageCapacity()*sizeof(typename HTValueStorage::value_type) + m_ht.capacity()*sizeof(HTStorage::value_type);}
+	///Bytes currently reserved by the parts of the trie
+	struct MemoryUsage {
+		UByteArrayAdapter::SizeType strings;
+		UByteArrayAdapter::SizeType nodes;
+		UByteArrayAdapter::SizeType table;
+		inline UByteArrayAdapter::SizeType total() const { return strings + nodes + table; }
+	};
+	MemoryUsage memoryUsage() const;
+	std::ostream & printStats(std::ostream & out) const;
+	/** Moves the string arena to memory of type @param mmt as soon as it holds more than @param bytes.
+	  * This keeps the first part of the construction in fast memory and bounds the RAM used by the strings.
+	  * @param bytes 0 disables spilling
+	  */
+	void setStringSpillThreshold(UByteArrayAdapter::SizeType bytes, sserialize::MmappedMemoryType mmt = sserialize::MM_FILEBASED);
+	inline sserialize::MmappedMemoryType stringStorageType() const { return m_stringData.mmt(); }
 	///reserve @param count strings
 	void reserve(SizeType count) { m_ht.reserve(count); }
 	
@@ -290,6 +331,14 @@ public:
 	StaticString insert(const StaticString & a);
 	template<typename T_OCTET_ITERATOR>
 	StaticString insert(T_OCTET_ITERATOR begin, const T_OCTET_ITERATOR & end);
+	/** Inserts the strings [begin, end) with @param threadCount threads, 0 for one per hardware thread.
+	  * The strings are partitioned by their hash, every partition is deduplicated by its own thread.
+	  * The partitions are then appended to the trie and the hash table is rebuilt once.
+	  * The values of new strings are default constructed.
+	  * @param begin random access iterator to std::string
+	  */
+	template<typename T_STRING_ITERATOR>
+	void mt_insert(const T_STRING_ITERATOR & begin, const T_STRING_ITERATOR & end, std::size_t threadCount = 0);
 	TValue & at(std::string const & str);
 	TValue const & at(std::string const & str) const;
 	TValue & operator[](const StaticString & str);
@@ -299,6 +348,7 @@ public:
 	
 	///call this if you want to navigate the trie
 	///you can always choose to add more strings to trie, but then you'd have to call this again
+	///The subtries are built concurrently with @param threadCount threads, 0 for one per hardware thread
 	void finalize(std::size_t threadCount = 0);
 	
 	///before using this, finalize has to be called and no inserts were made afterwards
@@ -308,6 +358,13 @@ public:
 		return NodePtr( tmp->m_ht.begin(), tmp->m_ht.end(), &m_strHandler);
 	}
 	
+	///Sample rate of the prefix directory of the serialized trie, 0 (the default) disables the directory
+	///and keeps the serialized trie readable by versions without directory support.
+	///FlatTrieBase::DefaultDirectorySampleRate is a good choice for large tries.
+	///See sserialize::Static::UnicodeTrie::FlatTrieBase
+	void setDirectorySampleRate(uint32_t sampleRate) { m_directorySampleRate = sampleRate; }
+	uint32_t directorySampleRate() const { return m_directorySampleRate; }
+	
 	///append just the trie, no payload
 	bool append(UByteArrayAdapter & dest);
 	
@@ -485,6 +542,58 @@ HashBasedFlatTrie<TValue>::insert(const std::string & a) {
 }
 
 
+template<typename TValue>
+typename HashBasedFlatTrie<TValue>::StaticString
+HashBasedFlatTrie<TValue>::pushString(const StaticString & a) {
+	typename StaticString::OffsetType strOff;
+	narrow_check_assign(strOff) = m_stringData.size();
+	m_stringData.push_back(m_strHandler.strBegin(a), m_strHandler.strEnd(a));
+	spillStrings();
+	return StaticString(strOff, a.size());
+}
+
+template<typename TValue>
+void
+HashBasedFlatTrie<TValue>::spillStrings() {
+	if (m_spillThreshold && m_stringData.size() > m_spillThreshold && m_stringData.mmt() != m_spillMMT) {
+		StringStorage tmp(m_spillMMT);
+		tmp.reserve(m_stringData.capacity());
+		tmp.push_back(m_stringData.begin(), m_stringData.end());
+		m_stringData = std::move(tmp);
+	}
+}
+
+template<typename TValue>
+void
+HashBasedFlatTrie<TValue>::setStringSpillThreshold(UByteArrayAdapter::SizeType bytes, sserialize::MmappedMemoryType mmt) {
+	m_spillThreshold = bytes;
+	m_spillMMT = mmt;
+}
+
+template<typename TValue>
+typename HashBasedFlatTrie<TValue>::MemoryUsage
+HashBasedFlatTrie<TValue>::memoryUsage() const {
+	MemoryUsage mu;
+	mu.strings = m_stringData.capacity();
+	mu.nodes = m_ht.storageCapacity()*sizeof(typename HTValueStorage::value_type);
+	mu.table = m_ht.capacity()*sizeof(typename HTStorage::value_type);
+	return mu;
+}
+
+template<typename TValue>
+std::ostream &
+HashBasedFlatTrie<TValue>::printStats(std::ostream & out) const {
+	MemoryUsage mu = memoryUsage();
+	out << "sserialize::HashBasedFlatTrie::stats--BEGIN" << std::endl;
+	out << "nodes=" << size() << std::endl;
+	out << "string data=" << sserialize::prettyFormatSize(m_stringData.size()) << " of " << sserialize::prettyFormatSize(mu.strings) << " reserved" << std::endl;
+	out << "node storage=" << sserialize::prettyFormatSize(mu.nodes) << std::endl;
+	out << "hash table=" << sserialize::prettyFormatSize(mu.table) << " with load factor " << m_ht.load_factor() << std::endl;
+	out << "total=" << sserialize::prettyFormatSize(mu.total()) << std::endl;
+	out << "sserialize::HashBasedFlatTrie::stats--END" << std::endl;
+	return out;
+}
+
 template<typename TValue>
 TValue &
 HashBasedFlatTrie<TValue>::operator[](const StaticString & a) {
@@ -492,10 +601,7 @@ HashBasedFlatTrie<TValue>::operator[](const StaticString & a) {
 		return m_ht[a];
 	}
 	else {
-		typename StaticString::OffsetType strOff;
-		narrow_check_assign(strOff) = m_stringData.size();
-		m_stringData.push_back(m_strHandler.strBegin(a), m_strHandler.strEnd(a));
-		return m_ht[StaticString(strOff, a.size())];
+		return m_ht[pushString(a)];
 	}
 }
 
@@ -577,11 +683,8 @@ HashBasedFlatTrie<TValue>::insert(const StaticString & a) {
 		return a;
 	}
 	else {//special string (comes from outside)
-		typename StaticString::OffsetType strOff;
-		narrow_check_assign(strOff) = m_stringData.size();
-		m_stringData.push_back(m_strHandler.strBegin(a), m_strHandler.strEnd(a));
 		SSERIALIZE_NORMAL_ASSERT(utf8::is_valid(m_strHandler.strBegin(a), m_strHandler.strEnd(a)));
-		StaticString ns(strOff, a.size());
+		StaticString ns(pushString(a));
 		m_ht.insert(ns);
 		return ns;
 	}
@@ -595,7 +698,101 @@ HashBasedFlatTrie<TValue>::insert(T_OCTET_ITERATOR begin, const T_OCTET_ITERATOR
 }
 
 template<typename TValue>
-void HashBasedFlatTrie<TValue>::finalize(uint64_t nodeBeginOff, uint64_t nodeEndOff, StaticString::SizeType posInStr) {
+template<typename T_STRING_ITERATOR>
+void
+HashBasedFlatTrie<TValue>::mt_insert(const T_STRING_ITERATOR & begin, const T_STRING_ITERATOR & end, std::size_t threadCount) {
+	if (!threadCount) {
+		threadCount = sserialize::ThreadPool::hardware_concurrency();
+	}
+	std::size_t strCount = end - begin;
+	if (!strCount) {
+		return;
+	}
+	threadCount = std::max<std::size_t>(1, std::min<std::size_t>(threadCount, strCount));
+	const std::size_t partitionCount = threadCount;
+	const std::size_t chunkSize = strCount/threadCount + 1;
+	//strings of a partition, offsets are relative to the partition arena
+	struct Partition {
+		std::vector<char> strings;
+		std::vector<StaticString> keys;
+	};
+	//chunkPartitions[chunk][partition] holds the positions of the strings of chunk that belong to partition
+	std::vector< std::vector< std::vector<std::size_t> > > chunkPartitions(threadCount, std::vector< std::vector<std::size_t> >(partitionCount));
+	std::vector<Partition> partitions(partitionCount);
+	std::atomic<std::size_t> nextChunk(0);
+	std::atomic<bool> tooLong(false);
+	sserialize::ThreadPool::execute([&]() {
+		std::hash<std::string_view> hasher;
+		while (true) {
+			std::size_t chunk = nextChunk.fetch_add(1, std::memory_order_relaxed);
+			if (chunk >= threadCount) {
+				break;
+			}
+			std::vector< std::vector<std::size_t> > & myPartitions = chunkPartitions[chunk];
+			for(std::size_t i(chunk*chunkSize), s(std::min(strCount, i+chunkSize)); i < s; ++i) {
+				const std::string & str = *(begin+i);
+				if (str.size() > StaticString::MaxStringSize) {
+					tooLong = true;
+					return;
+				}
+				myPartitions[hasher(std::string_view(str)) % partitionCount].push_back(i);
+			}
+		}
+	}, (uint32_t) threadCount, sserialize::ThreadPool::CopyTaskTag());
+	if (tooLong) {
+		throw sserialize::OutOfBoundsException("HashBasedFlatTrie::mt_insert: string is too long");
+	}
+	//equal strings end up in the same partition, hence the partitions can be deduplicated independently
+	std::atomic<std::size_t> nextPartition(0);
+	sserialize::ThreadPool::execute([&]() {
+		std::unordered_set<std::string_view> seen;
+		while (true) {
+			std::size_t partition = nextPartition.fetch_add(1, std::memory_order_relaxed);
+			if (partition >= partitionCount) {
+				break;
+			}
+			Partition & p = partitions[partition];
+			seen.clear();
+			for(std::size_t chunk(0); chunk < threadCount; ++chunk) {
+				std::vector<std::size_t> & positions = chunkPartitions[chunk][partition];
+				for(std::size_t i : positions) {
+					const std::string & str = *(begin+i);
+					if (seen.insert(std::string_view(str)).second) {
+						SSERIALIZE_NORMAL_ASSERT(utf8::is_valid(str.begin(), str.end()));
+						p.keys.emplace_back(p.strings.size(), str.size());
+						p.strings.insert(p.strings.end(), str.begin(), str.end());
+					}
+				}
+				std::vector<std::size_t>().swap(positions);
+			}
+		}
+	}, (uint32_t) threadCount, sserialize::ThreadPool::CopyTaskTag());
+	chunkPartitions.clear();
+	//Append the partitions, only strings that are already in the trie need a lookup
+	bool checkExisting = m_ht.size();
+	std::vector<StaticString> keys;
+	for(Partition & p : partitions) {
+		typename StaticString::OffsetType strOff;
+		narrow_check_assign(strOff) = m_stringData.size();
+		m_stringData.push_back(p.strings.begin(), p.strings.end());
+		spillStrings();
+		for(const StaticString & x : p.keys) {
+			StaticString key(strOff+x.offset(), x.size());
+			if (!checkExisting || !m_ht.count(key)) {
+				keys.push_back(key);
+			}
+		}
+		std::vector<char>().swap(p.strings);
+		std::vector<StaticString>().swap(p.keys);
+	}
+	m_ht.insert_unique(keys.begin(), keys.end());
+}
+
+template<typename TValue>
+void HashBasedFlatTrie<TValue>::finalize(const NodeRange & node, std::vector<StaticString> & missing, std::vector<NodeRange> & children) const {
+	uint64_t nodeBeginOff = node.begin;
+	uint64_t nodeEndOff = node.end;
+	StaticString::SizeType posInStr = node.posInStr;
 	if (nodeBeginOff != nodeEndOff) {
 		{//find the end of our current node
 			const_iterator nodeBegin = begin()+nodeBeginOff;
@@ -617,7 +814,7 @@ void HashBasedFlatTrie<TValue>::finalize(uint64_t nodeBeginOff, uint64_t nodeEnd
 		}
 		//if we reach this, the following is true: posInStr points to the next unicodepoint
 		if ((begin()+nodeBeginOff)->first.size() > posInStr) {//our current node has a missing parent, add it to the hash
-			m_ht.insert(StaticString((begin()+nodeBeginOff)->first.offset(), posInStr));
+			missing.push_back(StaticString((begin()+nodeBeginOff)->first.offset(), posInStr));
 		}
 		else {//the first string is the correct internal node string
 			++nodeBeginOff;
@@ -631,7 +828,7 @@ void HashBasedFlatTrie<TValue>::finalize(uint64_t nodeBeginOff, uint64_t nodeEnd
 			CodePoint cp = utf8::next(childNextCP, m_strHandler.strEnd(nodeBegin->first));
 			const_iterator endChildNode = std::upper_bound(nodeBegin, nodeEnd, cp, compFunc);
 			uint64_t childEndOff = endChildNode-begin();
-			finalize(nodeBeginOff, childEndOff, (StaticString::SizeType) (childNextCP - m_strHandler.strBegin(nodeBegin->first)));
+			children.emplace_back(nodeBeginOff, childEndOff, (StaticString::SizeType) (childNextCP - m_strHandler.strBegin(nodeBegin->first)));
 			nodeBeginOff = childEndOff;
 		}
 	}
@@ -664,7 +861,47 @@ void HashBasedFlatTrie<TValue>::finalize(std::size_t threadCount) {
 		return sserialize::unicodeIsSmaller(strHandler->strBegin(a.first), strHandler->strEnd(a.first), strHandler->strBegin(b.first), strHandler->strEnd(b.first));
 	};
 	m_ht.mt_sort(sortFunc, threadCount);
-	finalize(0, m_ht.size(), 0);
+	if (!threadCount) {
+		threadCount = sserialize::ThreadPool::hardware_concurrency();
+	}
+	//Split the trie level by level into independent subtries until there is enough work for all threads.
+	//Missing parents are only collected and inserted afterwards since the hash table does not support concurrent inserts.
+	std::vector<StaticString> missing;
+	std::vector<NodeRange> subTries, children;
+	subTries.emplace_back(0, m_ht.size(), 0);
+	while (subTries.size() && subTries.size() < 4*threadCount) {
+		children.clear();
+		for(const NodeRange & x : subTries) {
+			finalize(x, missing, children);
+		}
+		subTries.swap(children);
+	}
+	std::atomic<std::size_t> nextSubTrie(0);
+	std::mutex missingLock;
+	if (subTries.size()) {
+		sserialize::ThreadPool::execute([this, &subTries, &nextSubTrie, &missing, &missingLock]() {
+			std::vector<StaticString> myMissing;
+			std::vector<NodeRange> stack;
+			while (true) {
+				std::size_t i = nextSubTrie.fetch_add(1, std::memory_order_relaxed);
+				if (i >= subTries.size()) {
+					break;
+				}
+				stack.push_back(subTries[i]);
+				while (stack.size()) {
+					NodeRange node = stack.back();
+					stack.pop_back();
+					finalize(node, myMissing, stack);
+				}
+			}
+			std::lock_guard<std::mutex> lck(missingLock);
+			missing.insert(missing.end(), myMissing.begin(), myMissing.end());
+		}, (uint32_t) std::min<std::size_t>(threadCount, subTries.size()), sserialize::ThreadPool::CopyTaskTag());
+	}
+	m_ht.reserve(m_ht.size() + missing.size());
+	for(const StaticString & x : missing) {
+		m_ht.insert(x);
+	}
 	m_ht.mt_sort(sortFunc, threadCount);
 }
 
@@ -710,7 +947,12 @@ bool HashBasedFlatTrie<TValue>::append(UByteArrayAdapter & dest) {
 #if defined(SSERIALIZE_EXPENSIVE_ASSERT_ENABLED)
 	UByteArrayAdapter::OffsetType flatTrieBaseBeginOffset = dest.tellPutPtr();
 #endif
-	dest.putUint8(1); //version of FlatTrieBase
+	if (m_directorySampleRate) {
+		dest.putUint8(SSERIALIZE_STATIC_UNICODE_TRIE_FLAT_TRIE_BASE_VERSION);
+	}
+	else {
+		dest.putUint8(1); //version of FlatTrieBase without directory
+	}
 	dest.putOffset(m_stringData.size());
 	
 	std::cout << "Copying string data(" << sserialize::prettyFormatSize(m_stringData.size()) << ")..." << std::flush;
@@ -750,6 +992,16 @@ bool HashBasedFlatTrie<TValue>::append(UByteArrayAdapter & dest) {
 	}
 	tsCreator.flush();
 	pinfo.end();
+	if (m_directorySampleRate) {
+		dest.putVlPackedUint32(m_directorySampleRate);
+		count = 0;
+		for(const auto & x : m_ht) {
+			if (count % m_directorySampleRate == 0) {
+				Static::UnicodeTrie::FlatTrieBase::putDirectoryEntry(dest, m_strHandler.strBegin(x.first), x.first.size());
+			}
+			++count;
+		}
+	}
 #if defined(SSERIALIZE_EXPENSIVE_ASSERT_ENABLED)
 	{
 		UByteArrayAdapter tmp(dest);
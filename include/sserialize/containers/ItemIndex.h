@@ -17,6 +17,7 @@ namespace sserialize {
 
 class DynamicBitSet;
 class ItemIndexPrivate;
+class ItemIndexArena;
 
 /** This class is an interface for an ItemIndex which is esential a set container of uint32_t,
   * but with different implentations which are all ref-counted, but not cowed
@@ -25,6 +26,7 @@ class ItemIndexPrivate;
 
 class ItemIndex final: public RCWrapper<ItemIndexPrivate>  {
 	typedef RCWrapper<ItemIndexPrivate> MyBaseClass;
+	friend class ItemIndexArena;
 public:
 	using value_type = uint32_t;
 	enum Types {
@@ -0,0 +1,67 @@
+#ifndef SSERIALIZE_ITEM_INDEX_ARENA_H
+#define SSERIALIZE_ITEM_INDEX_ARENA_H
+#include <sserialize/utility/refcounting.h>
+#include <sserialize/containers/ItemIndex.h>
+#include <memory_resource>
+#include <iterator>
+#include <vector>
+
+namespace sserialize {
+
+/** A bump allocator for temporary ItemIndex results, usually one per query.
+  * All indexes created by the arena are ItemIndexPrivateArenaVector instances whose data and private
+  * are allocated from a monotonic buffer. Nothing is freed until the last index created by the arena and
+  * the last reference to the arena itself are gone. Then all memory is released at once.
+  *
+  * The arena is NOT thread-safe: only one thread at a time may create indexes with it.
+  * Indexes created by the arena may be used and destroyed by any thread.
+  */
+class ItemIndexArena: public RefCountObject {
+public:
+	///@param initialSize size of the first buffer in bytes
+	explicit ItemIndexArena(std::size_t initialSize = 64*1024);
+	virtual ~ItemIndexArena();
+	void * allocate(std::size_t bytes, std::size_t alignment);
+	///number of bytes handed out by allocate
+	inline std::size_t bytesAllocated() const { return m_bytesAllocated; }
+	///number of indexes created by this arena
+	inline std::size_t indexCount() const { return m_indexCount; }
+public:
+	///@param ids sorted and unique ids
+	ItemIndex create(const uint32_t * begin, const uint32_t * end);
+	///@param ids sorted and unique ids
+	ItemIndex create(const std::vector<uint32_t> & ids);
+	///@param ids sorted and unique ids
+	template<typename T_IT>
+	ItemIndex create(T_IT begin, T_IT end);
+public:
+	ItemIndex intersect(const ItemIndex & a, const ItemIndex & b);
+	ItemIndex unite(const ItemIndex & a, const ItemIndex & b);
+	ItemIndex difference(const ItemIndex & a, const ItemIndex & b);
+	ItemIndex symmetricDifference(const ItemIndex & a, const ItemIndex & b);
+private:
+	template<typename TFunc>
+	ItemIndex setOp(const ItemIndex & a, const ItemIndex & b);
+	uint32_t * allocateIds(std::size_t count);
+	ItemIndex make(const uint32_t * data, uint32_t size);
+private:
+	std::pmr::monotonic_buffer_resource m_res;
+	std::size_t m_bytesAllocated{0};
+	std::size_t m_indexCount{0};
+	//scratch space reused by the set operations
+	std::vector<uint32_t> m_first;
+	std::vector<uint32_t> m_second;
+	std::vector<uint32_t> m_result;
+};
+
+template<typename T_IT>
+ItemIndex ItemIndexArena::create(T_IT begin, T_IT end) {
+	std::size_t size = std::distance(begin, end);
+	uint32_t * data = allocateIds(size);
+	std::copy(begin, end, data);
+	return make(data, (uint32_t) size);
+}
+
+}//end namespace
+
+#endif
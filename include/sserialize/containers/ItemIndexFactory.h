@@ -13,6 +13,7 @@
 #include <sserialize/containers/ItemIndexPrivates/ItemIndexPrivates.h>
 #include <sserialize/utility/types.h>
 #include <sserialize/Static/ItemIndexStore.h>
+#include <sserialize/containers/SortedOffsetIndexPrivate.h>
 #include <sserialize/storage/pack_unpack_functions.h>
 #include <sserialize/containers/MMVector.h>
 #include <sserialize/algorithm/hashspecializations.h>
@@ -88,13 +89,17 @@ public:
 	void setCheckIndex(bool checkIndex) { m_checkIndex = checkIndex;}
 	//default is on
 	void setDeduplication(bool dedup) { m_useDeduplication  = dedup; }
+	///default is off, if on then flush() creates a version 8 store with an ItemIndexSummary for every index
+	void setSummaries(bool summaries) { m_summaries = summaries; }
+	///Encoding of the index offsets written by flush(), default is CM_REGLINE
+	void setOffsetsCreationMode(Static::SortedOffsetIndexPrivate::CreationMode mode) { m_offsetsCreationMode = mode; }
 	
 	void setGrowSize(UByteArrayAdapter::SizeType v) { m_growSize = v; }
 	
 	void recalculateDeduplicationData();
 	
 	inline UByteArrayAdapter::SizeType dataSizeById(uint32_t id) const {
-		return (id+1 < m_idToOffsets.size() ? m_idToOffsets.at(id+1) : m_idToOffsets.size()) - m_idToOffsets.at(id);
+		return (id+1 < m_idToOffsets.size() ? m_idToOffsets.at(id+1) : m_dataOffset) - m_idToOffsets.at(id);
 	}
 	inline UByteArrayAdapter indexDataById(uint32_t id) const { return sserialize::UByteArrayAdapter(m_indexStore, m_idToOffsets.at(id), dataSizeById(id)); }
 	inline ItemIndex indexById(uint32_t id) const { return ItemIndex(indexDataById(id), type(id)); }
@@ -123,6 +128,9 @@ public:
 	///BROKEN
 	static UByteArrayAdapter::OffsetType compressWithVarUint(sserialize::Static::ItemIndexStore & store, UByteArrayAdapter & dest);
 	static UByteArrayAdapter::OffsetType compressWithLZO(sserialize::Static::ItemIndexStore & store, UByteArrayAdapter & dest);
+	///Compresses runs of consecutive indexes together. Indexes are added to a group until it holds at least groupSize bytes.
+	///Indexes larger than groupSize therefore end up in a group of their own
+	static UByteArrayAdapter::OffsetType compressWithLZOGrouped(sserialize::Static::ItemIndexStore & store, UByteArrayAdapter & dest, UByteArrayAdapter::SizeType groupSize = 16*1024);
 	
 	///@return the type created if type & ItemIndex::T_MULTIPLE, ItemIndex::T_NULL if creation failed
 	template<typename TSortedContainer>
@@ -159,6 +167,8 @@ private:
 	//config
 	bool m_checkIndex;
 	bool m_useDeduplication;
+	bool m_summaries;
+	Static::SortedOffsetIndexPrivate::CreationMode m_offsetsCreationMode;
 	int m_type;
 	Static::ItemIndexStore::IndexCompressionType m_compressionType;
 	UByteArrayAdapter::SizeType m_growSize;
@@ -315,6 +325,8 @@ public:
 	virtual const UByteArrayAdapter & getData() const override;
 	virtual RCPtrWrapper<Static::HuffmanDecoder> getHuffmanTree() const override;
 	virtual UByteArrayAdapter getHuffmanTreeData() const override;
+	virtual bool hasSummaries() const override;
+	virtual ItemIndexSummary summary(uint32_t pos) const override;
 };
 
 };
@@ -57,8 +57,12 @@ public:
 };
 
 
+/** Leaf iterator of an ItemIndex. The ids are decoded sequentially with ItemIndex::const_iterator while iterating,
+  * compressed indices are therefore never fully decoded if iteration stops early.
+  */
 class ItemIndexIteratorPrivateItemIndex: public ItemIndexIteratorPrivate {
 	ItemIndex m_index;
+	ItemIndex::const_iterator m_it;
 	uint32_t m_pos;
 	uint32_t m_cur;
 public:
@@ -95,17 +99,22 @@ public:
 	ItemIndexIterator& reset();
 	///convert this ItemIndexIterator to an ItemIndex with all the ids from the current position to the end
 	ItemIndex toItemIndex() const;
+	///convert this ItemIndexIterator to an ItemIndex with at most @param maxCount ids starting at the current position
+	ItemIndex toItemIndex(uint32_t maxCount) const;
+	///number of ids from the current position to the end, evaluates the iterator without materializing the result
+	uint32_t count() const;
 
 	template<class RandomAccessIterator>
 	static ItemIndexIterator createTree(const RandomAccessIterator & begin, const RandomAccessIterator & end, ItemIndexIteratorOperatorFP fp) {
-		if (end-begin == 2) {
-			return (*fp)(*begin, *end);
+		if (end-begin == 0) {
+			return ItemIndexIterator();
 		}
 		else if (end-begin == 1) {
 			return ItemIndexIterator(*begin);
 		}
 		else {
-			return (*fp)( createTree(begin, begin + ((end-begin)/2), fp), createTree(begin + ((end-begin)/2) + 1, end, fp) );
+			RandomAccessIterator mid = begin + ((end-begin)/2);
+			return (*fp)( createTree(begin, mid, fp), createTree(mid, end, fp) );
 		}
 	}
 
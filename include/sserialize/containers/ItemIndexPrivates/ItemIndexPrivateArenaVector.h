@@ -0,0 +1,46 @@
+#ifndef SSERIALIZE_ITEM_INDEX_PRIVATE_ARENA_VECTOR_H
+#define SSERIALIZE_ITEM_INDEX_PRIVATE_ARENA_VECTOR_H
+#include <sserialize/containers/ItemIndexPrivates/ItemIndexPrivate.h>
+#include <cstddef>
+
+namespace sserialize {
+
+class ItemIndexArena;
+
+/** An in-memory index whose data and the private itself live in an ItemIndexArena.
+  * Instances can only be created with placement new on an arena: new(arena) ItemIndexPrivateArenaVector(...).
+  * Every instance holds a reference to its arena, hence it may outlive the query that created it.
+  * Deleting an instance does not free any memory, the memory is released together with the arena.
+  */
+class ItemIndexPrivateArenaVector: public ItemIndexPrivate {
+public:
+	///@param data has to be allocated in the same arena and contain size sorted ids
+	ItemIndexPrivateArenaVector(const uint32_t * data, uint32_t size);
+	virtual ~ItemIndexPrivateArenaVector();
+	virtual ItemIndex::Types type() const override;
+public:
+	static void * operator new(std::size_t size, ItemIndexArena * arena);
+	static void operator delete(void * ptr, ItemIndexArena * arena);
+	static void operator delete(void * ptr);
+public:
+	virtual uint32_t at(uint32_t pos) const override;
+	virtual uint32_t uncheckedAt(uint32_t pos) const override;
+	virtual uint32_t first() const override;
+	virtual uint32_t last() const override;
+	virtual uint32_t find(uint32_t id) const override;
+
+	virtual uint32_t size() const override;
+
+	virtual sserialize::UByteArrayAdapter::SizeType getSizeInBytes() const override;
+	virtual uint8_t bpn() const override;
+
+	virtual void putInto(DynamicBitSet & bitSet) const override;
+	virtual void putInto(uint32_t* dest) const override;
+private:
+	const uint32_t * m_data;
+	uint32_t m_size;
+};
+
+}//end namespace
+
+#endif
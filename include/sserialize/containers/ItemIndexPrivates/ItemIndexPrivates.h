@@ -4,6 +4,7 @@
 #include "ItemIndexPrivateSimple.h"
 #include "ItemIndexPrivateStlDeque.h"
 #include "ItemIndexPrivateStlVector.h"
+#include "ItemIndexPrivateArenaVector.h"
 #include "ItemIndexPrivateWAH.h"
 #include "ItemIndexPrivateDE.h"
 #include "ItemIndexPrivateRleDE.h"
@@ -0,0 +1,65 @@
+#ifndef SSERIALIZE_ITEM_INDEX_SUMMARY_H
+#define SSERIALIZE_ITEM_INDEX_SUMMARY_H
+#include <sserialize/containers/ItemIndex.h>
+#include <limits>
+#include <cstdint>
+
+namespace sserialize {
+
+/** A small summary of an ItemIndex: the first id, the last id and a 64 bit bloom signature.
+  * Bit (hash(id) % 64) of the signature is set for every id of the index.
+  * This allows to detect disjoint indexes and to estimate intersection sizes without decoding them.
+  * The empty summary has first() > last() and no signature bits.
+  */
+class ItemIndexSummary final {
+public:
+	ItemIndexSummary() : m_first(std::numeric_limits<uint32_t>::max()), m_last(0), m_signature(0) {}
+	ItemIndexSummary(uint32_t first, uint32_t last, uint64_t signature) : m_first(first), m_last(last), m_signature(signature) {}
+	///@param range as returned by range()
+	ItemIndexSummary(uint64_t range, uint64_t signature) : m_first(uint32_t(range >> 32)), m_last(uint32_t(range)), m_signature(signature) {}
+	~ItemIndexSummary() {}
+	///@param begin, end sorted ids
+	template<typename T_IT>
+	static ItemIndexSummary create(T_IT begin, T_IT end);
+	static ItemIndexSummary create(const ItemIndex & idx) { return create(idx.cbegin(), idx.cend()); }
+	static inline uint64_t signatureBit(uint32_t id) { return uint64_t(1) << ((uint64_t(id) * 0x9E3779B97F4A7C15ULL) >> 58); }
+public:
+	inline bool empty() const { return m_first > m_last; }
+	inline uint32_t first() const { return m_first; }
+	inline uint32_t last() const { return m_last; }
+	inline uint64_t signature() const { return m_signature; }
+	///first id in the upper 32 bits, last id in the lower ones
+	inline uint64_t range() const { return (uint64_t(m_first) << 32) | m_last; }
+	///@return true if the indexes are disjoint for sure
+	bool disjoint(const ItemIndexSummary & other) const;
+	/** Estimate the size of the intersection with other assuming the ids are uniformly distributed in their ranges.
+	  * @param mySize size of the index belonging to this
+	  * @param otherSize size of the index belonging to other
+	  * @return 0 if disjoint(other), otherwise an estimate which is at most min(mySize, otherSize)
+	  */
+	uint32_t estimateIntersectionSize(uint32_t mySize, const ItemIndexSummary & other, uint32_t otherSize) const;
+	bool operator==(const ItemIndexSummary & other) const;
+	bool operator!=(const ItemIndexSummary & other) const;
+private:
+	uint32_t m_first;
+	uint32_t m_last;
+	uint64_t m_signature;
+};
+
+template<typename T_IT>
+ItemIndexSummary ItemIndexSummary::create(T_IT begin, T_IT end) {
+	ItemIndexSummary ret;
+	if (begin == end) {
+		return ret;
+	}
+	ret.m_first = *begin;
+	for(; begin != end; ++begin) {
+		ret.m_last = *begin;
+		ret.m_signature |= signatureBit(ret.m_last);
+	}
+	return ret;
+}
+
+}//end namespace
+
+#endif
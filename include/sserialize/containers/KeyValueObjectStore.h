@@ -67,7 +67,8 @@ public:
 	void sort();
 	
 	///sort() has to be  called before using this!
-	UByteArrayAdapter::OffsetType serialize(sserialize::UByteArrayAdapter & dest) const;
+	///@param frontCoded store the key and value strings as Static::FrontCodedStringTable
+	UByteArrayAdapter::OffsetType serialize(sserialize::UByteArrayAdapter & dest, bool frontCoded = false) const;
 	std::pair<std::string, std::string> keyValue(uint32_t keyId, uint32_t valueId) const;
 	///@param reorderMap maps new positions to old positions
 	template<typename T_REORDER_MAP>
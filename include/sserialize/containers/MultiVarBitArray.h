@@ -51,6 +51,8 @@ public:
 	SizeType size() const;
 	UByteArrayAdapter::OffsetType getSizeInBytes() const;
 	value_type at(SizeType pos, uint32_t subPos) const;
+	void getRange(SizeType pos, SizeType count, uint32_t subPos, value_type * dest) const;
+	void getRows(SizeType pos, SizeType count, value_type * dest) const;
 	value_type set(SizeType pos, uint32_t subPos, value_type value);
 
 	const UByteArrayAdapter & data() const;
@@ -81,6 +83,10 @@ public:
 	///This is not valid if you used the second constructor with a given bitConfig
 	UByteArrayAdapter::OffsetType getSizeInBytes() const;
 	value_type at(SizeType pos, uint32_t subPos) const;
+	///Decodes field subPos of the count entries beginning at pos into dest
+	void getRange(SizeType pos, SizeType count, uint32_t subPos, value_type * dest) const;
+	///Decodes all fields of the count entries beginning at pos into dest with dest[i*bitConfigCount()+j] = at(pos+i, j)
+	void getRows(SizeType pos, SizeType count, value_type * dest) const;
 	value_type set(SizeType pos, uint32_t subPos, value_type value);
 
 	///return the data without the header
@@ -218,6 +218,10 @@ public:
 	///Adding more elements to the hash invalidates iterators iff storage container invalidates iterators on insertion
 	mapped_type & operator[](const key_type & key);
 	void insert(const key_type & key);
+	///Appends the keys [begin, end) with default constructed values and rebuilds the table once.
+	///The keys have to be pairwise distinct and must not be in the table yet.
+	template<typename T_KEY_ITERATOR>
+	void insert_unique(T_KEY_ITERATOR begin, const T_KEY_ITERATOR & end);
 	mapped_type & at(const key_type & key);
 	const mapped_type & at(const key_type & key) const;
 	inline void emplace(key_type const & key, mapped_type const & value) {
@@ -348,6 +352,23 @@ OADHashTable<TKey, TValue, THash1, THash2, TValueStorageType, TTableStorageType,
 	operator[](key);
 }
 
+template<typename TKey, typename TValue, typename THash1, typename THash2, typename TValueStorageType, typename TTableStorageType, typename TKeyEq>
+template<typename T_KEY_ITERATOR>
+void
+OADHashTable<TKey, TValue, THash1, THash2, TValueStorageType, TTableStorageType, TKeyEq>::insert_unique(T_KEY_ITERATOR begin, const T_KEY_ITERATOR & end) {
+	for(; begin != end; ++begin) {
+		m_valueStorage.push_back(value_type(*begin, mapped_type()));
+	}
+	if (size() != m_valueStorage.size()) {
+		throw std::out_of_range("OADHashTable: overflow in TableStorage pointer type. Too many elements in hash.");
+	}
+	uint64_t count = m_d.size();
+	while ((double)size()/count > m_maxLoad) {
+		count = count*m_rehashMult;
+	}
+	rehash(count);
+}
+
 template<typename TKey, typename TValue, typename THash1, typename THash2, typename TValueStorageType, typename TTableStorageType, typename TKeyEq>
 TValue &
 OADHashTable<TKey, TValue, THash1, THash2, TValueStorageType, TTableStorageType, TKeyEq>::at(const key_type & key) {
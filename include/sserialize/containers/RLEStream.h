@@ -1,6 +1,8 @@
 #ifndef SSERIALIZE_STATIC_RLE_STREAM_H
 #define SSERIALIZE_STATIC_RLE_STREAM_H
 #include <sserialize/storage/UByteArrayAdapter.h>
+#include <sserialize/utility/checks.h>
+#include <vector>
 
 namespace sserialize {
 /**
@@ -11,6 +13,18 @@ namespace sserialize {
   * 0x3 => rle
   * If rle => next codeword is signed
   *
+  * A stream may optionally have a checkpoint table in front of it, see create().
+  * It stores for every checkpointInterval-th entry the offset of its first codeword
+  * and the value of the entry before it, which enables seek() to skip to any entry in O(checkpointInterval).
+  * Such a stream has to be opened with the CheckpointsTag constructor.
+  *
+  * struct RLEStreamWithCheckpoints {
+  *   v<uint32> checkpointInterval;
+  *   v<uint32> checkpointCount;
+  *   (uint<32> offset, uint<32> value)[checkpointCount];
+  *   RLEStream stream;
+  * };
+  *
   */
 
 class RLEStream final {
@@ -19,7 +33,12 @@ private:
 	uint32_t m_curRleCount;
 	int32_t m_curRleDiff;
 	uint32_t m_curId;
+	///checkpoint table, empty if the stream has none
+	sserialize::UByteArrayAdapter m_cp;
+	uint32_t m_cpInterval;
 public:
+	struct CheckpointsTag {};
+	static constexpr uint32_t CheckpointEntrySize = 8;
 	class Creator {
 	private:
 		UByteArrayAdapter * m_dest;
@@ -42,6 +61,8 @@ public:
 	RLEStream(const RLEStream & other);
 	RLEStream(RLEStream && other);
 	RLEStream(const sserialize::UByteArrayAdapter & begin);
+	///Open a stream created by create() with checkpoints
+	RLEStream(const sserialize::UByteArrayAdapter & d, CheckpointsTag);
 	~RLEStream() {}
 	RLEStream & operator=(const RLEStream & other);
 	RLEStream & operator=(RLEStream && other);
@@ -51,8 +72,63 @@ public:
 	inline uint32_t operator*() const {
 		return m_curId;
 	}
+	inline bool hasCheckpoints() const { return m_cpInterval; }
+	inline uint32_t checkpointInterval() const { return m_cpInterval; }
+	/** Positions the stream at entry pos, i.e. operator*() returns the value of entry pos afterwards.
+	  * With checkpoints this decodes at most checkpointInterval entries,
+	  * otherwise the stream is decoded from the beginning.
+	  */
+	RLEStream & seek(uint32_t pos);
+public:
+	/** Creates a stream of the values in [begin, end) at dest.tellPutPtr()
+	  * @param checkpointInterval add a checkpoint table with a checkpoint every checkpointInterval entries,
+	  *        0 creates a plain stream without table
+	  */
+	template<typename T_ITERATOR>
+	static UByteArrayAdapter & create(T_ITERATOR begin, T_ITERATOR end, UByteArrayAdapter & dest, uint32_t checkpointInterval);
+private:
+	void reset(uint32_t value);
 };
 
+template<typename T_ITERATOR>
+UByteArrayAdapter &
+RLEStream::create(T_ITERATOR begin, T_ITERATOR end, UByteArrayAdapter & dest, uint32_t checkpointInterval) {
+	if (!checkpointInterval) {
+		Creator c(dest);
+		for(; begin != end; ++begin) {
+			c.put(*begin);
+		}
+		c.flush();
+		return dest;
+	}
+	//encode the stream first to get the offsets of the checkpoints
+	std::vector<uint8_t> streamData;
+	UByteArrayAdapter stream(&streamData, false);
+	std::vector< std::pair<uint32_t, uint32_t> > checkpoints;
+	{
+		Creator c(stream);
+		uint32_t prev = 0;
+		for(uint32_t i(0); begin != end; ++begin, ++i) {
+			if (i % checkpointInterval == 0) {
+				//runs must not cross a checkpoint
+				c.flush();
+				checkpoints.emplace_back(narrow_check<uint32_t>(stream.tellPutPtr()), prev);
+			}
+			prev = *begin;
+			c.put(prev);
+		}
+		c.flush();
+	}
+	dest.putVlPackedUint32(checkpointInterval);
+	dest.putVlPackedUint32(narrow_check<uint32_t>(checkpoints.size()));
+	for(const auto & x : checkpoints) {
+		dest.putUint32(x.first);
+		dest.putUint32(x.second);
+	}
+	dest.putData(streamData);
+	return dest;
+}
+
 }//end namespace
 
 #endif
\ No newline at end of file
@@ -11,6 +11,9 @@ namespace Static {
   * max(offset[i]) < max(uint36_t) for all i
   * offset[i+1]-offset[i] < max(uint32_t) for all i
   * You can store up to max(uint36_t) elements in it
+  *
+  * The offsets are either stored as residuals to a regression line (T_REGLINE)
+  * or Elias-Fano encoded (T_ELIAS_FANO), see SortedOffsetIndexPrivate::create()
   */
 
 class SortedOffsetIndexPrivate;
@@ -19,7 +22,7 @@ class SortedOffsetIndex: RCWrapper<SortedOffsetIndexPrivate> {
 private:
 	typedef RCWrapper<SortedOffsetIndexPrivate> MyParentClass;
 public:
-	typedef enum {T_REGLINE} Types;
+	typedef enum {T_REGLINE=0, T_ELIAS_FANO=1} Types;
 	using SizeType = sserialize::SizeType;
 public:
 	SortedOffsetIndex();
@@ -32,6 +35,7 @@ public:
 	SortedOffsetIndex & operator=(const SortedOffsetIndex & other);
 	SizeType size() const;
 	UByteArrayAdapter::OffsetType at(SizeType pos) const;
+	Types type() const;
 };
 
 template<typename T_SORTED_CONTAINER>
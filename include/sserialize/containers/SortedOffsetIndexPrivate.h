@@ -1,6 +1,8 @@
 #ifndef SSERIALIZE_SORTED_OFFSET_INDEX_PRIVATE_H
 #define SSERIALIZE_SORTED_OFFSET_INDEX_PRIVATE_H
+#include <sserialize/containers/SortedOffsetIndex.h>
 #include <sserialize/containers/CompactUintArray.h>
+#include <sserialize/storage/pack_unpack_functions.h>
 #include <sserialize/stats/statfuncs.h>
 #include <sserialize/algorithm/utilfuncs.h>
 #include <sserialize/utility/assert.h>
@@ -28,11 +30,32 @@ namespace Static {
  * if (COUNT == 1) => only Y-INTERCEPT present = id, but encoded as uint64
  * else
  *    ID = IDS(POS) + (SLOPENOM)/(COUNT-1)*POS + ((SLOPENOM % (COUNT-1))*POS)/(COUNT-1) + Y-INTERCEPT - IDOFFSET
+ *
+ * Elias-Fano:
+ * -----------------------------------------------------------------------------------------
+ * MARKER |COUNT   |LOWBITS|SAMPLEBITS|UPPERWORDS|LOWS        |SAMPLES     |UPPER
+ * -----------------------------------------------------------------------------------------
+ * v64    |v64     |uint8  |uint8     |v64       |COMPACTARRAY|COMPACTARRAY|uint64[UPPERWORDS]
+ * -----------------------------------------------------------------------------------------
+ *
+ * MARKER: the header of v4 with COUNT=0 and IDBITS=T_ELIAS_FANO, which is not used by v4
+ * LOWS: the lower LOWBITS bits of every id, not present if LOWBITS=0
+ * UPPER: bit vector with bit (ID(POS) >> LOWBITS) + POS set for every POS
+ * SAMPLES: position of every SelectSampleRate-th set bit in UPPER
+ * Calculating ids:
+ *    ID = ((select1(UPPER, POS) - POS) << LOWBITS) | LOWS(POS)
  */
 
 class SortedOffsetIndexPrivate: public sserialize::RefCountObject {
 public:
 	using SizeType = sserialize::SizeType;
+	using Types = SortedOffsetIndex::Types;
+	typedef enum {
+		CM_REGLINE=0, ///< regression line with residuals, readable by all versions
+		CM_ELIAS_FANO=1, ///< Elias-Fano encoding
+		CM_AUTO=2 ///< the smaller one of both
+	} CreationMode;
+	static constexpr uint32_t SelectSampleRate = 64;
 private:
 	static constexpr uint8_t IdBits = 6;
 	static constexpr SizeType MaxSize = sserialize::createMask64(64-IdBits);
@@ -103,17 +126,32 @@ public:
 	SortedOffsetIndexPrivate(const UByteArrayAdapter & data);
 	virtual ~SortedOffsetIndexPrivate();
 	virtual UByteArrayAdapter::OffsetType getSizeInBytes() const;
-	SizeType size() const;
-	UByteArrayAdapter::OffsetType at(SizeType pos) const;
+	virtual SizeType size() const;
+	virtual UByteArrayAdapter::OffsetType at(SizeType pos) const;
+	virtual Types type() const;
+public:
+	///true if data holds an Elias-Fano encoded index
+	static bool isEliasFano(const UByteArrayAdapter & data);
+	///Storage size of an Elias-Fano encoded index of count offsets with the largest being maxValue
+	static UByteArrayAdapter::OffsetType eliasFanoStorageSize(SizeType count, uint64_t maxValue);
+	
+	///Append an Elias-Fano encoded SortedOffsetIndexPrivate with at least 2 entries at dest
+	template<typename TSortedContainer>
+	static bool createEliasFano(const TSortedContainer & src, sserialize::UByteArrayAdapter & destination);
 	
 	///Append a SortedOffsetIndexPrivate at dest
+	///@param mode the encoding, indices with less than 2 entries always use the regression line encoding
 	template<typename TSortedContainer>
-	static bool create(const TSortedContainer & src, sserialize::UByteArrayAdapter & destination) {
+	static bool create(const TSortedContainer & src, sserialize::UByteArrayAdapter & destination, CreationMode mode = CM_REGLINE) {
 		SSERIALIZE_EXPENSIVE_ASSERT(std::is_sorted(src.cbegin(), src.cend()));
 		
 		if (src.size() > MaxSize) {
 			throw sserialize::OutOfBoundsException("sserialize::SortedOffsetIndex::create: too many entries in src");
 		}
+		
+		if (src.size() > 1 && mode == CM_ELIAS_FANO) {
+			return createEliasFano(src, destination);
+		}
 	
 		if (src.size() > 1) {
 			uint64_t slopenom = 0;
@@ -131,6 +169,15 @@ public:
 				yintercept = 0;
 				idOffset = 0;
 			}
+			
+			if (mode == CM_AUTO) {
+				UByteArrayAdapter::OffsetType reglineSize = psize_vu64((static_cast<uint64_t>(src.size()) << IdBits) | (bitsForIds-1));
+				reglineSize += psize_vs64(yintercept) + psize_vu64(slopenom) + psize_vu64(idOffset);
+				reglineSize += CompactUintArray::minStorageBytes(bitsForIds, src.size());
+				if (eliasFanoStorageSize(src.size(), *src.rbegin()) < reglineSize) {
+					return createEliasFano(src, destination);
+				}
+			}
 
 			uint64_t countTypeHeader = static_cast<uint64_t>(src.size()) << IdBits;
 			countTypeHeader |= (bitsForIds-1);
@@ -174,6 +221,78 @@ public:
 	}
 };
 
+class SortedOffsetIndexPrivateEliasFano: public SortedOffsetIndexPrivate {
+public:
+	SortedOffsetIndexPrivateEliasFano(const UByteArrayAdapter & data);
+	virtual ~SortedOffsetIndexPrivateEliasFano();
+	virtual UByteArrayAdapter::OffsetType getSizeInBytes() const override;
+	virtual SizeType size() const override;
+	virtual UByteArrayAdapter::OffsetType at(SizeType pos) const override;
+	virtual Types type() const override;
+public:
+	///number of lower bits stored verbatim for count offsets with the largest being maxValue
+	static uint8_t lowBits(SizeType count, uint64_t maxValue);
+private:
+	///position of the pos-th set bit in m_upper
+	uint64_t select1(SizeType pos) const;
+private:
+	SizeType m_size;
+	uint8_t m_lowBits;
+	UByteArrayAdapter::OffsetType m_headerSize;
+	CompactUintArray m_lows;
+	CompactUintArray m_samples;
+	SizeType m_sampleCount;
+	UByteArrayAdapter m_upper;
+};
+
+template<typename TSortedContainer>
+bool SortedOffsetIndexPrivate::createEliasFano(const TSortedContainer & src, sserialize::UByteArrayAdapter & destination) {
+	SSERIALIZE_CHEAP_ASSERT_LARGER(src.size(), SizeType(1));
+	SizeType count = narrow_check<SizeType>(src.size());
+	uint64_t maxValue = *src.rbegin();
+	uint8_t lowBits = SortedOffsetIndexPrivateEliasFano::lowBits(count, maxValue);
+	uint64_t upperBitCount = (maxValue >> lowBits) + count;
+	uint64_t upperWordCount = upperBitCount/64 + 1;
+	uint8_t sampleBits = (uint8_t) CompactUintArray::minStorageBits(upperBitCount);
+	SizeType sampleCount = (count+SelectSampleRate-1)/SelectSampleRate;
+	
+	destination.putVlPackedUint64(SortedOffsetIndex::T_ELIAS_FANO);
+	destination.putVlPackedUint64(count);
+	destination.putUint8(lowBits);
+	destination.putUint8(sampleBits);
+	destination.putVlPackedUint64(upperWordCount);
+	
+	UByteArrayAdapter::OffsetType lowsStorageNeed = (lowBits ? CompactUintArray::minStorageBytes(lowBits, count) : 0);
+	UByteArrayAdapter::OffsetType samplesStorageNeed = CompactUintArray::minStorageBytes(sampleBits, sampleCount);
+	destination.growStorage(lowsStorageNeed + samplesStorageNeed + upperWordCount*SerializationInfo<uint64_t>::length);
+	CompactUintArray lows;
+	if (lowBits) {
+		lows = CompactUintArray(destination+destination.tellPutPtr(), lowBits);
+		destination.incPutPtr(lowsStorageNeed);
+	}
+	CompactUintArray samples(destination+destination.tellPutPtr(), sampleBits);
+	destination.incPutPtr(samplesStorageNeed);
+	
+	std::vector<uint64_t> upper(upperWordCount, 0);
+	uint64_t lowMask = createMask64(lowBits);
+	SizeType pos = 0;
+	for(auto it(src.begin()), end(src.end()); it != end; ++it, ++pos) {
+		uint64_t value = *it;
+		uint64_t bit = (value >> lowBits) + pos;
+		upper[bit/64] |= static_cast<uint64_t>(1) << (bit%64);
+		if (lowBits) {
+			lows.set64(pos, value & lowMask);
+		}
+		if (pos % SelectSampleRate == 0) {
+			samples.set64(pos/SelectSampleRate, bit);
+		}
+	}
+	for(uint64_t word : upper) {
+		destination.putUint64(word);
+	}
+	return true;
+}
+
 class SortedOffsetIndexPrivateEmpty: public SortedOffsetIndexPrivate {
 public:
 	SortedOffsetIndexPrivateEmpty();
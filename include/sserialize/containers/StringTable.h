@@ -9,6 +9,8 @@
 #include <sserialize/utility/exceptions.h>
 #include <sserialize/strings/stringfunctions.h>
 #include <sserialize/Static/Array.h>
+#include <sserialize/Static/FrontCodedStringTable.h>
+#include <sserialize/iterator/TransformIterator.h>
 #include <sserialize/algorithm/hashspecializations.h>
 
 namespace sserialize {
@@ -187,6 +189,17 @@ public:
 		return dest;
 	};
 	
+	///Same as serialize() but creates a Static::FrontCodedStringTable
+	inline UByteArrayAdapter serializeFrontCoded(UByteArrayAdapter & dest, uint32_t blockSize = sserialize::Static::FrontCodedStringTable::DefaultBlockSize) const {
+		if (!std::is_sorted(m_strings.begin(), m_strings.end(), MySmaller(&m_strData))) {
+			throw sserialize::CreationException("StringTable is not sorted");
+		}
+		auto toString = [this](const StaticString & str) { return std::string(cbegin(str), cend(str)); };
+		typedef sserialize::TransformIterator<decltype(toString), std::string, std::vector<StaticString>::const_iterator> MyIterator;
+		sserialize::Static::FrontCodedStringTable::create(MyIterator(toString, m_strings.cbegin()), MyIterator(toString, m_strings.cend()), dest, blockSize);
+		return dest;
+	}
+	
 	void swap(StringTable & other) {
 		using std::swap;
 		swap(m_map, other.m_map);
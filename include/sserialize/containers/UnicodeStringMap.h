@@ -2,6 +2,8 @@
 #define SSERIALIZE_UNICODE_STRING_MAP_H
 #include <sserialize/utility/refcounting.h>
 #include <sserialize/utility/exceptions.h>
+#include <sserialize/strings/LevenshteinAutomaton.h>
+#include <vector>
 
 namespace sserialize {
 namespace detail {
@@ -14,6 +16,23 @@ public:
 	virtual TValue at(const std::string & str, bool prefixMatch) const = 0;
 	virtual bool count(const std::string::const_iterator & strBegin, const std::string::const_iterator & strEnd, bool prefixMatch) const = 0;
 	virtual bool count(const std::string & str, bool prefixMatch) const = 0;
+	/** Batched lookup of @param strs, sets values[i] to the value of strs[i] if found[i] is true.
+	  * Implementations may reuse work between consecutive strings, hence sorted input is usually faster.
+	  */
+	virtual void findMany(const std::vector<std::string> & strs, bool prefixMatch, std::vector<TValue> & values, std::vector<bool> & found) const {
+		values.resize(strs.size());
+		found.resize(strs.size());
+		for(std::size_t i(0), s(strs.size()); i < s; ++i) {
+			found[i] = count(strs[i], prefixMatch);
+			if (found[i]) {
+				values[i] = at(strs[i], prefixMatch);
+			}
+		}
+	}
+	///Sets @param values to the values of all strings matching @param la and @param distances to their edit distances
+	virtual void fuzzyFind(const LevenshteinAutomaton & /*la*/, bool /*prefixMatch*/, std::vector<TValue> & /*values*/, std::vector<uint32_t> & /*distances*/) const {
+		throw sserialize::UnsupportedFeatureException("sserialize::UnicodeStringMap::fuzzyFind: " + getName());
+	}
 	virtual std::ostream & printStats(std::ostream & out) const = 0;
 	virtual std::string getName() const = 0;
 };
@@ -33,6 +52,10 @@ public:
 	virtual bool count(const std::string & /*str*/, bool /*prefixMatch*/) const override {
 		return false;
 	}
+	virtual void fuzzyFind(const LevenshteinAutomaton & /*la*/, bool /*prefixMatch*/, std::vector<TValue> & values, std::vector<uint32_t> & distances) const override {
+		values.clear();
+		distances.clear();
+	}
 	virtual std::ostream & printStats(std::ostream & out) const override {
 		return out << "sserialize::UnicodeStringMap: Empty string map" << std::endl;
 	}
@@ -60,6 +83,12 @@ public:
 	TValue at(const std::string & str, bool prefixMatch) const { return priv()->at(str, prefixMatch); }
 	bool count(const std::string::const_iterator & strBegin, const std::string::const_iterator & strEnd, bool prefixMatch) const { return priv()->count(strBegin, strEnd, prefixMatch); }
 	bool count(const std::string & str, bool prefixMatch) const { return priv()->count(str, prefixMatch); }
+	void findMany(const std::vector<std::string> & strs, bool prefixMatch, std::vector<TValue> & values, std::vector<bool> & found) const {
+		priv()->findMany(strs, prefixMatch, values, found);
+	}
+	void fuzzyFind(const LevenshteinAutomaton & la, bool prefixMatch, std::vector<TValue> & values, std::vector<uint32_t> & distances) const {
+		priv()->fuzzyFind(la, prefixMatch, values, distances);
+	}
 	std::ostream & printStats(std::ostream & out) const { return priv()->printStats(out); }
 	std::string getName() const { return priv()->getName(); }
 
@@ -100,6 +100,10 @@ public:
 	MultiBitIterator & operator+=(uint32_t bitCount);
 	void reset();
 	bool hasNext() const;
+	///number of bits from the current position to the end of the data
+	inline UByteArrayAdapter::OffsetType remainingBits() const {
+		return (m_data.size() - m_data.tellGetPtr())*8 - m_bitOffset;
+	}
 	UByteArrayAdapter::OffsetType dataSize() const { return m_data.size(); }
 };
 
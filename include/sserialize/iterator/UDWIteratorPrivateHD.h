@@ -3,12 +3,20 @@
 #include <sserialize/iterator/UDWIterator.h>
 #include <sserialize/iterator/MultiBitIterator.h>
 #include <sserialize/Static/HuffmanDecoder.h>
+#include <array>
 
 namespace sserialize {
 
+///Decodes the words in blocks of BufferSize with HuffmanDecoder's bulk decoding
 class UDWIteratorPrivateHD: public UDWIteratorPrivate {
+	static constexpr uint32_t BufferSize = 32;
 	MultiBitIterator m_bitIterator;
 	RCPtrWrapper<Static::HuffmanDecoder> m_decoder;
+	std::array<uint32_t, BufferSize> m_buffer;
+	uint32_t m_bufferPos;
+	uint32_t m_bufferSize;
+private:
+	UDWIteratorPrivateHD(const UDWIteratorPrivateHD & other) = default;
 public:
 	UDWIteratorPrivateHD();
 	UDWIteratorPrivateHD(const MultiBitIterator & bitIterator, const RCPtrWrapper<Static::HuffmanDecoder> & decoder);
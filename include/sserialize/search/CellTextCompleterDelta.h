@@ -0,0 +1,124 @@
+#ifndef SSERIALIZE_SEARCH_CELL_TEXT_COMPLETER_DELTA_H
+#define SSERIALIZE_SEARCH_CELL_TEXT_COMPLETER_DELTA_H
+#include <sserialize/spatial/CellQueryResult.h>
+#include <sserialize/search/StringCompleter.h>
+#include <sserialize/strings/unicode_case_functions.h>
+#include <sserialize/storage/UByteArrayAdapter.h>
+#include <map>
+#include <set>
+#include <vector>
+#include <string>
+
+#define SSERIALIZE_CELL_TEXT_COMPLETER_DELTA_VERSION 1
+
+namespace sserialize {
+
+/** Overlay of item changes on top of a build-once text search index like Static::CellTextCompleter.
+  * A delta holds the new state of every added, changed or removed item.
+  * Query results of the base index are patched at query time by apply():
+  * touched items are removed from the cells they had in the base and re-added to their new cells if their new strings match the query.
+  * Only the cells touched by the delta are materialized, all other cells of the base result are passed through unchanged.
+  *
+  * The strings of an item follow OOMSACTCCreator: exactStrings are searchable by exact and prefix queries,
+  * suffixStrings by suffix and substring queries. They have to be normalized the same way as those of the base index.
+  *
+  * Deltas are small and loaded into memory completely. The strings of all items are kept in a sorted index,
+  * so a query only visits the items it matches instead of testing every item of the delta.
+  * Consecutive deltas can be folded with merge().
+  * A new base has to be created with the regular creation pipeline from the updated data, touchedItems() tells which items changed.
+  *
+  * File format
+  *
+  * struct CellTextCompleterDelta {
+  *   uint<8> version(1);
+  *   vuint<32> itemCount;
+  *   Item items[itemCount]; //sorted by itemId
+  * };
+  *
+  * struct Item {
+  *   vuint<32> itemId;
+  *   vuint<32> baseCellCount;
+  *   vuint<32> baseCells[baseCellCount];
+  *   vuint<32> cellCount; //0 if the item was removed
+  *   vuint<32> cells[cellCount];
+  *   vuint<32> exactStringCount;
+  *   string exactStrings[exactStringCount];
+  *   vuint<32> suffixStringCount;
+  *   string suffixStrings[suffixStringCount];
+  * };
+  */
+class CellTextCompleterDelta final {
+public:
+	using itemid_type = uint32_t;
+	using cellid_type = uint32_t;
+	struct Item {
+		///cells of the item in the base index, empty for new items
+		std::vector<cellid_type> baseCells;
+		///cells of the item after the update, empty if the item was removed
+		std::vector<cellid_type> cells;
+		std::vector<std::string> exactStrings;
+		std::vector<std::string> suffixStrings;
+		inline bool removed() const { return cells.empty(); }
+	};
+	typedef std::map<itemid_type, Item> ItemContainer;
+private:
+	///sorted (string, itemId) pairs
+	typedef std::set< std::pair<std::string, itemid_type> > StringIndex;
+private:
+	ItemContainer m_items;
+	///exactStrings of all items that were not removed
+	StringIndex m_exactStrings;
+	///every suffix of the suffixStrings of all items that were not removed, like in the base index
+	StringIndex m_suffixes;
+	///number of items per cell of the base index
+	std::map<cellid_type, uint32_t> m_baseCells;
+private:
+	void addToIndex(itemid_type itemId, const Item & item);
+	void removeFromIndex(itemid_type itemId, const Item & item);
+	///appends the ids of all items matching (@param qstr, @param qt) to @param dest, may contain duplicates
+	void matchingItems(const std::string & qstr, sserialize::StringCompleter::QuerryType qt, std::vector<itemid_type> & dest) const;
+public:
+	CellTextCompleterDelta();
+	///Reads a delta created by operator<<
+	CellTextCompleterDelta(const UByteArrayAdapter & d);
+	~CellTextCompleterDelta();
+	inline std::size_t size() const { return m_items.size(); }
+	inline const ItemContainer & items() const { return m_items; }
+	///ids of all added, changed or removed items in ascending order
+	std::vector<itemid_type> touchedItems() const;
+
+	///Adds item @param itemId that is not part of the base index
+	void insert(itemid_type itemId, std::vector<cellid_type> cells, std::vector<std::string> exactStrings, std::vector<std::string> suffixStrings);
+	///Replaces item @param itemId which is in @param baseCells in the base index
+	void update(itemid_type itemId, std::vector<cellid_type> baseCells, std::vector<cellid_type> cells, std::vector<std::string> exactStrings, std::vector<std::string> suffixStrings);
+	///Removes item @param itemId which is in @param baseCells in the base index
+	void remove(itemid_type itemId, std::vector<cellid_type> baseCells);
+
+	/** Folds @param newer into this delta, changes of @param newer take precedence.
+	  * @param newer has to refer to the base patched by this delta, the result then refers to the base of this delta.
+	  * Hence the base cells of items present in both are taken from this delta.
+	  */
+	void merge(const CellTextCompleterDelta & newer);
+
+	/** Patches @param base, the result of the query (@param qstr, @param qt) on the base index.
+	  * @param qstr has to be normalized like the query string of the base index (e.g. lower case if it is case insensitive).
+	  * QT_FUZZY is supported with LevenshteinAutomaton::defaultMaxDistance().
+	  */
+	sserialize::CellQueryResult apply(const sserialize::CellQueryResult & base, const std::string & qstr, sserialize::StringCompleter::QuerryType qt) const;
+
+	///Completes (@param qstr, @param qt) with @param base (e.g. a Static::CellTextCompleter) and patches the result
+	template<typename T_COMPLETER>
+	sserialize::CellQueryResult complete(const T_COMPLETER & base, const std::string & qstr, sserialize::StringCompleter::QuerryType qt) const {
+		sserialize::CellQueryResult cqr = base.template complete<sserialize::CellQueryResult>(qstr, qt);
+		if (base.getSupportedQuerries() & sserialize::StringCompleter::SQ_CASE_INSENSITIVE) {
+			return apply(cqr, sserialize::unicode_to_lower(qstr), qt);
+		}
+		return apply(cqr, qstr, qt);
+	}
+};
+
+UByteArrayAdapter & operator<<(UByteArrayAdapter & dest, const CellTextCompleterDelta & src);
+
+}//end namespace
+
+#endif
@@ -173,6 +173,8 @@ struct is_trivially_copyable< detail::OOMCTCValuesCreator::ValueEntry<TNodeIdent
   *     template<typename TInputIterator>
   *     indexid_type operator()(TInputIterator begin, TInputIterator end);
   *   };
+  *   ///write a checkpoint table every checkpointInterval() ptrs into the ptr stream of a node, 0 for none
+  *   uint32_t checkpointInterval() const;
   * };
   */
 
@@ -469,12 +471,14 @@ void OOMCTCValuesCreator<TBaseTraits>::append(TOutputTraits otraits)
 		std::vector<cellid_type> fmCellIds;
 		std::vector<cellid_type> pmCellIds;
 		std::vector<indexid_type> pmCellIdxPtrs;
+		std::vector<indexid_type> ptrs;
 		sserialize::UByteArrayAdapter sd;
 		SingleEntryState() : sd(sserialize::UByteArrayAdapter::createCache(0, sserialize::MM_PROGRAM_MEMORY)) {}
 		void clear() {
 			fmCellIds.clear();
 			pmCellIds.clear();
 			pmCellIdxPtrs.clear();
+			ptrs.clear();
 			sd.resize(0);
 		}
 	};
@@ -539,7 +543,8 @@ void OOMCTCValuesCreator<TBaseTraits>::append(TOutputTraits otraits)
 		Worker(State * s, OutputTraits & otraits) :
 		state(s),
 		ifo(otraits.indexFactoryOut()),
-		dout(otraits.dataOut())
+		dout(otraits.dataOut()),
+		checkpointInterval(otraits.checkpointInterval())
 		{}
 		void operator()() {
 			std::unique_lock<std::mutex> lock(state->wqLock, std::defer_lock);
@@ -597,13 +602,21 @@ void OOMCTCValuesCreator<TBaseTraits>::append(TOutputTraits otraits)
 			//serialize the data
 			indexid_type fmIdxPtr = ifo(ses.fmCellIds.begin(), ses.fmCellIds.end());
 			indexid_type pmIdxPtr = ifo(ses.pmCellIds.begin(), ses.pmCellIds.end());
-			sserialize::RLEStream::Creator rlc(ses.sd);
-			rlc.put(fmIdxPtr);
-			rlc.put(pmIdxPtr);
-			for(auto x : ses.pmCellIdxPtrs) {
-				rlc.put(x);
+			if (checkpointInterval) {
+				ses.ptrs.push_back(fmIdxPtr);
+				ses.ptrs.push_back(pmIdxPtr);
+				ses.ptrs.insert(ses.ptrs.end(), ses.pmCellIdxPtrs.begin(), ses.pmCellIdxPtrs.end());
+				sserialize::RLEStream::create(ses.ptrs.begin(), ses.ptrs.end(), ses.sd, checkpointInterval);
+			}
+			else {
+				sserialize::RLEStream::Creator rlc(ses.sd);
+				rlc.put(fmIdxPtr);
+				rlc.put(pmIdxPtr);
+				for(auto x : ses.pmCellIdxPtrs) {
+					rlc.put(x);
+				}
+				rlc.flush();
 			}
-			rlc.flush();
 			dout(ni, ses.sd);
 			ses.clear();
 		}
@@ -612,6 +625,7 @@ void OOMCTCValuesCreator<TBaseTraits>::append(TOutputTraits otraits)
 		State * state;
 		IndexFactoryOut ifo;
 		DataOut dout;
+		uint32_t checkpointInterval;
 		SingleEntryState ses;
 		BlockDescription bd;
 	};
@@ -342,6 +342,8 @@ public:
 		typedef sserialize::Static::ArrayCreator<sserialize::UByteArrayAdapter> PayloadCreator;
 	private:
 		PayloadCreator * m_payloadCreator;
+		///additional flags of the types byte, Payload::CheckpointsFlag if the ptr streams have checkpoints
+		uint32_t m_typesFlags;
 		trie_nodeid_type m_curNodeId;
 		uint32_t m_curTypes;
 		sserialize::UByteArrayAdapter m_curData;
@@ -357,7 +359,7 @@ public:
 				}
 				m_payloadCreator->beginRawPut();
 				
-				m_payloadCreator->rawPut().putUint8(m_curTypes);
+				m_payloadCreator->rawPut().putUint8(m_curTypes | m_typesFlags);
 				for(std::size_t i(1), s(m_curOffsets.size()); i < s; ++i) {
 					m_payloadCreator->rawPut().putVlPackedUint32( narrow_check<uint32_t>(m_curOffsets[i]-m_curOffsets[i-1]) );
 				}
@@ -372,8 +374,8 @@ public:
 			}
 		}
 	public:
-		FinalDataOut(PayloadCreator * pc) :
-		m_payloadCreator(pc), m_curNodeId(0), m_curTypes(sserialize::StringCompleter::QT_NONE),
+		FinalDataOut(PayloadCreator * pc, uint32_t typesFlags) :
+		m_payloadCreator(pc), m_typesFlags(typesFlags), m_curNodeId(0), m_curTypes(sserialize::StringCompleter::QT_NONE),
 		m_curData(sserialize::UByteArrayAdapter::createCache(1, sserialize::MM_PROGRAM_MEMORY))
 		{}
 		void operator()(const NodeIdentifier & ni, const sserialize::UByteArrayAdapter & data) {
@@ -397,7 +399,7 @@ public:
 	private:
 		typedef sserialize::Static::DynamicVector<sserialize::UByteArrayAdapter> TemporaryPayloadStorage;
 	public:
-		UnorderedDataOutPrivate(FinalDataOut::PayloadCreator * pc) : m_tempStore(1024, 10*1024*1024), m_do(pc) {}
+		UnorderedDataOutPrivate(FinalDataOut::PayloadCreator * pc, uint32_t typesFlags) : m_tempStore(1024, 10*1024*1024), m_do(pc, typesFlags) {}
 		UnorderedDataOutPrivate(const UnorderedDataOutPrivate&) = delete;
 		~UnorderedDataOutPrivate() {
 			flush();
@@ -455,15 +457,18 @@ private:
 	sserialize::MmappedMemoryType m_mmt;
 	std::size_t m_sortConcurrency;
 	std::size_t m_payloadConcurrency;
+	uint32_t m_checkpointInterval;
 public:
-	OutputTraits(ItemIndexFactory * idxFactory, PayloadCreator * payloadCreator, uint64_t maxMemoryUsage, MmappedMemoryType mmt, std::size_t sortConcurrency = 0, std::size_t payloadConcurrency = 0) :
+	///@param checkpointInterval add a checkpoint table to the ptr streams of the payload, 0 for none
+	OutputTraits(ItemIndexFactory * idxFactory, PayloadCreator * payloadCreator, uint64_t maxMemoryUsage, MmappedMemoryType mmt, std::size_t sortConcurrency = 0, std::size_t payloadConcurrency = 0, uint32_t checkpointInterval = 0) :
 	m_idxFactory(idxFactory),
 	m_payloadCreator(payloadCreator),
-	m_dataOut(sserialize::RCPtrWrapper<UnorderedDataOutPrivate>( new UnorderedDataOutPrivate(m_payloadCreator) ) ),
+	m_dataOut(sserialize::RCPtrWrapper<UnorderedDataOutPrivate>( new UnorderedDataOutPrivate(m_payloadCreator, checkpointInterval ? sserialize::Static::detail::CellTextCompleter::Payload::CheckpointsFlag : 0) ) ),
 	m_maxMemoryUsage(maxMemoryUsage),
 	m_mmt(mmt),
 	m_sortConcurrency(sortConcurrency),
-	m_payloadConcurrency(payloadConcurrency)
+	m_payloadConcurrency(payloadConcurrency),
+	m_checkpointInterval(checkpointInterval)
 	{}
 	OutputTraits(const OutputTraits &) = default;
 	OutputTraits(OutputTraits &&) = default;
@@ -478,6 +483,7 @@ public:
 	inline sserialize::MmappedMemoryType mmt() const { return m_mmt; }
 	inline std::size_t sortConcurrency() const { return m_sortConcurrency; }
 	inline std::size_t payloadConcurrency() const { return m_payloadConcurrency; }
+	inline uint32_t checkpointInterval() const { return m_checkpointInterval; }
 public:
 	///Flushes the payload, invalidates data out
 	void flushPayload() {
@@ -589,6 +595,7 @@ struct Worker {
 
 }}//end namespace detail::OOMSACTCCreator
 
+///@param checkpointInterval write the ptr streams of the payloads with a checkpoint table, see sserialize::RLEStream::create()
 template<typename TItemIterator, typename TRegionIterator, typename TItemTraits, typename TRegionTraits, bool TWithProgressInfo = true>
 void appendSACTC(TItemIterator itemsBegin, TItemIterator itemsEnd,
 				 TRegionIterator regionsBegin, TRegionIterator regionsEnd, 
@@ -600,7 +607,8 @@ void appendSACTC(TItemIterator itemsBegin, TItemIterator itemsEnd,
 				 MmappedMemoryType tmpFileType,
 				 sserialize::StringCompleter::SupportedQuerries sq,
 				 sserialize::ItemIndexFactory & idxFactory, 
-				 sserialize::UByteArrayAdapter & dest)
+				 sserialize::UByteArrayAdapter & dest,
+				 uint32_t checkpointInterval = 0)
 {
 	typedef detail::OOMSACTCCreator::BaseTraits BaseTraits;
 	typedef TItemTraits ItemTraits;
@@ -730,7 +738,7 @@ void appendSACTC(TItemIterator itemsBegin, TItemIterator itemsEnd,
 	{
 		dest.putUint8(1); //version of sserialize::Static::UnicodeTrie::FlatTrie
 		sserialize::Static::ArrayCreator<sserialize::UByteArrayAdapter> pc(dest);
-		OutputTraits outPutTraits(&idxFactory, &pc, maxMemoryUsage, tmpFileType, sortConcurrency, payloadConcurrency);
+		OutputTraits outPutTraits(&idxFactory, &pc, maxMemoryUsage, tmpFileType, sortConcurrency, payloadConcurrency, checkpointInterval);
 		vc.append<OutputTraits, TWithProgressInfo>(outPutTraits);
 		outPutTraits.flushPayload();
 		pc.flush();
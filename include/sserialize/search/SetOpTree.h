@@ -83,6 +83,7 @@ public:
 	void setMinStrLen(uint32_t size);
 	
 	void buildTree(const std::string & queryString);
+	///Lazy evaluation of the tree built by buildTree() with the partialComplete() iterators of its leaves
 	ItemIndexIterator asItemIndexIterator();
 	ItemIndex update(const std::string& queryString);
 	void doCompletions();
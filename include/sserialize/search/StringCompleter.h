@@ -42,8 +42,9 @@ class StringCompleter: public RCWrapper<StringCompleterPrivate> {
 public:
 	typedef RCWrapper<StringCompleterPrivate> MyBaseClass;
 	///QuerryType, can be used in conjunction with SupportedQuerries (they are the same)
+	///QT_FUZZY can be combined with the other types to tolerate a bounded number of edits, see LevenshteinAutomaton
 	enum QuerryType {
-		QT_NONE=0, QT_EXACT=1, QT_PREFIX=2, QT_SUFFIX=4, QT_SUBSTRING=8, QT_EPSS=15, QT_CASE_INSENSITIVE=16, QT_CASE_SENSTIVE=32
+		QT_NONE=0, QT_EXACT=1, QT_PREFIX=2, QT_SUFFIX=4, QT_SUBSTRING=8, QT_EPSS=15, QT_CASE_INSENSITIVE=16, QT_CASE_SENSTIVE=32, QT_FUZZY=64
 	};
 	
 	enum SupportedQuerries {
@@ -78,6 +79,9 @@ public:
 	bool supportsQuerry(QuerryType qt);
 
 	ItemIndex complete(const std::string & str, QuerryType qtype);
+	/** Lazy variant of complete(): the result is pulled id by id through the leaf indices and set operations of the completer.
+	  * Use ItemIndexIterator::toItemIndex(maxCount) or ItemIndexIterator::count() if only the first results or the result size are needed.
+	  */
 	ItemIndexIterator partialComplete(const std::string & str, QuerryType qtype);
 	
 	ForwardIterator forwardIterator() const;
@@ -7,6 +7,8 @@
 
 namespace sserialize {
 
+class ItemIndexArena;
+
 namespace detail {
 	class CellQueryResult;
 }
@@ -118,6 +120,13 @@ public:
 	const CellInfo & cellInfo() const;
 	const ItemIndexStore & idxStore() const;
 	int flags() const;
+	const RCPtrWrapper<ItemIndexArena> & arena() const;
+	/** Set operations on this result and on results derived from it allocate
+	  * the indexes of partial matched cells in the given arena.
+	  * This is shared by all copies of this result.
+	  * Since the arena is not thread-safe, these results should only be used by a single thread.
+	  */
+	void setArena(const RCPtrWrapper<ItemIndexArena> & arena);
 	
 	uint32_t cellCount() const;
 	bool hasHits() const;
@@ -2,6 +2,7 @@
 #define SSERIALIZE_CELL_QUERY_RESULT_PRIVATE_H
 #include <sserialize/Static/ItemIndexStore.h>
 #include <sserialize/spatial/CellQueryResult.h>
+#include <sserialize/containers/ItemIndexArena.h>
 #include <memory>
 #include <string.h>
 
@@ -45,10 +46,16 @@ private:
 	int m_flags;
 	std::vector<CellDesc> m_desc;
 	IndexDesc * m_idx;
+	///if set then results of partial matched cells in set operations are allocated in this arena
+	RCPtrWrapper<ItemIndexArena> m_arena;
 private:
 	void uncheckedSet(uint32_t pos, const sserialize::ItemIndex & idx);
 	void uncheckedSet(uint32_t pos, sserialize::ItemIndex && idx);
 	static bool flagCheck(int first, int second);
+	///the arena of this, or the one of other if this has none
+	const RCPtrWrapper<ItemIndexArena> & resultArena(const CellQueryResult * other) const;
+	///true if both cells are partial matches stored in the index store whose summaries show that they are disjoint
+	bool disjointPartials(uint32_t myPos, const CellQueryResult & other, uint32_t otherPos) const;
 public:
 	CellQueryResult();
 	CellQueryResult(const CellInfo & ci, const ItemIndexStore & idxStore, int flags);
@@ -65,6 +72,8 @@ public:
 	inline const CellInfo & cellInfo() const { return m_ci; }
 	inline const ItemIndexStore & idxStore() const { return m_idxStore; }
 	inline int flags() const { return m_flags; }
+	inline const RCPtrWrapper<ItemIndexArena> & arena() const { return m_arena; }
+	inline void setArena(const RCPtrWrapper<ItemIndexArena> & arena) { m_arena = arena; }
 	int defaultIndexTypes() const { return m_idxStore.indexTypes(); }
 	uint32_t idxSize(uint32_t pos) const;
 	///this is thread-safe for different pos
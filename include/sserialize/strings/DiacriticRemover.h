@@ -3,10 +3,16 @@
 #ifndef __ANDROID__
 #include <unicode/translit.h>
 #endif
+#include <string>
 
 namespace sserialize {
 
 #ifndef __ANDROID__
+/** Removes diacritics with the transliteration "NFD; [:Nonspacing Mark:] Remove; NFC;".
+  * Most strings are handled by the precomputed table of unicode_fold(),
+  * the ICU transliterator is only used for strings the table can not handle.
+  * If the table was created from a different ICU major version than the one sserialize is built with, all strings use the transliterator.
+  */
 class DiacriticRemover {
 public:
 	typedef UErrorCode ErrorCodeType;
@@ -21,6 +27,8 @@ public:
 
 	void transliterate(std::string & str) const;
 	std::string operator()(const std::string & str) const;
+	///Removes diacritics and converts to lower case in a single pass, same as unicode_to_lower((*this)(str))
+	std::string fold(const std::string & str) const;
 	static bool isFailure(ErrorCodeType error) { return U_FAILURE(error); }
 	static std::string errorName(ErrorCodeType error) { return std::string(u_errorName(error)); }
 
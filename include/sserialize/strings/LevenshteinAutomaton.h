@@ -0,0 +1,48 @@
+#ifndef SSERIALIZE_LEVENSHTEIN_AUTOMATON_H
+#define SSERIALIZE_LEVENSHTEIN_AUTOMATON_H
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace sserialize {
+
+/** Levenshtein automaton accepting all strings within a bounded edit distance of a query string.
+  * The automaton is simulated by the rows of the dynamic programming matrix over the code points of the query.
+  * A State holds the edit distance of every prefix of the query to the input consumed so far,
+  * distances larger than maxDistance() are clamped to maxDistance()+1.
+  * Intersecting it with a trie amounts to a depth-first traversal that calls step() for every code point
+  * and prunes subtrees as soon as canMatch() is false.
+  */
+class LevenshteinAutomaton {
+public:
+	typedef std::vector<uint32_t> State;
+private:
+	std::vector<uint32_t> m_str;
+	uint32_t m_maxDistance;
+public:
+	LevenshteinAutomaton();
+	///@param str utf-8 encoded query string
+	LevenshteinAutomaton(const std::string & str, uint32_t maxDistance);
+	~LevenshteinAutomaton();
+	inline uint32_t maxDistance() const { return m_maxDistance; }
+	///number of code points of the query string
+	inline uint32_t size() const { return (uint32_t) m_str.size(); }
+	///state before any input
+	State start() const;
+	///sets @param next to the state reached from @param state with input @param codePoint
+	void step(const State & state, uint32_t codePoint, State & next) const;
+	///true if the consumed input is within maxDistance() of the query string
+	inline bool isMatch(const State & state) const { return state.back() <= m_maxDistance; }
+	///true if there is an extension of the consumed input that matches
+	bool canMatch(const State & state) const;
+	///edit distance of the consumed input to the query string, maxDistance()+1 if it does not match
+	inline uint32_t distance(const State & state) const { return state.back(); }
+	///@param prefixMatch accept strings whose prefix matches
+	bool matches(const std::string & str, bool prefixMatch) const;
+	///maximum edit distance suitable for the length of @param str: 0 for up to 2, 1 for up to 5 and 2 for longer code point sequences
+	static uint32_t defaultMaxDistance(const std::string & str);
+};
+
+}//end namespace
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef SSERIALIZE_UNICODE_FOLDING_FUNCTIONS_H
+#define SSERIALIZE_UNICODE_FOLDING_FUNCTIONS_H
+#include <string>
+#include <stdint.h>
+
+namespace sserialize {
+
+/** Table driven version of the transliteration "NFD; [:Nonspacing Mark:] Remove; NFC;" used by DiacriticRemover.
+  * The table is created by support/unicode_tools/create_cpp_folding_table.cpp from the ICU data.
+  * If @param toLower is true, then unicode32_to_lower() is applied to the result in the same pass,
+  * i.e. @param dest is unicode_to_lower(transliterate(@param str)).
+  * ASCII characters are handled without any table lookup.
+  * @return false if @param str is not valid utf-8 or contains a code point that may interact with its predecessor
+  *         under normalization (e.g. Hangul jamo or spacing combining marks). @param dest is unspecified in this case
+  *         and the result has to be computed by the transliterator.
+  */
+bool unicode_fold(const std::string & str, bool toLower, std::string & dest);
+
+///major version of the ICU the table of unicode_fold() was created from, results may differ for other versions
+uint32_t unicode_fold_icu_version_major();
+
+}//end namespace
+
+#endif
@@ -0,0 +1,8533 @@
+//Generated by support/unicode_tools/create_cpp_folding_table.cpp from ICU 72.1, do not edit
+#ifndef UNICODE_FOLDING_TABLE_H
+#define UNICODE_FOLDING_TABLE_H
+#include <stdint.h>
+//the folding is only identical to the transliterator of this ICU major version
+#define UNICODE_FOLDING_TABLE_ICU_VERSION_MAJOR 72
+#define UNICODE_FOLDING_TABLE_SIZE 4094
+#define UNICODE_FOLDING_DATA_SIZE 5228
+//code points whose folding is not the identity or that may interact with their predecessor, sorted
+static const uint32_t unicode_folding_source_table[] = {
+0x0000C0,
+0x0000C1,
+0x0000C2,
+0x0000C3,
+0x0000C4,
+0x0000C5,
+0x0000C7,
+0x0000C8,
+0x0000C9,
+0x0000CA,
+0x0000CB,
+0x0000CC,
+0x0000CD,
+0x0000CE,
+0x0000CF,
+0x0000D1,
+0x0000D2,
+0x0000D3,
+0x0000D4,
+0x0000D5,
+0x0000D6,
+0x0000D9,
+0x0000DA,
+0x0000DB,
+0x0000DC,
+0x0000DD,
+0x0000E0,
+0x0000E1,
+0x0000E2,
+0x0000E3,
+0x0000E4,
+0x0000E5,
+0x0000E7,
+0x0000E8,
+0x0000E9,
+0x0000EA,
+0x0000EB,
+0x0000EC,
+0x0000ED,
+0x0000EE,
+0x0000EF,
+0x0000F1,
+0x0000F2,
+0x0000F3,
+0x0000F4,
+0x0000F5,
+0x0000F6,
+0x0000F9,
+0x0000FA,
+0x0000FB,
+0x0000FC,
+0x0000FD,
+0x0000FF,
+0x000100,
+0x000101,
+0x000102,
+0x000103,
+0x000104,
+0x000105,
+0x000106,
+0x000107,
+0x000108,
+0x000109,
+0x00010A,
+0x00010B,
+0x00010C,
+0x00010D,
+0x00010E,
+0x00010F,
+0x000112,
+0x000113,
+0x000114,
+0x000115,
+0x000116,
+0x000117,
+0x000118,
+0x000119,
+0x00011A,
+0x00011B,
+0x00011C,
+0x00011D,
+0x00011E,
+0x00011F,
+0x000120,
+0x000121,
+0x000122,
+0x000123,
+0x000124,
+0x000125,
+0x000128,
+0x000129,
+0x00012A,
+0x00012B,
+0x00012C,
+0x00012D,
+0x00012E,
+0x00012F,
+0x000130,
+0x000134,
+0x000135,
+0x000136,
+0x000137,
+0x000139,
+0x00013A,
+0x00013B,
+0x00013C,
+0x00013D,
+0x00013E,
+0x000143,
+0x000144,
+0x000145,
+0x000146,
+0x000147,
+0x000148,
+0x00014C,
+0x00014D,
+0x00014E,
+0x00014F,
+0x000150,
+0x000151,
+0x000154,
+0x000155,
+0x000156,
+0x000157,
+0x000158,
+0x000159,
+0x00015A,
+0x00015B,
+0x00015C,
+0x00015D,
+0x00015E,
+0x00015F,
+0x000160,
+0x000161,
+0x000162,
+0x000163,
+0x000164,
+0x000165,
+0x000168,
+0x000169,
+0x00016A,
+0x00016B,
+0x00016C,
+0x00016D,
+0x00016E,
+0x00016F,
+0x000170,
+0x000171,
+0x000172,
+0x000173,
+0x000174,
+0x000175,
+0x000176,
+0x000177,
+0x000178,
+0x000179,
+0x00017A,
+0x00017B,
+0x00017C,
+0x00017D,
+0x00017E,
+0x0001A0,
+0x0001A1,
+0x0001AF,
+0x0001B0,
+0x0001CD,
+0x0001CE,
+0x0001CF,
+0x0001D0,
+0x0001D1,
+0x0001D2,
+0x0001D3,
+0x0001D4,
+0x0001D5,
+0x0001D6,
+0x0001D7,
+0x0001D8,
+0x0001D9,
+0x0001DA,
+0x0001DB,
+0x0001DC,
+0x0001DE,
+0x0001DF,
+0x0001E0,
+0x0001E1,
+0x0001E2,
+0x0001E3,
+0x0001E6,
+0x0001E7,
+0x0001E8,
+0x0001E9,
+0x0001EA,
+0x0001EB,
+0x0001EC,
+0x0001ED,
+0x0001EE,
+0x0001EF,
+0x0001F0,
+0x0001F4,
+0x0001F5,
+0x0001F8,
+0x0001F9,
+0x0001FA,
+0x0001FB,
+0x0001FC,
+0x0001FD,
+0x0001FE,
+0x0001FF,
+0x000200,
+0x000201,
+0x000202,
+0x000203,
+0x000204,
+0x000205,
+0x000206,
+0x000207,
+0x000208,
+0x000209,
+0x00020A,
+0x00020B,
+0x00020C,
+0x00020D,
+0x00020E,
+0x00020F,
+0x000210,
+0x000211,
+0x000212,
+0x000213,
+0x000214,
+0x000215,
+0x000216,
+0x000217,
+0x000218,
+0x000219,
+0x00021A,
+0x00021B,
+0x00021E,
+0x00021F,
+0x000226,
+0x000227,
+0x000228,
+0x000229,
+0x00022A,
+0x00022B,
+0x00022C,
+0x00022D,
+0x00022E,
+0x00022F,
+0x000230,
+0x000231,
+0x000232,
+0x000233,
+0x000300,
+0x000301,
+0x000302,
+0x000303,
+0x000304,
+0x000305,
+0x000306,
+0x000307,
+0x000308,
+0x000309,
+0x00030A,
+0x00030B,
+0x00030C,
+0x00030D,
+0x00030E,
+0x00030F,
+0x000310,
+0x000311,
+0x000312,
+0x000313,
+0x000314,
+0x000315,
+0x000316,
+0x000317,
+0x000318,
+0x000319,
+0x00031A,
+0x00031B,
+0x00031C,
+0x00031D,
+0x00031E,
+0x00031F,
+0x000320,
+0x000321,
+0x000322,
+0x000323,
+0x000324,
+0x000325,
+0x000326,
+0x000327,
+0x000328,
+0x000329,
+0x00032A,
+0x00032B,
+0x00032C,
+0x00032D,
+0x00032E,
+0x00032F,
+0x000330,
+0x000331,
+0x000332,
+0x000333,
+0x000334,
+0x000335,
+0x000336,
+0x000337,
+0x000338,
+0x000339,
+0x00033A,
+0x00033B,
+0x00033C,
+0x00033D,
+0x00033E,
+0x00033F,
+0x000340,
+0x000341,
+0x000342,
+0x000343,
+0x000344,
+0x000345,
+0x000346,
+0x000347,
+0x000348,
+0x000349,
+0x00034A,
+0x00034B,
+0x00034C,
+0x00034D,
+0x00034E,
+0x00034F,
+0x000350,
+0x000351,
+0x000352,
+0x000353,
+0x000354,
+0x000355,
+0x000356,
+0x000357,
+0x000358,
+0x000359,
+0x00035A,
+0x00035B,
+0x00035C,
+0x00035D,
+0x00035E,
+0x00035F,
+0x000360,
+0x000361,
+0x000362,
+0x000363,
+0x000364,
+0x000365,
+0x000366,
+0x000367,
+0x000368,
+0x000369,
+0x00036A,
+0x00036B,
+0x00036C,
+0x00036D,
+0x00036E,
+0x00036F,
+0x000374,
+0x00037E,
+0x000385,
+0x000386,
+0x000387,
+0x000388,
+0x000389,
+0x00038A,
+0x00038C,
+0x00038E,
+0x00038F,
+0x000390,
+0x0003AA,
+0x0003AB,
+0x0003AC,
+0x0003AD,
+0x0003AE,
+0x0003AF,
+0x0003B0,
+0x0003CA,
+0x0003CB,
+0x0003CC,
+0x0003CD,
+0x0003CE,
+0x0003D3,
+0x0003D4,
+0x000400,
+0x000401,
+0x000403,
+0x000407,
+0x00040C,
+0x00040D,
+0x00040E,
+0x000419,
+0x000439,
+0x000450,
+0x000451,
+0x000453,
+0x000457,
+0x00045C,
+0x00045D,
+0x00045E,
+0x000476,
+0x000477,
+0x000483,
+0x000484,
+0x000485,
+0x000486,
+0x000487,
+0x0004C1,
+0x0004C2,
+0x0004D0,
+0x0004D1,
+0x0004D2,
+0x0004D3,
+0x0004D6,
+0x0004D7,
+0x0004DA,
+0x0004DB,
+0x0004DC,
+0x0004DD,
+0x0004DE,
+0x0004DF,
+0x0004E2,
+0x0004E3,
+0x0004E4,
+0x0004E5,
+0x0004E6,
+0x0004E7,
+0x0004EA,
+0x0004EB,
+0x0004EC,
+0x0004ED,
+0x0004EE,
+0x0004EF,
+0x0004F0,
+0x0004F1,
+0x0004F2,
+0x0004F3,
+0x0004F4,
+0x0004F5,
+0x0004F8,
+0x0004F9,
+0x000591,
+0x000592,
+0x000593,
+0x000594,
+0x000595,
+0x000596,
+0x000597,
+0x000598,
+0x000599,
+0x00059A,
+0x00059B,
+0x00059C,
+0x00059D,
+0x00059E,
+0x00059F,
+0x0005A0,
+0x0005A1,
+0x0005A2,
+0x0005A3,
+0x0005A4,
+0x0005A5,
+0x0005A6,
+0x0005A7,
+0x0005A8,
+0x0005A9,
+0x0005AA,
+0x0005AB,
+0x0005AC,
+0x0005AD,
+0x0005AE,
+0x0005AF,
+0x0005B0,
+0x0005B1,
+0x0005B2,
+0x0005B3,
+0x0005B4,
+0x0005B5,
+0x0005B6,
+0x0005B7,
+0x0005B8,
+0x0005B9,
+0x0005BA,
+0x0005BB,
+0x0005BC,
+0x0005BD,
+0x0005BF,
+0x0005C1,
+0x0005C2,
+0x0005C4,
+0x0005C5,
+0x0005C7,
+0x000610,
+0x000611,
+0x000612,
+0x000613,
+0x000614,
+0x000615,
+0x000616,
+0x000617,
+0x000618,
+0x000619,
+0x00061A,
+0x000622,
+0x000623,
+0x000624,
+0x000625,
+0x000626,
+0x00064B,
+0x00064C,
+0x00064D,
+0x00064E,
+0x00064F,
+0x000650,
+0x000651,
+0x000652,
+0x000653,
+0x000654,
+0x000655,
+0x000656,
+0x000657,
+0x000658,
+0x000659,
+0x00065A,
+0x00065B,
+0x00065C,
+0x00065D,
+0x00065E,
+0x00065F,
+0x000670,
+0x0006C0,
+0x0006C2,
+0x0006D3,
+0x0006D6,
+0x0006D7,
+0x0006D8,
+0x0006D9,
+0x0006DA,
+0x0006DB,
+0x0006DC,
+0x0006DF,
+0x0006E0,
+0x0006E1,
+0x0006E2,
+0x0006E3,
+0x0006E4,
+0x0006E7,
+0x0006E8,
+0x0006EA,
+0x0006EB,
+0x0006EC,
+0x0006ED,
+0x000711,
+0x000730,
+0x000731,
+0x000732,
+0x000733,
+0x000734,
+0x000735,
+0x000736,
+0x000737,
+0x000738,
+0x000739,
+0x00073A,
+0x00073B,
+0x00073C,
+0x00073D,
+0x00073E,
+0x00073F,
+0x000740,
+0x000741,
+0x000742,
+0x000743,
+0x000744,
+0x000745,
+0x000746,
+0x000747,
+0x000748,
+0x000749,
+0x00074A,
+0x0007A6,
+0x0007A7,
+0x0007A8,
+0x0007A9,
+0x0007AA,
+0x0007AB,
+0x0007AC,
+0x0007AD,
+0x0007AE,
+0x0007AF,
+0x0007B0,
+0x0007EB,
+0x0007EC,
+0x0007ED,
+0x0007EE,
+0x0007EF,
+0x0007F0,
+0x0007F1,
+0x0007F2,
+0x0007F3,
+0x0007FD,
+0x000816,
+0x000817,
+0x000818,
+0x000819,
+0x00081B,
+0x00081C,
+0x00081D,
+0x00081E,
+0x00081F,
+0x000820,
+0x000821,
+0x000822,
+0x000823,
+0x000825,
+0x000826,
+0x000827,
+0x000829,
+0x00082A,
+0x00082B,
+0x00082C,
+0x00082D,
+0x000859,
+0x00085A,
+0x00085B,
+0x000898,
+0x000899,
+0x00089A,
+0x00089B,
+0x00089C,
+0x00089D,
+0x00089E,
+0x00089F,
+0x0008CA,
+0x0008CB,
+0x0008CC,
+0x0008CD,
+0x0008CE,
+0x0008CF,
+0x0008D0,
+0x0008D1,
+0x0008D2,
+0x0008D3,
+0x0008D4,
+0x0008D5,
+0x0008D6,
+0x0008D7,
+0x0008D8,
+0x0008D9,
+0x0008DA,
+0x0008DB,
+0x0008DC,
+0x0008DD,
+0x0008DE,
+0x0008DF,
+0x0008E0,
+0x0008E1,
+0x0008E3,
+0x0008E4,
+0x0008E5,
+0x0008E6,
+0x0008E7,
+0x0008E8,
+0x0008E9,
+0x0008EA,
+0x0008EB,
+0x0008EC,
+0x0008ED,
+0x0008EE,
+0x0008EF,
+0x0008F0,
+0x0008F1,
+0x0008F2,
+0x0008F3,
+0x0008F4,
+0x0008F5,
+0x0008F6,
+0x0008F7,
+0x0008F8,
+0x0008F9,
+0x0008FA,
+0x0008FB,
+0x0008FC,
+0x0008FD,
+0x0008FE,
+0x0008FF,
+0x000900,
+0x000901,
+0x000902,
+0x000929,
+0x000931,
+0x000934,
+0x00093A,
+0x00093C,
+0x000941,
+0x000942,
+0x000943,
+0x000944,
+0x000945,
+0x000946,
+0x000947,
+0x000948,
+0x00094D,
+0x000951,
+0x000952,
+0x000953,
+0x000954,
+0x000955,
+0x000956,
+0x000957,
+0x000958,
+0x000959,
+0x00095A,
+0x00095B,
+0x00095C,
+0x00095D,
+0x00095E,
+0x00095F,
+0x000962,
+0x000963,
+0x000981,
+0x0009BC,
+0x0009BE,
+0x0009C1,
+0x0009C2,
+0x0009C3,
+0x0009C4,
+0x0009CD,
+0x0009D7,
+0x0009DC,
+0x0009DD,
+0x0009DF,
+0x0009E2,
+0x0009E3,
+0x0009FE,
+0x000A01,
+0x000A02,
+0x000A33,
+0x000A36,
+0x000A3C,
+0x000A41,
+0x000A42,
+0x000A47,
+0x000A48,
+0x000A4B,
+0x000A4C,
+0x000A4D,
+0x000A51,
+0x000A59,
+0x000A5A,
+0x000A5B,
+0x000A5E,
+0x000A70,
+0x000A71,
+0x000A75,
+0x000A81,
+0x000A82,
+0x000ABC,
+0x000AC1,
+0x000AC2,
+0x000AC3,
+0x000AC4,
+0x000AC5,
+0x000AC7,
+0x000AC8,
+0x000ACD,
+0x000AE2,
+0x000AE3,
+0x000AFA,
+0x000AFB,
+0x000AFC,
+0x000AFD,
+0x000AFE,
+0x000AFF,
+0x000B01,
+0x000B3C,
+0x000B3E,
+0x000B3F,
+0x000B41,
+0x000B42,
+0x000B43,
+0x000B44,
+0x000B48,
+0x000B4D,
+0x000B55,
+0x000B56,
+0x000B57,
+0x000B5C,
+0x000B5D,
+0x000B62,
+0x000B63,
+0x000B82,
+0x000BBE,
+0x000BC0,
+0x000BCD,
+0x000BD7,
+0x000C00,
+0x000C04,
+0x000C3C,
+0x000C3E,
+0x000C3F,
+0x000C40,
+0x000C46,
+0x000C47,
+0x000C48,
+0x000C4A,
+0x000C4B,
+0x000C4C,
+0x000C4D,
+0x000C55,
+0x000C56,
+0x000C62,
+0x000C63,
+0x000C81,
+0x000CBC,
+0x000CBF,
+0x000CC0,
+0x000CC2,
+0x000CC6,
+0x000CC7,
+0x000CC8,
+0x000CCA,
+0x000CCB,
+0x000CCC,
+0x000CCD,
+0x000CD5,
+0x000CD6,
+0x000CE2,
+0x000CE3,
+0x000D00,
+0x000D01,
+0x000D3B,
+0x000D3C,
+0x000D3E,
+0x000D41,
+0x000D42,
+0x000D43,
+0x000D44,
+0x000D4D,
+0x000D57,
+0x000D62,
+0x000D63,
+0x000D81,
+0x000DCA,
+0x000DCF,
+0x000DD2,
+0x000DD3,
+0x000DD4,
+0x000DD6,
+0x000DDA,
+0x000DDD,
+0x000DDF,
+0x000E31,
+0x000E34,
+0x000E35,
+0x000E36,
+0x000E37,
+0x000E38,
+0x000E39,
+0x000E3A,
+0x000E47,
+0x000E48,
+0x000E49,
+0x000E4A,
+0x000E4B,
+0x000E4C,
+0x000E4D,
+0x000E4E,
+0x000EB1,
+0x000EB4,
+0x000EB5,
+0x000EB6,
+0x000EB7,
+0x000EB8,
+0x000EB9,
+0x000EBA,
+0x000EBB,
+0x000EBC,
+0x000EC8,
+0x000EC9,
+0x000ECA,
+0x000ECB,
+0x000ECC,
+0x000ECD,
+0x000ECE,
+0x000F18,
+0x000F19,
+0x000F35,
+0x000F37,
+0x000F39,
+0x000F43,
+0x000F4D,
+0x000F52,
+0x000F57,
+0x000F5C,
+0x000F69,
+0x000F71,
+0x000F72,
+0x000F73,
+0x000F74,
+0x000F75,
+0x000F76,
+0x000F77,
+0x000F78,
+0x000F79,
+0x000F7A,
+0x000F7B,
+0x000F7C,
+0x000F7D,
+0x000F7E,
+0x000F80,
+0x000F81,
+0x000F82,
+0x000F83,
+0x000F84,
+0x000F86,
+0x000F87,
+0x000F8D,
+0x000F8E,
+0x000F8F,
+0x000F90,
+0x000F91,
+0x000F92,
+0x000F93,
+0x000F94,
+0x000F95,
+0x000F96,
+0x000F97,
+0x000F99,
+0x000F9A,
+0x000F9B,
+0x000F9C,
+0x000F9D,
+0x000F9E,
+0x000F9F,
+0x000FA0,
+0x000FA1,
+0x000FA2,
+0x000FA3,
+0x000FA4,
+0x000FA5,
+0x000FA6,
+0x000FA7,
+0x000FA8,
+0x000FA9,
+0x000FAA,
+0x000FAB,
+0x000FAC,
+0x000FAD,
+0x000FAE,
+0x000FAF,
+0x000FB0,
+0x000FB1,
+0x000FB2,
+0x000FB3,
+0x000FB4,
+0x000FB5,
+0x000FB6,
+0x000FB7,
+0x000FB8,
+0x000FB9,
+0x000FBA,
+0x000FBB,
+0x000FBC,
+0x000FC6,
+0x001026,
+0x00102D,
+0x00102E,
+0x00102F,
+0x001030,
+0x001032,
+0x001033,
+0x001034,
+0x001035,
+0x001036,
+0x001037,
+0x001039,
+0x00103A,
+0x00103D,
+0x00103E,
+0x001058,
+0x001059,
+0x00105E,
+0x00105F,
+0x001060,
+0x001071,
+0x001072,
+0x001073,
+0x001074,
+0x001082,
+0x001085,
+0x001086,
+0x00108D,
+0x00109D,
+0x001161,
+0x001162,
+0x001163,
+0x001164,
+0x001165,
+0x001166,
+0x001167,
+0x001168,
+0x001169,
+0x00116A,
+0x00116B,
+0x00116C,
+0x00116D,
+0x00116E,
+0x00116F,
+0x001170,
+0x001171,
+0x001172,
+0x001173,
+0x001174,
+0x001175,
+0x0011A8,
+0x0011A9,
+0x0011AA,
+0x0011AB,
+0x0011AC,
+0x0011AD,
+0x0011AE,
+0x0011AF,
+0x0011B0,
+0x0011B1,
+0x0011B2,
+0x0011B3,
+0x0011B4,
+0x0011B5,
+0x0011B6,
+0x0011B7,
+0x0011B8,
+0x0011B9,
+0x0011BA,
+0x0011BB,
+0x0011BC,
+0x0011BD,
+0x0011BE,
+0x0011BF,
+0x0011C0,
+0x0011C1,
+0x0011C2,
+0x00135D,
+0x00135E,
+0x00135F,
+0x001712,
+0x001713,
+0x001714,
+0x001715,
+0x001732,
+0x001733,
+0x001734,
+0x001752,
+0x001753,
+0x001772,
+0x001773,
+0x0017B4,
+0x0017B5,
+0x0017B7,
+0x0017B8,
+0x0017B9,
+0x0017BA,
+0x0017BB,
+0x0017BC,
+0x0017BD,
+0x0017C6,
+0x0017C9,
+0x0017CA,
+0x0017CB,
+0x0017CC,
+0x0017CD,
+0x0017CE,
+0x0017CF,
+0x0017D0,
+0x0017D1,
+0x0017D2,
+0x0017D3,
+0x0017DD,
+0x00180B,
+0x00180C,
+0x00180D,
+0x00180F,
+0x001885,
+0x001886,
+0x0018A9,
+0x001920,
+0x001921,
+0x001922,
+0x001927,
+0x001928,
+0x001932,
+0x001939,
+0x00193A,
+0x00193B,
+0x001A17,
+0x001A18,
+0x001A1B,
+0x001A56,
+0x001A58,
+0x001A59,
+0x001A5A,
+0x001A5B,
+0x001A5C,
+0x001A5D,
+0x001A5E,
+0x001A60,
+0x001A62,
+0x001A65,
+0x001A66,
+0x001A67,
+0x001A68,
+0x001A69,
+0x001A6A,
+0x001A6B,
+0x001A6C,
+0x001A73,
+0x001A74,
+0x001A75,
+0x001A76,
+0x001A77,
+0x001A78,
+0x001A79,
+0x001A7A,
+0x001A7B,
+0x001A7C,
+0x001A7F,
+0x001AB0,
+0x001AB1,
+0x001AB2,
+0x001AB3,
+0x001AB4,
+0x001AB5,
+0x001AB6,
+0x001AB7,
+0x001AB8,
+0x001AB9,
+0x001ABA,
+0x001ABB,
+0x001ABC,
+0x001ABD,
+0x001ABF,
+0x001AC0,
+0x001AC1,
+0x001AC2,
+0x001AC3,
+0x001AC4,
+0x001AC5,
+0x001AC6,
+0x001AC7,
+0x001AC8,
+0x001AC9,
+0x001ACA,
+0x001ACB,
+0x001ACC,
+0x001ACD,
+0x001ACE,
+0x001B00,
+0x001B01,
+0x001B02,
+0x001B03,
+0x001B34,
+0x001B35,
+0x001B36,
+0x001B37,
+0x001B38,
+0x001B39,
+0x001B3A,
+0x001B3B,
+0x001B3C,
+0x001B3D,
+0x001B42,
+0x001B43,
+0x001B44,
+0x001B6B,
+0x001B6C,
+0x001B6D,
+0x001B6E,
+0x001B6F,
+0x001B70,
+0x001B71,
+0x001B72,
+0x001B73,
+0x001B80,
+0x001B81,
+0x001BA2,
+0x001BA3,
+0x001BA4,
+0x001BA5,
+0x001BA8,
+0x001BA9,
+0x001BAA,
+0x001BAB,
+0x001BAC,
+0x001BAD,
+0x001BE6,
+0x001BE8,
+0x001BE9,
+0x001BED,
+0x001BEF,
+0x001BF0,
+0x001BF1,
+0x001BF2,
+0x001BF3,
+0x001C2C,
+0x001C2D,
+0x001C2E,
+0x001C2F,
+0x001C30,
+0x001C31,
+0x001C32,
+0x001C33,
+0x001C36,
+0x001C37,
+0x001CD0,
+0x001CD1,
+0x001CD2,
+0x001CD4,
+0x001CD5,
+0x001CD6,
+0x001CD7,
+0x001CD8,
+0x001CD9,
+0x001CDA,
+0x001CDB,
+0x001CDC,
+0x001CDD,
+0x001CDE,
+0x001CDF,
+0x001CE0,
+0x001CE2,
+0x001CE3,
+0x001CE4,
+0x001CE5,
+0x001CE6,
+0x001CE7,
+0x001CE8,
+0x001CED,
+0x001CF4,
+0x001CF8,
+0x001CF9,
+0x001DC0,
+0x001DC1,
+0x001DC2,
+0x001DC3,
+0x001DC4,
+0x001DC5,
+0x001DC6,
+0x001DC7,
+0x001DC8,
+0x001DC9,
+0x001DCA,
+0x001DCB,
+0x001DCC,
+0x001DCD,
+0x001DCE,
+0x001DCF,
+0x001DD0,
+0x001DD1,
+0x001DD2,
+0x001DD3,
+0x001DD4,
+0x001DD5,
+0x001DD6,
+0x001DD7,
+0x001DD8,
+0x001DD9,
+0x001DDA,
+0x001DDB,
+0x001DDC,
+0x001DDD,
+0x001DDE,
+0x001DDF,
+0x001DE0,
+0x001DE1,
+0x001DE2,
+0x001DE3,
+0x001DE4,
+0x001DE5,
+0x001DE6,
+0x001DE7,
+0x001DE8,
+0x001DE9,
+0x001DEA,
+0x001DEB,
+0x001DEC,
+0x001DED,
+0x001DEE,
+0x001DEF,
+0x001DF0,
+0x001DF1,
+0x001DF2,
+0x001DF3,
+0x001DF4,
+0x001DF5,
+0x001DF6,
+0x001DF7,
+0x001DF8,
+0x001DF9,
+0x001DFA,
+0x001DFB,
+0x001DFC,
+0x001DFD,
+0x001DFE,
+0x001DFF,
+0x001E00,
+0x001E01,
+0x001E02,
+0x001E03,
+0x001E04,
+0x001E05,
+0x001E06,
+0x001E07,
+0x001E08,
+0x001E09,
+0x001E0A,
+0x001E0B,
+0x001E0C,
+0x001E0D,
+0x001E0E,
+0x001E0F,
+0x001E10,
+0x001E11,
+0x001E12,
+0x001E13,
+0x001E14,
+0x001E15,
+0x001E16,
+0x001E17,
+0x001E18,
+0x001E19,
+0x001E1A,
+0x001E1B,
+0x001E1C,
+0x001E1D,
+0x001E1E,
+0x001E1F,
+0x001E20,
+0x001E21,
+0x001E22,
+0x001E23,
+0x001E24,
+0x001E25,
+0x001E26,
+0x001E27,
+0x001E28,
+0x001E29,
+0x001E2A,
+0x001E2B,
+0x001E2C,
+0x001E2D,
+0x001E2E,
+0x001E2F,
+0x001E30,
+0x001E31,
+0x001E32,
+0x001E33,
+0x001E34,
+0x001E35,
+0x001E36,
+0x001E37,
+0x001E38,
+0x001E39,
+0x001E3A,
+0x001E3B,
+0x001E3C,
+0x001E3D,
+0x001E3E,
+0x001E3F,
+0x001E40,
+0x001E41,
+0x001E42,
+0x001E43,
+0x001E44,
+0x001E45,
+0x001E46,
+0x001E47,
+0x001E48,
+0x001E49,
+0x001E4A,
+0x001E4B,
+0x001E4C,
+0x001E4D,
+0x001E4E,
+0x001E4F,
+0x001E50,
+0x001E51,
+0x001E52,
+0x001E53,
+0x001E54,
+0x001E55,
+0x001E56,
+0x001E57,
+0x001E58,
+0x001E59,
+0x001E5A,
+0x001E5B,
+0x001E5C,
+0x001E5D,
+0x001E5E,
+0x001E5F,
+0x001E60,
+0x001E61,
+0x001E62,
+0x001E63,
+0x001E64,
+0x001E65,
+0x001E66,
+0x001E67,
+0x001E68,
+0x001E69,
+0x001E6A,
+0x001E6B,
+0x001E6C,
+0x001E6D,
+0x001E6E,
+0x001E6F,
+0x001E70,
+0x001E71,
+0x001E72,
+0x001E73,
+0x001E74,
+0x001E75,
+0x001E76,
+0x001E77,
+0x001E78,
+0x001E79,
+0x001E7A,
+0x001E7B,
+0x001E7C,
+0x001E7D,
+0x001E7E,
+0x001E7F,
+0x001E80,
+0x001E81,
+0x001E82,
+0x001E83,
+0x001E84,
+0x001E85,
+0x001E86,
+0x001E87,
+0x001E88,
+0x001E89,
+0x001E8A,
+0x001E8B,
+0x001E8C,
+0x001E8D,
+0x001E8E,
+0x001E8F,
+0x001E90,
+0x001E91,
+0x001E92,
+0x001E93,
+0x001E94,
+0x001E95,
+0x001E96,
+0x001E97,
+0x001E98,
+0x001E99,
+0x001E9B,
+0x001EA0,
+0x001EA1,
+0x001EA2,
+0x001EA3,
+0x001EA4,
+0x001EA5,
+0x001EA6,
+0x001EA7,
+0x001EA8,
+0x001EA9,
+0x001EAA,
+0x001EAB,
+0x001EAC,
+0x001EAD,
+0x001EAE,
+0x001EAF,
+0x001EB0,
+0x001EB1,
+0x001EB2,
+0x001EB3,
+0x001EB4,
+0x001EB5,
+0x001EB6,
+0x001EB7,
+0x001EB8,
+0x001EB9,
+0x001EBA,
+0x001EBB,
+0x001EBC,
+0x001EBD,
+0x001EBE,
+0x001EBF,
+0x001EC0,
+0x001EC1,
+0x001EC2,
+0x001EC3,
+0x001EC4,
+0x001EC5,
+0x001EC6,
+0x001EC7,
+0x001EC8,
+0x001EC9,
+0x001ECA,
+0x001ECB,
+0x001ECC,
+0x001ECD,
+0x001ECE,
+0x001ECF,
+0x001ED0,
+0x001ED1,
+0x001ED2,
+0x001ED3,
+0x001ED4,
+0x001ED5,
+0x001ED6,
+0x001ED7,
+0x001ED8,
+0x001ED9,
+0x001EDA,
+0x001EDB,
+0x001EDC,
+0x001EDD,
+0x001EDE,
+0x001EDF,
+0x001EE0,
+0x001EE1,
+0x001EE2,
+0x001EE3,
+0x001EE4,
+0x001EE5,
+0x001EE6,
+0x001EE7,
+0x001EE8,
+0x001EE9,
+0x001EEA,
+0x001EEB,
+0x001EEC,
+0x001EED,
+0x001EEE,
+0x001EEF,
+0x001EF0,
+0x001EF1,
+0x001EF2,
+0x001EF3,
+0x001EF4,
+0x001EF5,
+0x001EF6,
+0x001EF7,
+0x001EF8,
+0x001EF9,
+0x001F00,
+0x001F01,
+0x001F02,
+0x001F03,
+0x001F04,
+0x001F05,
+0x001F06,
+0x001F07,
+0x001F08,
+0x001F09,
+0x001F0A,
+0x001F0B,
+0x001F0C,
+0x001F0D,
+0x001F0E,
+0x001F0F,
+0x001F10,
+0x001F11,
+0x001F12,
+0x001F13,
+0x001F14,
+0x001F15,
+0x001F18,
+0x001F19,
+0x001F1A,
+0x001F1B,
+0x001F1C,
+0x001F1D,
+0x001F20,
+0x001F21,
+0x001F22,
+0x001F23,
+0x001F24,
+0x001F25,
+0x001F26,
+0x001F27,
+0x001F28,
+0x001F29,
+0x001F2A,
+0x001F2B,
+0x001F2C,
+0x001F2D,
+0x001F2E,
+0x001F2F,
+0x001F30,
+0x001F31,
+0x001F32,
+0x001F33,
+0x001F34,
+0x001F35,
+0x001F36,
+0x001F37,
+0x001F38,
+0x001F39,
+0x001F3A,
+0x001F3B,
+0x001F3C,
+0x001F3D,
+0x001F3E,
+0x001F3F,
+0x001F40,
+0x001F41,
+0x001F42,
+0x001F43,
+0x001F44,
+0x001F45,
+0x001F48,
+0x001F49,
+0x001F4A,
+0x001F4B,
+0x001F4C,
+0x001F4D,
+0x001F50,
+0x001F51,
+0x001F52,
+0x001F53,
+0x001F54,
+0x001F55,
+0x001F56,
+0x001F57,
+0x001F59,
+0x001F5B,
+0x001F5D,
+0x001F5F,
+0x001F60,
+0x001F61,
+0x001F62,
+0x001F63,
+0x001F64,
+0x001F65,
+0x001F66,
+0x001F67,
+0x001F68,
+0x001F69,
+0x001F6A,
+0x001F6B,
+0x001F6C,
+0x001F6D,
+0x001F6E,
+0x001F6F,
+0x001F70,
+0x001F71,
+0x001F72,
+0x001F73,
+0x001F74,
+0x001F75,
+0x001F76,
+0x001F77,
+0x001F78,
+0x001F79,
+0x001F7A,
+0x001F7B,
+0x001F7C,
+0x001F7D,
+0x001F80,
+0x001F81,
+0x001F82,
+0x001F83,
+0x001F84,
+0x001F85,
+0x001F86,
+0x001F87,
+0x001F88,
+0x001F89,
+0x001F8A,
+0x001F8B,
+0x001F8C,
+0x001F8D,
+0x001F8E,
+0x001F8F,
+0x001F90,
+0x001F91,
+0x001F92,
+0x001F93,
+0x001F94,
+0x001F95,
+0x001F96,
+0x001F97,
+0x001F98,
+0x001F99,
+0x001F9A,
+0x001F9B,
+0x001F9C,
+0x001F9D,
+0x001F9E,
+0x001F9F,
+0x001FA0,
+0x001FA1,
+0x001FA2,
+0x001FA3,
+0x001FA4,
+0x001FA5,
+0x001FA6,
+0x001FA7,
+0x001FA8,
+0x001FA9,
+0x001FAA,
+0x001FAB,
+0x001FAC,
+0x001FAD,
+0x001FAE,
+0x001FAF,
+0x001FB0,
+0x001FB1,
+0x001FB2,
+0x001FB3,
+0x001FB4,
+0x001FB6,
+0x001FB7,
+0x001FB8,
+0x001FB9,
+0x001FBA,
+0x001FBB,
+0x001FBC,
+0x001FBE,
+0x001FC1,
+0x001FC2,
+0x001FC3,
+0x001FC4,
+0x001FC6,
+0x001FC7,
+0x001FC8,
+0x001FC9,
+0x001FCA,
+0x001FCB,
+0x001FCC,
+0x001FCD,
+0x001FCE,
+0x001FCF,
+0x001FD0,
+0x001FD1,
+0x001FD2,
+0x001FD3,
+0x001FD6,
+0x001FD7,
+0x001FD8,
+0x001FD9,
+0x001FDA,
+0x001FDB,
+0x001FDD,
+0x001FDE,
+0x001FDF,
+0x001FE0,
+0x001FE1,
+0x001FE2,
+0x001FE3,
+0x001FE4,
+0x001FE5,
+0x001FE6,
+0x001FE7,
+0x001FE8,
+0x001FE9,
+0x001FEA,
+0x001FEB,
+0x001FEC,
+0x001FED,
+0x001FEE,
+0x001FEF,
+0x001FF2,
+0x001FF3,
+0x001FF4,
+0x001FF6,
+0x001FF7,
+0x001FF8,
+0x001FF9,
+0x001FFA,
+0x001FFB,
+0x001FFC,
+0x001FFD,
+0x002000,
+0x002001,
+0x0020D0,
+0x0020D1,
+0x0020D2,
+0x0020D3,
+0x0020D4,
+0x0020D5,
+0x0020D6,
+0x0020D7,
+0x0020D8,
+0x0020D9,
+0x0020DA,
+0x0020DB,
+0x0020DC,
+0x0020E1,
+0x0020E5,
+0x0020E6,
+0x0020E7,
+0x0020E8,
+0x0020E9,
+0x0020EA,
+0x0020EB,
+0x0020EC,
+0x0020ED,
+0x0020EE,
+0x0020EF,
+0x0020F0,
+0x002126,
+0x00212A,
+0x00212B,
+0x00219A,
+0x00219B,
+0x0021AE,
+0x0021CD,
+0x0021CE,
+0x0021CF,
+0x002204,
+0x002209,
+0x00220C,
+0x002224,
+0x002226,
+0x002241,
+0x002244,
+0x002247,
+0x002249,
+0x002260,
+0x002262,
+0x00226D,
+0x00226E,
+0x00226F,
+0x002270,
+0x002271,
+0x002274,
+0x002275,
+0x002278,
+0x002279,
+0x002280,
+0x002281,
+0x002284,
+0x002285,
+0x002288,
+0x002289,
+0x0022AC,
+0x0022AD,
+0x0022AE,
+0x0022AF,
+0x0022E0,
+0x0022E1,
+0x0022E2,
+0x0022E3,
+0x0022EA,
+0x0022EB,
+0x0022EC,
+0x0022ED,
+0x002329,
+0x00232A,
+0x002ADC,
+0x002CEF,
+0x002CF0,
+0x002CF1,
+0x002D7F,
+0x002DE0,
+0x002DE1,
+0x002DE2,
+0x002DE3,
+0x002DE4,
+0x002DE5,
+0x002DE6,
+0x002DE7,
+0x002DE8,
+0x002DE9,
+0x002DEA,
+0x002DEB,
+0x002DEC,
+0x002DED,
+0x002DEE,
+0x002DEF,
+0x002DF0,
+0x002DF1,
+0x002DF2,
+0x002DF3,
+0x002DF4,
+0x002DF5,
+0x002DF6,
+0x002DF7,
+0x002DF8,
+0x002DF9,
+0x002DFA,
+0x002DFB,
+0x002DFC,
+0x002DFD,
+0x002DFE,
+0x002DFF,
+0x00302A,
+0x00302B,
+0x00302C,
+0x00302D,
+0x00302E,
+0x00302F,
+0x00304C,
+0x00304E,
+0x003050,
+0x003052,
+0x003054,
+0x003056,
+0x003058,
+0x00305A,
+0x00305C,
+0x00305E,
+0x003060,
+0x003062,
+0x003065,
+0x003067,
+0x003069,
+0x003070,
+0x003071,
+0x003073,
+0x003074,
+0x003076,
+0x003077,
+0x003079,
+0x00307A,
+0x00307C,
+0x00307D,
+0x003094,
+0x003099,
+0x00309A,
+0x00309E,
+0x0030AC,
+0x0030AE,
+0x0030B0,
+0x0030B2,
+0x0030B4,
+0x0030B6,
+0x0030B8,
+0x0030BA,
+0x0030BC,
+0x0030BE,
+0x0030C0,
+0x0030C2,
+0x0030C5,
+0x0030C7,
+0x0030C9,
+0x0030D0,
+0x0030D1,
+0x0030D3,
+0x0030D4,
+0x0030D6,
+0x0030D7,
+0x0030D9,
+0x0030DA,
+0x0030DC,
+0x0030DD,
+0x0030F4,
+0x0030F7,
+0x0030F8,
+0x0030F9,
+0x0030FA,
+0x0030FE,
+0x00A66F,
+0x00A674,
+0x00A675,
+0x00A676,
+0x00A677,
+0x00A678,
+0x00A679,
+0x00A67A,
+0x00A67B,
+0x00A67C,
+0x00A67D,
+0x00A69E,
+0x00A69F,
+0x00A6F0,
+0x00A6F1,
+0x00A802,
+0x00A806,
+0x00A80B,
+0x00A825,
+0x00A826,
+0x00A82C,
+0x00A8C4,
+0x00A8C5,
+0x00A8E0,
+0x00A8E1,
+0x00A8E2,
+0x00A8E3,
+0x00A8E4,
+0x00A8E5,
+0x00A8E6,
+0x00A8E7,
+0x00A8E8,
+0x00A8E9,
+0x00A8EA,
+0x00A8EB,
+0x00A8EC,
+0x00A8ED,
+0x00A8EE,
+0x00A8EF,
+0x00A8F0,
+0x00A8F1,
+0x00A8FF,
+0x00A926,
+0x00A927,
+0x00A928,
+0x00A929,
+0x00A92A,
+0x00A92B,
+0x00A92C,
+0x00A92D,
+0x00A947,
+0x00A948,
+0x00A949,
+0x00A94A,
+0x00A94B,
+0x00A94C,
+0x00A94D,
+0x00A94E,
+0x00A94F,
+0x00A950,
+0x00A951,
+0x00A953,
+0x00A980,
+0x00A981,
+0x00A982,
+0x00A9B3,
+0x00A9B6,
+0x00A9B7,
+0x00A9B8,
+0x00A9B9,
+0x00A9BC,
+0x00A9BD,
+0x00A9C0,
+0x00A9E5,
+0x00AA29,
+0x00AA2A,
+0x00AA2B,
+0x00AA2C,
+0x00AA2D,
+0x00AA2E,
+0x00AA31,
+0x00AA32,
+0x00AA35,
+0x00AA36,
+0x00AA43,
+0x00AA4C,
+0x00AA7C,
+0x00AAB0,
+0x00AAB2,
+0x00AAB3,
+0x00AAB4,
+0x00AAB7,
+0x00AAB8,
+0x00AABE,
+0x00AABF,
+0x00AAC1,
+0x00AAEC,
+0x00AAED,
+0x00AAF6,
+0x00ABE5,
+0x00ABE8,
+0x00ABED,
+0x00F900,
+0x00F901,
+0x00F902,
+0x00F903,
+0x00F904,
+0x00F905,
+0x00F906,
+0x00F907,
+0x00F908,
+0x00F909,
+0x00F90A,
+0x00F90B,
+0x00F90C,
+0x00F90D,
+0x00F90E,
+0x00F90F,
+0x00F910,
+0x00F911,
+0x00F912,
+0x00F913,
+0x00F914,
+0x00F915,
+0x00F916,
+0x00F917,
+0x00F918,
+0x00F919,
+0x00F91A,
+0x00F91B,
+0x00F91C,
+0x00F91D,
+0x00F91E,
+0x00F91F,
+0x00F920,
+0x00F921,
+0x00F922,
+0x00F923,
+0x00F924,
+0x00F925,
+0x00F926,
+0x00F927,
+0x00F928,
+0x00F929,
+0x00F92A,
+0x00F92B,
+0x00F92C,
+0x00F92D,
+0x00F92E,
+0x00F92F,
+0x00F930,
+0x00F931,
+0x00F932,
+0x00F933,
+0x00F934,
+0x00F935,
+0x00F936,
+0x00F937,
+0x00F938,
+0x00F939,
+0x00F93A,
+0x00F93B,
+0x00F93C,
+0x00F93D,
+0x00F93E,
+0x00F93F,
+0x00F940,
+0x00F941,
+0x00F942,
+0x00F943,
+0x00F944,
+0x00F945,
+0x00F946,
+0x00F947,
+0x00F948,
+0x00F949,
+0x00F94A,
+0x00F94B,
+0x00F94C,
+0x00F94D,
+0x00F94E,
+0x00F94F,
+0x00F950,
+0x00F951,
+0x00F952,
+0x00F953,
+0x00F954,
+0x00F955,
+0x00F956,
+0x00F957,
+0x00F958,
+0x00F959,
+0x00F95A,
+0x00F95B,
+0x00F95C,
+0x00F95D,
+0x00F95E,
+0x00F95F,
+0x00F960,
+0x00F961,
+0x00F962,
+0x00F963,
+0x00F964,
+0x00F965,
+0x00F966,
+0x00F967,
+0x00F968,
+0x00F969,
+0x00F96A,
+0x00F96B,
+0x00F96C,
+0x00F96D,
+0x00F96E,
+0x00F96F,
+0x00F970,
+0x00F971,
+0x00F972,
+0x00F973,
+0x00F974,
+0x00F975,
+0x00F976,
+0x00F977,
+0x00F978,
+0x00F979,
+0x00F97A,
+0x00F97B,
+0x00F97C,
+0x00F97D,
+0x00F97E,
+0x00F97F,
+0x00F980,
+0x00F981,
+0x00F982,
+0x00F983,
+0x00F984,
+0x00F985,
+0x00F986,
+0x00F987,
+0x00F988,
+0x00F989,
+0x00F98A,
+0x00F98B,
+0x00F98C,
+0x00F98D,
+0x00F98E,
+0x00F98F,
+0x00F990,
+0x00F991,
+0x00F992,
+0x00F993,
+0x00F994,
+0x00F995,
+0x00F996,
+0x00F997,
+0x00F998,
+0x00F999,
+0x00F99A,
+0x00F99B,
+0x00F99C,
+0x00F99D,
+0x00F99E,
+0x00F99F,
+0x00F9A0,
+0x00F9A1,
+0x00F9A2,
+0x00F9A3,
+0x00F9A4,
+0x00F9A5,
+0x00F9A6,
+0x00F9A7,
+0x00F9A8,
+0x00F9A9,
+0x00F9AA,
+0x00F9AB,
+0x00F9AC,
+0x00F9AD,
+0x00F9AE,
+0x00F9AF,
+0x00F9B0,
+0x00F9B1,
+0x00F9B2,
+0x00F9B3,
+0x00F9B4,
+0x00F9B5,
+0x00F9B6,
+0x00F9B7,
+0x00F9B8,
+0x00F9B9,
+0x00F9BA,
+0x00F9BB,
+0x00F9BC,
+0x00F9BD,
+0x00F9BE,
+0x00F9BF,
+0x00F9C0,
+0x00F9C1,
+0x00F9C2,
+0x00F9C3,
+0x00F9C4,
+0x00F9C5,
+0x00F9C6,
+0x00F9C7,
+0x00F9C8,
+0x00F9C9,
+0x00F9CA,
+0x00F9CB,
+0x00F9CC,
+0x00F9CD,
+0x00F9CE,
+0x00F9CF,
+0x00F9D0,
+0x00F9D1,
+0x00F9D2,
+0x00F9D3,
+0x00F9D4,
+0x00F9D5,
+0x00F9D6,
+0x00F9D7,
+0x00F9D8,
+0x00F9D9,
+0x00F9DA,
+0x00F9DB,
+0x00F9DC,
+0x00F9DD,
+0x00F9DE,
+0x00F9DF,
+0x00F9E0,
+0x00F9E1,
+0x00F9E2,
+0x00F9E3,
+0x00F9E4,
+0x00F9E5,
+0x00F9E6,
+0x00F9E7,
+0x00F9E8,
+0x00F9E9,
+0x00F9EA,
+0x00F9EB,
+0x00F9EC,
+0x00F9ED,
+0x00F9EE,
+0x00F9EF,
+0x00F9F0,
+0x00F9F1,
+0x00F9F2,
+0x00F9F3,
+0x00F9F4,
+0x00F9F5,
+0x00F9F6,
+0x00F9F7,
+0x00F9F8,
+0x00F9F9,
+0x00F9FA,
+0x00F9FB,
+0x00F9FC,
+0x00F9FD,
+0x00F9FE,
+0x00F9FF,
+0x00FA00,
+0x00FA01,
+0x00FA02,
+0x00FA03,
+0x00FA04,
+0x00FA05,
+0x00FA06,
+0x00FA07,
+0x00FA08,
+0x00FA09,
+0x00FA0A,
+0x00FA0B,
+0x00FA0C,
+0x00FA0D,
+0x00FA10,
+0x00FA12,
+0x00FA15,
+0x00FA16,
+0x00FA17,
+0x00FA18,
+0x00FA19,
+0x00FA1A,
+0x00FA1B,
+0x00FA1C,
+0x00FA1D,
+0x00FA1E,
+0x00FA20,
+0x00FA22,
+0x00FA25,
+0x00FA26,
+0x00FA2A,
+0x00FA2B,
+0x00FA2C,
+0x00FA2D,
+0x00FA2E,
+0x00FA2F,
+0x00FA30,
+0x00FA31,
+0x00FA32,
+0x00FA33,
+0x00FA34,
+0x00FA35,
+0x00FA36,
+0x00FA37,
+0x00FA38,
+0x00FA39,
+0x00FA3A,
+0x00FA3B,
+0x00FA3C,
+0x00FA3D,
+0x00FA3E,
+0x00FA3F,
+0x00FA40,
+0x00FA41,
+0x00FA42,
+0x00FA43,
+0x00FA44,
+0x00FA45,
+0x00FA46,
+0x00FA47,
+0x00FA48,
+0x00FA49,
+0x00FA4A,
+0x00FA4B,
+0x00FA4C,
+0x00FA4D,
+0x00FA4E,
+0x00FA4F,
+0x00FA50,
+0x00FA51,
+0x00FA52,
+0x00FA53,
+0x00FA54,
+0x00FA55,
+0x00FA56,
+0x00FA57,
+0x00FA58,
+0x00FA59,
+0x00FA5A,
+0x00FA5B,
+0x00FA5C,
+0x00FA5D,
+0x00FA5E,
+0x00FA5F,
+0x00FA60,
+0x00FA61,
+0x00FA62,
+0x00FA63,
+0x00FA64,
+0x00FA65,
+0x00FA66,
+0x00FA67,
+0x00FA68,
+0x00FA69,
+0x00FA6A,
+0x00FA6B,
+0x00FA6C,
+0x00FA6D,
+0x00FA70,
+0x00FA71,
+0x00FA72,
+0x00FA73,
+0x00FA74,
+0x00FA75,
+0x00FA76,
+0x00FA77,
+0x00FA78,
+0x00FA79,
+0x00FA7A,
+0x00FA7B,
+0x00FA7C,
+0x00FA7D,
+0x00FA7E,
+0x00FA7F,
+0x00FA80,
+0x00FA81,
+0x00FA82,
+0x00FA83,
+0x00FA84,
+0x00FA85,
+0x00FA86,
+0x00FA87,
+0x00FA88,
+0x00FA89,
+0x00FA8A,
+0x00FA8B,
+0x00FA8C,
+0x00FA8D,
+0x00FA8E,
+0x00FA8F,
+0x00FA90,
+0x00FA91,
+0x00FA92,
+0x00FA93,
+0x00FA94,
+0x00FA95,
+0x00FA96,
+0x00FA97,
+0x00FA98,
+0x00FA99,
+0x00FA9A,
+0x00FA9B,
+0x00FA9C,
+0x00FA9D,
+0x00FA9E,
+0x00FA9F,
+0x00FAA0,
+0x00FAA1,
+0x00FAA2,
+0x00FAA3,
+0x00FAA4,
+0x00FAA5,
+0x00FAA6,
+0x00FAA7,
+0x00FAA8,
+0x00FAA9,
+0x00FAAA,
+0x00FAAB,
+0x00FAAC,
+0x00FAAD,
+0x00FAAE,
+0x00FAAF,
+0x00FAB0,
+0x00FAB1,
+0x00FAB2,
+0x00FAB3,
+0x00FAB4,
+0x00FAB5,
+0x00FAB6,
+0x00FAB7,
+0x00FAB8,
+0x00FAB9,
+0x00FABA,
+0x00FABB,
+0x00FABC,
+0x00FABD,
+0x00FABE,
+0x00FABF,
+0x00FAC0,
+0x00FAC1,
+0x00FAC2,
+0x00FAC3,
+0x00FAC4,
+0x00FAC5,
+0x00FAC6,
+0x00FAC7,
+0x00FAC8,
+0x00FAC9,
+0x00FACA,
+0x00FACB,
+0x00FACC,
+0x00FACD,
+0x00FACE,
+0x00FACF,
+0x00FAD0,
+0x00FAD1,
+0x00FAD2,
+0x00FAD3,
+0x00FAD4,
+0x00FAD5,
+0x00FAD6,
+0x00FAD7,
+0x00FAD8,
+0x00FAD9,
+0x00FB1D,
+0x00FB1E,
+0x00FB1F,
+0x00FB2A,
+0x00FB2B,
+0x00FB2C,
+0x00FB2D,
+0x00FB2E,
+0x00FB2F,
+0x00FB30,
+0x00FB31,
+0x00FB32,
+0x00FB33,
+0x00FB34,
+0x00FB35,
+0x00FB36,
+0x00FB38,
+0x00FB39,
+0x00FB3A,
+0x00FB3B,
+0x00FB3C,
+0x00FB3E,
+0x00FB40,
+0x00FB41,
+0x00FB43,
+0x00FB44,
+0x00FB46,
+0x00FB47,
+0x00FB48,
+0x00FB49,
+0x00FB4A,
+0x00FB4B,
+0x00FB4C,
+0x00FB4D,
+0x00FB4E,
+0x00FE00,
+0x00FE01,
+0x00FE02,
+0x00FE03,
+0x00FE04,
+0x00FE05,
+0x00FE06,
+0x00FE07,
+0x00FE08,
+0x00FE09,
+0x00FE0A,
+0x00FE0B,
+0x00FE0C,
+0x00FE0D,
+0x00FE0E,
+0x00FE0F,
+0x00FE20,
+0x00FE21,
+0x00FE22,
+0x00FE23,
+0x00FE24,
+0x00FE25,
+0x00FE26,
+0x00FE27,
+0x00FE28,
+0x00FE29,
+0x00FE2A,
+0x00FE2B,
+0x00FE2C,
+0x00FE2D,
+0x00FE2E,
+0x00FE2F,
+0x0101FD,
+0x0102E0,
+0x010376,
+0x010377,
+0x010378,
+0x010379,
+0x01037A,
+0x010A01,
+0x010A02,
+0x010A03,
+0x010A05,
+0x010A06,
+0x010A0C,
+0x010A0D,
+0x010A0E,
+0x010A0F,
+0x010A38,
+0x010A39,
+0x010A3A,
+0x010A3F,
+0x010AE5,
+0x010AE6,
+0x010D24,
+0x010D25,
+0x010D26,
+0x010D27,
+0x010EAB,
+0x010EAC,
+0x010EFD,
+0x010EFE,
+0x010EFF,
+0x010F46,
+0x010F47,
+0x010F48,
+0x010F49,
+0x010F4A,
+0x010F4B,
+0x010F4C,
+0x010F4D,
+0x010F4E,
+0x010F4F,
+0x010F50,
+0x010F82,
+0x010F83,
+0x010F84,
+0x010F85,
+0x011001,
+0x011038,
+0x011039,
+0x01103A,
+0x01103B,
+0x01103C,
+0x01103D,
+0x01103E,
+0x01103F,
+0x011040,
+0x011041,
+0x011042,
+0x011043,
+0x011044,
+0x011045,
+0x011046,
+0x011070,
+0x011073,
+0x011074,
+0x01107F,
+0x011080,
+0x011081,
+0x01109A,
+0x01109C,
+0x0110AB,
+0x0110B3,
+0x0110B4,
+0x0110B5,
+0x0110B6,
+0x0110B9,
+0x0110BA,
+0x0110C2,
+0x011100,
+0x011101,
+0x011102,
+0x011127,
+0x011128,
+0x011129,
+0x01112A,
+0x01112B,
+0x01112D,
+0x01112E,
+0x01112F,
+0x011130,
+0x011131,
+0x011132,
+0x011133,
+0x011134,
+0x011173,
+0x011180,
+0x011181,
+0x0111B6,
+0x0111B7,
+0x0111B8,
+0x0111B9,
+0x0111BA,
+0x0111BB,
+0x0111BC,
+0x0111BD,
+0x0111BE,
+0x0111C0,
+0x0111C9,
+0x0111CA,
+0x0111CB,
+0x0111CC,
+0x0111CF,
+0x01122F,
+0x011230,
+0x011231,
+0x011234,
+0x011235,
+0x011236,
+0x011237,
+0x01123E,
+0x011241,
+0x0112DF,
+0x0112E3,
+0x0112E4,
+0x0112E5,
+0x0112E6,
+0x0112E7,
+0x0112E8,
+0x0112E9,
+0x0112EA,
+0x011300,
+0x011301,
+0x01133B,
+0x01133C,
+0x01133E,
+0x011340,
+0x01134D,
+0x011357,
+0x011366,
+0x011367,
+0x011368,
+0x011369,
+0x01136A,
+0x01136B,
+0x01136C,
+0x011370,
+0x011371,
+0x011372,
+0x011373,
+0x011374,
+0x011438,
+0x011439,
+0x01143A,
+0x01143B,
+0x01143C,
+0x01143D,
+0x01143E,
+0x01143F,
+0x011442,
+0x011443,
+0x011444,
+0x011446,
+0x01145E,
+0x0114B0,
+0x0114B3,
+0x0114B4,
+0x0114B5,
+0x0114B6,
+0x0114B7,
+0x0114B8,
+0x0114BA,
+0x0114BB,
+0x0114BD,
+0x0114BF,
+0x0114C0,
+0x0114C2,
+0x0114C3,
+0x0115AF,
+0x0115B2,
+0x0115B3,
+0x0115B4,
+0x0115B5,
+0x0115BC,
+0x0115BD,
+0x0115BF,
+0x0115C0,
+0x0115DC,
+0x0115DD,
+0x011633,
+0x011634,
+0x011635,
+0x011636,
+0x011637,
+0x011638,
+0x011639,
+0x01163A,
+0x01163D,
+0x01163F,
+0x011640,
+0x0116AB,
+0x0116AD,
+0x0116B0,
+0x0116B1,
+0x0116B2,
+0x0116B3,
+0x0116B4,
+0x0116B5,
+0x0116B6,
+0x0116B7,
+0x01171D,
+0x01171E,
+0x01171F,
+0x011722,
+0x011723,
+0x011724,
+0x011725,
+0x011727,
+0x011728,
+0x011729,
+0x01172A,
+0x01172B,
+0x01182F,
+0x011830,
+0x011831,
+0x011832,
+0x011833,
+0x011834,
+0x011835,
+0x011836,
+0x011837,
+0x011839,
+0x01183A,
+0x011930,
+0x01193B,
+0x01193C,
+0x01193D,
+0x01193E,
+0x011943,
+0x0119D4,
+0x0119D5,
+0x0119D6,
+0x0119D7,
+0x0119DA,
+0x0119DB,
+0x0119E0,
+0x011A01,
+0x011A02,
+0x011A03,
+0x011A04,
+0x011A05,
+0x011A06,
+0x011A07,
+0x011A08,
+0x011A09,
+0x011A0A,
+0x011A33,
+0x011A34,
+0x011A35,
+0x011A36,
+0x011A37,
+0x011A38,
+0x011A3B,
+0x011A3C,
+0x011A3D,
+0x011A3E,
+0x011A47,
+0x011A51,
+0x011A52,
+0x011A53,
+0x011A54,
+0x011A55,
+0x011A56,
+0x011A59,
+0x011A5A,
+0x011A5B,
+0x011A8A,
+0x011A8B,
+0x011A8C,
+0x011A8D,
+0x011A8E,
+0x011A8F,
+0x011A90,
+0x011A91,
+0x011A92,
+0x011A93,
+0x011A94,
+0x011A95,
+0x011A96,
+0x011A98,
+0x011A99,
+0x011C30,
+0x011C31,
+0x011C32,
+0x011C33,
+0x011C34,
+0x011C35,
+0x011C36,
+0x011C38,
+0x011C39,
+0x011C3A,
+0x011C3B,
+0x011C3C,
+0x011C3D,
+0x011C3F,
+0x011C92,
+0x011C93,
+0x011C94,
+0x011C95,
+0x011C96,
+0x011C97,
+0x011C98,
+0x011C99,
+0x011C9A,
+0x011C9B,
+0x011C9C,
+0x011C9D,
+0x011C9E,
+0x011C9F,
+0x011CA0,
+0x011CA1,
+0x011CA2,
+0x011CA3,
+0x011CA4,
+0x011CA5,
+0x011CA6,
+0x011CA7,
+0x011CAA,
+0x011CAB,
+0x011CAC,
+0x011CAD,
+0x011CAE,
+0x011CAF,
+0x011CB0,
+0x011CB2,
+0x011CB3,
+0x011CB5,
+0x011CB6,
+0x011D31,
+0x011D32,
+0x011D33,
+0x011D34,
+0x011D35,
+0x011D36,
+0x011D3A,
+0x011D3C,
+0x011D3D,
+0x011D3F,
+0x011D40,
+0x011D41,
+0x011D42,
+0x011D43,
+0x011D44,
+0x011D45,
+0x011D47,
+0x011D90,
+0x011D91,
+0x011D95,
+0x011D97,
+0x011EF3,
+0x011EF4,
+0x011F00,
+0x011F01,
+0x011F36,
+0x011F37,
+0x011F38,
+0x011F39,
+0x011F3A,
+0x011F40,
+0x011F41,
+0x011F42,
+0x013440,
+0x013447,
+0x013448,
+0x013449,
+0x01344A,
+0x01344B,
+0x01344C,
+0x01344D,
+0x01344E,
+0x01344F,
+0x013450,
+0x013451,
+0x013452,
+0x013453,
+0x013454,
+0x013455,
+0x016AF0,
+0x016AF1,
+0x016AF2,
+0x016AF3,
+0x016AF4,
+0x016B30,
+0x016B31,
+0x016B32,
+0x016B33,
+0x016B34,
+0x016B35,
+0x016B36,
+0x016F4F,
+0x016F8F,
+0x016F90,
+0x016F91,
+0x016F92,
+0x016FE4,
+0x016FF0,
+0x016FF1,
+0x01BC9D,
+0x01BC9E,
+0x01CF00,
+0x01CF01,
+0x01CF02,
+0x01CF03,
+0x01CF04,
+0x01CF05,
+0x01CF06,
+0x01CF07,
+0x01CF08,
+0x01CF09,
+0x01CF0A,
+0x01CF0B,
+0x01CF0C,
+0x01CF0D,
+0x01CF0E,
+0x01CF0F,
+0x01CF10,
+0x01CF11,
+0x01CF12,
+0x01CF13,
+0x01CF14,
+0x01CF15,
+0x01CF16,
+0x01CF17,
+0x01CF18,
+0x01CF19,
+0x01CF1A,
+0x01CF1B,
+0x01CF1C,
+0x01CF1D,
+0x01CF1E,
+0x01CF1F,
+0x01CF20,
+0x01CF21,
+0x01CF22,
+0x01CF23,
+0x01CF24,
+0x01CF25,
+0x01CF26,
+0x01CF27,
+0x01CF28,
+0x01CF29,
+0x01CF2A,
+0x01CF2B,
+0x01CF2C,
+0x01CF2D,
+0x01CF30,
+0x01CF31,
+0x01CF32,
+0x01CF33,
+0x01CF34,
+0x01CF35,
+0x01CF36,
+0x01CF37,
+0x01CF38,
+0x01CF39,
+0x01CF3A,
+0x01CF3B,
+0x01CF3C,
+0x01CF3D,
+0x01CF3E,
+0x01CF3F,
+0x01CF40,
+0x01CF41,
+0x01CF42,
+0x01CF43,
+0x01CF44,
+0x01CF45,
+0x01CF46,
+0x01D15E,
+0x01D15F,
+0x01D160,
+0x01D161,
+0x01D162,
+0x01D163,
+0x01D164,
+0x01D165,
+0x01D166,
+0x01D167,
+0x01D168,
+0x01D169,
+0x01D16D,
+0x01D16E,
+0x01D16F,
+0x01D170,
+0x01D171,
+0x01D172,
+0x01D17B,
+0x01D17C,
+0x01D17D,
+0x01D17E,
+0x01D17F,
+0x01D180,
+0x01D181,
+0x01D182,
+0x01D185,
+0x01D186,
+0x01D187,
+0x01D188,
+0x01D189,
+0x01D18A,
+0x01D18B,
+0x01D1AA,
+0x01D1AB,
+0x01D1AC,
+0x01D1AD,
+0x01D1BB,
+0x01D1BC,
+0x01D1BD,
+0x01D1BE,
+0x01D1BF,
+0x01D1C0,
+0x01D242,
+0x01D243,
+0x01D244,
+0x01DA00,
+0x01DA01,
+0x01DA02,
+0x01DA03,
+0x01DA04,
+0x01DA05,
+0x01DA06,
+0x01DA07,
+0x01DA08,
+0x01DA09,
+0x01DA0A,
+0x01DA0B,
+0x01DA0C,
+0x01DA0D,
+0x01DA0E,
+0x01DA0F,
+0x01DA10,
+0x01DA11,
+0x01DA12,
+0x01DA13,
+0x01DA14,
+0x01DA15,
+0x01DA16,
+0x01DA17,
+0x01DA18,
+0x01DA19,
+0x01DA1A,
+0x01DA1B,
+0x01DA1C,
+0x01DA1D,
+0x01DA1E,
+0x01DA1F,
+0x01DA20,
+0x01DA21,
+0x01DA22,
+0x01DA23,
+0x01DA24,
+0x01DA25,
+0x01DA26,
+0x01DA27,
+0x01DA28,
+0x01DA29,
+0x01DA2A,
+0x01DA2B,
+0x01DA2C,
+0x01DA2D,
+0x01DA2E,
+0x01DA2F,
+0x01DA30,
+0x01DA31,
+0x01DA32,
+0x01DA33,
+0x01DA34,
+0x01DA35,
+0x01DA36,
+0x01DA3B,
+0x01DA3C,
+0x01DA3D,
+0x01DA3E,
+0x01DA3F,
+0x01DA40,
+0x01DA41,
+0x01DA42,
+0x01DA43,
+0x01DA44,
+0x01DA45,
+0x01DA46,
+0x01DA47,
+0x01DA48,
+0x01DA49,
+0x01DA4A,
+0x01DA4B,
+0x01DA4C,
+0x01DA4D,
+0x01DA4E,
+0x01DA4F,
+0x01DA50,
+0x01DA51,
+0x01DA52,
+0x01DA53,
+0x01DA54,
+0x01DA55,
+0x01DA56,
+0x01DA57,
+0x01DA58,
+0x01DA59,
+0x01DA5A,
+0x01DA5B,
+0x01DA5C,
+0x01DA5D,
+0x01DA5E,
+0x01DA5F,
+0x01DA60,
+0x01DA61,
+0x01DA62,
+0x01DA63,
+0x01DA64,
+0x01DA65,
+0x01DA66,
+0x01DA67,
+0x01DA68,
+0x01DA69,
+0x01DA6A,
+0x01DA6B,
+0x01DA6C,
+0x01DA75,
+0x01DA84,
+0x01DA9B,
+0x01DA9C,
+0x01DA9D,
+0x01DA9E,
+0x01DA9F,
+0x01DAA1,
+0x01DAA2,
+0x01DAA3,
+0x01DAA4,
+0x01DAA5,
+0x01DAA6,
+0x01DAA7,
+0x01DAA8,
+0x01DAA9,
+0x01DAAA,
+0x01DAAB,
+0x01DAAC,
+0x01DAAD,
+0x01DAAE,
+0x01DAAF,
+0x01E000,
+0x01E001,
+0x01E002,
+0x01E003,
+0x01E004,
+0x01E005,
+0x01E006,
+0x01E008,
+0x01E009,
+0x01E00A,
+0x01E00B,
+0x01E00C,
+0x01E00D,
+0x01E00E,
+0x01E00F,
+0x01E010,
+0x01E011,
+0x01E012,
+0x01E013,
+0x01E014,
+0x01E015,
+0x01E016,
+0x01E017,
+0x01E018,
+0x01E01B,
+0x01E01C,
+0x01E01D,
+0x01E01E,
+0x01E01F,
+0x01E020,
+0x01E021,
+0x01E023,
+0x01E024,
+0x01E026,
+0x01E027,
+0x01E028,
+0x01E029,
+0x01E02A,
+0x01E08F,
+0x01E130,
+0x01E131,
+0x01E132,
+0x01E133,
+0x01E134,
+0x01E135,
+0x01E136,
+0x01E2AE,
+0x01E2EC,
+0x01E2ED,
+0x01E2EE,
+0x01E2EF,
+0x01E4EC,
+0x01E4ED,
+0x01E4EE,
+0x01E4EF,
+0x01E8D0,
+0x01E8D1,
+0x01E8D2,
+0x01E8D3,
+0x01E8D4,
+0x01E8D5,
+0x01E8D6,
+0x01E944,
+0x01E945,
+0x01E946,
+0x01E947,
+0x01E948,
+0x01E949,
+0x01E94A,
+0x02F800,
+0x02F801,
+0x02F802,
+0x02F803,
+0x02F804,
+0x02F805,
+0x02F806,
+0x02F807,
+0x02F808,
+0x02F809,
+0x02F80A,
+0x02F80B,
+0x02F80C,
+0x02F80D,
+0x02F80E,
+0x02F80F,
+0x02F810,
+0x02F811,
+0x02F812,
+0x02F813,
+0x02F814,
+0x02F815,
+0x02F816,
+0x02F817,
+0x02F818,
+0x02F819,
+0x02F81A,
+0x02F81B,
+0x02F81C,
+0x02F81D,
+0x02F81E,
+0x02F81F,
+0x02F820,
+0x02F821,
+0x02F822,
+0x02F823,
+0x02F824,
+0x02F825,
+0x02F826,
+0x02F827,
+0x02F828,
+0x02F829,
+0x02F82A,
+0x02F82B,
+0x02F82C,
+0x02F82D,
+0x02F82E,
+0x02F82F,
+0x02F830,
+0x02F831,
+0x02F832,
+0x02F833,
+0x02F834,
+0x02F835,
+0x02F836,
+0x02F837,
+0x02F838,
+0x02F839,
+0x02F83A,
+0x02F83B,
+0x02F83C,
+0x02F83D,
+0x02F83E,
+0x02F83F,
+0x02F840,
+0x02F841,
+0x02F842,
+0x02F843,
+0x02F844,
+0x02F845,
+0x02F846,
+0x02F847,
+0x02F848,
+0x02F849,
+0x02F84A,
+0x02F84B,
+0x02F84C,
+0x02F84D,
+0x02F84E,
+0x02F84F,
+0x02F850,
+0x02F851,
+0x02F852,
+0x02F853,
+0x02F854,
+0x02F855,
+0x02F856,
+0x02F857,
+0x02F858,
+0x02F859,
+0x02F85A,
+0x02F85B,
+0x02F85C,
+0x02F85D,
+0x02F85E,
+0x02F85F,
+0x02F860,
+0x02F861,
+0x02F862,
+0x02F863,
+0x02F864,
+0x02F865,
+0x02F866,
+0x02F867,
+0x02F868,
+0x02F869,
+0x02F86A,
+0x02F86B,
+0x02F86C,
+0x02F86D,
+0x02F86E,
+0x02F86F,
+0x02F870,
+0x02F871,
+0x02F872,
+0x02F873,
+0x02F874,
+0x02F875,
+0x02F876,
+0x02F877,
+0x02F878,
+0x02F879,
+0x02F87A,
+0x02F87B,
+0x02F87C,
+0x02F87D,
+0x02F87E,
+0x02F87F,
+0x02F880,
+0x02F881,
+0x02F882,
+0x02F883,
+0x02F884,
+0x02F885,
+0x02F886,
+0x02F887,
+0x02F888,
+0x02F889,
+0x02F88A,
+0x02F88B,
+0x02F88C,
+0x02F88D,
+0x02F88E,
+0x02F88F,
+0x02F890,
+0x02F891,
+0x02F892,
+0x02F893,
+0x02F894,
+0x02F895,
+0x02F896,
+0x02F897,
+0x02F898,
+0x02F899,
+0x02F89A,
+0x02F89B,
+0x02F89C,
+0x02F89D,
+0x02F89E,
+0x02F89F,
+0x02F8A0,
+0x02F8A1,
+0x02F8A2,
+0x02F8A3,
+0x02F8A4,
+0x02F8A5,
+0x02F8A6,
+0x02F8A7,
+0x02F8A8,
+0x02F8A9,
+0x02F8AA,
+0x02F8AB,
+0x02F8AC,
+0x02F8AD,
+0x02F8AE,
+0x02F8AF,
+0x02F8B0,
+0x02F8B1,
+0x02F8B2,
+0x02F8B3,
+0x02F8B4,
+0x02F8B5,
+0x02F8B6,
+0x02F8B7,
+0x02F8B8,
+0x02F8B9,
+0x02F8BA,
+0x02F8BB,
+0x02F8BC,
+0x02F8BD,
+0x02F8BE,
+0x02F8BF,
+0x02F8C0,
+0x02F8C1,
+0x02F8C2,
+0x02F8C3,
+0x02F8C4,
+0x02F8C5,
+0x02F8C6,
+0x02F8C7,
+0x02F8C8,
+0x02F8C9,
+0x02F8CA,
+0x02F8CB,
+0x02F8CC,
+0x02F8CD,
+0x02F8CE,
+0x02F8CF,
+0x02F8D0,
+0x02F8D1,
+0x02F8D2,
+0x02F8D3,
+0x02F8D4,
+0x02F8D5,
+0x02F8D6,
+0x02F8D7,
+0x02F8D8,
+0x02F8D9,
+0x02F8DA,
+0x02F8DB,
+0x02F8DC,
+0x02F8DD,
+0x02F8DE,
+0x02F8DF,
+0x02F8E0,
+0x02F8E1,
+0x02F8E2,
+0x02F8E3,
+0x02F8E4,
+0x02F8E5,
+0x02F8E6,
+0x02F8E7,
+0x02F8E8,
+0x02F8E9,
+0x02F8EA,
+0x02F8EB,
+0x02F8EC,
+0x02F8ED,
+0x02F8EE,
+0x02F8EF,
+0x02F8F0,
+0x02F8F1,
+0x02F8F2,
+0x02F8F3,
+0x02F8F4,
+0x02F8F5,
+0x02F8F6,
+0x02F8F7,
+0x02F8F8,
+0x02F8F9,
+0x02F8FA,
+0x02F8FB,
+0x02F8FC,
+0x02F8FD,
+0x02F8FE,
+0x02F8FF,
+0x02F900,
+0x02F901,
+0x02F902,
+0x02F903,
+0x02F904,
+0x02F905,
+0x02F906,
+0x02F907,
+0x02F908,
+0x02F909,
+0x02F90A,
+0x02F90B,
+0x02F90C,
+0x02F90D,
+0x02F90E,
+0x02F90F,
+0x02F910,
+0x02F911,
+0x02F912,
+0x02F913,
+0x02F914,
+0x02F915,
+0x02F916,
+0x02F917,
+0x02F918,
+0x02F919,
+0x02F91A,
+0x02F91B,
+0x02F91C,
+0x02F91D,
+0x02F91E,
+0x02F91F,
+0x02F920,
+0x02F921,
+0x02F922,
+0x02F923,
+0x02F924,
+0x02F925,
+0x02F926,
+0x02F927,
+0x02F928,
+0x02F929,
+0x02F92A,
+0x02F92B,
+0x02F92C,
+0x02F92D,
+0x02F92E,
+0x02F92F,
+0x02F930,
+0x02F931,
+0x02F932,
+0x02F933,
+0x02F934,
+0x02F935,
+0x02F936,
+0x02F937,
+0x02F938,
+0x02F939,
+0x02F93A,
+0x02F93B,
+0x02F93C,
+0x02F93D,
+0x02F93E,
+0x02F93F,
+0x02F940,
+0x02F941,
+0x02F942,
+0x02F943,
+0x02F944,
+0x02F945,
+0x02F946,
+0x02F947,
+0x02F948,
+0x02F949,
+0x02F94A,
+0x02F94B,
+0x02F94C,
+0x02F94D,
+0x02F94E,
+0x02F94F,
+0x02F950,
+0x02F951,
+0x02F952,
+0x02F953,
+0x02F954,
+0x02F955,
+0x02F956,
+0x02F957,
+0x02F958,
+0x02F959,
+0x02F95A,
+0x02F95B,
+0x02F95C,
+0x02F95D,
+0x02F95E,
+0x02F95F,
+0x02F960,
+0x02F961,
+0x02F962,
+0x02F963,
+0x02F964,
+0x02F965,
+0x02F966,
+0x02F967,
+0x02F968,
+0x02F969,
+0x02F96A,
+0x02F96B,
+0x02F96C,
+0x02F96D,
+0x02F96E,
+0x02F96F,
+0x02F970,
+0x02F971,
+0x02F972,
+0x02F973,
+0x02F974,
+0x02F975,
+0x02F976,
+0x02F977,
+0x02F978,
+0x02F979,
+0x02F97A,
+0x02F97B,
+0x02F97C,
+0x02F97D,
+0x02F97E,
+0x02F97F,
+0x02F980,
+0x02F981,
+0x02F982,
+0x02F983,
+0x02F984,
+0x02F985,
+0x02F986,
+0x02F987,
+0x02F988,
+0x02F989,
+0x02F98A,
+0x02F98B,
+0x02F98C,
+0x02F98D,
+0x02F98E,
+0x02F98F,
+0x02F990,
+0x02F991,
+0x02F992,
+0x02F993,
+0x02F994,
+0x02F995,
+0x02F996,
+0x02F997,
+0x02F998,
+0x02F999,
+0x02F99A,
+0x02F99B,
+0x02F99C,
+0x02F99D,
+0x02F99E,
+0x02F99F,
+0x02F9A0,
+0x02F9A1,
+0x02F9A2,
+0x02F9A3,
+0x02F9A4,
+0x02F9A5,
+0x02F9A6,
+0x02F9A7,
+0x02F9A8,
+0x02F9A9,
+0x02F9AA,
+0x02F9AB,
+0x02F9AC,
+0x02F9AD,
+0x02F9AE,
+0x02F9AF,
+0x02F9B0,
+0x02F9B1,
+0x02F9B2,
+0x02F9B3,
+0x02F9B4,
+0x02F9B5,
+0x02F9B6,
+0x02F9B7,
+0x02F9B8,
+0x02F9B9,
+0x02F9BA,
+0x02F9BB,
+0x02F9BC,
+0x02F9BD,
+0x02F9BE,
+0x02F9BF,
+0x02F9C0,
+0x02F9C1,
+0x02F9C2,
+0x02F9C3,
+0x02F9C4,
+0x02F9C5,
+0x02F9C6,
+0x02F9C7,
+0x02F9C8,
+0x02F9C9,
+0x02F9CA,
+0x02F9CB,
+0x02F9CC,
+0x02F9CD,
+0x02F9CE,
+0x02F9CF,
+0x02F9D0,
+0x02F9D1,
+0x02F9D2,
+0x02F9D3,
+0x02F9D4,
+0x02F9D5,
+0x02F9D6,
+0x02F9D7,
+0x02F9D8,
+0x02F9D9,
+0x02F9DA,
+0x02F9DB,
+0x02F9DC,
+0x02F9DD,
+0x02F9DE,
+0x02F9DF,
+0x02F9E0,
+0x02F9E1,
+0x02F9E2,
+0x02F9E3,
+0x02F9E4,
+0x02F9E5,
+0x02F9E6,
+0x02F9E7,
+0x02F9E8,
+0x02F9E9,
+0x02F9EA,
+0x02F9EB,
+0x02F9EC,
+0x02F9ED,
+0x02F9EE,
+0x02F9EF,
+0x02F9F0,
+0x02F9F1,
+0x02F9F2,
+0x02F9F3,
+0x02F9F4,
+0x02F9F5,
+0x02F9F6,
+0x02F9F7,
+0x02F9F8,
+0x02F9F9,
+0x02F9FA,
+0x02F9FB,
+0x02F9FC,
+0x02F9FD,
+0x02F9FE,
+0x02F9FF,
+0x02FA00,
+0x02FA01,
+0x02FA02,
+0x02FA03,
+0x02FA04,
+0x02FA05,
+0x02FA06,
+0x02FA07,
+0x02FA08,
+0x02FA09,
+0x02FA0A,
+0x02FA0B,
+0x02FA0C,
+0x02FA0D,
+0x02FA0E,
+0x02FA0F,
+0x02FA10,
+0x02FA11,
+0x02FA12,
+0x02FA13,
+0x02FA14,
+0x02FA15,
+0x02FA16,
+0x02FA17,
+0x02FA18,
+0x02FA19,
+0x02FA1A,
+0x02FA1B,
+0x02FA1C,
+0x02FA1D,
+0x0E0100,
+0x0E0101,
+0x0E0102,
+0x0E0103,
+0x0E0104,
+0x0E0105,
+0x0E0106,
+0x0E0107,
+0x0E0108,
+0x0E0109,
+0x0E010A,
+0x0E010B,
+0x0E010C,
+0x0E010D,
+0x0E010E,
+0x0E010F,
+0x0E0110,
+0x0E0111,
+0x0E0112,
+0x0E0113,
+0x0E0114,
+0x0E0115,
+0x0E0116,
+0x0E0117,
+0x0E0118,
+0x0E0119,
+0x0E011A,
+0x0E011B,
+0x0E011C,
+0x0E011D,
+0x0E011E,
+0x0E011F,
+0x0E0120,
+0x0E0121,
+0x0E0122,
+0x0E0123,
+0x0E0124,
+0x0E0125,
+0x0E0126,
+0x0E0127,
+0x0E0128,
+0x0E0129,
+0x0E012A,
+0x0E012B,
+0x0E012C,
+0x0E012D,
+0x0E012E,
+0x0E012F,
+0x0E0130,
+0x0E0131,
+0x0E0132,
+0x0E0133,
+0x0E0134,
+0x0E0135,
+0x0E0136,
+0x0E0137,
+0x0E0138,
+0x0E0139,
+0x0E013A,
+0x0E013B,
+0x0E013C,
+0x0E013D,
+0x0E013E,
+0x0E013F,
+0x0E0140,
+0x0E0141,
+0x0E0142,
+0x0E0143,
+0x0E0144,
+0x0E0145,
+0x0E0146,
+0x0E0147,
+0x0E0148,
+0x0E0149,
+0x0E014A,
+0x0E014B,
+0x0E014C,
+0x0E014D,
+0x0E014E,
+0x0E014F,
+0x0E0150,
+0x0E0151,
+0x0E0152,
+0x0E0153,
+0x0E0154,
+0x0E0155,
+0x0E0156,
+0x0E0157,
+0x0E0158,
+0x0E0159,
+0x0E015A,
+0x0E015B,
+0x0E015C,
+0x0E015D,
+0x0E015E,
+0x0E015F,
+0x0E0160,
+0x0E0161,
+0x0E0162,
+0x0E0163,
+0x0E0164,
+0x0E0165,
+0x0E0166,
+0x0E0167,
+0x0E0168,
+0x0E0169,
+0x0E016A,
+0x0E016B,
+0x0E016C,
+0x0E016D,
+0x0E016E,
+0x0E016F,
+0x0E0170,
+0x0E0171,
+0x0E0172,
+0x0E0173,
+0x0E0174,
+0x0E0175,
+0x0E0176,
+0x0E0177,
+0x0E0178,
+0x0E0179,
+0x0E017A,
+0x0E017B,
+0x0E017C,
+0x0E017D,
+0x0E017E,
+0x0E017F,
+0x0E0180,
+0x0E0181,
+0x0E0182,
+0x0E0183,
+0x0E0184,
+0x0E0185,
+0x0E0186,
+0x0E0187,
+0x0E0188,
+0x0E0189,
+0x0E018A,
+0x0E018B,
+0x0E018C,
+0x0E018D,
+0x0E018E,
+0x0E018F,
+0x0E0190,
+0x0E0191,
+0x0E0192,
+0x0E0193,
+0x0E0194,
+0x0E0195,
+0x0E0196,
+0x0E0197,
+0x0E0198,
+0x0E0199,
+0x0E019A,
+0x0E019B,
+0x0E019C,
+0x0E019D,
+0x0E019E,
+0x0E019F,
+0x0E01A0,
+0x0E01A1,
+0x0E01A2,
+0x0E01A3,
+0x0E01A4,
+0x0E01A5,
+0x0E01A6,
+0x0E01A7,
+0x0E01A8,
+0x0E01A9,
+0x0E01AA,
+0x0E01AB,
+0x0E01AC,
+0x0E01AD,
+0x0E01AE,
+0x0E01AF,
+0x0E01B0,
+0x0E01B1,
+0x0E01B2,
+0x0E01B3,
+0x0E01B4,
+0x0E01B5,
+0x0E01B6,
+0x0E01B7,
+0x0E01B8,
+0x0E01B9,
+0x0E01BA,
+0x0E01BB,
+0x0E01BC,
+0x0E01BD,
+0x0E01BE,
+0x0E01BF,
+0x0E01C0,
+0x0E01C1,
+0x0E01C2,
+0x0E01C3,
+0x0E01C4,
+0x0E01C5,
+0x0E01C6,
+0x0E01C7,
+0x0E01C8,
+0x0E01C9,
+0x0E01CA,
+0x0E01CB,
+0x0E01CC,
+0x0E01CD,
+0x0E01CE,
+0x0E01CF,
+0x0E01D0,
+0x0E01D1,
+0x0E01D2,
+0x0E01D3,
+0x0E01D4,
+0x0E01D5,
+0x0E01D6,
+0x0E01D7,
+0x0E01D8,
+0x0E01D9,
+0x0E01DA,
+0x0E01DB,
+0x0E01DC,
+0x0E01DD,
+0x0E01DE,
+0x0E01DF,
+0x0E01E0,
+0x0E01E1,
+0x0E01E2,
+0x0E01E3,
+0x0E01E4,
+0x0E01E5,
+0x0E01E6,
+0x0E01E7,
+0x0E01E8,
+0x0E01E9,
+0x0E01EA,
+0x0E01EB,
+0x0E01EC,
+0x0E01ED,
+0x0E01EE,
+0x0E01EF,
+};
+//bits 0-23: offset into unicode_folding_data, bits 24-30: length in bytes, bit 31: interacts with its predecessor
+static const uint32_t unicode_folding_target_table[] = {
+0x01000000,
+0x01000001,
+0x01000002,
+0x01000003,
+0x01000004,
+0x01000005,
+0x01000006,
+0x01000007,
+0x01000008,
+0x01000009,
+0x0100000A,
+0x0100000B,
+0x0100000C,
+0x0100000D,
+0x0100000E,
+0x0100000F,
+0x01000010,
+0x01000011,
+0x01000012,
+0x01000013,
+0x01000014,
+0x01000015,
+0x01000016,
+0x01000017,
+0x01000018,
+0x01000019,
+0x0100001A,
+0x0100001B,
+0x0100001C,
+0x0100001D,
+0x0100001E,
+0x0100001F,
+0x01000020,
+0x01000021,
+0x01000022,
+0x01000023,
+0x01000024,
+0x01000025,
+0x01000026,
+0x01000027,
+0x01000028,
+0x01000029,
+0x0100002A,
+0x0100002B,
+0x0100002C,
+0x0100002D,
+0x0100002E,
+0x0100002F,
+0x01000030,
+0x01000031,
+0x01000032,
+0x01000033,
+0x01000034,
+0x01000035,
+0x01000036,
+0x01000037,
+0x01000038,
+0x01000039,
+0x0100003A,
+0x0100003B,
+0x0100003C,
+0x0100003D,
+0x0100003E,
+0x0100003F,
+0x01000040,
+0x01000041,
+0x01000042,
+0x01000043,
+0x01000044,
+0x01000045,
+0x01000046,
+0x01000047,
+0x01000048,
+0x01000049,
+0x0100004A,
+0x0100004B,
+0x0100004C,
+0x0100004D,
+0x0100004E,
+0x0100004F,
+0x01000050,
+0x01000051,
+0x01000052,
+0x01000053,
+0x01000054,
+0x01000055,
+0x01000056,
+0x01000057,
+0x01000058,
+0x01000059,
+0x0100005A,
+0x0100005B,
+0x0100005C,
+0x0100005D,
+0x0100005E,
+0x0100005F,
+0x01000060,
+0x01000061,
+0x01000062,
+0x01000063,
+0x01000064,
+0x01000065,
+0x01000066,
+0x01000067,
+0x01000068,
+0x01000069,
+0x0100006A,
+0x0100006B,
+0x0100006C,
+0x0100006D,
+0x0100006E,
+0x0100006F,
+0x01000070,
+0x01000071,
+0x01000072,
+0x01000073,
+0x01000074,
+0x01000075,
+0x01000076,
+0x01000077,
+0x01000078,
+0x01000079,
+0x0100007A,
+0x0100007B,
+0x0100007C,
+0x0100007D,
+0x0100007E,
+0x0100007F,
+0x01000080,
+0x01000081,
+0x01000082,
+0x01000083,
+0x01000084,
+0x01000085,
+0x01000086,
+0x01000087,
+0x01000088,
+0x01000089,
+0x0100008A,
+0x0100008B,
+0x0100008C,
+0x0100008D,
+0x0100008E,
+0x0100008F,
+0x01000090,
+0x01000091,
+0x01000092,
+0x01000093,
+0x01000094,
+0x01000095,
+0x01000096,
+0x01000097,
+0x01000098,
+0x01000099,
+0x0100009A,
+0x0100009B,
+0x0100009C,
+0x0100009D,
+0x0100009E,
+0x0100009F,
+0x010000A0,
+0x010000A1,
+0x010000A2,
+0x010000A3,
+0x010000A4,
+0x010000A5,
+0x010000A6,
+0x010000A7,
+0x010000A8,
+0x010000A9,
+0x010000AA,
+0x010000AB,
+0x010000AC,
+0x010000AD,
+0x010000AE,
+0x010000AF,
+0x010000B0,
+0x010000B1,
+0x010000B2,
+0x010000B3,
+0x010000B4,
+0x010000B5,
+0x010000B6,
+0x010000B7,
+0x010000B8,
+0x020000B9,
+0x020000BB,
+0x010000BD,
+0x010000BE,
+0x010000BF,
+0x010000C0,
+0x010000C1,
+0x010000C2,
+0x010000C3,
+0x010000C4,
+0x020000C5,
+0x020000C7,
+0x010000C9,
+0x010000CA,
+0x010000CB,
+0x010000CC,
+0x010000CD,
+0x010000CE,
+0x010000CF,
+0x020000D0,
+0x020000D2,
+0x020000D4,
+0x020000D6,
+0x010000D8,
+0x010000D9,
+0x010000DA,
+0x010000DB,
+0x010000DC,
+0x010000DD,
+0x010000DE,
+0x010000DF,
+0x010000E0,
+0x010000E1,
+0x010000E2,
+0x010000E3,
+0x010000E4,
+0x010000E5,
+0x010000E6,
+0x010000E7,
+0x010000E8,
+0x010000E9,
+0x010000EA,
+0x010000EB,
+0x010000EC,
+0x010000ED,
+0x010000EE,
+0x010000EF,
+0x010000F0,
+0x010000F1,
+0x010000F2,
+0x010000F3,
+0x010000F4,
+0x010000F5,
+0x010000F6,
+0x010000F7,
+0x010000F8,
+0x010000F9,
+0x010000FA,
+0x010000FB,
+0x010000FC,
+0x010000FD,
+0x010000FE,
+0x010000FF,
+0x01000100,
+0x01000101,
+0x01000102,
+0x01000103,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x00000104,
+0x02000104,
+0x01000106,
+0x02000107,
+0x02000109,
+0x0200010B,
+0x0200010D,
+0x0200010F,
+0x02000111,
+0x02000113,
+0x02000115,
+0x02000117,
+0x02000119,
+0x0200011B,
+0x0200011D,
+0x0200011F,
+0x02000121,
+0x02000123,
+0x02000125,
+0x02000127,
+0x02000129,
+0x0200012B,
+0x0200012D,
+0x0200012F,
+0x02000131,
+0x02000133,
+0x02000135,
+0x02000137,
+0x02000139,
+0x0200013B,
+0x0200013D,
+0x0200013F,
+0x02000141,
+0x02000143,
+0x02000145,
+0x02000147,
+0x02000149,
+0x0200014B,
+0x0200014D,
+0x0200014F,
+0x02000151,
+0x02000153,
+0x02000155,
+0x02000157,
+0x02000159,
+0x0000015B,
+0x0000015B,
+0x0000015B,
+0x0000015B,
+0x0000015B,
+0x0200015B,
+0x0200015D,
+0x0200015F,
+0x02000161,
+0x02000163,
+0x02000165,
+0x02000167,
+0x02000169,
+0x0200016B,
+0x0200016D,
+0x0200016F,
+0x02000171,
+0x02000173,
+0x02000175,
+0x02000177,
+0x02000179,
+0x0200017B,
+0x0200017D,
+0x0200017F,
+0x02000181,
+0x02000183,
+0x02000185,
+0x02000187,
+0x02000189,
+0x0200018B,
+0x0200018D,
+0x0200018F,
+0x02000191,
+0x02000193,
+0x02000195,
+0x02000197,
+0x02000199,
+0x0200019B,
+0x0200019D,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0000019F,
+0x0200019F,
+0x020001A1,
+0x020001A3,
+0x020001A5,
+0x020001A7,
+0x000001A9,
+0x000001A9,
+0x000001A9,
+0x000001A9,
+0x000001A9,
+0x000001A9,
+0x000001A9,
+0x000001A9,
+0x000001A9,
+0x000001A9,
+0x000001A9,
+0x000001A9,
+0x000001A9,
+0x000001A9,
+0x000001A9,
+0x000001A9,
+0x000001A9,
+0x000001A9,
+0x000001A9,
+0x000001A9,
+0x000001A9,
+0x000001A9,
+0x020001A9,
+0x020001AB,
+0x020001AD,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x000001AF,
+0x030001AF,
+0x030001B2,
+0x030001B5,
+0x000001B8,
+0x000001B8,
+0x000001B8,
+0x000001B8,
+0x000001B8,
+0x000001B8,
+0x000001B8,
+0x000001B8,
+0x000001B8,
+0x000001B8,
+0x000001B8,
+0x000001B8,
+0x000001B8,
+0x000001B8,
+0x000001B8,
+0x000001B8,
+0x000001B8,
+0x000001B8,
+0x030001B8,
+0x030001BB,
+0x030001BE,
+0x030001C1,
+0x030001C4,
+0x030001C7,
+0x030001CA,
+0x030001CD,
+0x000001D0,
+0x000001D0,
+0x000001D0,
+0x000001D0,
+0x830001D0,
+0x000001D3,
+0x000001D3,
+0x000001D3,
+0x000001D3,
+0x000001D3,
+0x830001D3,
+0x030001D6,
+0x030001D9,
+0x030001DC,
+0x000001DF,
+0x000001DF,
+0x000001DF,
+0x000001DF,
+0x000001DF,
+0x030001DF,
+0x030001E2,
+0x000001E5,
+0x000001E5,
+0x000001E5,
+0x000001E5,
+0x000001E5,
+0x000001E5,
+0x000001E5,
+0x000001E5,
+0x000001E5,
+0x030001E5,
+0x030001E8,
+0x030001EB,
+0x030001EE,
+0x000001F1,
+0x000001F1,
+0x000001F1,
+0x000001F1,
+0x000001F1,
+0x000001F1,
+0x000001F1,
+0x000001F1,
+0x000001F1,
+0x000001F1,
+0x000001F1,
+0x000001F1,
+0x000001F1,
+0x000001F1,
+0x000001F1,
+0x000001F1,
+0x000001F1,
+0x000001F1,
+0x000001F1,
+0x000001F1,
+0x000001F1,
+0x000001F1,
+0x000001F1,
+0x000001F1,
+0x830001F1,
+0x000001F4,
+0x000001F4,
+0x000001F4,
+0x000001F4,
+0x000001F4,
+0x030001F4,
+0x000001F7,
+0x000001F7,
+0x000001F7,
+0x830001F7,
+0x030001FA,
+0x030001FD,
+0x00000200,
+0x00000200,
+0x00000200,
+0x83000200,
+0x00000203,
+0x00000203,
+0x83000203,
+0x00000206,
+0x00000206,
+0x00000206,
+0x00000206,
+0x00000206,
+0x00000206,
+0x00000206,
+0x00000206,
+0x00000206,
+0x00000206,
+0x00000206,
+0x00000206,
+0x00000206,
+0x00000206,
+0x00000206,
+0x00000206,
+0x00000206,
+0x00000206,
+0x00000206,
+0x00000206,
+0x03000206,
+0x83000209,
+0x0000020C,
+0x0300020C,
+0x0300020F,
+0x03000212,
+0x06000215,
+0x0000021B,
+0x0000021B,
+0x8300021B,
+0x8300021E,
+0x00000221,
+0x00000221,
+0x00000221,
+0x00000221,
+0x00000221,
+0x00000221,
+0x83000221,
+0x00000224,
+0x00000224,
+0x00000224,
+0x00000224,
+0x00000224,
+0x83000224,
+0x00000227,
+0x00000227,
+0x00000227,
+0x00000227,
+0x83000227,
+0x0000022A,
+0x0000022A,
+0x0000022A,
+0x0000022A,
+0x0300022A,
+0x0300022D,
+0x83000230,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x00000233,
+0x03000233,
+0x03000236,
+0x03000239,
+0x0300023C,
+0x0300023F,
+0x03000242,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x00000245,
+0x03000245,
+0x00000248,
+0x00000248,
+0x00000248,
+0x00000248,
+0x00000248,
+0x00000248,
+0x00000248,
+0x00000248,
+0x00000248,
+0x00000248,
+0x00000248,
+0x00000248,
+0x00000248,
+0x00000248,
+0x00000248,
+0x00000248,
+0x00000248,
+0x00000248,
+0x00000248,
+0x00000248,
+0x00000248,
+0x00000248,
+0x00000248,
+0x00000248,
+0x00000248,
+0x00000248,
+0x00000248,
+0x00000248,
+0x83000248,
+0x8300024B,
+0x8300024E,
+0x83000251,
+0x83000254,
+0x83000257,
+0x8300025A,
+0x8300025D,
+0x83000260,
+0x83000263,
+0x83000266,
+0x83000269,
+0x8300026C,
+0x8300026F,
+0x83000272,
+0x83000275,
+0x83000278,
+0x8300027B,
+0x8300027E,
+0x83000281,
+0x83000284,
+0x83000287,
+0x8300028A,
+0x8300028D,
+0x83000290,
+0x83000293,
+0x83000296,
+0x83000299,
+0x8300029C,
+0x8300029F,
+0x830002A2,
+0x830002A5,
+0x830002A8,
+0x830002AB,
+0x830002AE,
+0x830002B1,
+0x830002B4,
+0x830002B7,
+0x830002BA,
+0x830002BD,
+0x830002C0,
+0x830002C3,
+0x830002C6,
+0x830002C9,
+0x830002CC,
+0x830002CF,
+0x830002D2,
+0x830002D5,
+0x000002D8,
+0x000002D8,
+0x000002D8,
+0x000002D8,
+0x000002D8,
+0x000002D8,
+0x830002D8,
+0x000002DB,
+0x000002DB,
+0x830002DB,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x000002DE,
+0x830002DE,
+0x000002E1,
+0x000002E1,
+0x000002E1,
+0x000002E1,
+0x000002E1,
+0x030002E1,
+0x000002E4,
+0x030002E4,
+0x000002E7,
+0x030002E7,
+0x830002EA,
+0x000002ED,
+0x000002ED,
+0x000002ED,
+0x000002ED,
+0x000002ED,
+0x000002ED,
+0x000002ED,
+0x000002ED,
+0x000002ED,
+0x000002ED,
+0x000002ED,
+0x000002ED,
+0x000002ED,
+0x000002ED,
+0x000002ED,
+0x000002ED,
+0x000002ED,
+0x830002ED,
+0x000002F0,
+0x000002F0,
+0x000002F0,
+0x000002F0,
+0x000002F0,
+0x000002F0,
+0x000002F0,
+0x000002F0,
+0x000002F0,
+0x000002F0,
+0x830002F0,
+0x830002F3,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x000002F6,
+0x010002F6,
+0x010002F7,
+0x010002F8,
+0x010002F9,
+0x010002FA,
+0x010002FB,
+0x010002FC,
+0x010002FD,
+0x010002FE,
+0x010002FF,
+0x01000300,
+0x01000301,
+0x01000302,
+0x01000303,
+0x01000304,
+0x01000305,
+0x01000306,
+0x01000307,
+0x01000308,
+0x01000309,
+0x0100030A,
+0x0100030B,
+0x0100030C,
+0x0100030D,
+0x0100030E,
+0x0100030F,
+0x01000310,
+0x01000311,
+0x01000312,
+0x01000313,
+0x01000314,
+0x01000315,
+0x01000316,
+0x01000317,
+0x01000318,
+0x01000319,
+0x0100031A,
+0x0100031B,
+0x0100031C,
+0x0100031D,
+0x0100031E,
+0x0100031F,
+0x01000320,
+0x01000321,
+0x01000322,
+0x01000323,
+0x01000324,
+0x01000325,
+0x01000326,
+0x01000327,
+0x01000328,
+0x01000329,
+0x0100032A,
+0x0100032B,
+0x0100032C,
+0x0100032D,
+0x0100032E,
+0x0100032F,
+0x01000330,
+0x01000331,
+0x01000332,
+0x01000333,
+0x01000334,
+0x01000335,
+0x01000336,
+0x01000337,
+0x01000338,
+0x01000339,
+0x0100033A,
+0x0100033B,
+0x0100033C,
+0x0100033D,
+0x0100033E,
+0x0100033F,
+0x01000340,
+0x01000341,
+0x01000342,
+0x01000343,
+0x01000344,
+0x01000345,
+0x01000346,
+0x01000347,
+0x01000348,
+0x01000349,
+0x0100034A,
+0x0100034B,
+0x0100034C,
+0x0100034D,
+0x0100034E,
+0x0100034F,
+0x01000350,
+0x01000351,
+0x01000352,
+0x01000353,
+0x01000354,
+0x01000355,
+0x01000356,
+0x01000357,
+0x01000358,
+0x01000359,
+0x0100035A,
+0x0100035B,
+0x0100035C,
+0x0100035D,
+0x0100035E,
+0x0100035F,
+0x01000360,
+0x01000361,
+0x01000362,
+0x01000363,
+0x01000364,
+0x01000365,
+0x01000366,
+0x01000367,
+0x01000368,
+0x01000369,
+0x0100036A,
+0x0100036B,
+0x0100036C,
+0x0100036D,
+0x0100036E,
+0x0100036F,
+0x01000370,
+0x01000371,
+0x01000372,
+0x01000373,
+0x01000374,
+0x01000375,
+0x01000376,
+0x01000377,
+0x01000378,
+0x01000379,
+0x0100037A,
+0x0100037B,
+0x0100037C,
+0x0100037D,
+0x0100037E,
+0x0100037F,
+0x01000380,
+0x01000381,
+0x01000382,
+0x01000383,
+0x01000384,
+0x01000385,
+0x01000386,
+0x01000387,
+0x01000388,
+0x01000389,
+0x0100038A,
+0x0100038B,
+0x0100038C,
+0x0100038D,
+0x0100038E,
+0x0100038F,
+0x02000390,
+0x01000392,
+0x01000393,
+0x01000394,
+0x01000395,
+0x01000396,
+0x01000397,
+0x01000398,
+0x01000399,
+0x0100039A,
+0x0100039B,
+0x0100039C,
+0x0100039D,
+0x0100039E,
+0x0100039F,
+0x010003A0,
+0x010003A1,
+0x010003A2,
+0x010003A3,
+0x010003A4,
+0x010003A5,
+0x010003A6,
+0x010003A7,
+0x010003A8,
+0x010003A9,
+0x010003AA,
+0x010003AB,
+0x010003AC,
+0x010003AD,
+0x010003AE,
+0x010003AF,
+0x010003B0,
+0x010003B1,
+0x010003B2,
+0x010003B3,
+0x010003B4,
+0x010003B5,
+0x010003B6,
+0x010003B7,
+0x010003B8,
+0x010003B9,
+0x010003BA,
+0x010003BB,
+0x010003BC,
+0x010003BD,
+0x010003BE,
+0x010003BF,
+0x010003C0,
+0x010003C1,
+0x010003C2,
+0x010003C3,
+0x010003C4,
+0x010003C5,
+0x010003C6,
+0x010003C7,
+0x010003C8,
+0x010003C9,
+0x010003CA,
+0x010003CB,
+0x010003CC,
+0x010003CD,
+0x010003CE,
+0x010003CF,
+0x010003D0,
+0x010003D1,
+0x010003D2,
+0x010003D3,
+0x010003D4,
+0x010003D5,
+0x010003D6,
+0x010003D7,
+0x010003D8,
+0x010003D9,
+0x010003DA,
+0x010003DB,
+0x010003DC,
+0x010003DD,
+0x010003DE,
+0x010003DF,
+0x010003E0,
+0x010003E1,
+0x010003E2,
+0x010003E3,
+0x010003E4,
+0x010003E5,
+0x010003E6,
+0x010003E7,
+0x010003E8,
+0x010003E9,
+0x010003EA,
+0x010003EB,
+0x020003EC,
+0x020003EE,
+0x020003F0,
+0x020003F2,
+0x020003F4,
+0x020003F6,
+0x020003F8,
+0x020003FA,
+0x020003FC,
+0x020003FE,
+0x02000400,
+0x02000402,
+0x02000404,
+0x02000406,
+0x02000408,
+0x0200040A,
+0x0200040C,
+0x0200040E,
+0x02000410,
+0x02000412,
+0x02000414,
+0x02000416,
+0x02000418,
+0x0200041A,
+0x0200041C,
+0x0200041E,
+0x02000420,
+0x02000422,
+0x02000424,
+0x02000426,
+0x02000428,
+0x0200042A,
+0x0200042C,
+0x0200042E,
+0x02000430,
+0x02000432,
+0x02000434,
+0x02000436,
+0x02000438,
+0x0200043A,
+0x0200043C,
+0x0200043E,
+0x02000440,
+0x02000442,
+0x02000444,
+0x02000446,
+0x02000448,
+0x0200044A,
+0x0200044C,
+0x0200044E,
+0x02000450,
+0x02000452,
+0x02000454,
+0x02000456,
+0x02000458,
+0x0200045A,
+0x0200045C,
+0x0200045E,
+0x02000460,
+0x02000462,
+0x02000464,
+0x02000466,
+0x02000468,
+0x0200046A,
+0x0200046C,
+0x0200046E,
+0x02000470,
+0x02000472,
+0x02000474,
+0x02000476,
+0x02000478,
+0x0200047A,
+0x0200047C,
+0x0200047E,
+0x02000480,
+0x02000482,
+0x02000484,
+0x02000486,
+0x02000488,
+0x0200048A,
+0x0200048C,
+0x0200048E,
+0x02000490,
+0x02000492,
+0x02000494,
+0x02000496,
+0x02000498,
+0x0200049A,
+0x0200049C,
+0x0200049E,
+0x020004A0,
+0x020004A2,
+0x020004A4,
+0x020004A6,
+0x020004A8,
+0x020004AA,
+0x020004AC,
+0x020004AE,
+0x020004B0,
+0x020004B2,
+0x020004B4,
+0x020004B6,
+0x020004B8,
+0x020004BA,
+0x020004BC,
+0x020004BE,
+0x020004C0,
+0x020004C2,
+0x020004C4,
+0x020004C6,
+0x020004C8,
+0x020004CA,
+0x020004CC,
+0x020004CE,
+0x020004D0,
+0x020004D2,
+0x020004D4,
+0x020004D6,
+0x020004D8,
+0x020004DA,
+0x020004DC,
+0x020004DE,
+0x020004E0,
+0x020004E2,
+0x020004E4,
+0x020004E6,
+0x020004E8,
+0x020004EA,
+0x020004EC,
+0x020004EE,
+0x020004F0,
+0x020004F2,
+0x020004F4,
+0x020004F6,
+0x020004F8,
+0x020004FA,
+0x020004FC,
+0x020004FE,
+0x02000500,
+0x02000502,
+0x02000504,
+0x02000506,
+0x02000508,
+0x0200050A,
+0x0200050C,
+0x0200050E,
+0x02000510,
+0x02000512,
+0x02000514,
+0x02000516,
+0x02000518,
+0x0200051A,
+0x0200051C,
+0x0200051E,
+0x02000520,
+0x02000522,
+0x02000524,
+0x02000526,
+0x02000528,
+0x0200052A,
+0x0200052C,
+0x0200052E,
+0x02000530,
+0x02000532,
+0x02000534,
+0x02000536,
+0x02000538,
+0x0200053A,
+0x0200053C,
+0x0200053E,
+0x02000540,
+0x02000542,
+0x02000544,
+0x02000546,
+0x02000548,
+0x0200054A,
+0x0200054C,
+0x0200054E,
+0x02000550,
+0x02000552,
+0x02000554,
+0x02000556,
+0x02000558,
+0x0200055A,
+0x0200055C,
+0x0200055E,
+0x03000560,
+0x03000563,
+0x03000566,
+0x02000569,
+0x0200056B,
+0x0200056D,
+0x0200056F,
+0x02000571,
+0x02000573,
+0x02000575,
+0x02000577,
+0x02000579,
+0x0200057B,
+0x0300057D,
+0x03000580,
+0x03000583,
+0x02000586,
+0x02000588,
+0x0200058A,
+0x0200058C,
+0x0200058E,
+0x02000590,
+0x02000592,
+0x02000594,
+0x02000596,
+0x02000598,
+0x0200059A,
+0x0200059C,
+0x0200059E,
+0x020005A0,
+0x020005A2,
+0x010005A4,
+0x020005A5,
+0x020005A7,
+0x020005A9,
+0x020005AB,
+0x020005AD,
+0x020005AF,
+0x020005B1,
+0x020005B3,
+0x020005B5,
+0x020005B7,
+0x020005B9,
+0x030005BB,
+0x030005BE,
+0x000005C1,
+0x000005C1,
+0x000005C1,
+0x000005C1,
+0x000005C1,
+0x000005C1,
+0x000005C1,
+0x000005C1,
+0x000005C1,
+0x000005C1,
+0x000005C1,
+0x000005C1,
+0x000005C1,
+0x000005C1,
+0x000005C1,
+0x000005C1,
+0x000005C1,
+0x000005C1,
+0x000005C1,
+0x000005C1,
+0x000005C1,
+0x000005C1,
+0x000005C1,
+0x000005C1,
+0x000005C1,
+0x000005C1,
+0x020005C1,
+0x010005C3,
+0x010005C4,
+0x030005C5,
+0x030005C8,
+0x030005CB,
+0x030005CE,
+0x030005D1,
+0x030005D4,
+0x030005D7,
+0x030005DA,
+0x030005DD,
+0x030005E0,
+0x030005E3,
+0x030005E6,
+0x030005E9,
+0x030005EC,
+0x030005EF,
+0x010005F2,
+0x030005F3,
+0x030005F6,
+0x010005F9,
+0x010005FA,
+0x030005FB,
+0x030005FE,
+0x03000601,
+0x03000604,
+0x03000607,
+0x0300060A,
+0x0300060D,
+0x03000610,
+0x03000613,
+0x03000616,
+0x03000619,
+0x0300061C,
+0x0300061F,
+0x03000622,
+0x03000625,
+0x03000628,
+0x0300062B,
+0x0300062E,
+0x03000631,
+0x03000634,
+0x03000637,
+0x0300063A,
+0x0300063D,
+0x03000640,
+0x03000643,
+0x03000646,
+0x03000649,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x0000064C,
+0x8300064C,
+0x8300064F,
+0x03000652,
+0x03000655,
+0x03000658,
+0x0300065B,
+0x0300065E,
+0x03000661,
+0x03000664,
+0x03000667,
+0x0300066A,
+0x0300066D,
+0x03000670,
+0x03000673,
+0x03000676,
+0x03000679,
+0x0300067C,
+0x0300067F,
+0x03000682,
+0x03000685,
+0x03000688,
+0x0300068B,
+0x0300068E,
+0x03000691,
+0x03000694,
+0x03000697,
+0x0300069A,
+0x0300069D,
+0x000006A0,
+0x000006A0,
+0x030006A0,
+0x030006A3,
+0x030006A6,
+0x030006A9,
+0x030006AC,
+0x030006AF,
+0x030006B2,
+0x030006B5,
+0x030006B8,
+0x030006BB,
+0x030006BE,
+0x030006C1,
+0x030006C4,
+0x030006C7,
+0x030006CA,
+0x030006CD,
+0x030006D0,
+0x030006D3,
+0x030006D6,
+0x030006D9,
+0x030006DC,
+0x030006DF,
+0x030006E2,
+0x030006E5,
+0x030006E8,
+0x030006EB,
+0x030006EE,
+0x030006F1,
+0x030006F4,
+0x030006F7,
+0x030006FA,
+0x030006FD,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x00000700,
+0x83000700,
+0x00000703,
+0x00000703,
+0x00000703,
+0x00000703,
+0x00000703,
+0x00000703,
+0x00000703,
+0x00000703,
+0x00000703,
+0x00000703,
+0x83000703,
+0x00000706,
+0x00000706,
+0x00000706,
+0x00000706,
+0x00000706,
+0x00000706,
+0x00000706,
+0x00000706,
+0x00000706,
+0x00000706,
+0x00000706,
+0x00000706,
+0x00000706,
+0x00000706,
+0x00000706,
+0x00000706,
+0x00000706,
+0x00000706,
+0x00000706,
+0x00000706,
+0x00000706,
+0x00000706,
+0x00000706,
+0x00000706,
+0x00000706,
+0x00000706,
+0x00000706,
+0x00000706,
+0x00000706,
+0x03000706,
+0x03000709,
+0x0300070C,
+0x0300070F,
+0x03000712,
+0x03000715,
+0x03000718,
+0x0300071B,
+0x0300071E,
+0x03000721,
+0x03000724,
+0x03000727,
+0x0300072A,
+0x0300072D,
+0x03000730,
+0x03000733,
+0x03000736,
+0x03000739,
+0x0300073C,
+0x0300073F,
+0x03000742,
+0x03000745,
+0x03000748,
+0x0300074B,
+0x0300074E,
+0x03000751,
+0x03000754,
+0x03000757,
+0x0300075A,
+0x0300075D,
+0x03000760,
+0x03000763,
+0x03000766,
+0x03000769,
+0x0300076C,
+0x0300076F,
+0x03000772,
+0x03000775,
+0x03000778,
+0x0300077B,
+0x0300077E,
+0x03000781,
+0x03000784,
+0x03000787,
+0x0300078A,
+0x0300078D,
+0x03000790,
+0x03000793,
+0x03000796,
+0x03000799,
+0x0300079C,
+0x0300079F,
+0x030007A2,
+0x030007A5,
+0x030007A8,
+0x030007AB,
+0x030007AE,
+0x030007B1,
+0x030007B4,
+0x030007B7,
+0x030007BA,
+0x030007BD,
+0x030007C0,
+0x030007C3,
+0x030007C6,
+0x030007C9,
+0x030007CC,
+0x030007CF,
+0x030007D2,
+0x030007D5,
+0x030007D8,
+0x030007DB,
+0x030007DE,
+0x030007E1,
+0x030007E4,
+0x030007E7,
+0x030007EA,
+0x030007ED,
+0x030007F0,
+0x030007F3,
+0x030007F6,
+0x030007F9,
+0x030007FC,
+0x030007FF,
+0x03000802,
+0x03000805,
+0x03000808,
+0x0300080B,
+0x0300080E,
+0x03000811,
+0x03000814,
+0x03000817,
+0x0300081A,
+0x0300081D,
+0x03000820,
+0x03000823,
+0x03000826,
+0x03000829,
+0x0300082C,
+0x0300082F,
+0x03000832,
+0x03000835,
+0x03000838,
+0x0300083B,
+0x0300083E,
+0x03000841,
+0x03000844,
+0x03000847,
+0x0300084A,
+0x0300084D,
+0x03000850,
+0x03000853,
+0x03000856,
+0x03000859,
+0x0300085C,
+0x0300085F,
+0x03000862,
+0x03000865,
+0x03000868,
+0x0300086B,
+0x0300086E,
+0x03000871,
+0x03000874,
+0x03000877,
+0x0300087A,
+0x0300087D,
+0x03000880,
+0x03000883,
+0x03000886,
+0x03000889,
+0x0300088C,
+0x0300088F,
+0x03000892,
+0x03000895,
+0x03000898,
+0x0300089B,
+0x0300089E,
+0x030008A1,
+0x030008A4,
+0x030008A7,
+0x030008AA,
+0x030008AD,
+0x030008B0,
+0x030008B3,
+0x030008B6,
+0x030008B9,
+0x030008BC,
+0x030008BF,
+0x030008C2,
+0x030008C5,
+0x030008C8,
+0x030008CB,
+0x030008CE,
+0x030008D1,
+0x030008D4,
+0x030008D7,
+0x030008DA,
+0x030008DD,
+0x030008E0,
+0x030008E3,
+0x030008E6,
+0x030008E9,
+0x030008EC,
+0x030008EF,
+0x030008F2,
+0x030008F5,
+0x030008F8,
+0x030008FB,
+0x030008FE,
+0x03000901,
+0x03000904,
+0x03000907,
+0x0300090A,
+0x0300090D,
+0x03000910,
+0x03000913,
+0x03000916,
+0x03000919,
+0x0300091C,
+0x0300091F,
+0x03000922,
+0x03000925,
+0x03000928,
+0x0300092B,
+0x0300092E,
+0x03000931,
+0x03000934,
+0x03000937,
+0x0300093A,
+0x0300093D,
+0x03000940,
+0x03000943,
+0x03000946,
+0x03000949,
+0x0300094C,
+0x0300094F,
+0x03000952,
+0x03000955,
+0x03000958,
+0x0300095B,
+0x0300095E,
+0x03000961,
+0x03000964,
+0x03000967,
+0x0300096A,
+0x0300096D,
+0x03000970,
+0x03000973,
+0x03000976,
+0x03000979,
+0x0300097C,
+0x0300097F,
+0x03000982,
+0x03000985,
+0x03000988,
+0x0300098B,
+0x0300098E,
+0x03000991,
+0x03000994,
+0x03000997,
+0x0300099A,
+0x0300099D,
+0x030009A0,
+0x030009A3,
+0x030009A6,
+0x030009A9,
+0x030009AC,
+0x030009AF,
+0x030009B2,
+0x030009B5,
+0x030009B8,
+0x030009BB,
+0x030009BE,
+0x030009C1,
+0x030009C4,
+0x030009C7,
+0x030009CA,
+0x030009CD,
+0x030009D0,
+0x030009D3,
+0x030009D6,
+0x030009D9,
+0x030009DC,
+0x030009DF,
+0x030009E2,
+0x030009E5,
+0x030009E8,
+0x030009EB,
+0x030009EE,
+0x030009F1,
+0x030009F4,
+0x030009F7,
+0x030009FA,
+0x030009FD,
+0x03000A00,
+0x03000A03,
+0x03000A06,
+0x03000A09,
+0x03000A0C,
+0x03000A0F,
+0x03000A12,
+0x03000A15,
+0x03000A18,
+0x03000A1B,
+0x03000A1E,
+0x03000A21,
+0x03000A24,
+0x03000A27,
+0x03000A2A,
+0x03000A2D,
+0x03000A30,
+0x03000A33,
+0x03000A36,
+0x03000A39,
+0x03000A3C,
+0x03000A3F,
+0x03000A42,
+0x03000A45,
+0x03000A48,
+0x03000A4B,
+0x03000A4E,
+0x03000A51,
+0x03000A54,
+0x03000A57,
+0x03000A5A,
+0x03000A5D,
+0x03000A60,
+0x03000A63,
+0x03000A66,
+0x03000A69,
+0x03000A6C,
+0x03000A6F,
+0x03000A72,
+0x03000A75,
+0x03000A78,
+0x03000A7B,
+0x03000A7E,
+0x03000A81,
+0x03000A84,
+0x03000A87,
+0x03000A8A,
+0x03000A8D,
+0x03000A90,
+0x03000A93,
+0x03000A96,
+0x03000A99,
+0x03000A9C,
+0x03000A9F,
+0x03000AA2,
+0x03000AA5,
+0x03000AA8,
+0x03000AAB,
+0x03000AAE,
+0x03000AB1,
+0x03000AB4,
+0x03000AB7,
+0x03000ABA,
+0x03000ABD,
+0x03000AC0,
+0x03000AC3,
+0x03000AC6,
+0x03000AC9,
+0x03000ACC,
+0x03000ACF,
+0x03000AD2,
+0x03000AD5,
+0x03000AD8,
+0x03000ADB,
+0x03000ADE,
+0x03000AE1,
+0x03000AE4,
+0x03000AE7,
+0x03000AEA,
+0x03000AED,
+0x03000AF0,
+0x03000AF3,
+0x03000AF6,
+0x03000AF9,
+0x03000AFC,
+0x03000AFF,
+0x03000B02,
+0x03000B05,
+0x03000B08,
+0x03000B0B,
+0x03000B0E,
+0x03000B11,
+0x03000B14,
+0x03000B17,
+0x03000B1A,
+0x03000B1D,
+0x03000B20,
+0x03000B23,
+0x04000B26,
+0x03000B2A,
+0x03000B2D,
+0x03000B30,
+0x03000B33,
+0x03000B36,
+0x03000B39,
+0x03000B3C,
+0x03000B3F,
+0x03000B42,
+0x03000B45,
+0x03000B48,
+0x03000B4B,
+0x03000B4E,
+0x03000B51,
+0x03000B54,
+0x03000B57,
+0x03000B5A,
+0x03000B5D,
+0x03000B60,
+0x03000B63,
+0x03000B66,
+0x03000B69,
+0x03000B6C,
+0x03000B6F,
+0x03000B72,
+0x03000B75,
+0x03000B78,
+0x03000B7B,
+0x03000B7E,
+0x03000B81,
+0x03000B84,
+0x03000B87,
+0x03000B8A,
+0x03000B8D,
+0x03000B90,
+0x03000B93,
+0x03000B96,
+0x03000B99,
+0x03000B9C,
+0x03000B9F,
+0x03000BA2,
+0x03000BA5,
+0x03000BA8,
+0x03000BAB,
+0x03000BAE,
+0x03000BB1,
+0x03000BB4,
+0x03000BB7,
+0x03000BBA,
+0x03000BBD,
+0x03000BC0,
+0x03000BC3,
+0x03000BC6,
+0x03000BC9,
+0x03000BCC,
+0x03000BCF,
+0x03000BD2,
+0x03000BD5,
+0x03000BD8,
+0x03000BDB,
+0x03000BDE,
+0x03000BE1,
+0x03000BE4,
+0x03000BE7,
+0x03000BEA,
+0x03000BED,
+0x03000BF0,
+0x03000BF3,
+0x03000BF6,
+0x03000BF9,
+0x03000BFC,
+0x03000BFF,
+0x03000C02,
+0x03000C05,
+0x03000C08,
+0x03000C0B,
+0x03000C0E,
+0x03000C11,
+0x03000C14,
+0x03000C17,
+0x03000C1A,
+0x03000C1D,
+0x03000C20,
+0x03000C23,
+0x03000C26,
+0x03000C29,
+0x03000C2C,
+0x03000C2F,
+0x03000C32,
+0x03000C35,
+0x03000C38,
+0x03000C3B,
+0x03000C3E,
+0x03000C41,
+0x03000C44,
+0x03000C47,
+0x04000C4A,
+0x04000C4E,
+0x04000C52,
+0x03000C56,
+0x03000C59,
+0x03000C5C,
+0x04000C5F,
+0x04000C63,
+0x04000C67,
+0x03000C6B,
+0x03000C6E,
+0x02000C71,
+0x00000C73,
+0x02000C73,
+0x02000C75,
+0x02000C77,
+0x02000C79,
+0x02000C7B,
+0x02000C7D,
+0x02000C7F,
+0x02000C81,
+0x02000C83,
+0x02000C85,
+0x02000C87,
+0x02000C89,
+0x02000C8B,
+0x02000C8D,
+0x02000C8F,
+0x02000C91,
+0x02000C93,
+0x02000C95,
+0x02000C97,
+0x02000C99,
+0x02000C9B,
+0x02000C9D,
+0x02000C9F,
+0x02000CA1,
+0x02000CA3,
+0x02000CA5,
+0x02000CA7,
+0x02000CA9,
+0x02000CAB,
+0x02000CAD,
+0x02000CAF,
+0x02000CB1,
+0x02000CB3,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x00000CB5,
+0x04000CB5,
+0x04000CB9,
+0x04000CBD,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x00000CC1,
+0x84000CC1,
+0x00000CC5,
+0x00000CC5,
+0x00000CC5,
+0x00000CC5,
+0x00000CC5,
+0x00000CC5,
+0x00000CC5,
+0x00000CC5,
+0x00000CC5,
+0x84000CC5,
+0x00000CC9,
+0x00000CC9,
+0x00000CC9,
+0x00000CC9,
+0x00000CC9,
+0x00000CC9,
+0x00000CC9,
+0x00000CC9,
+0x00000CC9,
+0x00000CC9,
+0x00000CC9,
+0x00000CC9,
+0x00000CC9,
+0x00000CC9,
+0x00000CC9,
+0x00000CC9,
+0x00000CC9,
+0x84000CC9,
+0x00000CCD,
+0x84000CCD,
+0x84000CD1,
+0x00000CD5,
+0x00000CD5,
+0x00000CD5,
+0x00000CD5,
+0x00000CD5,
+0x00000CD5,
+0x00000CD5,
+0x00000CD5,
+0x00000CD5,
+0x00000CD5,
+0x00000CD5,
+0x00000CD5,
+0x00000CD5,
+0x00000CD5,
+0x00000CD5,
+0x00000CD5,
+0x00000CD5,
+0x00000CD5,
+0x00000CD5,
+0x00000CD5,
+0x00000CD5,
+0x00000CD5,
+0x00000CD5,
+0x00000CD5,
+0x00000CD5,
+0x84000CD5,
+0x00000CD9,
+0x00000CD9,
+0x00000CD9,
+0x00000CD9,
+0x00000CD9,
+0x00000CD9,
+0x00000CD9,
+0x04000CD9,
+0x84000CDD,
+0x00000CE1,
+0x00000CE1,
+0x00000CE1,
+0x00000CE1,
+0x84000CE1,
+0x00000CE5,
+0x00000CE5,
+0x00000CE5,
+0x00000CE5,
+0x00000CE5,
+0x00000CE5,
+0x00000CE5,
+0x00000CE5,
+0x00000CE5,
+0x00000CE5,
+0x00000CE5,
+0x00000CE5,
+0x00000CE5,
+0x00000CE5,
+0x00000CE5,
+0x00000CE5,
+0x00000CE5,
+0x00000CE5,
+0x00000CE5,
+0x00000CE5,
+0x00000CE5,
+0x00000CE5,
+0x00000CE5,
+0x00000CE5,
+0x00000CE5,
+0x00000CE5,
+0x00000CE5,
+0x00000CE5,
+0x00000CE5,
+0x84000CE5,
+0x00000CE9,
+0x00000CE9,
+0x00000CE9,
+0x00000CE9,
+0x00000CE9,
+0x00000CE9,
+0x00000CE9,
+0x00000CE9,
+0x00000CE9,
+0x00000CE9,
+0x00000CE9,
+0x00000CE9,
+0x00000CE9,
+0x00000CE9,
+0x00000CE9,
+0x00000CE9,
+0x00000CE9,
+0x00000CE9,
+0x00000CE9,
+0x00000CE9,
+0x00000CE9,
+0x00000CE9,
+0x00000CE9,
+0x00000CE9,
+0x84000CE9,
+0x00000CED,
+0x00000CED,
+0x84000CED,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x00000CF1,
+0x84000CF1,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x00000CF5,
+0x84000CF5,
+0x84000CF9,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x00000CFD,
+0x08000CFD,
+0x08000D05,
+0x0C000D0D,
+0x0C000D19,
+0x0C000D25,
+0x0C000D31,
+0x0C000D3D,
+0x84000D49,
+0x84000D4D,
+0x00000D51,
+0x00000D51,
+0x00000D51,
+0x84000D51,
+0x84000D55,
+0x84000D59,
+0x84000D5D,
+0x84000D61,
+0x84000D65,
+0x00000D69,
+0x00000D69,
+0x00000D69,
+0x00000D69,
+0x00000D69,
+0x00000D69,
+0x00000D69,
+0x00000D69,
+0x00000D69,
+0x00000D69,
+0x00000D69,
+0x00000D69,
+0x00000D69,
+0x00000D69,
+0x00000D69,
+0x00000D69,
+0x00000D69,
+0x00000D69,
+0x00000D69,
+0x08000D69,
+0x08000D71,
+0x0C000D79,
+0x0C000D85,
+0x0C000D91,
+0x0C000D9D,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x00000DA9,
+0x03000DA9,
+0x03000DAC,
+0x03000DAF,
+0x04000DB2,
+0x03000DB6,
+0x03000DB9,
+0x03000DBC,
+0x03000DBF,
+0x03000DC2,
+0x03000DC5,
+0x03000DC8,
+0x03000DCB,
+0x03000DCE,
+0x04000DD1,
+0x03000DD5,
+0x03000DD8,
+0x03000DDB,
+0x03000DDE,
+0x04000DE1,
+0x03000DE5,
+0x03000DE8,
+0x03000DEB,
+0x04000DEE,
+0x03000DF2,
+0x03000DF5,
+0x03000DF8,
+0x03000DFB,
+0x03000DFE,
+0x04000E01,
+0x03000E05,
+0x03000E08,
+0x03000E0B,
+0x03000E0E,
+0x03000E11,
+0x03000E14,
+0x03000E17,
+0x03000E1A,
+0x03000E1D,
+0x03000E20,
+0x03000E23,
+0x03000E26,
+0x03000E29,
+0x03000E2C,
+0x03000E2F,
+0x03000E32,
+0x03000E35,
+0x03000E38,
+0x03000E3B,
+0x03000E3E,
+0x03000E41,
+0x03000E44,
+0x03000E47,
+0x04000E4A,
+0x03000E4E,
+0x03000E51,
+0x03000E54,
+0x04000E57,
+0x03000E5B,
+0x03000E5E,
+0x03000E61,
+0x03000E64,
+0x03000E67,
+0x03000E6A,
+0x03000E6D,
+0x03000E70,
+0x03000E73,
+0x03000E76,
+0x03000E79,
+0x03000E7C,
+0x03000E7F,
+0x03000E82,
+0x03000E85,
+0x03000E88,
+0x03000E8B,
+0x03000E8E,
+0x03000E91,
+0x03000E94,
+0x03000E97,
+0x03000E9A,
+0x03000E9D,
+0x03000EA0,
+0x03000EA3,
+0x03000EA6,
+0x03000EA9,
+0x03000EAC,
+0x03000EAF,
+0x03000EB2,
+0x03000EB5,
+0x03000EB8,
+0x04000EBB,
+0x03000EBF,
+0x03000EC2,
+0x03000EC5,
+0x03000EC8,
+0x03000ECB,
+0x03000ECE,
+0x04000ED1,
+0x04000ED5,
+0x03000ED9,
+0x03000EDC,
+0x03000EDF,
+0x03000EE2,
+0x03000EE5,
+0x03000EE8,
+0x03000EEB,
+0x03000EEE,
+0x03000EF1,
+0x03000EF4,
+0x04000EF7,
+0x03000EFB,
+0x03000EFE,
+0x03000F01,
+0x03000F04,
+0x04000F07,
+0x03000F0B,
+0x03000F0E,
+0x03000F11,
+0x03000F14,
+0x03000F17,
+0x03000F1A,
+0x03000F1D,
+0x03000F20,
+0x03000F23,
+0x04000F26,
+0x03000F2A,
+0x04000F2D,
+0x03000F31,
+0x03000F34,
+0x03000F37,
+0x03000F3A,
+0x03000F3D,
+0x03000F40,
+0x03000F43,
+0x03000F46,
+0x03000F49,
+0x03000F4C,
+0x03000F4F,
+0x04000F52,
+0x03000F56,
+0x03000F59,
+0x03000F5C,
+0x03000F5F,
+0x03000F62,
+0x04000F65,
+0x03000F69,
+0x04000F6C,
+0x04000F70,
+0x03000F74,
+0x03000F77,
+0x03000F7A,
+0x03000F7D,
+0x04000F80,
+0x04000F84,
+0x03000F88,
+0x03000F8B,
+0x03000F8E,
+0x03000F91,
+0x03000F94,
+0x03000F97,
+0x03000F9A,
+0x03000F9D,
+0x03000FA0,
+0x03000FA3,
+0x03000FA6,
+0x04000FA9,
+0x03000FAD,
+0x03000FB0,
+0x03000FB3,
+0x03000FB6,
+0x03000FB9,
+0x03000FBC,
+0x03000FBF,
+0x03000FC2,
+0x03000FC5,
+0x03000FC8,
+0x03000FCB,
+0x03000FCE,
+0x03000FD1,
+0x03000FD4,
+0x03000FD7,
+0x03000FDA,
+0x03000FDD,
+0x03000FE0,
+0x03000FE3,
+0x04000FE6,
+0x03000FEA,
+0x03000FED,
+0x03000FF0,
+0x03000FF3,
+0x03000FF6,
+0x04000FF9,
+0x03000FFD,
+0x03001000,
+0x03001003,
+0x03001006,
+0x03001009,
+0x0300100C,
+0x0300100F,
+0x03001012,
+0x03001015,
+0x03001018,
+0x0300101B,
+0x0400101E,
+0x03001022,
+0x03001025,
+0x03001028,
+0x0300102B,
+0x0300102E,
+0x03001031,
+0x03001034,
+0x03001037,
+0x0300103A,
+0x0300103D,
+0x03001040,
+0x03001043,
+0x03001046,
+0x03001049,
+0x0300104C,
+0x0300104F,
+0x03001052,
+0x03001055,
+0x04001058,
+0x0300105C,
+0x0300105F,
+0x03001062,
+0x03001065,
+0x03001068,
+0x0400106B,
+0x0300106F,
+0x03001072,
+0x03001075,
+0x03001078,
+0x0300107B,
+0x0300107E,
+0x03001081,
+0x03001084,
+0x04001087,
+0x0300108B,
+0x0300108E,
+0x03001091,
+0x04001094,
+0x03001098,
+0x0300109B,
+0x0300109E,
+0x030010A1,
+0x030010A4,
+0x030010A7,
+0x040010AA,
+0x040010AE,
+0x040010B2,
+0x030010B6,
+0x040010B9,
+0x030010BD,
+0x030010C0,
+0x030010C3,
+0x030010C6,
+0x030010C9,
+0x030010CC,
+0x030010CF,
+0x030010D2,
+0x030010D5,
+0x030010D8,
+0x040010DB,
+0x030010DF,
+0x030010E2,
+0x030010E5,
+0x030010E8,
+0x030010EB,
+0x030010EE,
+0x040010F1,
+0x030010F5,
+0x030010F8,
+0x040010FB,
+0x040010FF,
+0x03001103,
+0x03001106,
+0x03001109,
+0x0300110C,
+0x0300110F,
+0x03001112,
+0x03001115,
+0x03001118,
+0x0300111B,
+0x0400111E,
+0x03001122,
+0x04001125,
+0x03001129,
+0x0400112C,
+0x03001130,
+0x03001133,
+0x03001136,
+0x04001139,
+0x0300113D,
+0x03001140,
+0x04001143,
+0x04001147,
+0x0300114B,
+0x0300114E,
+0x03001151,
+0x03001154,
+0x03001157,
+0x0300115A,
+0x0300115D,
+0x03001160,
+0x03001163,
+0x03001166,
+0x03001169,
+0x0300116C,
+0x0300116F,
+0x04001172,
+0x03001176,
+0x04001179,
+0x0300117D,
+0x04001180,
+0x03001184,
+0x04001187,
+0x0400118B,
+0x0400118F,
+0x03001193,
+0x03001196,
+0x03001199,
+0x0400119C,
+0x040011A0,
+0x040011A4,
+0x040011A8,
+0x030011AC,
+0x030011AF,
+0x030011B2,
+0x030011B5,
+0x030011B8,
+0x030011BB,
+0x030011BE,
+0x030011C1,
+0x040011C4,
+0x030011C8,
+0x030011CB,
+0x030011CE,
+0x030011D1,
+0x040011D4,
+0x030011D8,
+0x040011DB,
+0x040011DF,
+0x030011E3,
+0x030011E6,
+0x030011E9,
+0x030011EC,
+0x030011EF,
+0x030011F2,
+0x040011F5,
+0x040011F9,
+0x040011FD,
+0x03001201,
+0x03001204,
+0x04001207,
+0x0300120B,
+0x0300120E,
+0x03001211,
+0x04001214,
+0x03001218,
+0x0300121B,
+0x0300121E,
+0x03001221,
+0x03001224,
+0x04001227,
+0x0300122B,
+0x0300122E,
+0x03001231,
+0x03001234,
+0x03001237,
+0x0300123A,
+0x0400123D,
+0x04001241,
+0x03001245,
+0x04001248,
+0x0300124C,
+0x0400124F,
+0x03001253,
+0x03001256,
+0x03001259,
+0x0400125C,
+0x04001260,
+0x03001264,
+0x04001267,
+0x0300126B,
+0x0400126E,
+0x03001272,
+0x03001275,
+0x03001278,
+0x0300127B,
+0x0300127E,
+0x03001281,
+0x04001284,
+0x04001288,
+0x0400128C,
+0x04001290,
+0x03001294,
+0x03001297,
+0x0300129A,
+0x0300129D,
+0x030012A0,
+0x030012A3,
+0x030012A6,
+0x030012A9,
+0x030012AC,
+0x030012AF,
+0x030012B2,
+0x030012B5,
+0x040012B8,
+0x030012BC,
+0x030012BF,
+0x030012C2,
+0x030012C5,
+0x030012C8,
+0x030012CB,
+0x030012CE,
+0x030012D1,
+0x030012D4,
+0x030012D7,
+0x030012DA,
+0x030012DD,
+0x040012E0,
+0x040012E4,
+0x040012E8,
+0x030012EC,
+0x030012EF,
+0x030012F2,
+0x030012F5,
+0x040012F8,
+0x030012FC,
+0x040012FF,
+0x03001303,
+0x03001306,
+0x04001309,
+0x0400130D,
+0x03001311,
+0x03001314,
+0x03001317,
+0x0300131A,
+0x0300131D,
+0x03001320,
+0x03001323,
+0x03001326,
+0x03001329,
+0x0300132C,
+0x0300132F,
+0x03001332,
+0x03001335,
+0x03001338,
+0x0300133B,
+0x0300133E,
+0x03001341,
+0x03001344,
+0x03001347,
+0x0400134A,
+0x0300134E,
+0x03001351,
+0x03001354,
+0x03001357,
+0x0300135A,
+0x0400135D,
+0x04001361,
+0x03001365,
+0x03001368,
+0x0300136B,
+0x0300136E,
+0x03001371,
+0x03001374,
+0x04001377,
+0x0300137B,
+0x0300137E,
+0x03001381,
+0x03001384,
+0x04001387,
+0x0400138B,
+0x0300138F,
+0x03001392,
+0x03001395,
+0x04001398,
+0x0300139C,
+0x0300139F,
+0x040013A2,
+0x040013A6,
+0x030013AA,
+0x030013AD,
+0x030013B0,
+0x040013B3,
+0x030013B7,
+0x030013BA,
+0x030013BD,
+0x030013C0,
+0x030013C3,
+0x030013C6,
+0x030013C9,
+0x040013CC,
+0x030013D0,
+0x030013D3,
+0x030013D6,
+0x040013D9,
+0x030013DD,
+0x030013E0,
+0x030013E3,
+0x030013E6,
+0x040013E9,
+0x040013ED,
+0x030013F1,
+0x030013F4,
+0x030013F7,
+0x040013FA,
+0x030013FE,
+0x04001401,
+0x03001405,
+0x03001408,
+0x0300140B,
+0x0400140E,
+0x03001412,
+0x03001415,
+0x03001418,
+0x0300141B,
+0x0300141E,
+0x03001421,
+0x03001424,
+0x04001427,
+0x0300142B,
+0x0300142E,
+0x03001431,
+0x03001434,
+0x03001437,
+0x0300143A,
+0x0400143D,
+0x03001441,
+0x04001444,
+0x04001448,
+0x0400144C,
+0x03001450,
+0x03001453,
+0x03001456,
+0x03001459,
+0x0300145C,
+0x0300145F,
+0x03001462,
+0x03001465,
+0x04001468,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+0x0000146C,
+};
+//utf-8 encoded folded strings
+static const uint8_t unicode_folding_data[] = {
+0x41,0x41,0x41,0x41,0x41,0x41,0x43,0x45,0x45,0x45,0x45,0x49,0x49,0x49,0x49,0x4E,
+0x4F,0x4F,0x4F,0x4F,0x4F,0x55,0x55,0x55,0x55,0x59,0x61,0x61,0x61,0x61,0x61,0x61,
+0x63,0x65,0x65,0x65,0x65,0x69,0x69,0x69,0x69,0x6E,0x6F,0x6F,0x6F,0x6F,0x6F,0x75,
+0x75,0x75,0x75,0x79,0x79,0x41,0x61,0x41,0x61,0x41,0x61,0x43,0x63,0x43,0x63,0x43,
+0x63,0x43,0x63,0x44,0x64,0x45,0x65,0x45,0x65,0x45,0x65,0x45,0x65,0x45,0x65,0x47,
+0x67,0x47,0x67,0x47,0x67,0x47,0x67,0x48,0x68,0x49,0x69,0x49,0x69,0x49,0x69,0x49,
+0x69,0x49,0x4A,0x6A,0x4B,0x6B,0x4C,0x6C,0x4C,0x6C,0x4C,0x6C,0x4E,0x6E,0x4E,0x6E,
+0x4E,0x6E,0x4F,0x6F,0x4F,0x6F,0x4F,0x6F,0x52,0x72,0x52,0x72,0x52,0x72,0x53,0x73,
+0x53,0x73,0x53,0x73,0x53,0x73,0x54,0x74,0x54,0x74,0x55,0x75,0x55,0x75,0x55,0x75,
+0x55,0x75,0x55,0x75,0x55,0x75,0x57,0x77,0x59,0x79,0x59,0x5A,0x7A,0x5A,0x7A,0x5A,
+0x7A,0x4F,0x6F,0x55,0x75,0x41,0x61,0x49,0x69,0x4F,0x6F,0x55,0x75,0x55,0x75,0x55,
+0x75,0x55,0x75,0x55,0x75,0x41,0x61,0x41,0x61,0xC3,0x86,0xC3,0xA6,0x47,0x67,0x4B,
+0x6B,0x4F,0x6F,0x4F,0x6F,0xC6,0xB7,0xCA,0x92,0x6A,0x47,0x67,0x4E,0x6E,0x41,0x61,
+0xC3,0x86,0xC3,0xA6,0xC3,0x98,0xC3,0xB8,0x41,0x61,0x41,0x61,0x45,0x65,0x45,0x65,
+0x49,0x69,0x49,0x69,0x4F,0x6F,0x4F,0x6F,0x52,0x72,0x52,0x72,0x55,0x75,0x55,0x75,
+0x53,0x73,0x54,0x74,0x48,0x68,0x41,0x61,0x45,0x65,0x4F,0x6F,0x4F,0x6F,0x4F,0x6F,
+0x4F,0x6F,0x59,0x79,0xCA,0xB9,0x3B,0xC2,0xA8,0xCE,0x91,0xC2,0xB7,0xCE,0x95,0xCE,
+0x97,0xCE,0x99,0xCE,0x9F,0xCE,0xA5,0xCE,0xA9,0xCE,0xB9,0xCE,0x99,0xCE,0xA5,0xCE,
+0xB1,0xCE,0xB5,0xCE,0xB7,0xCE,0xB9,0xCF,0x85,0xCE,0xB9,0xCF,0x85,0xCE,0xBF,0xCF,
+0x85,0xCF,0x89,0xCF,0x92,0xCF,0x92,0xD0,0x95,0xD0,0x95,0xD0,0x93,0xD0,0x86,0xD0,
+0x9A,0xD0,0x98,0xD0,0xA3,0xD0,0x98,0xD0,0xB8,0xD0,0xB5,0xD0,0xB5,0xD0,0xB3,0xD1,
+0x96,0xD0,0xBA,0xD0,0xB8,0xD1,0x83,0xD1,0xB4,0xD1,0xB5,0xD0,0x96,0xD0,0xB6,0xD0,
+0x90,0xD0,0xB0,0xD0,0x90,0xD0,0xB0,0xD0,0x95,0xD0,0xB5,0xD3,0x98,0xD3,0x99,0xD0,
+0x96,0xD0,0xB6,0xD0,0x97,0xD0,0xB7,0xD0,0x98,0xD0,0xB8,0xD0,0x98,0xD0,0xB8,0xD0,
+0x9E,0xD0,0xBE,0xD3,0xA8,0xD3,0xA9,0xD0,0xAD,0xD1,0x8D,0xD0,0xA3,0xD1,0x83,0xD0,
+0xA3,0xD1,0x83,0xD0,0xA3,0xD1,0x83,0xD0,0xA7,0xD1,0x87,0xD0,0xAB,0xD1,0x8B,0xD8,
+0xA7,0xD8,0xA7,0xD9,0x88,0xD8,0xA7,0xD9,0x8A,0xDB,0x95,0xDB,0x81,0xDB,0x92,0xE0,
+0xA4,0xA8,0xE0,0xA4,0xB0,0xE0,0xA4,0xB3,0xE0,0xA4,0x95,0xE0,0xA4,0x96,0xE0,0xA4,
+0x97,0xE0,0xA4,0x9C,0xE0,0xA4,0xA1,0xE0,0xA4,0xA2,0xE0,0xA4,0xAB,0xE0,0xA4,0xAF,
+0xE0,0xA6,0xBE,0xE0,0xA7,0x97,0xE0,0xA6,0xA1,0xE0,0xA6,0xA2,0xE0,0xA6,0xAF,0xE0,
+0xA8,0xB2,0xE0,0xA8,0xB8,0xE0,0xA8,0x96,0xE0,0xA8,0x97,0xE0,0xA8,0x9C,0xE0,0xA8,
+0xAB,0xE0,0xAC,0xBE,0xE0,0xAD,0x87,0xE0,0xAD,0x97,0xE0,0xAC,0xA1,0xE0,0xAC,0xA2,
+0xE0,0xAE,0xBE,0xE0,0xAF,0x97,0xE0,0xB3,0x95,0xE0,0xB3,0x82,0xE0,0xB3,0x95,0xE0,
+0xB3,0x96,0xE0,0xB3,0x82,0xE0,0xB3,0x82,0xE0,0xB3,0x95,0xE0,0xB3,0x95,0xE0,0xB3,
+0x96,0xE0,0xB4,0xBE,0xE0,0xB5,0x97,0xE0,0xB7,0x8F,0xE0,0xB7,0x99,0xE0,0xB7,0x9C,
+0xE0,0xB7,0x9F,0xE0,0xBD,0x82,0xE0,0xBD,0x8C,0xE0,0xBD,0x91,0xE0,0xBD,0x96,0xE0,
+0xBD,0x9B,0xE0,0xBD,0x80,0xE1,0x80,0xA5,0xE1,0x85,0xA1,0xE1,0x85,0xA2,0xE1,0x85,
+0xA3,0xE1,0x85,0xA4,0xE1,0x85,0xA5,0xE1,0x85,0xA6,0xE1,0x85,0xA7,0xE1,0x85,0xA8,
+0xE1,0x85,0xA9,0xE1,0x85,0xAA,0xE1,0x85,0xAB,0xE1,0x85,0xAC,0xE1,0x85,0xAD,0xE1,
+0x85,0xAE,0xE1,0x85,0xAF,0xE1,0x85,0xB0,0xE1,0x85,0xB1,0xE1,0x85,0xB2,0xE1,0x85,
+0xB3,0xE1,0x85,0xB4,0xE1,0x85,0xB5,0xE1,0x86,0xA8,0xE1,0x86,0xA9,0xE1,0x86,0xAA,
+0xE1,0x86,0xAB,0xE1,0x86,0xAC,0xE1,0x86,0xAD,0xE1,0x86,0xAE,0xE1,0x86,0xAF,0xE1,
+0x86,0xB0,0xE1,0x86,0xB1,0xE1,0x86,0xB2,0xE1,0x86,0xB3,0xE1,0x86,0xB4,0xE1,0x86,
+0xB5,0xE1,0x86,0xB6,0xE1,0x86,0xB7,0xE1,0x86,0xB8,0xE1,0x86,0xB9,0xE1,0x86,0xBA,
+0xE1,0x86,0xBB,0xE1,0x86,0xBC,0xE1,0x86,0xBD,0xE1,0x86,0xBE,0xE1,0x86,0xBF,0xE1,
+0x87,0x80,0xE1,0x87,0x81,0xE1,0x87,0x82,0xE1,0x9C,0x95,0xE1,0x9C,0xB4,0xE1,0xAC,
+0xB5,0xE1,0xAC,0xB5,0xE1,0xAC,0xB5,0xE1,0xAC,0xB5,0xE1,0xAD,0x84,0xE1,0xAE,0xAA,
+0xE1,0xAF,0xB2,0xE1,0xAF,0xB3,0x41,0x61,0x42,0x62,0x42,0x62,0x42,0x62,0x43,0x63,
+0x44,0x64,0x44,0x64,0x44,0x64,0x44,0x64,0x44,0x64,0x45,0x65,0x45,0x65,0x45,0x65,
+0x45,0x65,0x45,0x65,0x46,0x66,0x47,0x67,0x48,0x68,0x48,0x68,0x48,0x68,0x48,0x68,
+0x48,0x68,0x49,0x69,0x49,0x69,0x4B,0x6B,0x4B,0x6B,0x4B,0x6B,0x4C,0x6C,0x4C,0x6C,
+0x4C,0x6C,0x4C,0x6C,0x4D,0x6D,0x4D,0x6D,0x4D,0x6D,0x4E,0x6E,0x4E,0x6E,0x4E,0x6E,
+0x4E,0x6E,0x4F,0x6F,0x4F,0x6F,0x4F,0x6F,0x4F,0x6F,0x50,0x70,0x50,0x70,0x52,0x72,
+0x52,0x72,0x52,0x72,0x52,0x72,0x53,0x73,0x53,0x73,0x53,0x73,0x53,0x73,0x53,0x73,
+0x54,0x74,0x54,0x74,0x54,0x74,0x54,0x74,0x55,0x75,0x55,0x75,0x55,0x75,0x55,0x75,
+0x55,0x75,0x56,0x76,0x56,0x76,0x57,0x77,0x57,0x77,0x57,0x77,0x57,0x77,0x57,0x77,
+0x58,0x78,0x58,0x78,0x59,0x79,0x5A,0x7A,0x5A,0x7A,0x5A,0x7A,0x68,0x74,0x77,0x79,
+0xC5,0xBF,0x41,0x61,0x41,0x61,0x41,0x61,0x41,0x61,0x41,0x61,0x41,0x61,0x41,0x61,
+0x41,0x61,0x41,0x61,0x41,0x61,0x41,0x61,0x41,0x61,0x45,0x65,0x45,0x65,0x45,0x65,
+0x45,0x65,0x45,0x65,0x45,0x65,0x45,0x65,0x45,0x65,0x49,0x69,0x49,0x69,0x4F,0x6F,
+0x4F,0x6F,0x4F,0x6F,0x4F,0x6F,0x4F,0x6F,0x4F,0x6F,0x4F,0x6F,0x4F,0x6F,0x4F,0x6F,
+0x4F,0x6F,0x4F,0x6F,0x4F,0x6F,0x55,0x75,0x55,0x75,0x55,0x75,0x55,0x75,0x55,0x75,
+0x55,0x75,0x55,0x75,0x59,0x79,0x59,0x79,0x59,0x79,0x59,0x79,0xCE,0xB1,0xCE,0xB1,
+0xCE,0xB1,0xCE,0xB1,0xCE,0xB1,0xCE,0xB1,0xCE,0xB1,0xCE,0xB1,0xCE,0x91,0xCE,0x91,
+0xCE,0x91,0xCE,0x91,0xCE,0x91,0xCE,0x91,0xCE,0x91,0xCE,0x91,0xCE,0xB5,0xCE,0xB5,
+0xCE,0xB5,0xCE,0xB5,0xCE,0xB5,0xCE,0xB5,0xCE,0x95,0xCE,0x95,0xCE,0x95,0xCE,0x95,
+0xCE,0x95,0xCE,0x95,0xCE,0xB7,0xCE,0xB7,0xCE,0xB7,0xCE,0xB7,0xCE,0xB7,0xCE,0xB7,
+0xCE,0xB7,0xCE,0xB7,0xCE,0x97,0xCE,0x97,0xCE,0x97,0xCE,0x97,0xCE,0x97,0xCE,0x97,
+0xCE,0x97,0xCE,0x97,0xCE,0xB9,0xCE,0xB9,0xCE,0xB9,0xCE,0xB9,0xCE,0xB9,0xCE,0xB9,
+0xCE,0xB9,0xCE,0xB9,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,
+0xCE,0x99,0xCE,0x99,0xCE,0xBF,0xCE,0xBF,0xCE,0xBF,0xCE,0xBF,0xCE,0xBF,0xCE,0xBF,
+0xCE,0x9F,0xCE,0x9F,0xCE,0x9F,0xCE,0x9F,0xCE,0x9F,0xCE,0x9F,0xCF,0x85,0xCF,0x85,
+0xCF,0x85,0xCF,0x85,0xCF,0x85,0xCF,0x85,0xCF,0x85,0xCF,0x85,0xCE,0xA5,0xCE,0xA5,
+0xCE,0xA5,0xCE,0xA5,0xCF,0x89,0xCF,0x89,0xCF,0x89,0xCF,0x89,0xCF,0x89,0xCF,0x89,
+0xCF,0x89,0xCF,0x89,0xCE,0xA9,0xCE,0xA9,0xCE,0xA9,0xCE,0xA9,0xCE,0xA9,0xCE,0xA9,
+0xCE,0xA9,0xCE,0xA9,0xCE,0xB1,0xCE,0xB1,0xCE,0xB5,0xCE,0xB5,0xCE,0xB7,0xCE,0xB7,
+0xCE,0xB9,0xCE,0xB9,0xCE,0xBF,0xCE,0xBF,0xCF,0x85,0xCF,0x85,0xCF,0x89,0xCF,0x89,
+0xCE,0xB1,0xCE,0xB1,0xCE,0xB1,0xCE,0xB1,0xCE,0xB1,0xCE,0xB1,0xCE,0xB1,0xCE,0xB1,
+0xCE,0x91,0xCE,0x91,0xCE,0x91,0xCE,0x91,0xCE,0x91,0xCE,0x91,0xCE,0x91,0xCE,0x91,
+0xCE,0xB7,0xCE,0xB7,0xCE,0xB7,0xCE,0xB7,0xCE,0xB7,0xCE,0xB7,0xCE,0xB7,0xCE,0xB7,
+0xCE,0x97,0xCE,0x97,0xCE,0x97,0xCE,0x97,0xCE,0x97,0xCE,0x97,0xCE,0x97,0xCE,0x97,
+0xCF,0x89,0xCF,0x89,0xCF,0x89,0xCF,0x89,0xCF,0x89,0xCF,0x89,0xCF,0x89,0xCF,0x89,
+0xCE,0xA9,0xCE,0xA9,0xCE,0xA9,0xCE,0xA9,0xCE,0xA9,0xCE,0xA9,0xCE,0xA9,0xCE,0xA9,
+0xCE,0xB1,0xCE,0xB1,0xCE,0xB1,0xCE,0xB1,0xCE,0xB1,0xCE,0xB1,0xCE,0xB1,0xCE,0x91,
+0xCE,0x91,0xCE,0x91,0xCE,0x91,0xCE,0x91,0xCE,0xB9,0xC2,0xA8,0xCE,0xB7,0xCE,0xB7,
+0xCE,0xB7,0xCE,0xB7,0xCE,0xB7,0xCE,0x95,0xCE,0x95,0xCE,0x97,0xCE,0x97,0xCE,0x97,
+0xE1,0xBE,0xBF,0xE1,0xBE,0xBF,0xE1,0xBE,0xBF,0xCE,0xB9,0xCE,0xB9,0xCE,0xB9,0xCE,
+0xB9,0xCE,0xB9,0xCE,0xB9,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xE1,0xBF,0xBE,
+0xE1,0xBF,0xBE,0xE1,0xBF,0xBE,0xCF,0x85,0xCF,0x85,0xCF,0x85,0xCF,0x85,0xCF,0x81,
+0xCF,0x81,0xCF,0x85,0xCF,0x85,0xCE,0xA5,0xCE,0xA5,0xCE,0xA5,0xCE,0xA5,0xCE,0xA1,
+0xC2,0xA8,0xC2,0xA8,0x60,0xCF,0x89,0xCF,0x89,0xCF,0x89,0xCF,0x89,0xCF,0x89,0xCE,
+0x9F,0xCE,0x9F,0xCE,0xA9,0xCE,0xA9,0xCE,0xA9,0xC2,0xB4,0xE2,0x80,0x82,0xE2,0x80,
+0x83,0xCE,0xA9,0x4B,0x41,0xE2,0x86,0x90,0xE2,0x86,0x92,0xE2,0x86,0x94,0xE2,0x87,
+0x90,0xE2,0x87,0x94,0xE2,0x87,0x92,0xE2,0x88,0x83,0xE2,0x88,0x88,0xE2,0x88,0x8B,
+0xE2,0x88,0xA3,0xE2,0x88,0xA5,0xE2,0x88,0xBC,0xE2,0x89,0x83,0xE2,0x89,0x85,0xE2,
+0x89,0x88,0x3D,0xE2,0x89,0xA1,0xE2,0x89,0x8D,0x3C,0x3E,0xE2,0x89,0xA4,0xE2,0x89,
+0xA5,0xE2,0x89,0xB2,0xE2,0x89,0xB3,0xE2,0x89,0xB6,0xE2,0x89,0xB7,0xE2,0x89,0xBA,
+0xE2,0x89,0xBB,0xE2,0x8A,0x82,0xE2,0x8A,0x83,0xE2,0x8A,0x86,0xE2,0x8A,0x87,0xE2,
+0x8A,0xA2,0xE2,0x8A,0xA8,0xE2,0x8A,0xA9,0xE2,0x8A,0xAB,0xE2,0x89,0xBC,0xE2,0x89,
+0xBD,0xE2,0x8A,0x91,0xE2,0x8A,0x92,0xE2,0x8A,0xB2,0xE2,0x8A,0xB3,0xE2,0x8A,0xB4,
+0xE2,0x8A,0xB5,0xE3,0x80,0x88,0xE3,0x80,0x89,0xE2,0xAB,0x9D,0xE3,0x80,0xAE,0xE3,
+0x80,0xAF,0xE3,0x81,0x8B,0xE3,0x81,0x8D,0xE3,0x81,0x8F,0xE3,0x81,0x91,0xE3,0x81,
+0x93,0xE3,0x81,0x95,0xE3,0x81,0x97,0xE3,0x81,0x99,0xE3,0x81,0x9B,0xE3,0x81,0x9D,
+0xE3,0x81,0x9F,0xE3,0x81,0xA1,0xE3,0x81,0xA4,0xE3,0x81,0xA6,0xE3,0x81,0xA8,0xE3,
+0x81,0xAF,0xE3,0x81,0xAF,0xE3,0x81,0xB2,0xE3,0x81,0xB2,0xE3,0x81,0xB5,0xE3,0x81,
+0xB5,0xE3,0x81,0xB8,0xE3,0x81,0xB8,0xE3,0x81,0xBB,0xE3,0x81,0xBB,0xE3,0x81,0x86,
+0xE3,0x82,0x9D,0xE3,0x82,0xAB,0xE3,0x82,0xAD,0xE3,0x82,0xAF,0xE3,0x82,0xB1,0xE3,
+0x82,0xB3,0xE3,0x82,0xB5,0xE3,0x82,0xB7,0xE3,0x82,0xB9,0xE3,0x82,0xBB,0xE3,0x82,
+0xBD,0xE3,0x82,0xBF,0xE3,0x83,0x81,0xE3,0x83,0x84,0xE3,0x83,0x86,0xE3,0x83,0x88,
+0xE3,0x83,0x8F,0xE3,0x83,0x8F,0xE3,0x83,0x92,0xE3,0x83,0x92,0xE3,0x83,0x95,0xE3,
+0x83,0x95,0xE3,0x83,0x98,0xE3,0x83,0x98,0xE3,0x83,0x9B,0xE3,0x83,0x9B,0xE3,0x82,
+0xA6,0xE3,0x83,0xAF,0xE3,0x83,0xB0,0xE3,0x83,0xB1,0xE3,0x83,0xB2,0xE3,0x83,0xBD,
+0xEA,0xA5,0x93,0xEA,0xA7,0x80,0xE8,0xB1,0x88,0xE6,0x9B,0xB4,0xE8,0xBB,0x8A,0xE8,
+0xB3,0x88,0xE6,0xBB,0x91,0xE4,0xB8,0xB2,0xE5,0x8F,0xA5,0xE9,0xBE,0x9C,0xE9,0xBE,
+0x9C,0xE5,0xA5,0x91,0xE9,0x87,0x91,0xE5,0x96,0x87,0xE5,0xA5,0x88,0xE6,0x87,0xB6,
+0xE7,0x99,0xA9,0xE7,0xBE,0x85,0xE8,0x98,0xBF,0xE8,0x9E,0xBA,0xE8,0xA3,0xB8,0xE9,
+0x82,0x8F,0xE6,0xA8,0x82,0xE6,0xB4,0x9B,0xE7,0x83,0x99,0xE7,0x8F,0x9E,0xE8,0x90,
+0xBD,0xE9,0x85,0xAA,0xE9,0xA7,0xB1,0xE4,0xBA,0x82,0xE5,0x8D,0xB5,0xE6,0xAC,0x84,
+0xE7,0x88,0x9B,0xE8,0x98,0xAD,0xE9,0xB8,0x9E,0xE5,0xB5,0x90,0xE6,0xBF,0xAB,0xE8,
+0x97,0x8D,0xE8,0xA5,0xA4,0xE6,0x8B,0x89,0xE8,0x87,0x98,0xE8,0xA0,0x9F,0xE5,0xBB,
+0x8A,0xE6,0x9C,0x97,0xE6,0xB5,0xAA,0xE7,0x8B,0xBC,0xE9,0x83,0x8E,0xE4,0xBE,0x86,
+0xE5,0x86,0xB7,0xE5,0x8B,0x9E,0xE6,0x93,0x84,0xE6,0xAB,0x93,0xE7,0x88,0x90,0xE7,
+0x9B,0xA7,0xE8,0x80,0x81,0xE8,0x98,0x86,0xE8,0x99,0x9C,0xE8,0xB7,0xAF,0xE9,0x9C,
+0xB2,0xE9,0xAD,0xAF,0xE9,0xB7,0xBA,0xE7,0xA2,0x8C,0xE7,0xA5,0xBF,0xE7,0xB6,0xA0,
+0xE8,0x8F,0x89,0xE9,0x8C,0x84,0xE9,0xB9,0xBF,0xE8,0xAB,0x96,0xE5,0xA3,0x9F,0xE5,
+0xBC,0x84,0xE7,0xB1,0xA0,0xE8,0x81,0xBE,0xE7,0x89,0xA2,0xE7,0xA3,0x8A,0xE8,0xB3,
+0x82,0xE9,0x9B,0xB7,0xE5,0xA3,0x98,0xE5,0xB1,0xA2,0xE6,0xA8,0x93,0xE6,0xB7,0x9A,
+0xE6,0xBC,0x8F,0xE7,0xB4,0xAF,0xE7,0xB8,0xB7,0xE9,0x99,0x8B,0xE5,0x8B,0x92,0xE8,
+0x82,0x8B,0xE5,0x87,0x9C,0xE5,0x87,0x8C,0xE7,0xA8,0x9C,0xE7,0xB6,0xBE,0xE8,0x8F,
+0xB1,0xE9,0x99,0xB5,0xE8,0xAE,0x80,0xE6,0x8B,0x8F,0xE6,0xA8,0x82,0xE8,0xAB,0xBE,
+0xE4,0xB8,0xB9,0xE5,0xAF,0xA7,0xE6,0x80,0x92,0xE7,0x8E,0x87,0xE7,0x95,0xB0,0xE5,
+0x8C,0x97,0xE7,0xA3,0xBB,0xE4,0xBE,0xBF,0xE5,0xBE,0xA9,0xE4,0xB8,0x8D,0xE6,0xB3,
+0x8C,0xE6,0x95,0xB8,0xE7,0xB4,0xA2,0xE5,0x8F,0x83,0xE5,0xA1,0x9E,0xE7,0x9C,0x81,
+0xE8,0x91,0x89,0xE8,0xAA,0xAA,0xE6,0xAE,0xBA,0xE8,0xBE,0xB0,0xE6,0xB2,0x88,0xE6,
+0x8B,0xBE,0xE8,0x8B,0xA5,0xE6,0x8E,0xA0,0xE7,0x95,0xA5,0xE4,0xBA,0xAE,0xE5,0x85,
+0xA9,0xE5,0x87,0x89,0xE6,0xA2,0x81,0xE7,0xB3,0xA7,0xE8,0x89,0xAF,0xE8,0xAB,0x92,
+0xE9,0x87,0x8F,0xE5,0x8B,0xB5,0xE5,0x91,0x82,0xE5,0xA5,0xB3,0xE5,0xBB,0xAC,0xE6,
+0x97,0x85,0xE6,0xBF,0xBE,0xE7,0xA4,0xAA,0xE9,0x96,0xAD,0xE9,0xA9,0xAA,0xE9,0xBA,
+0x97,0xE9,0xBB,0x8E,0xE5,0x8A,0x9B,0xE6,0x9B,0x86,0xE6,0xAD,0xB7,0xE8,0xBD,0xA2,
+0xE5,0xB9,0xB4,0xE6,0x86,0x90,0xE6,0x88,0x80,0xE6,0x92,0x9A,0xE6,0xBC,0xA3,0xE7,
+0x85,0x89,0xE7,0x92,0x89,0xE7,0xA7,0x8A,0xE7,0xB7,0xB4,0xE8,0x81,0xAF,0xE8,0xBC,
+0xA6,0xE8,0x93,0xAE,0xE9,0x80,0xA3,0xE9,0x8D,0x8A,0xE5,0x88,0x97,0xE5,0x8A,0xA3,
+0xE5,0x92,0xBD,0xE7,0x83,0x88,0xE8,0xA3,0x82,0xE8,0xAA,0xAA,0xE5,0xBB,0x89,0xE5,
+0xBF,0xB5,0xE6,0x8D,0xBB,0xE6,0xAE,0xAE,0xE7,0xB0,0xBE,0xE7,0x8D,0xB5,0xE4,0xBB,
+0xA4,0xE5,0x9B,0xB9,0xE5,0xAF,0xA7,0xE5,0xB6,0xBA,0xE6,0x80,0x9C,0xE7,0x8E,0xB2,
+0xE7,0x91,0xA9,0xE7,0xBE,0x9A,0xE8,0x81,0x86,0xE9,0x88,0xB4,0xE9,0x9B,0xB6,0xE9,
+0x9D,0x88,0xE9,0xA0,0x98,0xE4,0xBE,0x8B,0xE7,0xA6,0xAE,0xE9,0x86,0xB4,0xE9,0x9A,
+0xB8,0xE6,0x83,0xA1,0xE4,0xBA,0x86,0xE5,0x83,0x9A,0xE5,0xAF,0xAE,0xE5,0xB0,0xBF,
+0xE6,0x96,0x99,0xE6,0xA8,0x82,0xE7,0x87,0x8E,0xE7,0x99,0x82,0xE8,0x93,0xBC,0xE9,
+0x81,0xBC,0xE9,0xBE,0x8D,0xE6,0x9A,0x88,0xE9,0x98,0xAE,0xE5,0x8A,0x89,0xE6,0x9D,
+0xBB,0xE6,0x9F,0xB3,0xE6,0xB5,0x81,0xE6,0xBA,0x9C,0xE7,0x90,0x89,0xE7,0x95,0x99,
+0xE7,0xA1,0xAB,0xE7,0xB4,0x90,0xE9,0xA1,0x9E,0xE5,0x85,0xAD,0xE6,0x88,0xAE,0xE9,
+0x99,0xB8,0xE5,0x80,0xAB,0xE5,0xB4,0x99,0xE6,0xB7,0xAA,0xE8,0xBC,0xAA,0xE5,0xBE,
+0x8B,0xE6,0x85,0x84,0xE6,0xA0,0x97,0xE7,0x8E,0x87,0xE9,0x9A,0x86,0xE5,0x88,0xA9,
+0xE5,0x90,0x8F,0xE5,0xB1,0xA5,0xE6,0x98,0x93,0xE6,0x9D,0x8E,0xE6,0xA2,0xA8,0xE6,
+0xB3,0xA5,0xE7,0x90,0x86,0xE7,0x97,0xA2,0xE7,0xBD,0xB9,0xE8,0xA3,0x8F,0xE8,0xA3,
+0xA1,0xE9,0x87,0x8C,0xE9,0x9B,0xA2,0xE5,0x8C,0xBF,0xE6,0xBA,0xBA,0xE5,0x90,0x9D,
+0xE7,0x87,0x90,0xE7,0x92,0x98,0xE8,0x97,0xBA,0xE9,0x9A,0xA3,0xE9,0xB1,0x97,0xE9,
+0xBA,0x9F,0xE6,0x9E,0x97,0xE6,0xB7,0x8B,0xE8,0x87,0xA8,0xE7,0xAB,0x8B,0xE7,0xAC,
+0xA0,0xE7,0xB2,0x92,0xE7,0x8B,0x80,0xE7,0x82,0x99,0xE8,0xAD,0x98,0xE4,0xBB,0x80,
+0xE8,0x8C,0xB6,0xE5,0x88,0xBA,0xE5,0x88,0x87,0xE5,0xBA,0xA6,0xE6,0x8B,0x93,0xE7,
+0xB3,0x96,0xE5,0xAE,0x85,0xE6,0xB4,0x9E,0xE6,0x9A,0xB4,0xE8,0xBC,0xBB,0xE8,0xA1,
+0x8C,0xE9,0x99,0x8D,0xE8,0xA6,0x8B,0xE5,0xBB,0x93,0xE5,0x85,0x80,0xE5,0x97,0x80,
+0xE5,0xA1,0x9A,0xE6,0x99,0xB4,0xE5,0x87,0x9E,0xE7,0x8C,0xAA,0xE7,0x9B,0x8A,0xE7,
+0xA4,0xBC,0xE7,0xA5,0x9E,0xE7,0xA5,0xA5,0xE7,0xA6,0x8F,0xE9,0x9D,0x96,0xE7,0xB2,
+0xBE,0xE7,0xBE,0xBD,0xE8,0x98,0x92,0xE8,0xAB,0xB8,0xE9,0x80,0xB8,0xE9,0x83,0xBD,
+0xE9,0xA3,0xAF,0xE9,0xA3,0xBC,0xE9,0xA4,0xA8,0xE9,0xB6,0xB4,0xE9,0x83,0x9E,0xE9,
+0x9A,0xB7,0xE4,0xBE,0xAE,0xE5,0x83,0xA7,0xE5,0x85,0x8D,0xE5,0x8B,0x89,0xE5,0x8B,
+0xA4,0xE5,0x8D,0x91,0xE5,0x96,0x9D,0xE5,0x98,0x86,0xE5,0x99,0xA8,0xE5,0xA1,0x80,
+0xE5,0xA2,0xA8,0xE5,0xB1,0xA4,0xE5,0xB1,0xAE,0xE6,0x82,0x94,0xE6,0x85,0xA8,0xE6,
+0x86,0x8E,0xE6,0x87,0xB2,0xE6,0x95,0x8F,0xE6,0x97,0xA2,0xE6,0x9A,0x91,0xE6,0xA2,
+0x85,0xE6,0xB5,0xB7,0xE6,0xB8,0x9A,0xE6,0xBC,0xA2,0xE7,0x85,0xAE,0xE7,0x88,0xAB,
+0xE7,0x90,0xA2,0xE7,0xA2,0x91,0xE7,0xA4,0xBE,0xE7,0xA5,0x89,0xE7,0xA5,0x88,0xE7,
+0xA5,0x90,0xE7,0xA5,0x96,0xE7,0xA5,0x9D,0xE7,0xA6,0x8D,0xE7,0xA6,0x8E,0xE7,0xA9,
+0x80,0xE7,0xAA,0x81,0xE7,0xAF,0x80,0xE7,0xB7,0xB4,0xE7,0xB8,0x89,0xE7,0xB9,0x81,
+0xE7,0xBD,0xB2,0xE8,0x80,0x85,0xE8,0x87,0xAD,0xE8,0x89,0xB9,0xE8,0x89,0xB9,0xE8,
+0x91,0x97,0xE8,0xA4,0x90,0xE8,0xA6,0x96,0xE8,0xAC,0x81,0xE8,0xAC,0xB9,0xE8,0xB3,
+0x93,0xE8,0xB4,0x88,0xE8,0xBE,0xB6,0xE9,0x80,0xB8,0xE9,0x9B,0xA3,0xE9,0x9F,0xBF,
+0xE9,0xA0,0xBB,0xE6,0x81,0xB5,0xF0,0xA4,0x8B,0xAE,0xE8,0x88,0x98,0xE4,0xB8,0xA6,
+0xE5,0x86,0xB5,0xE5,0x85,0xA8,0xE4,0xBE,0x80,0xE5,0x85,0x85,0xE5,0x86,0x80,0xE5,
+0x8B,0x87,0xE5,0x8B,0xBA,0xE5,0x96,0x9D,0xE5,0x95,0x95,0xE5,0x96,0x99,0xE5,0x97,
+0xA2,0xE5,0xA1,0x9A,0xE5,0xA2,0xB3,0xE5,0xA5,0x84,0xE5,0xA5,0x94,0xE5,0xA9,0xA2,
+0xE5,0xAC,0xA8,0xE5,0xBB,0x92,0xE5,0xBB,0x99,0xE5,0xBD,0xA9,0xE5,0xBE,0xAD,0xE6,
+0x83,0x98,0xE6,0x85,0x8E,0xE6,0x84,0x88,0xE6,0x86,0x8E,0xE6,0x85,0xA0,0xE6,0x87,
+0xB2,0xE6,0x88,0xB4,0xE6,0x8F,0x84,0xE6,0x90,0x9C,0xE6,0x91,0x92,0xE6,0x95,0x96,
+0xE6,0x99,0xB4,0xE6,0x9C,0x97,0xE6,0x9C,0x9B,0xE6,0x9D,0x96,0xE6,0xAD,0xB9,0xE6,
+0xAE,0xBA,0xE6,0xB5,0x81,0xE6,0xBB,0x9B,0xE6,0xBB,0x8B,0xE6,0xBC,0xA2,0xE7,0x80,
+0x9E,0xE7,0x85,0xAE,0xE7,0x9E,0xA7,0xE7,0x88,0xB5,0xE7,0x8A,0xAF,0xE7,0x8C,0xAA,
+0xE7,0x91,0xB1,0xE7,0x94,0x86,0xE7,0x94,0xBB,0xE7,0x98,0x9D,0xE7,0x98,0x9F,0xE7,
+0x9B,0x8A,0xE7,0x9B,0x9B,0xE7,0x9B,0xB4,0xE7,0x9D,0x8A,0xE7,0x9D,0x80,0xE7,0xA3,
+0x8C,0xE7,0xAA,0xB1,0xE7,0xAF,0x80,0xE7,0xB1,0xBB,0xE7,0xB5,0x9B,0xE7,0xB7,0xB4,
+0xE7,0xBC,0xBE,0xE8,0x80,0x85,0xE8,0x8D,0x92,0xE8,0x8F,0xAF,0xE8,0x9D,0xB9,0xE8,
+0xA5,0x81,0xE8,0xA6,0x86,0xE8,0xA6,0x96,0xE8,0xAA,0xBF,0xE8,0xAB,0xB8,0xE8,0xAB,
+0x8B,0xE8,0xAC,0x81,0xE8,0xAB,0xBE,0xE8,0xAB,0xAD,0xE8,0xAC,0xB9,0xE8,0xAE,0x8A,
+0xE8,0xB4,0x88,0xE8,0xBC,0xB8,0xE9,0x81,0xB2,0xE9,0x86,0x99,0xE9,0x89,0xB6,0xE9,
+0x99,0xBC,0xE9,0x9B,0xA3,0xE9,0x9D,0x96,0xE9,0x9F,0x9B,0xE9,0x9F,0xBF,0xE9,0xA0,
+0x8B,0xE9,0xA0,0xBB,0xE9,0xAC,0x92,0xE9,0xBE,0x9C,0xF0,0xA2,0xA1,0x8A,0xF0,0xA2,
+0xA1,0x84,0xF0,0xA3,0x8F,0x95,0xE3,0xAE,0x9D,0xE4,0x80,0x98,0xE4,0x80,0xB9,0xF0,
+0xA5,0x89,0x89,0xF0,0xA5,0xB3,0x90,0xF0,0xA7,0xBB,0x93,0xE9,0xBD,0x83,0xE9,0xBE,
+0x8E,0xD7,0x99,0xD7,0xB2,0xD7,0xA9,0xD7,0xA9,0xD7,0xA9,0xD7,0xA9,0xD7,0x90,0xD7,
+0x90,0xD7,0x90,0xD7,0x91,0xD7,0x92,0xD7,0x93,0xD7,0x94,0xD7,0x95,0xD7,0x96,0xD7,
+0x98,0xD7,0x99,0xD7,0x9A,0xD7,0x9B,0xD7,0x9C,0xD7,0x9E,0xD7,0xA0,0xD7,0xA1,0xD7,
+0xA3,0xD7,0xA4,0xD7,0xA6,0xD7,0xA7,0xD7,0xA8,0xD7,0xA9,0xD7,0xAA,0xD7,0x95,0xD7,
+0x91,0xD7,0x9B,0xD7,0xA4,0xF0,0x91,0x82,0x99,0xF0,0x91,0x82,0x9B,0xF0,0x91,0x82,
+0xA5,0xF0,0x91,0x87,0x80,0xF0,0x91,0x88,0xB5,0xF0,0x91,0x8C,0xBE,0xF0,0x91,0x8D,
+0x8D,0xF0,0x91,0x8D,0x97,0xF0,0x91,0x92,0xB0,0xF0,0x91,0x92,0xB9,0xF0,0x91,0x92,
+0xBD,0xF0,0x91,0x96,0xAF,0xF0,0x91,0x9A,0xB6,0xF0,0x91,0xA4,0xB0,0xF0,0x91,0xA4,
+0xBD,0xF0,0x91,0xBD,0x81,0xF0,0x96,0xBF,0xB0,0xF0,0x96,0xBF,0xB1,0xF0,0x9D,0x85,
+0x97,0xF0,0x9D,0x85,0xA5,0xF0,0x9D,0x85,0x98,0xF0,0x9D,0x85,0xA5,0xF0,0x9D,0x85,
+0x98,0xF0,0x9D,0x85,0xA5,0xF0,0x9D,0x85,0xAE,0xF0,0x9D,0x85,0x98,0xF0,0x9D,0x85,
+0xA5,0xF0,0x9D,0x85,0xAF,0xF0,0x9D,0x85,0x98,0xF0,0x9D,0x85,0xA5,0xF0,0x9D,0x85,
+0xB0,0xF0,0x9D,0x85,0x98,0xF0,0x9D,0x85,0xA5,0xF0,0x9D,0x85,0xB1,0xF0,0x9D,0x85,
+0x98,0xF0,0x9D,0x85,0xA5,0xF0,0x9D,0x85,0xB2,0xF0,0x9D,0x85,0xA5,0xF0,0x9D,0x85,
+0xA6,0xF0,0x9D,0x85,0xAD,0xF0,0x9D,0x85,0xAE,0xF0,0x9D,0x85,0xAF,0xF0,0x9D,0x85,
+0xB0,0xF0,0x9D,0x85,0xB1,0xF0,0x9D,0x85,0xB2,0xF0,0x9D,0x86,0xB9,0xF0,0x9D,0x85,
+0xA5,0xF0,0x9D,0x86,0xBA,0xF0,0x9D,0x85,0xA5,0xF0,0x9D,0x86,0xB9,0xF0,0x9D,0x85,
+0xA5,0xF0,0x9D,0x85,0xAE,0xF0,0x9D,0x86,0xBA,0xF0,0x9D,0x85,0xA5,0xF0,0x9D,0x85,
+0xAE,0xF0,0x9D,0x86,0xB9,0xF0,0x9D,0x85,0xA5,0xF0,0x9D,0x85,0xAF,0xF0,0x9D,0x86,
+0xBA,0xF0,0x9D,0x85,0xA5,0xF0,0x9D,0x85,0xAF,0xE4,0xB8,0xBD,0xE4,0xB8,0xB8,0xE4,
+0xB9,0x81,0xF0,0xA0,0x84,0xA2,0xE4,0xBD,0xA0,0xE4,0xBE,0xAE,0xE4,0xBE,0xBB,0xE5,
+0x80,0x82,0xE5,0x81,0xBA,0xE5,0x82,0x99,0xE5,0x83,0xA7,0xE5,0x83,0x8F,0xE3,0x92,
+0x9E,0xF0,0xA0,0x98,0xBA,0xE5,0x85,0x8D,0xE5,0x85,0x94,0xE5,0x85,0xA4,0xE5,0x85,
+0xB7,0xF0,0xA0,0x94,0x9C,0xE3,0x92,0xB9,0xE5,0x85,0xA7,0xE5,0x86,0x8D,0xF0,0xA0,
+0x95,0x8B,0xE5,0x86,0x97,0xE5,0x86,0xA4,0xE4,0xBB,0x8C,0xE5,0x86,0xAC,0xE5,0x86,
+0xB5,0xF0,0xA9,0x87,0x9F,0xE5,0x87,0xB5,0xE5,0x88,0x83,0xE3,0x93,0x9F,0xE5,0x88,
+0xBB,0xE5,0x89,0x86,0xE5,0x89,0xB2,0xE5,0x89,0xB7,0xE3,0x94,0x95,0xE5,0x8B,0x87,
+0xE5,0x8B,0x89,0xE5,0x8B,0xA4,0xE5,0x8B,0xBA,0xE5,0x8C,0x85,0xE5,0x8C,0x86,0xE5,
+0x8C,0x97,0xE5,0x8D,0x89,0xE5,0x8D,0x91,0xE5,0x8D,0x9A,0xE5,0x8D,0xB3,0xE5,0x8D,
+0xBD,0xE5,0x8D,0xBF,0xE5,0x8D,0xBF,0xE5,0x8D,0xBF,0xF0,0xA0,0xA8,0xAC,0xE7,0x81,
+0xB0,0xE5,0x8F,0x8A,0xE5,0x8F,0x9F,0xF0,0xA0,0xAD,0xA3,0xE5,0x8F,0xAB,0xE5,0x8F,
+0xB1,0xE5,0x90,0x86,0xE5,0x92,0x9E,0xE5,0x90,0xB8,0xE5,0x91,0x88,0xE5,0x91,0xA8,
+0xE5,0x92,0xA2,0xE5,0x93,0xB6,0xE5,0x94,0x90,0xE5,0x95,0x93,0xE5,0x95,0xA3,0xE5,
+0x96,0x84,0xE5,0x96,0x84,0xE5,0x96,0x99,0xE5,0x96,0xAB,0xE5,0x96,0xB3,0xE5,0x97,
+0x82,0xE5,0x9C,0x96,0xE5,0x98,0x86,0xE5,0x9C,0x97,0xE5,0x99,0x91,0xE5,0x99,0xB4,
+0xE5,0x88,0x87,0xE5,0xA3,0xAE,0xE5,0x9F,0x8E,0xE5,0x9F,0xB4,0xE5,0xA0,0x8D,0xE5,
+0x9E,0x8B,0xE5,0xA0,0xB2,0xE5,0xA0,0xB1,0xE5,0xA2,0xAC,0xF0,0xA1,0x93,0xA4,0xE5,
+0xA3,0xB2,0xE5,0xA3,0xB7,0xE5,0xA4,0x86,0xE5,0xA4,0x9A,0xE5,0xA4,0xA2,0xE5,0xA5,
+0xA2,0xF0,0xA1,0x9A,0xA8,0xF0,0xA1,0x9B,0xAA,0xE5,0xA7,0xAC,0xE5,0xA8,0x9B,0xE5,
+0xA8,0xA7,0xE5,0xA7,0x98,0xE5,0xA9,0xA6,0xE3,0x9B,0xAE,0xE3,0x9B,0xBC,0xE5,0xAC,
+0x88,0xE5,0xAC,0xBE,0xE5,0xAC,0xBE,0xF0,0xA1,0xA7,0x88,0xE5,0xAF,0x83,0xE5,0xAF,
+0x98,0xE5,0xAF,0xA7,0xE5,0xAF,0xB3,0xF0,0xA1,0xAC,0x98,0xE5,0xAF,0xBF,0xE5,0xB0,
+0x86,0xE5,0xBD,0x93,0xE5,0xB0,0xA2,0xE3,0x9E,0x81,0xE5,0xB1,0xA0,0xE5,0xB1,0xAE,
+0xE5,0xB3,0x80,0xE5,0xB2,0x8D,0xF0,0xA1,0xB7,0xA4,0xE5,0xB5,0x83,0xF0,0xA1,0xB7,
+0xA6,0xE5,0xB5,0xAE,0xE5,0xB5,0xAB,0xE5,0xB5,0xBC,0xE5,0xB7,0xA1,0xE5,0xB7,0xA2,
+0xE3,0xA0,0xAF,0xE5,0xB7,0xBD,0xE5,0xB8,0xA8,0xE5,0xB8,0xBD,0xE5,0xB9,0xA9,0xE3,
+0xA1,0xA2,0xF0,0xA2,0x86,0x83,0xE3,0xA1,0xBC,0xE5,0xBA,0xB0,0xE5,0xBA,0xB3,0xE5,
+0xBA,0xB6,0xE5,0xBB,0x8A,0xF0,0xAA,0x8E,0x92,0xE5,0xBB,0xBE,0xF0,0xA2,0x8C,0xB1,
+0xF0,0xA2,0x8C,0xB1,0xE8,0x88,0x81,0xE5,0xBC,0xA2,0xE5,0xBC,0xA2,0xE3,0xA3,0x87,
+0xF0,0xA3,0x8A,0xB8,0xF0,0xA6,0x87,0x9A,0xE5,0xBD,0xA2,0xE5,0xBD,0xAB,0xE3,0xA3,
+0xA3,0xE5,0xBE,0x9A,0xE5,0xBF,0x8D,0xE5,0xBF,0x97,0xE5,0xBF,0xB9,0xE6,0x82,0x81,
+0xE3,0xA4,0xBA,0xE3,0xA4,0x9C,0xE6,0x82,0x94,0xF0,0xA2,0x9B,0x94,0xE6,0x83,0x87,
+0xE6,0x85,0x88,0xE6,0x85,0x8C,0xE6,0x85,0x8E,0xE6,0x85,0x8C,0xE6,0x85,0xBA,0xE6,
+0x86,0x8E,0xE6,0x86,0xB2,0xE6,0x86,0xA4,0xE6,0x86,0xAF,0xE6,0x87,0x9E,0xE6,0x87,
+0xB2,0xE6,0x87,0xB6,0xE6,0x88,0x90,0xE6,0x88,0x9B,0xE6,0x89,0x9D,0xE6,0x8A,0xB1,
+0xE6,0x8B,0x94,0xE6,0x8D,0x90,0xF0,0xA2,0xAC,0x8C,0xE6,0x8C,0xBD,0xE6,0x8B,0xBC,
+0xE6,0x8D,0xA8,0xE6,0x8E,0x83,0xE6,0x8F,0xA4,0xF0,0xA2,0xAF,0xB1,0xE6,0x90,0xA2,
+0xE6,0x8F,0x85,0xE6,0x8E,0xA9,0xE3,0xA8,0xAE,0xE6,0x91,0xA9,0xE6,0x91,0xBE,0xE6,
+0x92,0x9D,0xE6,0x91,0xB7,0xE3,0xA9,0xAC,0xE6,0x95,0x8F,0xE6,0x95,0xAC,0xF0,0xA3,
+0x80,0x8A,0xE6,0x97,0xA3,0xE6,0x9B,0xB8,0xE6,0x99,0x89,0xE3,0xAC,0x99,0xE6,0x9A,
+0x91,0xE3,0xAC,0x88,0xE3,0xAB,0xA4,0xE5,0x86,0x92,0xE5,0x86,0x95,0xE6,0x9C,0x80,
+0xE6,0x9A,0x9C,0xE8,0x82,0xAD,0xE4,0x8F,0x99,0xE6,0x9C,0x97,0xE6,0x9C,0x9B,0xE6,
+0x9C,0xA1,0xE6,0x9D,0x9E,0xE6,0x9D,0x93,0xF0,0xA3,0x8F,0x83,0xE3,0xAD,0x89,0xE6,
+0x9F,0xBA,0xE6,0x9E,0x85,0xE6,0xA1,0x92,0xE6,0xA2,0x85,0xF0,0xA3,0x91,0xAD,0xE6,
+0xA2,0x8E,0xE6,0xA0,0x9F,0xE6,0xA4,0x94,0xE3,0xAE,0x9D,0xE6,0xA5,0x82,0xE6,0xA6,
+0xA3,0xE6,0xA7,0xAA,0xE6,0xAA,0xA8,0xF0,0xA3,0x9A,0xA3,0xE6,0xAB,0x9B,0xE3,0xB0,
+0x98,0xE6,0xAC,0xA1,0xF0,0xA3,0xA2,0xA7,0xE6,0xAD,0x94,0xE3,0xB1,0x8E,0xE6,0xAD,
+0xB2,0xE6,0xAE,0x9F,0xE6,0xAE,0xBA,0xE6,0xAE,0xBB,0xF0,0xA3,0xAA,0x8D,0xF0,0xA1,
+0xB4,0x8B,0xF0,0xA3,0xAB,0xBA,0xE6,0xB1,0x8E,0xF0,0xA3,0xB2,0xBC,0xE6,0xB2,0xBF,
+0xE6,0xB3,0x8D,0xE6,0xB1,0xA7,0xE6,0xB4,0x96,0xE6,0xB4,0xBE,0xE6,0xB5,0xB7,0xE6,
+0xB5,0x81,0xE6,0xB5,0xA9,0xE6,0xB5,0xB8,0xE6,0xB6,0x85,0xF0,0xA3,0xB4,0x9E,0xE6,
+0xB4,0xB4,0xE6,0xB8,0xAF,0xE6,0xB9,0xAE,0xE3,0xB4,0xB3,0xE6,0xBB,0x8B,0xE6,0xBB,
+0x87,0xF0,0xA3,0xBB,0x91,0xE6,0xB7,0xB9,0xE6,0xBD,0xAE,0xF0,0xA3,0xBD,0x9E,0xF0,
+0xA3,0xBE,0x8E,0xE6,0xBF,0x86,0xE7,0x80,0xB9,0xE7,0x80,0x9E,0xE7,0x80,0x9B,0xE3,
+0xB6,0x96,0xE7,0x81,0x8A,0xE7,0x81,0xBD,0xE7,0x81,0xB7,0xE7,0x82,0xAD,0xF0,0xA0,
+0x94,0xA5,0xE7,0x85,0x85,0xF0,0xA4,0x89,0xA3,0xE7,0x86,0x9C,0xF0,0xA4,0x8E,0xAB,
+0xE7,0x88,0xA8,0xE7,0x88,0xB5,0xE7,0x89,0x90,0xF0,0xA4,0x98,0x88,0xE7,0x8A,0x80,
+0xE7,0x8A,0x95,0xF0,0xA4,0x9C,0xB5,0xF0,0xA4,0xA0,0x94,0xE7,0x8D,0xBA,0xE7,0x8E,
+0x8B,0xE3,0xBA,0xAC,0xE7,0x8E,0xA5,0xE3,0xBA,0xB8,0xE3,0xBA,0xB8,0xE7,0x91,0x87,
+0xE7,0x91,0x9C,0xE7,0x91,0xB1,0xE7,0x92,0x85,0xE7,0x93,0x8A,0xE3,0xBC,0x9B,0xE7,
+0x94,0xA4,0xF0,0xA4,0xB0,0xB6,0xE7,0x94,0xBE,0xF0,0xA4,0xB2,0x92,0xE7,0x95,0xB0,
+0xF0,0xA2,0x86,0x9F,0xE7,0x98,0x90,0xF0,0xA4,0xBE,0xA1,0xF0,0xA4,0xBE,0xB8,0xF0,
+0xA5,0x81,0x84,0xE3,0xBF,0xBC,0xE4,0x80,0x88,0xE7,0x9B,0xB4,0xF0,0xA5,0x83,0xB3,
+0xF0,0xA5,0x83,0xB2,0xF0,0xA5,0x84,0x99,0xF0,0xA5,0x84,0xB3,0xE7,0x9C,0x9E,0xE7,
+0x9C,0x9F,0xE7,0x9C,0x9F,0xE7,0x9D,0x8A,0xE4,0x80,0xB9,0xE7,0x9E,0x8B,0xE4,0x81,
+0x86,0xE4,0x82,0x96,0xF0,0xA5,0x90,0x9D,0xE7,0xA1,0x8E,0xE7,0xA2,0x8C,0xE7,0xA3,
+0x8C,0xE4,0x83,0xA3,0xF0,0xA5,0x98,0xA6,0xE7,0xA5,0x96,0xF0,0xA5,0x9A,0x9A,0xF0,
+0xA5,0x9B,0x85,0xE7,0xA6,0x8F,0xE7,0xA7,0xAB,0xE4,0x84,0xAF,0xE7,0xA9,0x80,0xE7,
+0xA9,0x8A,0xE7,0xA9,0x8F,0xF0,0xA5,0xA5,0xBC,0xF0,0xA5,0xAA,0xA7,0xF0,0xA5,0xAA,
+0xA7,0xE7,0xAB,0xAE,0xE4,0x88,0x82,0xF0,0xA5,0xAE,0xAB,0xE7,0xAF,0x86,0xE7,0xAF,
+0x89,0xE4,0x88,0xA7,0xF0,0xA5,0xB2,0x80,0xE7,0xB3,0x92,0xE4,0x8A,0xA0,0xE7,0xB3,
+0xA8,0xE7,0xB3,0xA3,0xE7,0xB4,0x80,0xF0,0xA5,0xBE,0x86,0xE7,0xB5,0xA3,0xE4,0x8C,
+0x81,0xE7,0xB7,0x87,0xE7,0xB8,0x82,0xE7,0xB9,0x85,0xE4,0x8C,0xB4,0xF0,0xA6,0x88,
+0xA8,0xF0,0xA6,0x89,0x87,0xE4,0x8D,0x99,0xF0,0xA6,0x8B,0x99,0xE7,0xBD,0xBA,0xF0,
+0xA6,0x8C,0xBE,0xE7,0xBE,0x95,0xE7,0xBF,0xBA,0xE8,0x80,0x85,0xF0,0xA6,0x93,0x9A,
+0xF0,0xA6,0x94,0xA3,0xE8,0x81,0xA0,0xF0,0xA6,0x96,0xA8,0xE8,0x81,0xB0,0xF0,0xA3,
+0x8D,0x9F,0xE4,0x8F,0x95,0xE8,0x82,0xB2,0xE8,0x84,0x83,0xE4,0x90,0x8B,0xE8,0x84,
+0xBE,0xE5,0xAA,0xB5,0xF0,0xA6,0x9E,0xA7,0xF0,0xA6,0x9E,0xB5,0xF0,0xA3,0x8E,0x93,
+0xF0,0xA3,0x8E,0x9C,0xE8,0x88,0x81,0xE8,0x88,0x84,0xE8,0xBE,0x9E,0xE4,0x91,0xAB,
+0xE8,0x8A,0x91,0xE8,0x8A,0x8B,0xE8,0x8A,0x9D,0xE5,0x8A,0xB3,0xE8,0x8A,0xB1,0xE8,
+0x8A,0xB3,0xE8,0x8A,0xBD,0xE8,0x8B,0xA6,0xF0,0xA6,0xAC,0xBC,0xE8,0x8B,0xA5,0xE8,
+0x8C,0x9D,0xE8,0x8D,0xA3,0xE8,0x8E,0xAD,0xE8,0x8C,0xA3,0xE8,0x8E,0xBD,0xE8,0x8F,
+0xA7,0xE8,0x91,0x97,0xE8,0x8D,0x93,0xE8,0x8F,0x8A,0xE8,0x8F,0x8C,0xE8,0x8F,0x9C,
+0xF0,0xA6,0xB0,0xB6,0xF0,0xA6,0xB5,0xAB,0xF0,0xA6,0xB3,0x95,0xE4,0x94,0xAB,0xE8,
+0x93,0xB1,0xE8,0x93,0xB3,0xE8,0x94,0x96,0xF0,0xA7,0x8F,0x8A,0xE8,0x95,0xA4,0xF0,
+0xA6,0xBC,0xAC,0xE4,0x95,0x9D,0xE4,0x95,0xA1,0xF0,0xA6,0xBE,0xB1,0xF0,0xA7,0x83,
+0x92,0xE4,0x95,0xAB,0xE8,0x99,0x90,0xE8,0x99,0x9C,0xE8,0x99,0xA7,0xE8,0x99,0xA9,
+0xE8,0x9A,0xA9,0xE8,0x9A,0x88,0xE8,0x9C,0x8E,0xE8,0x9B,0xA2,0xE8,0x9D,0xB9,0xE8,
+0x9C,0xA8,0xE8,0x9D,0xAB,0xE8,0x9E,0x86,0xE4,0x97,0x97,0xE8,0x9F,0xA1,0xE8,0xA0,
+0x81,0xE4,0x97,0xB9,0xE8,0xA1,0xA0,0xE8,0xA1,0xA3,0xF0,0xA7,0x99,0xA7,0xE8,0xA3,
+0x97,0xE8,0xA3,0x9E,0xE4,0x98,0xB5,0xE8,0xA3,0xBA,0xE3,0x92,0xBB,0xF0,0xA7,0xA2,
+0xAE,0xF0,0xA7,0xA5,0xA6,0xE4,0x9A,0xBE,0xE4,0x9B,0x87,0xE8,0xAA,0xA0,0xE8,0xAB,
+0xAD,0xE8,0xAE,0x8A,0xE8,0xB1,0x95,0xF0,0xA7,0xB2,0xA8,0xE8,0xB2,0xAB,0xE8,0xB3,
+0x81,0xE8,0xB4,0x9B,0xE8,0xB5,0xB7,0xF0,0xA7,0xBC,0xAF,0xF0,0xA0,0xA0,0x84,0xE8,
+0xB7,0x8B,0xE8,0xB6,0xBC,0xE8,0xB7,0xB0,0xF0,0xA0,0xA3,0x9E,0xE8,0xBB,0x94,0xE8,
+0xBC,0xB8,0xF0,0xA8,0x97,0x92,0xF0,0xA8,0x97,0xAD,0xE9,0x82,0x94,0xE9,0x83,0xB1,
+0xE9,0x84,0x91,0xF0,0xA8,0x9C,0xAE,0xE9,0x84,0x9B,0xE9,0x88,0xB8,0xE9,0x8B,0x97,
+0xE9,0x8B,0x98,0xE9,0x89,0xBC,0xE9,0x8F,0xB9,0xE9,0x90,0x95,0xF0,0xA8,0xAF,0xBA,
+0xE9,0x96,0x8B,0xE4,0xA6,0x95,0xE9,0x96,0xB7,0xF0,0xA8,0xB5,0xB7,0xE4,0xA7,0xA6,
+0xE9,0x9B,0x83,0xE5,0xB6,0xB2,0xE9,0x9C,0xA3,0xF0,0xA9,0x85,0x85,0xF0,0xA9,0x88,
+0x9A,0xE4,0xA9,0xAE,0xE4,0xA9,0xB6,0xE9,0x9F,0xA0,0xF0,0xA9,0x90,0x8A,0xE4,0xAA,
+0xB2,0xF0,0xA9,0x92,0x96,0xE9,0xA0,0x8B,0xE9,0xA0,0x8B,0xE9,0xA0,0xA9,0xF0,0xA9,
+0x96,0xB6,0xE9,0xA3,0xA2,0xE4,0xAC,0xB3,0xE9,0xA4,0xA9,0xE9,0xA6,0xA7,0xE9,0xA7,
+0x82,0xE9,0xA7,0xBE,0xE4,0xAF,0x8E,0xF0,0xA9,0xAC,0xB0,0xE9,0xAC,0x92,0xE9,0xB1,
+0x80,0xE9,0xB3,0xBD,0xE4,0xB3,0x8E,0xE4,0xB3,0xAD,0xE9,0xB5,0xA7,0xF0,0xAA,0x83,
+0x8E,0xE4,0xB3,0xB8,0xF0,0xAA,0x84,0x85,0xF0,0xAA,0x88,0x8E,0xF0,0xAA,0x8A,0x91,
+0xE9,0xBA,0xBB,0xE4,0xB5,0x96,0xE9,0xBB,0xB9,0xE9,0xBB,0xBE,0xE9,0xBC,0x85,0xE9,
+0xBC,0x8F,0xE9,0xBC,0x96,0xE9,0xBC,0xBB,0xF0,0xAA,0x98,0x80,
+};
+#endif
@@ -5,6 +5,7 @@
 #include <sserialize/algorithm/utilmath.h>
 #include <sserialize/algorithm/utilfunctional.h>
 
+#include <array>
 #include <memory>
 #include <limits>
 #include <numeric>
@@ -272,9 +273,52 @@ constexpr std::array<uint8_t, BitpackingImp<bpn>::BlockSize> BitpackingImp<bpn>:
 template<uint32_t bpn>
 constexpr std::array<uint8_t, BitpackingImp<bpn>::BlockSize> BitpackingImp<bpn>::m_up_ls;
 
+
+///Unpacks numbers stored with the least significant bit first (the layout of CompactUintArray and MultiVarBitArray)
+template<uint32_t bpn>
+class LsbUnpacker {
+public:
+	static constexpr uint64_t mask = sserialize::createMask64(bpn);
+	static constexpr bool MayNeedNinthByte = (bpn > 57);
+private:
+	///loads up to 8 bytes beginning at src, bytes beyond end are zero
+	static inline uint64_t load(const uint8_t * src, const uint8_t * end) {
+		uint64_t buffer = 0;
+		if (end - src >= 8) {
+			::memmove(&buffer, src, 8);
+			return le64toh(buffer);
+		}
+		for(uint32_t i(0); src+i < end; ++i) {
+			buffer |= static_cast<uint64_t>(src[i]) << (8*i);
+		}
+		return buffer;
+	}
+public:
+	///@param begin, end the bytes holding the numbers
+	///@param bitPos position of the first bit of the first number
+	///@param stride distance in bits between two numbers, bpn for a plain array
+	template<typename T_DESTINATION_ITERATOR>
+	static void unpack(const uint8_t * begin, const uint8_t * end, uint64_t bitPos, uint64_t stride, T_DESTINATION_ITERATOR dest, std::size_t count) {
+		for(std::size_t i(0); i < count; ++i, bitPos += stride, ++dest) {
+			const uint8_t * src = begin + bitPos/8;
+			uint32_t shift = bitPos%8;
+			uint64_t buffer = load(src, end) >> shift;
+			if (MayNeedNinthByte && shift+bpn > 64) {
+				buffer |= static_cast<uint64_t>(src[8]) << (64-shift);
+			}
+			*dest = buffer & mask;
+		}
+	}
+};
 	
 }} //end namespace detail::bitpacking
 
+/** Unpacks count numbers with bpn bits each that are stored with the least significant bit first.
+  * The numbers start at bit bitPos of begin and are stride bits apart.
+  * This dispatches once to an unpacker specialized for bpn instead of computing masks per number.
+  */
+void unpack_lsb(uint32_t bpn, const uint8_t * begin, const uint8_t * end, uint64_t bitPos, uint64_t stride, uint64_t * dest, std::size_t count);
+
 
 class BitpackingInterface {
 public:
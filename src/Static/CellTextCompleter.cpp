@@ -1,5 +1,6 @@
 #include <sserialize/Static/CellTextCompleter.h>
 #include <sserialize/strings/unicode_case_functions.h>
+#include <algorithm>
 
 
 namespace sserialize {
@@ -48,6 +49,9 @@ uint32_t CellTextCompleter::Payload::qt2Pos(int requested, int available) {
 
 CellTextCompleter::Payload::Type CellTextCompleter::Payload::type(int qt) const {
 	try {
+		if (hasCheckpoints()) {
+			return Type(sserialize::RLEStream(typeData(qt), sserialize::RLEStream::CheckpointsTag()));
+		}
 		return Type(sserialize::RLEStream(typeData(qt)));
 	}
 	catch (sserialize::OutOfBoundsException const & e) {
@@ -94,16 +98,7 @@ bool CellTextCompleter::count(const std::string::const_iterator& begin, const st
 	return m_trie.count(begin, end, true);
 }
 
-CellTextCompleter::Payload::Type CellTextCompleter::typeFromCompletion(const std::string& qs, const sserialize::StringCompleter::QuerryType qt) const {
-	std::string qstr;
-	if (m_sq & sserialize::StringCompleter::SQ_CASE_INSENSITIVE) {
-		qstr = sserialize::unicode_to_lower(qs);
-	}
-	else {
-		qstr = qs;
-	}
-	Payload p( m_trie.at(qstr, (qt & sserialize::StringCompleter::QT_SUBSTRING || qt & sserialize::StringCompleter::QT_PREFIX)) );
-	Payload::Type t;
+bool CellTextCompleter::typeFromPayload(const Payload & p, const sserialize::StringCompleter::QuerryType qt, Payload::Type & t) {
 	if (p.types() & qt) {
 		t = p.type(qt);
 	}
@@ -118,18 +113,91 @@ CellTextCompleter::Payload::Type CellTextCompleter::typeFromCompletion(const std
 			t = p.type(sserialize::StringCompleter::QT_EXACT);
 		}
 		else {
-			throw sserialize::OutOfBoundsException("CellTextCompleter::typeFromCompletion");
+			return false;
 		}
 	}
 	else if (p.types() & sserialize::StringCompleter::QT_EXACT) { //qt is either prefix, suffix, exact
 		t = p.type(sserialize::StringCompleter::QT_EXACT);
 	}
 	else {
+		return false;
+	}
+	return true;
+}
+
+CellTextCompleter::Payload::Type CellTextCompleter::typeFromCompletion(const std::string& qs, const sserialize::StringCompleter::QuerryType qt) const {
+	std::string qstr;
+	if (m_sq & sserialize::StringCompleter::SQ_CASE_INSENSITIVE) {
+		qstr = sserialize::unicode_to_lower(qs);
+	}
+	else {
+		qstr = qs;
+	}
+	Payload p( m_trie.at(qstr, (qt & sserialize::StringCompleter::QT_SUBSTRING || qt & sserialize::StringCompleter::QT_PREFIX)) );
+	Payload::Type t;
+	if (!typeFromPayload(p, qt, t)) {
 		throw sserialize::OutOfBoundsException("CellTextCompleter::typeFromCompletion");
 	}
 	return t;
 }
 
+void CellTextCompleter::typesFromCompletion(const std::vector<std::string> & qs, const sserialize::StringCompleter::QuerryType qt, std::vector<Payload::Type> & types) const {
+	//sort the query strings so that the trie can reuse the work done for common prefixes
+	std::vector<std::string> qstrs;
+	qstrs.reserve(qs.size());
+	for(const std::string & x : qs) {
+		if (m_sq & sserialize::StringCompleter::SQ_CASE_INSENSITIVE) {
+			qstrs.emplace_back(sserialize::unicode_to_lower(x));
+		}
+		else {
+			qstrs.emplace_back(x);
+		}
+	}
+	std::vector<uint32_t> perm(qstrs.size());
+	for(uint32_t i(0), s((uint32_t) perm.size()); i < s; ++i) {
+		perm[i] = i;
+	}
+	std::sort(perm.begin(), perm.end(), [&qstrs](uint32_t a, uint32_t b) { return qstrs[a] < qstrs[b]; });
+	std::vector<std::string> sorted;
+	sorted.reserve(qstrs.size());
+	for(uint32_t x : perm) {
+		sorted.emplace_back(std::move(qstrs[x]));
+	}
+	
+	std::vector<Payload> payloads;
+	std::vector<bool> found;
+	m_trie.findMany(sorted, (qt & sserialize::StringCompleter::QT_SUBSTRING || qt & sserialize::StringCompleter::QT_PREFIX), payloads, found);
+	
+	types.assign(qs.size(), Payload::Type());
+	for(std::size_t i(0), s(perm.size()); i < s; ++i) {
+		if (found[i]) {
+			typeFromPayload(payloads[i], qt, types[perm[i]]);
+		}
+	}
+}
+
+void CellTextCompleter::typesFromFuzzyCompletion(const std::string & qs, const sserialize::StringCompleter::QuerryType qt, uint32_t maxDistance, std::vector<Payload::Type> & types) const {
+	std::string qstr;
+	if (m_sq & sserialize::StringCompleter::SQ_CASE_INSENSITIVE) {
+		qstr = sserialize::unicode_to_lower(qs);
+	}
+	else {
+		qstr = qs;
+	}
+	sserialize::LevenshteinAutomaton la(qstr, maxDistance);
+	std::vector<Payload> payloads;
+	std::vector<uint32_t> distances;
+	m_trie.fuzzyFind(la, (qt & sserialize::StringCompleter::QT_SUBSTRING || qt & sserialize::StringCompleter::QT_PREFIX), payloads, distances);
+	types.clear();
+	types.reserve(payloads.size());
+	Payload::Type t;
+	for(const Payload & p : payloads) {
+		if (typeFromPayload(p, qt, t)) {
+			types.push_back(t);
+		}
+	}
+}
+
 sserialize::StringCompleter::SupportedQuerries CellTextCompleter::getSupportedQuerries() const {
 	return m_sq;
 }
@@ -55,14 +55,20 @@ void DynamicKeyValueObjectStore::push_back(const std::vector< std::pair< std::st
 	m_items.push_back(item, m_itemSerializer);
 }
 
-UByteArrayAdapter::OffsetType DynamicKeyValueObjectStore::serialize(sserialize::UByteArrayAdapter & dest) const {
+UByteArrayAdapter::OffsetType DynamicKeyValueObjectStore::serialize(sserialize::UByteArrayAdapter & dest, bool frontCoded) const {
 	UByteArrayAdapter::OffsetType dataBegin = dest.tellPutPtr();
 	dest.putUint8(0); //Version
 	sserialize::TimeMeasurer tm;
 	tm.begin();
 	std::cout << "DynamicKeyValueObjectStore::serialize: Serializing string tables..." << std::flush;
-	m_keyStringTable.serialize(dest);
-	m_valueStringTable.serialize(dest);
+	if (frontCoded) {
+		m_keyStringTable.serializeFrontCoded(dest);
+		m_valueStringTable.serializeFrontCoded(dest);
+	}
+	else {
+		m_keyStringTable.serialize(dest);
+		m_valueStringTable.serialize(dest);
+	}
 	tm.end();
 	std::cout << "took " << tm.elapsedSeconds() << " seconds" << std::endl;
 
@@ -0,0 +1,163 @@
+#include <sserialize/Static/FrontCodedStringTable.h>
+#include <sserialize/strings/stringfunctions.h>
+#include <iostream>
+
+namespace sserialize {
+namespace Static {
+
+FrontCodedStringTable::FrontCodedStringTable() :
+m_blockSize(DefaultBlockSize),
+m_size(0)
+{}
+
+FrontCodedStringTable::FrontCodedStringTable(const UByteArrayAdapter & data) :
+m_blockSize(0),
+m_size(0)
+{
+	if (!isFrontCoded(data)) {
+		throw sserialize::TypeMissMatchException("FrontCodedStringTable: data is not a front coded string table");
+	}
+	SSERIALIZE_VERSION_MISSMATCH_CHECK(SSERIALIZE_STATIC_FRONT_CODED_STRING_TABLE_VERSION, data.at(1), "Static::FrontCodedStringTable");
+	UByteArrayAdapter::OffsetType offset = 2;
+	int len = 0;
+	m_blockSize = data.getVlPackedUint32(offset, &len);
+	if (len < 0 || !m_blockSize) {
+		throw sserialize::CorruptDataException("FrontCodedStringTable: invalid block size");
+	}
+	offset += len;
+	m_size = data.getVlPackedUint64(offset, &len);
+	if (len < 0) {
+		throw sserialize::CorruptDataException("FrontCodedStringTable: invalid size");
+	}
+	offset += len;
+	m_blocks = Static::Array<UByteArrayAdapter>(data+offset);
+	if (m_blocks.size() != (m_size+m_blockSize-1)/m_blockSize) {
+		throw sserialize::CorruptDataException("FrontCodedStringTable: number of blocks does not match size");
+	}
+}
+
+FrontCodedStringTable::FrontCodedStringTable(UByteArrayAdapter & data, UByteArrayAdapter::ConsumeTag) :
+FrontCodedStringTable(data)
+{
+	data += getSizeInBytes();
+}
+
+FrontCodedStringTable::FrontCodedStringTable(UByteArrayAdapter const & data, UByteArrayAdapter::NoConsumeTag) :
+FrontCodedStringTable(data)
+{}
+
+FrontCodedStringTable::~FrontCodedStringTable() {}
+
+UByteArrayAdapter::OffsetType FrontCodedStringTable::getSizeInBytes() const {
+	return 2+psize_vu32(m_blockSize)+psize_v<uint64_t>(m_size)+m_blocks.getSizeInBytes();
+}
+
+bool FrontCodedStringTable::isFrontCoded(const UByteArrayAdapter & data) {
+	return data.size() > 2 && data.at(0) == SSERIALIZE_STATIC_FRONT_CODED_STRING_TABLE_TAG;
+}
+
+std::string FrontCodedStringTable::head(SizeType block) const {
+	return m_blocks.at(block).getString(0);
+}
+
+std::string FrontCodedStringTable::at(SizeType pos) const {
+	std::string str;
+	at(pos, str);
+	return str;
+}
+
+namespace {
+
+///appends the string at the get pointer of @param d to @param dest
+inline void appendString(UByteArrayAdapter & d, std::string & dest) {
+	uint32_t strLen = d.getStringLength();
+	//same as UByteArrayAdapter::getString()
+	if (!strLen || d.tellGetPtr()+strLen > d.size()) {
+		return;
+	}
+	std::string::size_type prefixLen = dest.size();
+	dest.resize(prefixLen + strLen);
+	d.getData(reinterpret_cast<uint8_t*>(&dest[prefixLen]), strLen);
+}
+
+}//end namespace
+
+void FrontCodedStringTable::at(SizeType pos, std::string & dest) const {
+	if (pos >= size()) {
+		throw sserialize::OutOfBoundsException("FrontCodedStringTable::at with size=" + std::to_string(size()) + " pos=" + std::to_string(pos));
+	}
+	UByteArrayAdapter d( m_blocks.at(pos/m_blockSize) );
+	d.resetGetPtr();
+	dest.clear();
+	appendString(d, dest);
+	for(SizeType i(0), s(pos%m_blockSize); i < s; ++i) {
+		dest.resize(d.getVlPackedUint32());
+		appendString(d, dest);
+	}
+}
+
+template<typename T_PREDICATE>
+FrontCodedStringTable::SizeType
+FrontCodedStringTable::partitionPoint(T_PREDICATE pred) const {
+	//first block whose first string does not fulfill pred
+	SizeType lb(0), count(m_blocks.size());
+	while(count) {
+		if (pred(head(lb+count/2))) {
+			lb = lb+count/2+1;
+			count -= count/2+1;
+		}
+		else {
+			count = count/2;
+		}
+	}
+	if (lb == 0) {
+		return 0;
+	}
+	//the result is in the previous block or it is the first string of block lb
+	SizeType block = lb-1;
+	SizeType blockBegin = block*m_blockSize;
+	SizeType blockEnd = std::min(blockBegin+m_blockSize, size());
+	UByteArrayAdapter d( m_blocks.at(block) );
+	d.resetGetPtr();
+	std::string str( d.getString() );
+	for(SizeType i(blockBegin+1); i < blockEnd; ++i) {
+		str.resize(d.getVlPackedUint32());
+		str += d.getString();
+		if (!pred(str)) {
+			return i;
+		}
+	}
+	return blockEnd;
+}
+
+FrontCodedStringTable::SizeType FrontCodedStringTable::find(const std::string & value) const {
+	SizeType pos = partitionPoint([&value](const std::string & str) {
+		return sserialize::unicodeIsSmaller(str, value);
+	});
+	if (pos < size() && at(pos) == value) {
+		return pos;
+	}
+	return npos;
+}
+
+std::pair<FrontCodedStringTable::SizeType, FrontCodedStringTable::SizeType>
+FrontCodedStringTable::range(const std::string & prefix) const {
+	SizeType lb = partitionPoint([&prefix](const std::string & str) {
+		return sserialize::unicodeIsSmaller(str, prefix);
+	});
+	SizeType ub = partitionPoint([&prefix](const std::string & str) {
+		return sserialize::unicodeIsSmaller(str, prefix) || sserialize::isPrefix(prefix, str);
+	});
+	return std::pair<SizeType, SizeType>(lb, ub);
+}
+
+std::ostream & FrontCodedStringTable::printStats(std::ostream & out) const {
+	out << "Static::FrontCodedStringTable::Stats->BEGIN" << std::endl;
+	out << "size: " << size() << std::endl;
+	out << "block size: " << blockSize() << std::endl;
+	out << "storage size: " << getSizeInBytes() << std::endl;
+	out << "Static::FrontCodedStringTable::Stats->END" << std::endl;
+	return out;
+}
+
+}}//end namespace sserialize::Static
@@ -25,13 +25,87 @@ void HuffmanDecoder::StaticNode::readInCache() const {
 	delete[] tmp;
 }
 
-HuffmanDecoder::HuffmanDecoder() {}
+HuffmanDecoder::HuffmanDecoder() :
+m_table(static_cast<std::size_t>(1) << TableBits, TableEntry{{0}, {0}, 0})
+{}
 
 HuffmanDecoder::HuffmanDecoder(const UByteArrayAdapter & data) :
 m_nodes(data),
 m_root(m_nodes.at(0))
 {
 	m_root.readInCache();
+	buildTable();
+}
+
+void HuffmanDecoder::buildTable() {
+	m_table.assign(static_cast<std::size_t>(1) << TableBits, TableEntry{{0}, {0}, 0});
+	for(uint32_t prefix(0), s(narrow_check<uint32_t>(m_table.size())); prefix < s; ++prefix) {
+		TableEntry & e = m_table[prefix];
+		uint32_t src = prefix << (32-TableBits);
+		uint32_t remainingBits = TableBits;
+		while (e.count < MaxTableSymbols) {
+			uint32_t value = 0;
+			int len = -1;
+			try {
+				len = decodeImp<uint32_t>(src, value);
+			}
+			catch (const sserialize::Exception &) {}
+			if (len <= 0 || uint32_t(len) > remainingBits) {
+				break;
+			}
+			e.values[e.count] = value;
+			e.lengths[e.count] = uint8_t(len);
+			++e.count;
+			src <<= len;
+			remainingBits -= len;
+		}
+	}
+}
+
+uint32_t HuffmanDecoder::decode(MultiBitIterator & it, uint32_t * dest, uint32_t count) const {
+	uint32_t decoded = 0;
+	UByteArrayAdapter::OffsetType remainingBits = it.remainingBits();
+	//window holds the next 64 bits of it, the first 64-windowBits of them are already decoded
+	if (!count || !remainingBits) {
+		return 0;
+	}
+	uint64_t window = it.get64();
+	uint32_t windowBits = 64;
+	while (decoded < count && remainingBits) {
+		if (windowBits < 32) {
+			it += 64-windowBits;
+			window = it.get64();
+			windowBits = 64;
+		}
+		const TableEntry & e = m_table[selectBits(window, TableBits)];
+		if (e.count) {
+			for(uint32_t i(0); i < e.count && decoded < count; ++i) {
+				if (e.lengths[i] > remainingBits) {
+					count = decoded;
+					break;
+				}
+				dest[decoded] = e.values[i];
+				++decoded;
+				window <<= e.lengths[i];
+				windowBits -= e.lengths[i];
+				remainingBits -= e.lengths[i];
+			}
+		}
+		else {
+			uint32_t value = 0;
+			int len = decodeImp<uint32_t>(uint32_t(window >> 32), value);
+			if (len <= 0 || uint32_t(len) > remainingBits) {
+				break;
+			}
+			dest[decoded] = value;
+			++decoded;
+			window <<= len;
+			windowBits -= len;
+			remainingBits -= len;
+		}
+	}
+	it += 64-windowBits;
+	return decoded;
 }
 
 void HuffmanDecoder::readInCache() {
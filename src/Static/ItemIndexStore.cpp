@@ -109,6 +109,75 @@ UByteArrayAdapter ItemIndexStore::LZODecompressor::decompress(uint32_t id, const
 	return UByteArrayAdapter();
 }
 
+ItemIndexStore::LZOGroupDecompressor::LZOGroupDecompressor() :
+m_uncompressedSize(0),
+m_cachedGroup(std::numeric_limits<uint32_t>::max())
+{}
+
+ItemIndexStore::LZOGroupDecompressor::LZOGroupDecompressor(const sserialize::UByteArrayAdapter & data) :
+m_uncompressedSize(data.getOffset(0)),
+m_cachedGroup(std::numeric_limits<uint32_t>::max())
+{
+	UByteArrayAdapter tmp(data, UByteArrayAdapter::OffsetTypeSerializedLength());
+	m_groupBegin = BoundedCompactUintArray(tmp, UByteArrayAdapter::ConsumeTag());
+	m_groupOffsets = SortedOffsetIndex(tmp);
+	SSERIALIZE_CHEAP_ASSERT_EQUAL(m_groupBegin.size(), m_groupOffsets.size()+1);
+}
+
+ItemIndexStore::LZOGroupDecompressor::~LZOGroupDecompressor() {}
+
+OffsetType ItemIndexStore::LZOGroupDecompressor::getSizeInBytes() const {
+	return UByteArrayAdapter::OffsetTypeSerializedLength() + m_groupBegin.getSizeInBytes() + m_groupOffsets.getSizeInBytes();
+}
+
+uint32_t ItemIndexStore::LZOGroupDecompressor::group(uint32_t id) const {
+	//find the last group with groupBegin <= id
+	uint32_t left = 0;
+	uint32_t right = groupCount();
+	while (right - left > 1) {
+		uint32_t mid = left + (right-left)/2;
+		if (m_groupBegin.at(mid) <= id) {
+			left = mid;
+		}
+		else {
+			right = mid;
+		}
+	}
+	return left;
+}
+
+UByteArrayAdapter ItemIndexStore::LZOGroupDecompressor::decompress(uint32_t group, const UByteArrayAdapter & data, OffsetType uncompressedGroupSize) const {
+	if (group >= groupCount()) {
+		return UByteArrayAdapter();
+	}
+	{
+		std::lock_guard<std::mutex> lck(m_cacheLock);
+		if (m_cachedGroup == group) {
+			return m_cachedGroupData;
+		}
+	}
+	OffsetType groupBegin = m_groupOffsets.at(group);
+	OffsetType groupEnd = (group+1 < groupCount() ? m_groupOffsets.at(group+1) : data.size());
+	UByteArrayAdapter src(UByteArrayAdapter::makeContigous(UByteArrayAdapter(data, groupBegin, groupEnd-groupBegin)));
+	//Get a memory view, but we don't write to it, so it's ok
+	const UByteArrayAdapter::MemoryView srcD = src.getMemView(0, src.size());
+	uint8_t * dest = new uint8_t[uncompressedGroupSize];
+	
+	lzo_uint destLen = uncompressedGroupSize;
+	int ok = ::lzo1x_decompress_safe(srcD.get(), src.size(), dest, &destLen, 0);
+	if (ok != LZO_E_OK || destLen != uncompressedGroupSize) {
+		delete[] dest;
+		return UByteArrayAdapter();
+	}
+	UByteArrayAdapter ret(dest, 0, destLen);
+	ret.setDeleteOnClose(true);
+	//the group data is never written to, hence it can be shared with the callers
+	std::lock_guard<std::mutex> lck(m_cacheLock);
+	m_cachedGroup = group;
+	m_cachedGroupData = ret;
+	return ret;
+}
+
 ItemIndexStore::ItemIndexStore() :
 m_type(ItemIndex::T_EMPTY),
 m_compression(sserialize::Static::ItemIndexStore::IC_NONE)
@@ -117,7 +186,7 @@ m_compression(sserialize::Static::ItemIndexStore::IC_NONE)
 ItemIndexStore::ItemIndexStore(UByteArrayAdapter data) :
 m_version(data.getUint8(0))
 {
-	if (m_version == 5 || m_version == 6) {
+	if (m_version >= 5 && m_version <= 8) {
 		m_type = data.getUint16(1);
 		m_compression = IndexCompressionType(data.getUint8(3));
 		data.resetGetPtr();
@@ -163,11 +232,29 @@ m_version(data.getUint8(0))
 		data += m_lzod->getSizeInBytes();
 	}
 	
+	if (m_compression & sserialize::Static::ItemIndexStore::IC_LZO_GROUPED) {
+		if (m_version < 7) {
+			throw sserialize::VersionMissMatchException("Grouped LZO compressed ItemIndexStore needs at least version 7", 7, m_version);
+		}
+		m_lzogd.reset(new LZOGroupDecompressor(data));
+		data += m_lzogd->getSizeInBytes();
+	}
+	
 	if (m_type & sserialize::ItemIndex::T_MULTIPLE) {
 		uint32_t bits = sserialize::msb(sserialize::msb(uint32_t(m_type - sserialize::ItemIndex::T_MULTIPLE))) + 1;
 		m_idxTypeInfo = CompactUintArray(data, bits, size());
 		data += m_idxTypeInfo.getSizeInBytes();
 	}
+	
+	if (m_version >= 8) {
+		m_summaryRanges = Static::Array<uint64_t>(data);
+		data += m_summaryRanges.getSizeInBytes();
+		m_summarySignatures = Static::Array<uint64_t>(data);
+		data += m_summarySignatures.getSizeInBytes();
+		if (m_summaryRanges.size() != m_summarySignatures.size() || (m_summaryRanges.size() && m_summaryRanges.size() != size())) {
+			throw sserialize::CorruptDataException("Static::ItemIndexStore: summaries have an invalid size");
+		}
+	}
 }
 
 ItemIndexStore::ItemIndexStore(sserialize::UByteArrayAdapter & data, UByteArrayAdapter::ConsumeTag) :
@@ -208,36 +295,62 @@ OffsetType ItemIndexStore::getSizeInBytes() const {
 	if (m_compression & sserialize::Static::ItemIndexStore::IC_LZO) {
 		r += m_lzod->getSizeInBytes();
 	}
+	if (m_compression & sserialize::Static::ItemIndexStore::IC_LZO_GROUPED) {
+		r += m_lzogd->getSizeInBytes();
+	}
 	if (m_type & sserialize::ItemIndex::T_MULTIPLE) {
 		r += m_idxTypeInfo.getSizeInBytes();
 	}
+	if (m_version >= 8) {
+		r += m_summaryRanges.getSizeInBytes();
+		r += m_summarySignatures.getSizeInBytes();
+	}
 	return r;
 }
 
-UByteArrayAdapter::OffsetType ItemIndexStore::dataSize(uint32_t pos) const {
-	if (pos >= size())
-		return 0;
-	UByteArrayAdapter::OffsetType indexStart = m_index.at(pos);
-	UByteArrayAdapter::OffsetType indexLength;
-	if (pos+1 == size()) {
-		indexLength = m_data.size() - indexStart;
+ItemIndexSummary ItemIndexStore::summary(uint32_t pos) const {
+	if (!hasSummaries() || pos >= size()) {
+		return ItemIndexSummary();
+	}
+	return ItemIndexSummary(m_summaryRanges.at(pos), m_summarySignatures.at(pos));
+}
+
+UByteArrayAdapter::OffsetType ItemIndexStore::dataBegin(uint32_t pos) const {
+	return m_index.at(pos);
+}
+
+UByteArrayAdapter::OffsetType ItemIndexStore::dataEnd(uint32_t pos) const {
+	if (pos+1 < size()) {
+		return m_index.at(pos+1);
+	}
+	else if (m_compression & sserialize::Static::ItemIndexStore::IC_LZO_GROUPED) {
+		return m_lzogd->uncompressedSize();
 	}
 	else {
-		indexLength = m_index.at(pos+1) - indexStart;
+		return m_data.size();
 	}
-	return indexLength;
+}
+
+UByteArrayAdapter::OffsetType ItemIndexStore::dataSize(uint32_t pos) const {
+	if (pos >= size())
+		return 0;
+	return dataEnd(pos) - dataBegin(pos);
 }
 
 UByteArrayAdapter ItemIndexStore::rawDataAt(uint32_t pos) const {
 	if (pos >= size())
 		return UByteArrayAdapter();
-	UByteArrayAdapter::OffsetType indexStart = m_index.at(pos);
-	UByteArrayAdapter::OffsetType indexLength;
-	if (pos+1 == size()) {
-		indexLength = m_data.size() - indexStart;
-	}
-	else {
-		indexLength = m_index.at(pos+1) - indexStart;
+	UByteArrayAdapter::OffsetType indexStart = dataBegin(pos);
+	UByteArrayAdapter::OffsetType indexLength = dataEnd(pos) - indexStart;
+	if (m_compression & sserialize::Static::ItemIndexStore::IC_LZO_GROUPED) {
+		uint32_t group = m_lzogd->group(pos);
+		UByteArrayAdapter::OffsetType groupStart = dataBegin(m_lzogd->groupBegin(group));
+		UByteArrayAdapter::OffsetType groupEnd = dataEnd(m_lzogd->groupEnd(group)-1);
+		UByteArrayAdapter groupData = m_lzogd->decompress(group, m_data, groupEnd-groupStart);
+		if (!groupData.size()) {
+			return UByteArrayAdapter();
+		}
+		return UByteArrayAdapter(groupData, indexStart-groupStart, indexLength);
 	}
 	return UByteArrayAdapter::makeContigous(UByteArrayAdapter(m_data, indexStart, indexLength));
 }
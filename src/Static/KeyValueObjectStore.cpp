@@ -1,9 +1,30 @@
 #include <sserialize/Static/KeyValueObjectStore.h>
 #include <sserialize/utility/exceptions.h>
 #include <sserialize/utility/log.h>
+#include <array>
 
 namespace sserialize {
 namespace Static {
+namespace {
+
+///Calls f(pos, kv) for the packed key-value pairs in [begin, end) until f returns false
+///The pairs are decoded in chunks instead of one at a time
+template<typename T_FUNC>
+void forEachKV(const CompactUintArray & kvs, uint32_t begin, uint32_t end, T_FUNC f) {
+	std::array<CompactUintArray::value_type, 64> buffer;
+	while (begin < end) {
+		uint32_t count = std::min<uint32_t>(end-begin, buffer.size());
+		kvs.getRange(begin, count, buffer.data());
+		for(uint32_t i(0); i < count; ++i) {
+			if (!f(begin+i, buffer[i])) {
+				return;
+			}
+		}
+		begin += count;
+	}
+}
+
+}//end anonymous namespace
 
 KeyValueObjectStoreItemBase::KeyValueObjectStoreItemBase() :
 m_sizeBPKV(0),
@@ -31,40 +52,48 @@ uint32_t KeyValueObjectStoreItemBase::valueId(uint32_t pos) const {
 }
 
 uint32_t KeyValueObjectStoreItemBase::findKey(uint32_t id, uint32_t start) const {
-	uint32_t s = size();
-	for(uint32_t i = start; i < s; ++i) {
-		if (keyId(i) == id)
-			return i;
-	}
-	return npos;
+	uint32_t ret = npos;
+	forEachKV(m_kv, start, size(), [this, id, &ret](uint32_t pos, CompactUintArray::value_type kv) {
+		if (m_keyBegin + (uint32_t)(kv >> valueBits()) == id) {
+			ret = pos;
+			return false;
+		}
+		return true;
+	});
+	return ret;
 }
 
 uint32_t KeyValueObjectStoreItemBase::findValue(uint32_t id, uint32_t start) const {
-	uint32_t s = size();
-	for(uint32_t i = start; i < s; ++i) {
-		if (valueId(i) == id)
-			return i;
-	}
-	return npos;
+	uint32_t ret = npos;
+	uint32_t mask = valueMask();
+	forEachKV(m_kv, start, size(), [this, id, mask, &ret](uint32_t pos, CompactUintArray::value_type kv) {
+		if (m_valueBegin + (uint32_t)(kv & mask) == id) {
+			ret = pos;
+			return false;
+		}
+		return true;
+	});
+	return ret;
 }
 
 uint32_t KeyValueObjectStoreItemBase::countKey(uint32_t id) const {
-	uint32_t s = size();
 	uint32_t count = 0;
-	for(uint32_t i = 0; i < s; ++i) {
-		if (keyId(i) == id)
+	forEachKV(m_kv, 0, size(), [this, id, &count](uint32_t, CompactUintArray::value_type kv) {
+		if (m_keyBegin + (uint32_t)(kv >> valueBits()) == id)
 			++count;
-	}
+		return true;
+	});
 	return count;
 }
 
 uint32_t KeyValueObjectStoreItemBase::countValue(uint32_t id) const {
-	uint32_t s = size();
 	uint32_t count = 0;
-	for(uint32_t i = 0; i < s; ++i) {
-		if (valueId(i) == id)
+	uint32_t mask = valueMask();
+	forEachKV(m_kv, 0, size(), [this, id, mask, &count](uint32_t, CompactUintArray::value_type kv) {
+		if (m_valueBegin + (uint32_t)(kv & mask) == id)
 			++count;
-	}
+		return true;
+	});
 	return count;
 }
 
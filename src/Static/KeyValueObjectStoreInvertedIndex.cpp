@@ -0,0 +1,262 @@
+#include <sserialize/Static/KeyValueObjectStoreInvertedIndex.h>
+#include <sserialize/containers/ItemIndexFactory.h>
+#include <sserialize/stats/ProgressInfo.h>
+#include <sserialize/mt/ThreadPool.h>
+#include <sserialize/utility/exceptions.h>
+#include <atomic>
+#include <mutex>
+
+namespace sserialize {
+namespace Static {
+
+KeyValueObjectStoreInvertedIndex::KeyValueObjectStoreInvertedIndex() {}
+
+KeyValueObjectStoreInvertedIndex::KeyValueObjectStoreInvertedIndex(const UByteArrayAdapter & data, const Static::ItemIndexStore & idxStore) :
+m_idxStore(idxStore)
+{
+	SSERIALIZE_VERSION_MISSMATCH_CHECK(SSERIALIZE_STATIC_KEY_VALUE_OBJECTSTORE_INVERTED_INDEX_VERSION, data.at(0), "sserialize::Static::KeyValueObjectStoreInvertedIndex");
+	UByteArrayAdapter tmp(data, 1);
+	m_keyOffsets = BoundedCompactUintArray(tmp, UByteArrayAdapter::ConsumeTag());
+	m_keyIndexIds = BoundedCompactUintArray(tmp, UByteArrayAdapter::ConsumeTag());
+	m_valueIds = BoundedCompactUintArray(tmp, UByteArrayAdapter::ConsumeTag());
+	m_valueIndexIds = BoundedCompactUintArray(tmp, UByteArrayAdapter::ConsumeTag());
+	SSERIALIZE_EQUAL_LENGTH_CHECK(m_keyOffsets.size(), m_keyIndexIds.size()+1, "sserialize::Static::KeyValueObjectStoreInvertedIndex: key offsets");
+	SSERIALIZE_EQUAL_LENGTH_CHECK(m_valueIds.size(), m_valueIndexIds.size(), "sserialize::Static::KeyValueObjectStoreInvertedIndex: value ids");
+}
+
+KeyValueObjectStoreInvertedIndex::KeyValueObjectStoreInvertedIndex(UByteArrayAdapter & data, const Static::ItemIndexStore & idxStore, UByteArrayAdapter::ConsumeTag) :
+KeyValueObjectStoreInvertedIndex(data, idxStore)
+{
+	data += getSizeInBytes();
+}
+
+KeyValueObjectStoreInvertedIndex::~KeyValueObjectStoreInvertedIndex() {}
+
+UByteArrayAdapter::OffsetType KeyValueObjectStoreInvertedIndex::getSizeInBytes() const {
+	return 1 + m_keyOffsets.getSizeInBytes() + m_keyIndexIds.getSizeInBytes() + m_valueIds.getSizeInBytes() + m_valueIndexIds.getSizeInBytes();
+}
+
+uint32_t KeyValueObjectStoreInvertedIndex::keyCount() const {
+	return m_keyIndexIds.size();
+}
+
+uint32_t KeyValueObjectStoreInvertedIndex::size() const {
+	return m_valueIds.size();
+}
+
+uint32_t KeyValueObjectStoreInvertedIndex::valueCount(uint32_t keyId) const {
+	if (keyId >= keyCount()) {
+		return 0;
+	}
+	return (uint32_t)(m_keyOffsets.at64(keyId+1) - m_keyOffsets.at64(keyId));
+}
+
+uint32_t KeyValueObjectStoreInvertedIndex::indexId(uint32_t keyId) const {
+	if (keyId >= keyCount()) {
+		return npos;
+	}
+	return (uint32_t) m_keyIndexIds.at64(keyId);
+}
+
+uint32_t KeyValueObjectStoreInvertedIndex::indexId(uint32_t keyId, uint32_t valueId) const {
+	if (keyId >= keyCount()) {
+		return npos;
+	}
+	uint32_t begin = (uint32_t) m_keyOffsets.at64(keyId);
+	uint32_t end = (uint32_t) m_keyOffsets.at64(keyId+1);
+	//lower bound on the sorted value ids of this key
+	while (begin < end) {
+		uint32_t mid = begin + (end-begin)/2;
+		if (m_valueIds.at64(mid) < valueId) {
+			begin = mid+1;
+		}
+		else {
+			end = mid;
+		}
+	}
+	if (begin < m_keyOffsets.at64(keyId+1) && m_valueIds.at64(begin) == valueId) {
+		return (uint32_t) m_valueIndexIds.at64(begin);
+	}
+	return npos;
+}
+
+ItemIndex KeyValueObjectStoreInvertedIndex::items(uint32_t keyId) const {
+	uint32_t id = indexId(keyId);
+	if (id == npos) {
+		return ItemIndex();
+	}
+	return m_idxStore.at(id);
+}
+
+ItemIndex KeyValueObjectStoreInvertedIndex::items(uint32_t keyId, uint32_t valueId) const {
+	uint32_t id = indexId(keyId, valueId);
+	if (id == npos) {
+		return ItemIndex();
+	}
+	return m_idxStore.at(id);
+}
+
+ItemIndex KeyValueObjectStoreInvertedIndex::items(const KeyValueObjectStore & store, const std::string & key, const std::string & value) const {
+	uint32_t keyId = store.findKeyId(key);
+	uint32_t valueId = store.findValueId(value);
+	if (keyId == KeyValueObjectStore::npos || valueId == KeyValueObjectStore::npos) {
+		return ItemIndex();
+	}
+	return items(keyId, valueId);
+}
+
+UByteArrayAdapter::OffsetType
+KeyValueObjectStoreInvertedIndex::create(const KeyValueObjectStore & store, ItemIndexFactory & idxFactory, UByteArrayAdapter & dest, uint32_t threadCount) {
+	typedef std::pair<uint32_t, uint32_t> ValueItemPair;
+	struct KeyValueItem {
+		uint32_t key;
+		uint32_t value;
+		uint32_t item;
+		KeyValueItem(uint32_t key, uint32_t value, uint32_t item) : key(key), value(value), item(item) {}
+	};
+	static constexpr uint32_t ItemBlockSize = 1024;
+
+	struct State {
+		const KeyValueObjectStore & store;
+		ItemIndexFactory & idxFactory;
+		uint32_t keyCount;
+		std::atomic<uint32_t> i{0};
+		std::mutex partsLock;
+		std::vector< std::vector<KeyValueItem> > parts;
+		//pairs bucketed by key, after the second pass the front of every bucket holds (value id, index id)
+		std::vector<ValueItemPair> pairs;
+		std::vector<uint64_t> keyBegin;
+		std::vector<uint32_t> keyValueCount;
+		std::vector<uint32_t> keyIndexIds;
+		sserialize::ProgressInfo pinfo;
+		State(const KeyValueObjectStore & store, ItemIndexFactory & idxFactory) :
+		store(store),
+		idxFactory(idxFactory),
+		keyCount(narrow_check<uint32_t>(store.keyStringTable().size()))
+		{}
+	};
+	//First pass: gather all (key, value, item) triples
+	struct GatherWorker {
+		State * state;
+		std::vector<KeyValueItem> kvi;
+		GatherWorker(State * state) : state(state) {}
+		GatherWorker(const GatherWorker & other) : state(other.state) {}
+		void operator()() {
+			uint32_t storeSize = state->store.size();
+			while(true) {
+				uint32_t begin = state->i.fetch_add(ItemBlockSize, std::memory_order_relaxed);
+				if (begin >= storeSize) {
+					break;
+				}
+				uint32_t end = std::min<uint32_t>(storeSize, begin+ItemBlockSize);
+				for(uint32_t itemId(begin); itemId < end; ++itemId) {
+					KeyValueObjectStoreItemBase item = state->store.baseItem(itemId);
+					for(uint32_t j(0), s(item.size()); j < s; ++j) {
+						kvi.emplace_back(item.keyId(j), item.valueId(j), itemId);
+					}
+				}
+				state->pinfo(std::min<uint32_t>(storeSize, state->i.load(std::memory_order_relaxed)));
+			}
+			std::lock_guard<std::mutex> lck(state->partsLock);
+			state->parts.emplace_back(std::move(kvi));
+		}
+	};
+	//Second pass: sort the bucket of every key and create its indexes
+	struct IndexWorker {
+		State * state;
+		std::vector<uint32_t> items;
+		std::vector<uint32_t> keyItems;
+		IndexWorker(State * state) : state(state) {}
+		IndexWorker(const IndexWorker & other) : state(other.state) {}
+		void operator()() {
+			while(true) {
+				uint32_t keyId = state->i.fetch_add(1, std::memory_order_relaxed);
+				if (keyId >= state->keyCount) {
+					break;
+				}
+				auto begin = state->pairs.begin() + state->keyBegin[keyId];
+				auto end = state->pairs.begin() + state->keyBegin[keyId+1];
+				std::sort(begin, end);
+				auto out = begin;
+				keyItems.clear();
+				for(auto it(begin); it != end;) {
+					uint32_t valueId = it->first;
+					items.clear();
+					for(; it != end && it->first == valueId; ++it) {
+						if (!items.size() || items.back() != it->second) {
+							items.push_back(it->second);
+						}
+					}
+					keyItems.insert(keyItems.end(), items.begin(), items.end());
+					//out never overtakes it since every value has at least one item
+					*out = ValueItemPair(valueId, state->idxFactory.addIndex(items));
+					++out;
+				}
+				std::sort(keyItems.begin(), keyItems.end());
+				keyItems.erase(std::unique(keyItems.begin(), keyItems.end()), keyItems.end());
+				state->keyValueCount[keyId] = (uint32_t)(out - begin);
+				state->keyIndexIds[keyId] = state->idxFactory.addIndex(keyItems);
+				state->pinfo(state->i.load(std::memory_order_relaxed));
+			}
+		}
+	};
+
+	State state(store, idxFactory);
+	state.pinfo.begin(store.size(), "KeyValueObjectStoreInvertedIndex: gathering pairs");
+	sserialize::ThreadPool::execute(GatherWorker(&state), threadCount, sserialize::ThreadPool::CopyTaskTag());
+	state.pinfo.end();
+
+	//bucket the pairs by key
+	state.keyBegin.assign(state.keyCount+1, 0);
+	for(const auto & part : state.parts) {
+		for(const KeyValueItem & x : part) {
+			if (x.key >= state.keyCount) {
+				throw sserialize::CreationException("KeyValueObjectStoreInvertedIndex: key id out of bounds");
+			}
+			state.keyBegin[x.key+1] += 1;
+		}
+	}
+	for(uint32_t k(0); k < state.keyCount; ++k) {
+		state.keyBegin[k+1] += state.keyBegin[k];
+	}
+	{
+		std::vector<uint64_t> insertPos(state.keyBegin.begin(), state.keyBegin.end()-1);
+		state.pairs.resize(state.keyBegin.back());
+		for(auto & part : state.parts) {
+			for(const KeyValueItem & x : part) {
+				state.pairs[insertPos[x.key]] = ValueItemPair(x.value, x.item);
+				insertPos[x.key] += 1;
+			}
+			part = std::vector<KeyValueItem>();
+		}
+		state.parts.clear();
+	}
+
+	state.keyValueCount.resize(state.keyCount, 0);
+	state.keyIndexIds.resize(state.keyCount, 0);
+	state.i = 0;
+	state.pinfo.begin(state.keyCount, "KeyValueObjectStoreInvertedIndex: creating indexes");
+	sserialize::ThreadPool::execute(IndexWorker(&state), threadCount, sserialize::ThreadPool::CopyTaskTag());
+	state.pinfo.end();
+
+	std::vector<uint32_t> keyOffsets(state.keyCount+1, 0);
+	std::vector<uint32_t> valueIds, valueIndexIds;
+	for(uint32_t k(0); k < state.keyCount; ++k) {
+		keyOffsets[k+1] = keyOffsets[k] + state.keyValueCount[k];
+		auto it = state.pairs.begin() + state.keyBegin[k];
+		for(uint32_t j(0); j < state.keyValueCount[k]; ++j, ++it) {
+			valueIds.push_back(it->first);
+			valueIndexIds.push_back(it->second);
+		}
+	}
+
+	UByteArrayAdapter::OffsetType beginOffset = dest.tellPutPtr();
+	dest.putUint8(SSERIALIZE_STATIC_KEY_VALUE_OBJECTSTORE_INVERTED_INDEX_VERSION);
+	BoundedCompactUintArray::create(keyOffsets, dest);
+	BoundedCompactUintArray::create(state.keyIndexIds, dest);
+	BoundedCompactUintArray::create(valueIds, dest);
+	BoundedCompactUintArray::create(valueIndexIds, dest);
+	return dest.tellPutPtr() - beginOffset;
+}
+
+}}//end namespace
@@ -2,18 +2,27 @@
 #include <iostream>
 #include <sserialize/strings/unicode_case_functions.h>
 #include <sserialize/vendor/utf8.h>
-#include <sserialize/algorithm/find_key_in_array_functions.h>
-#include <sserialize/strings/stringfunctions.h>
 
 namespace sserialize {
 namespace Static {
 
+namespace {
+
+StringTablePrivate * createPrivate(const UByteArrayAdapter & data) {
+	if (FrontCodedStringTable::isFrontCoded(data)) {
+		return new StringTablePrivateFrontCoded(data);
+	}
+	return new StringTablePrivateArray(data);
+}
+
+}//end anonymous namespace
+
 StringTable::StringTable() :
-RCWrapper< sserialize::Static::Array<std::string> >(new sserialize::Static::Array< std::string >())
+RCWrapper< StringTablePrivate >(new StringTablePrivateArray())
 {}
 
 StringTable::StringTable(const UByteArrayAdapter& data) :
-RCWrapper< sserialize::Static::Array<std::string> >(new sserialize::Static::Array< std::string >(data) )
+RCWrapper< StringTablePrivate >(createPrivate(data))
 {}
 
 StringTable::StringTable(UByteArrayAdapter & data, UByteArrayAdapter::ConsumeTag) :
@@ -28,14 +37,14 @@ StringTable(data)
 
 StringTable::~StringTable() {}
 
-StringTable::StringTable(Array< std::string >* data): RCWrapper< sserialize::Static::Array< std::string > >(data)
+StringTable::StringTable(StringTablePrivate * priv): RCWrapper< StringTablePrivate >(priv)
 {}
 
-StringTable::StringTable(const StringTable& other) : RCWrapper< sserialize::Static::Array<std::string> >(other)
+StringTable::StringTable(const StringTable& other) : RCWrapper< StringTablePrivate >(other)
 {}
 
 StringTable& StringTable::operator=(const StringTable& other) {
-	RCWrapper< sserialize::Static::Array<std::string> >::operator=(other);
+	RCWrapper< StringTablePrivate >::operator=(other);
 	return *this;
 }
 
@@ -128,16 +137,16 @@ bool matchSuffixCIS(const std::string& searchStr, const UByteArrayAdapter & str)
 	std::string::const_iterator searchStrBegin = searchStr.begin();
 	std::string::const_iterator searchStrEnd = searchStr.end();
 
-	uint32_t searchStrItUCode = utf8::prior(searchStrEnd, searchStrBegin);
-	uint32_t strItUCode = unicode32_to_lower( utf8::prior(strEnd, strBegin) );
-	while (searchStrBegin != searchStrEnd && strBegin != strEnd) {
+	//str may be shorter than searchStr, check before stepping back
+	while (searchStrBegin != searchStrEnd) {
+		if (strEnd.size() >= str.size())
+			return false;
+		uint32_t searchStrItUCode = utf8::prior(searchStrEnd, searchStrBegin);
+		uint32_t strItUCode = unicode32_to_lower( utf8::prior(strEnd, strBegin) );
 		if (searchStrItUCode != strItUCode)
 			return false;
-		searchStrItUCode = utf8::prior(searchStrEnd, searchStrBegin);
-		strItUCode = unicode32_to_lower( utf8::prior(strEnd, strBegin) );
-
 	}
-	return (searchStrItUCode == strItUCode && searchStrBegin == searchStrEnd);
+	return true;
 }
 
 bool matchSuffixPrefix(const std::string& searchStr, const UByteArrayAdapter & str) {
@@ -182,112 +191,65 @@ bool matchSuffixPrefixCIS(const std::string& searchStr, const UByteArrayAdapter
 	return (searchStrIt == searchStrEnd);
 }
 
-std::unordered_set< uint32_t > StringTable::find(const std::string& searchStr, sserialize::StringCompleter::QuerryType qtype) const {
-	std::unordered_set< uint32_t > ret;
-	if (searchStr.empty())
-		return std::unordered_set< uint32_t >();
-	find(ret, searchStr, qtype);
-	return ret;
-}
-
-void 
-StringTable::find(std::unordered_set< uint32_t >& ret, std::string searchStr, sserialize::StringCompleter::QuerryType qtype) const {
-	StrMatchFunction strMatchFunc;
-
+StrMatchFunction matchFunction(sserialize::StringCompleter::QuerryType qtype) {
 	if (qtype & sserialize::StringCompleter::QT_CASE_INSENSITIVE) {
-		searchStr = unicode_to_lower(searchStr);
 		if (qtype & sserialize::StringCompleter::QT_EXACT) {
-			strMatchFunc = &matchExactCIS;
+			return &matchExactCIS;
 		}
 		else if (qtype & sserialize::StringCompleter::QT_PREFIX) {
-			strMatchFunc = &matchPrefixCIS;
+			return &matchPrefixCIS;
 		}
 		else if (qtype & sserialize::StringCompleter::QT_SUFFIX) {
-			strMatchFunc = &matchSuffixCIS;
+			return &matchSuffixCIS;
 		}
 		else {
-			strMatchFunc = &matchSuffixPrefixCIS;
+			return &matchSuffixPrefixCIS;
 		}
 	}
 	else {
 		if (qtype & sserialize::StringCompleter::QT_EXACT) {
-			strMatchFunc = &matchExact;
+			return &matchExact;
 		}
 		else if (qtype & sserialize::StringCompleter::QT_PREFIX) {
-			strMatchFunc = &matchPrefix;
+			return &matchPrefix;
 		}
 		else if (qtype & sserialize::StringCompleter::QT_SUFFIX) {
-			strMatchFunc = &matchSuffix;
+			return &matchSuffix;
 		}
 		else {
-			strMatchFunc = &matchSuffixPrefix;
-		}
-	}
-	UByteArrayAdapter strs = data();
-	for(uint32_t i = 0; i < size(); i++) {
-		if ( (*strMatchFunc)(searchStr, strs.getStringData()) ) {
-			ret.insert(i);
+			return &matchSuffixPrefix;
 		}
 	}
 }
 
-bool StringTable::match(uint32_t stringId, const std::string & searchStr, sserialize::StringCompleter::QuerryType qtype) const {
-	if (size() < stringId)
-		return false;
+std::unordered_set< uint32_t > StringTable::find(const std::string& searchStr, sserialize::StringCompleter::QuerryType qtype) const {
+	std::unordered_set< uint32_t > ret;
+	if (searchStr.empty())
+		return std::unordered_set< uint32_t >();
+	find(ret, searchStr, qtype);
+	return ret;
+}
 
-	StrMatchFunction strMatchFunc;
-		
+void 
+StringTable::find(std::unordered_set< uint32_t >& ret, std::string searchStr, sserialize::StringCompleter::QuerryType qtype) const {
 	if (qtype & sserialize::StringCompleter::QT_CASE_INSENSITIVE) {
-		if (qtype & sserialize::StringCompleter::QT_EXACT) {
-			strMatchFunc = &matchExactCIS;
-		}
-		else if (qtype & sserialize::StringCompleter::QT_PREFIX) {
-			strMatchFunc = &matchPrefixCIS;
-		}
-		else if (qtype & sserialize::StringCompleter::QT_SUFFIX) {
-			strMatchFunc = &matchSuffixCIS;
-		}
-		else {
-			strMatchFunc = &matchSuffixPrefixCIS;
-		}
-	}
-	else {
-		if (qtype & sserialize::StringCompleter::QT_EXACT) {
-			strMatchFunc = &matchExact;
-		}
-		else if (qtype & sserialize::StringCompleter::QT_PREFIX) {
-			strMatchFunc = &matchPrefix;
-		}
-		else if (qtype & sserialize::StringCompleter::QT_SUFFIX) {
-			strMatchFunc = &matchSuffix;
-		}
-		else {
-			strMatchFunc = &matchSuffixPrefix;
-		}
+		searchStr = unicode_to_lower(searchStr);
 	}
+	priv()->find(ret, searchStr, qtype);
+}
+
+bool StringTable::match(uint32_t stringId, const std::string & searchStr, sserialize::StringCompleter::QuerryType qtype) const {
+	if (size() <= stringId)
+		return false;
+	return priv()->match(stringId, searchStr, qtype);
+}
 
-	return  (*strMatchFunc)(searchStr, strDataAt(stringId));
+bool StringTable::match(const std::string & searchStr, const UByteArrayAdapter & str, sserialize::StringCompleter::QuerryType qtype) {
+	return (*matchFunction(qtype))(searchStr, str);
 }
 
 std::ostream& StringTable::printStats(std::ostream& out) const {
-	out << "Static::StringTable::Stats->BEGIN" << std::endl;
-	out << "size: " << size() << std::endl;
-	out << "storage size: " << getSizeInBytes() << std::endl;
-	if (size()) {
-		std::string::size_type longestStringLength = 0;
-		std::string::size_type totallen = 0;
-		for(uint32_t i = 0; i <size(); i++) {
-			std::string::size_type len = at(i).size();
-			totallen += len;
-			if (len > longestStringLength) {
-				longestStringLength = len;
-			}
-		}
-		out << "longest string length: " << longestStringLength << std::endl;
-		out << "Average string length: " << (double)totallen/size() << std::endl;
-	}
-	out << "Static::StringTable::Stats->END" << std::endl;
-	return out;
+	return priv()->printStats(out);
 }
 
 FrequencyStringTable::FrequencyStringTable() :
@@ -309,16 +271,32 @@ FrequencyStringTable(data)
 {}
 
 FrequencyStringTable::FrequencyStringTable(const FrequencyStringTable & other) :
-StringTable(other)
+StringTable(other),
+m_hashIndex(other.m_hashIndex)
 {}
 
 FrequencyStringTable::~FrequencyStringTable() {}
 
 FrequencyStringTable & FrequencyStringTable::operator=(const FrequencyStringTable & other) {
 	StringTable::operator=(other);
+	m_hashIndex = other.m_hashIndex;
 	return *this;
 }
 
+void FrequencyStringTable::setHashIndex(const StringTableHashIndex & idx) {
+	if (idx.size() != size()) {
+		throw sserialize::ConfigurationException("FrequencyStringTable::setHashIndex", "index size does not match table size");
+	}
+	m_hashIndex = idx;
+}
+
+StringTable::SizeType FrequencyStringTable::find(const std::string & value) const {
+	if (m_hashIndex.size()) {
+		return m_hashIndex.find(*this, value);
+	}
+	return priv()->find(value);
+}
+
 SortedStringTable::SortedStringTable() :
 StringTable()
 {}
@@ -338,43 +316,29 @@ SortedStringTable(data)
 {}
 
 SortedStringTable::SortedStringTable(const sserialize::Static::SortedStringTable & other) :
-StringTable(other)
+StringTable(other),
+m_hashIndex(other.m_hashIndex)
 {}
 
 SortedStringTable::~SortedStringTable() {}
+
+void SortedStringTable::setHashIndex(const StringTableHashIndex & idx) {
+	if (idx.size() != size()) {
+		throw sserialize::ConfigurationException("SortedStringTable::setHashIndex", "index size does not match table size");
+	}
+	m_hashIndex = idx;
+}
+
 sserialize::Static::StringTable::SizeType SortedStringTable::find(const std::string& value) const {
-	SizeType tmp = binarySearchKeyInArray(*priv(), value);
-	return (tmp < npos ? tmp : npos);
+	if (m_hashIndex.size()) {
+		return m_hashIndex.find(*this, value);
+	}
+	return priv()->sortedFind(value);
 }
 
 std::pair<sserialize::Static::SortedStringTable::SizeType, sserialize::Static::SortedStringTable::SizeType>
 sserialize::Static::SortedStringTable::range(const std::string & prefix) const {
-	SizeType lb(0), count(size());
-	
-	while(count) {
-		if ( sserialize::unicodeIsSmaller( at(lb+count/2), prefix ) ) {
-			lb = lb+count/2+1;
-			count -= count/2+1;
-		}
-		else {
-			count = count/2;
-		}
-	}
-	
-	SizeType ub(lb);
-	count = size() - ub;
-	while(count) {
-		std::string midstr = at(ub+count/2);
-		if ( sserialize::unicodeIsSmaller(midstr, prefix) || sserialize::isPrefix(prefix, midstr)) {
-			ub = ub+count/2+1;
-			count -= count/2+1;
-		}
-		else {
-			count = count/2;
-		}
-	}
-	
-	return std::pair<SizeType, SizeType>(lb, ub);
+	return priv()->sortedRange(prefix);
 }
 
 }}//end namespace
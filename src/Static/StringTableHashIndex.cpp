@@ -0,0 +1,179 @@
+#include <sserialize/Static/StringTableHashIndex.h>
+#include <sserialize/algorithm/utilmath.h>
+#include <algorithm>
+
+namespace sserialize {
+namespace Static {
+namespace {
+
+struct PlacedString {
+	uint64_t bit;
+	uint32_t id;
+	uint8_t fingerprint;
+};
+
+inline uint64_t mix64(uint64_t v) {
+	v ^= v >> 30;
+	v *= 0xBF58476D1CE4E5B9ULL;
+	v ^= v >> 27;
+	v *= 0x94D049BB133111EBULL;
+	v ^= v >> 31;
+	return v;
+}
+
+}//end anonymous namespace
+
+StringTableHashIndex::StringTableHashIndex() :
+m_levelSizesDataSize(0)
+{}
+
+StringTableHashIndex::StringTableHashIndex(const UByteArrayAdapter & d) {
+	SSERIALIZE_VERSION_MISSMATCH_CHECK(SSERIALIZE_STATIC_STRING_TABLE_HASH_INDEX_VERSION, d.at(0), "Static::StringTableHashIndex");
+	UByteArrayAdapter data(d, 1);
+	Static::Array<uint32_t> levelSizes(data, UByteArrayAdapter::ConsumeTag());
+	m_levelSizes.assign(levelSizes.cbegin(), levelSizes.cend());
+	m_levelSizesDataSize = levelSizes.getSizeInBytes();
+	m_words = Static::Array<uint64_t>(data, UByteArrayAdapter::ConsumeTag());
+	m_ranks = Static::Array<uint32_t>(data, UByteArrayAdapter::ConsumeTag());
+	m_ids = BoundedCompactUintArray(data, UByteArrayAdapter::ConsumeTag());
+	m_fingerprints = BoundedCompactUintArray(data, UByteArrayAdapter::ConsumeTag());
+	if (m_ids.size() != m_fingerprints.size()) {
+		throw sserialize::CorruptDataException("Static::StringTableHashIndex: number of ids and fingerprints differ");
+	}
+	if (m_ranks.size() != (m_words.size()+RankSampleWords-1)/RankSampleWords) {
+		throw sserialize::CorruptDataException("Static::StringTableHashIndex: number of rank samples does not match");
+	}
+}
+
+StringTableHashIndex::StringTableHashIndex(UByteArrayAdapter & data, UByteArrayAdapter::ConsumeTag) :
+StringTableHashIndex(data)
+{
+	data += getSizeInBytes();
+}
+
+StringTableHashIndex::~StringTableHashIndex() {}
+
+UByteArrayAdapter::OffsetType StringTableHashIndex::getSizeInBytes() const {
+	return 1 + m_levelSizesDataSize + m_words.getSizeInBytes() +
+		m_ranks.getSizeInBytes() + m_ids.getSizeInBytes() + m_fingerprints.getSizeInBytes();
+}
+
+uint64_t StringTableHashIndex::hash(const std::string & str) {
+	//FNV-1a with a final mix since the low bits of FNV are weak
+	uint64_t h = 0xCBF29CE484222325ULL;
+	for(char c : str) {
+		h ^= static_cast<uint8_t>(c);
+		h *= 0x100000001B3ULL;
+	}
+	return mix64(h);
+}
+
+uint64_t StringTableHashIndex::levelHash(uint64_t hash, uint32_t level) {
+	return mix64(hash + (static_cast<uint64_t>(level)+1)*0x9E3779B97F4A7C15ULL);
+}
+
+StringTableHashIndex::SizeType StringTableHashIndex::rank(SizeType word) const {
+	SizeType sample = word/RankSampleWords;
+	SizeType r = m_ranks.at(sample);
+	for(SizeType i(sample*RankSampleWords); i < word; ++i) {
+		r += popCount<uint64_t>(m_words.at(i));
+	}
+	return r;
+}
+
+StringTableHashIndex::SizeType StringTableHashIndex::candidate(const std::string & str) const {
+	uint64_t h = hash(str);
+	SizeType wordBegin = 0;
+	for(uint32_t level(0), s(narrow_check<uint32_t>(m_levelSizes.size())); level < s; ++level) {
+		uint64_t levelBits = static_cast<uint64_t>(m_levelSizes[level])*64;
+		uint64_t bit = levelHash(h, level) % levelBits;
+		SizeType wordPos = wordBegin + bit/64;
+		uint64_t word = m_words.at(wordPos);
+		uint64_t mask = static_cast<uint64_t>(1) << (bit%64);
+		if (word & mask) {
+			SizeType slot = rank(wordPos) + popCount<uint64_t>(word & (mask-1));
+			if (m_fingerprints.at(slot) != fingerprint(h)) {
+				return npos;
+			}
+			return m_ids.at(slot);
+		}
+		wordBegin += m_levelSizes[level];
+	}
+	return npos;
+}
+
+UByteArrayAdapter & StringTableHashIndex::create(const std::vector<uint64_t> & hashes, UByteArrayAdapter & dest) {
+	std::vector< std::pair<uint64_t, uint32_t> > remaining;
+	remaining.reserve(hashes.size());
+	for(std::size_t i(0), s(hashes.size()); i < s; ++i) {
+		remaining.emplace_back(hashes[i], narrow_check<uint32_t>(i));
+	}
+	std::vector<uint32_t> levelSizes;
+	std::vector<uint64_t> words;
+	std::vector<PlacedString> placed;
+	placed.reserve(hashes.size());
+	std::vector<uint64_t> seen, collision;
+	while (remaining.size()) {
+		if (levelSizes.size() >= MaxLevels) {
+			throw sserialize::CreationException("Static::StringTableHashIndex: unable to separate strings, table contains duplicates");
+		}
+		uint32_t level = narrow_check<uint32_t>(levelSizes.size());
+		std::size_t levelWords = (remaining.size()*Gamma+63)/64;
+		uint64_t levelBits = static_cast<uint64_t>(levelWords)*64;
+		seen.assign(levelWords, 0);
+		collision.assign(levelWords, 0);
+		for(const auto & x : remaining) {
+			uint64_t bit = levelHash(x.first, level) % levelBits;
+			uint64_t mask = static_cast<uint64_t>(1) << (bit%64);
+			if (seen[bit/64] & mask) {
+				collision[bit/64] |= mask;
+			}
+			seen[bit/64] |= mask;
+		}
+		uint64_t wordBegin = words.size();
+		for(std::size_t i(0); i < levelWords; ++i) {
+			words.push_back(seen[i] & ~collision[i]);
+		}
+		std::size_t unplaced = 0;
+		for(const auto & x : remaining) {
+			uint64_t bit = levelHash(x.first, level) % levelBits;
+			if (collision[bit/64] & (static_cast<uint64_t>(1) << (bit%64))) {
+				remaining[unplaced] = x;
+				++unplaced;
+			}
+			else {
+				placed.push_back(PlacedString{wordBegin*64+bit, x.second, fingerprint(x.first)});
+			}
+		}
+		remaining.resize(unplaced);
+		levelSizes.push_back(narrow_check<uint32_t>(levelWords));
+	}
+
+	//the slot of a string is the rank of its bit
+	std::sort(placed.begin(), placed.end(), [](const PlacedString & a, const PlacedString & b) {
+		return a.bit < b.bit;
+	});
+
+	dest.putUint8(SSERIALIZE_STATIC_STRING_TABLE_HASH_INDEX_VERSION);
+	dest << levelSizes;
+	dest << words;
+	{
+		std::vector<uint32_t> ranks;
+		uint32_t r = 0;
+		for(std::size_t i(0), s(words.size()); i < s; ++i) {
+			if (i % RankSampleWords == 0) {
+				ranks.push_back(r);
+			}
+			r += popCount<uint64_t>(words[i]);
+		}
+		dest << ranks;
+	}
+	std::vector<uint32_t> tmp(placed.size());
+	std::transform(placed.begin(), placed.end(), tmp.begin(), [](const PlacedString & x) { return x.id; });
+	BoundedCompactUintArray::create(tmp, dest);
+	std::transform(placed.begin(), placed.end(), tmp.begin(), [](const PlacedString & x) { return uint32_t(x.fingerprint); });
+	BoundedCompactUintArray::create(tmp, dest);
+	return dest;
+}
+
+}}//end namespace sserialize::Static
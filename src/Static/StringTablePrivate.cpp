@@ -0,0 +1,252 @@
+#include <sserialize/Static/StringTablePrivate.h>
+#include <sserialize/Static/StringTable.h>
+#include <sserialize/algorithm/find_key_in_array_functions.h>
+#include <sserialize/strings/stringfunctions.h>
+#include <algorithm>
+#include <iostream>
+
+namespace sserialize {
+namespace Static {
+
+StringTablePrivate::StringTablePrivate() :
+RefCountObject()
+{}
+
+StringTablePrivate::~StringTablePrivate() {}
+
+uint32_t StringTablePrivate::strSize(SizeType pos) const {
+	return narrow_check<uint32_t>(at(pos).size());
+}
+
+bool StringTablePrivate::match(SizeType pos, const std::string & searchStr, sserialize::StringCompleter::QuerryType qtype) const {
+	return StringTable::match(searchStr, strDataAt(pos), qtype);
+}
+
+StringTablePrivate::SizeType StringTablePrivate::find(const std::string & value) const {
+	for(SizeType i(0), s(size()); i < s; ++i) {
+		if (at(i) == value) {
+			return i;
+		}
+	}
+	return npos;
+}
+
+StringTablePrivate::SizeType StringTablePrivate::sortedFind(const std::string & value) const {
+	SizeType lb(0), count(size());
+	while(count) {
+		if ( sserialize::unicodeIsSmaller( at(lb+count/2), value ) ) {
+			lb = lb+count/2+1;
+			count -= count/2+1;
+		}
+		else {
+			count = count/2;
+		}
+	}
+	return (lb < size() && at(lb) == value ? lb : npos);
+}
+
+std::pair<StringTablePrivate::SizeType, StringTablePrivate::SizeType>
+StringTablePrivate::sortedRange(const std::string & prefix) const {
+	SizeType lb(0), count(size());
+
+	while(count) {
+		if ( sserialize::unicodeIsSmaller( at(lb+count/2), prefix ) ) {
+			lb = lb+count/2+1;
+			count -= count/2+1;
+		}
+		else {
+			count = count/2;
+		}
+	}
+
+	SizeType ub(lb);
+	count = size() - ub;
+	while(count) {
+		std::string midstr = at(ub+count/2);
+		if ( sserialize::unicodeIsSmaller(midstr, prefix) || sserialize::isPrefix(prefix, midstr)) {
+			ub = ub+count/2+1;
+			count -= count/2+1;
+		}
+		else {
+			count = count/2;
+		}
+	}
+
+	return std::pair<SizeType, SizeType>(lb, ub);
+}
+
+void StringTablePrivate::find(std::unordered_set<uint32_t> & ret, const std::string & searchStr, sserialize::StringCompleter::QuerryType qtype) const {
+	for(SizeType i(0), s(size()); i < s; ++i) {
+		if (StringTable::match(searchStr, strDataAt(i), qtype)) {
+			ret.insert(narrow_check<uint32_t>(i));
+		}
+	}
+}
+
+std::ostream& StringTablePrivate::printStats(std::ostream& out) const {
+	out << "Static::StringTable::Stats->BEGIN" << std::endl;
+	out << "size: " << size() << std::endl;
+	out << "storage size: " << getSizeInBytes() << std::endl;
+	if (size()) {
+		std::string::size_type longestStringLength = 0;
+		std::string::size_type totallen = 0;
+		for(uint32_t i = 0; i <size(); i++) {
+			std::string::size_type len = at(i).size();
+			totallen += len;
+			if (len > longestStringLength) {
+				longestStringLength = len;
+			}
+		}
+		out << "longest string length: " << longestStringLength << std::endl;
+		out << "Average string length: " << (double)totallen/size() << std::endl;
+	}
+	out << "Static::StringTable::Stats->END" << std::endl;
+	return out;
+}
+
+StringTablePrivateArray::StringTablePrivateArray() {}
+
+StringTablePrivateArray::StringTablePrivateArray(const UByteArrayAdapter & data) :
+m_data(data)
+{}
+
+StringTablePrivateArray::~StringTablePrivateArray() {}
+
+StringTablePrivate::SizeType StringTablePrivateArray::size() const {
+	return m_data.size();
+}
+
+UByteArrayAdapter::OffsetType StringTablePrivateArray::getSizeInBytes() const {
+	return m_data.getSizeInBytes();
+}
+
+std::string StringTablePrivateArray::at(SizeType pos) const {
+	return m_data.at(pos);
+}
+
+UByteArrayAdapter StringTablePrivateArray::strDataAt(SizeType pos) const {
+	return m_data.dataAt(pos).getStringData(0);
+}
+
+uint32_t StringTablePrivateArray::strSize(SizeType pos) const {
+	return m_data.dataAt(pos).getStringLength(0);
+}
+
+StringTablePrivate::SizeType StringTablePrivateArray::find(const std::string & value) const {
+	return m_data.find(value);
+}
+
+StringTablePrivate::SizeType StringTablePrivateArray::sortedFind(const std::string & value) const {
+	SizeType tmp = binarySearchKeyInArray(m_data, value);
+	return (tmp < npos ? tmp : npos);
+}
+
+void StringTablePrivateArray::find(std::unordered_set<uint32_t> & ret, const std::string & searchStr, sserialize::StringCompleter::QuerryType qtype) const {
+	//the strings are stored one after another, no need to look up every offset
+	UByteArrayAdapter strs = m_data.data();
+	for(uint32_t i = 0, s = narrow_check<uint32_t>(size()); i < s; i++) {
+		if ( StringTable::match(searchStr, strs.getStringData(), qtype) ) {
+			ret.insert(i);
+		}
+	}
+}
+
+namespace {
+
+///Buffer to match decoded strings without allocating memory for every string
+class DecodeBuffer {
+public:
+	///decoded string
+	std::string str;
+public:
+	///@return view of a copy of @param src, valid until the next call
+	UByteArrayAdapter data(const std::string & src) {
+		if (src.size() > m_data.size() || !m_dataAdapter.size()) {
+			m_data.resize(std::max<std::size_t>(src.size(), 2*m_data.size()+16));
+			m_dataAdapter = UByteArrayAdapter(&m_data, false);
+		}
+		std::copy(src.begin(), src.end(), m_data.begin());
+		return UByteArrayAdapter(m_dataAdapter, 0, src.size());
+	}
+private:
+	std::vector<uint8_t> m_data;
+	UByteArrayAdapter m_dataAdapter;
+};
+
+thread_local DecodeBuffer frontCodedDecodeBuffer;
+
+}//end namespace
+
+StringTablePrivateFrontCoded::StringTablePrivateFrontCoded(const UByteArrayAdapter & data) :
+m_fc(data)
+{}
+
+StringTablePrivateFrontCoded::~StringTablePrivateFrontCoded() {}
+
+StringTablePrivate::SizeType StringTablePrivateFrontCoded::size() const {
+	return m_fc.size();
+}
+
+UByteArrayAdapter::OffsetType StringTablePrivateFrontCoded::getSizeInBytes() const {
+	return m_fc.getSizeInBytes();
+}
+
+std::string StringTablePrivateFrontCoded::at(SizeType pos) const {
+	return m_fc.at(pos);
+}
+
+UByteArrayAdapter StringTablePrivateFrontCoded::strDataAt(SizeType pos) const {
+	std::string & str = frontCodedDecodeBuffer.str;
+	m_fc.at(pos, str);
+	//the returned data has to stay valid, hence it can not use the decode buffer
+	return UByteArrayAdapter(new std::vector<uint8_t>(str.begin(), str.end()), true);
+}
+
+uint32_t StringTablePrivateFrontCoded::strSize(SizeType pos) const {
+	std::string & str = frontCodedDecodeBuffer.str;
+	m_fc.at(pos, str);
+	return narrow_check<uint32_t>(str.size());
+}
+
+bool StringTablePrivateFrontCoded::match(SizeType pos, const std::string & searchStr, sserialize::StringCompleter::QuerryType qtype) const {
+	m_fc.at(pos, frontCodedDecodeBuffer.str);
+	return StringTable::match(searchStr, frontCodedDecodeBuffer.data(frontCodedDecodeBuffer.str), qtype);
+}
+
+StringTablePrivate::SizeType StringTablePrivateFrontCoded::find(const std::string & value) const {
+	return m_fc.find(value);
+}
+
+StringTablePrivate::SizeType StringTablePrivateFrontCoded::sortedFind(const std::string & value) const {
+	return m_fc.find(value);
+}
+
+std::pair<StringTablePrivate::SizeType, StringTablePrivate::SizeType>
+StringTablePrivateFrontCoded::sortedRange(const std::string & prefix) const {
+	return m_fc.range(prefix);
+}
+
+void StringTablePrivateFrontCoded::find(std::unordered_set<uint32_t> & ret, const std::string & searchStr, sserialize::StringCompleter::QuerryType qtype) const {
+	if (!(qtype & sserialize::StringCompleter::QT_CASE_INSENSITIVE) && (qtype & (sserialize::StringCompleter::QT_EXACT | sserialize::StringCompleter::QT_PREFIX))) {
+		//the table is sorted, no need to look at every string
+		std::pair<SizeType, SizeType> r( m_fc.range(searchStr) );
+		for(SizeType i(r.first); i < r.second; ++i) {
+			if (!(qtype & sserialize::StringCompleter::QT_EXACT) || m_fc.at(i).size() == searchStr.size()) {
+				ret.insert(narrow_check<uint32_t>(i));
+			}
+		}
+		return;
+	}
+	DecodeBuffer & buffer = frontCodedDecodeBuffer;
+	m_fc.visit([&](SizeType pos, const std::string & str) {
+		if (StringTable::match(searchStr, buffer.data(str), qtype)) {
+			ret.insert(narrow_check<uint32_t>(pos));
+		}
+	});
+}
+
+std::ostream & StringTablePrivateFrontCoded::printStats(std::ostream & out) const {
+	return m_fc.printStats(out);
+}
+
+}}//end namespace
@@ -0,0 +1,285 @@
+#include <sserialize/Static/StringTableSuffixIndex.h>
+#include <sserialize/strings/unicode_case_functions.h>
+#include <sserialize/vendor/utf8.h>
+#include <sserialize/mt/ThreadPool.h>
+#include <sserialize/utility/exceptions.h>
+#include <string_view>
+#include <algorithm>
+#include <atomic>
+
+namespace sserialize {
+namespace Static {
+namespace {
+
+struct SuffixEntry {
+	uint32_t strId;
+	uint32_t offset;
+	uint32_t keyOffset;
+};
+
+///Calls cb(offset, keyOffset) for every code point of str and appends the search key of str to key
+template<typename T_CALLBACK>
+void forEachSuffix(const std::string & str, bool caseSensitive, std::string & key, T_CALLBACK cb) {
+	if (caseSensitive) {
+		key.append(str);
+		for(uint32_t i(0), s(narrow_check<uint32_t>(str.size())); i < s; ++i) {
+			if ((static_cast<uint8_t>(str[i]) & 0xC0) != 0x80) {
+				cb(i, i);
+			}
+		}
+	}
+	else {
+		std::string::const_iterator it(str.begin()), end(str.end());
+		while (it != end) {
+			cb(narrow_check<uint32_t>(it-str.begin()), narrow_check<uint32_t>(key.size()));
+			utf8::append(unicode32_to_lower(utf8::next(it, end)), std::back_inserter(key));
+		}
+	}
+}
+
+std::string toLower(const std::string & str) {
+	std::string result;
+	forEachSuffix(str, false, result, [](uint32_t, uint32_t) {});
+	return result;
+}
+
+///Runs f(i) for i in [0, count) with threadCount threads
+template<typename T_FUNC>
+void parallelFor(std::size_t count, uint32_t threadCount, T_FUNC f) {
+	std::atomic<std::size_t> next(0);
+	auto worker = [&next, &f, count]() {
+		for(std::size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+			f(i);
+		}
+	};
+	sserialize::ThreadPool::execute(worker, threadCount, sserialize::ThreadPool::CopyTaskTag());
+}
+
+}//end anonymous namespace
+
+StringTableSuffixIndex::StringTableSuffixIndex() :
+m_flags(F_NONE)
+{}
+
+StringTableSuffixIndex::StringTableSuffixIndex(const UByteArrayAdapter & data, const StringTable & table) :
+m_table(table),
+m_flags(data.getUint8(1)),
+m_stringIds(data+2),
+m_offsets(data+(2+m_stringIds.getSizeInBytes()))
+{
+	SSERIALIZE_VERSION_MISSMATCH_CHECK(SSERIALIZE_STATIC_STRING_TABLE_SUFFIX_INDEX_VERSION, data.at(0), "Static::StringTableSuffixIndex");
+	if (m_stringIds.size() != m_offsets.size()) {
+		throw sserialize::CorruptDataException("Static::StringTableSuffixIndex: number of string ids and offsets differ");
+	}
+}
+
+StringTableSuffixIndex::StringTableSuffixIndex(UByteArrayAdapter & data, UByteArrayAdapter::ConsumeTag, const StringTable & table) :
+StringTableSuffixIndex(data, table)
+{
+	data += getSizeInBytes();
+}
+
+StringTableSuffixIndex::~StringTableSuffixIndex() {}
+
+UByteArrayAdapter::OffsetType StringTableSuffixIndex::getSizeInBytes() const {
+	return 2+m_stringIds.getSizeInBytes()+m_offsets.getSizeInBytes();
+}
+
+bool StringTableSuffixIndex::supports(sserialize::StringCompleter::QuerryType qtype) const {
+	bool cis = qtype & sserialize::StringCompleter::QT_CASE_INSENSITIVE;
+	return (cis != caseSensitive()) && (qtype & sserialize::StringCompleter::QT_EPSS);
+}
+
+std::unordered_set<uint32_t> StringTableSuffixIndex::find(const std::string & searchStr, sserialize::StringCompleter::QuerryType qtype) const {
+	std::unordered_set<uint32_t> ret;
+	if (searchStr.empty()) {
+		return ret;
+	}
+	find(ret, searchStr, qtype);
+	return ret;
+}
+
+void StringTableSuffixIndex::find(std::unordered_set<uint32_t> & ret, const std::string & searchStr, sserialize::StringCompleter::QuerryType qtype) const {
+	if (!supports(qtype)) {
+		throw sserialize::UnsupportedFeatureException("Static::StringTableSuffixIndex: query type is not supported by this index");
+	}
+	std::string qstr( caseSensitive() ? searchStr : toLower(searchStr) );
+	std::pair<SizeType, SizeType> r( range(qstr) );
+	if (qtype & sserialize::StringCompleter::QT_EXACT) {
+		//exact matches are the smallest suffixes in the range
+		for(SizeType i(r.first); i < r.second && equal(i, qstr); ++i) {
+			if (offset(i) == 0) {
+				ret.insert(stringId(i));
+			}
+		}
+	}
+	else if (qtype & sserialize::StringCompleter::QT_PREFIX) {
+		for(SizeType i(r.first); i < r.second; ++i) {
+			if (offset(i) == 0) {
+				ret.insert(stringId(i));
+			}
+		}
+	}
+	else if (qtype & sserialize::StringCompleter::QT_SUFFIX) {
+		for(SizeType i(r.first); i < r.second && equal(i, qstr); ++i) {
+			ret.insert(stringId(i));
+		}
+	}
+	else {
+		for(SizeType i(r.first); i < r.second; ++i) {
+			ret.insert(stringId(i));
+		}
+	}
+}
+
+std::pair<StringTableSuffixIndex::SizeType, StringTableSuffixIndex::SizeType>
+StringTableSuffixIndex::range(const std::string & searchStr) const {
+	SizeType lb(0), count(size());
+	while(count) {
+		if (compare(lb+count/2, searchStr) < 0) {
+			lb = lb+count/2+1;
+			count -= count/2+1;
+		}
+		else {
+			count = count/2;
+		}
+	}
+	SizeType ub(lb);
+	count = size() - ub;
+	while(count) {
+		if (compare(ub+count/2, searchStr) <= 0) {
+			ub = ub+count/2+1;
+			count -= count/2+1;
+		}
+		else {
+			count = count/2;
+		}
+	}
+	return std::pair<SizeType, SizeType>(lb, ub);
+}
+
+int StringTableSuffixIndex::compare(SizeType pos, const std::string & searchStr) const {
+	UByteArrayAdapter str( m_table.strDataAt(stringId(pos)) );
+	str += offset(pos);
+	if (caseSensitive()) {
+		UByteArrayAdapter::OffsetType strSize = str.size();
+		for(std::string::size_type i(0), s(searchStr.size()); i < s; ++i) {
+			if (i >= strSize) {
+				return -1;
+			}
+			uint8_t sc = str.at(i);
+			uint8_t qc = static_cast<uint8_t>(searchStr[i]);
+			if (sc != qc) {
+				return (sc < qc ? -1 : 1);
+			}
+		}
+		return 0;
+	}
+	else {
+		UByteArrayAdapter strIt(str);
+		UByteArrayAdapter strEnd(str + str.size());
+		std::string::const_iterator qIt(searchStr.begin()), qEnd(searchStr.end());
+		while (qIt != qEnd) {
+			if (strIt.size() == 0) {
+				return -1;
+			}
+			uint32_t sc = unicode32_to_lower( utf8::next(strIt, strEnd) );
+			uint32_t qc = utf8::next(qIt, qEnd);
+			if (sc != qc) {
+				return (sc < qc ? -1 : 1);
+			}
+		}
+		return 0;
+	}
+}
+
+bool StringTableSuffixIndex::equal(SizeType pos, const std::string & searchStr) const {
+	if (compare(pos, searchStr) != 0) {
+		return false;
+	}
+	UByteArrayAdapter str( m_table.strDataAt(stringId(pos)) );
+	str += offset(pos);
+	if (caseSensitive()) {
+		return str.size() == searchStr.size();
+	}
+	else {
+		//number of code points has to match
+		UByteArrayAdapter strIt(str);
+		UByteArrayAdapter strEnd(str + str.size());
+		std::string::const_iterator qIt(searchStr.begin()), qEnd(searchStr.end());
+		while (qIt != qEnd && strIt.size()) {
+			utf8::next(strIt, strEnd);
+			utf8::next(qIt, qEnd);
+		}
+		return qIt == qEnd && strIt.size() == 0;
+	}
+}
+
+UByteArrayAdapter & StringTableSuffixIndex::create(const StringTable & table, UByteArrayAdapter & dest, bool caseSensitive, uint32_t threadCount) {
+	if (!threadCount) {
+		threadCount = sserialize::ThreadPool::hardware_concurrency();
+	}
+	threadCount = std::max<uint32_t>(threadCount, 1);
+	std::size_t strCount = table.size();
+
+	//search keys and number of suffixes per string
+	std::vector<std::string> keys(strCount);
+	std::vector<std::size_t> suffixBegin(strCount+1, 0);
+	parallelFor(strCount, threadCount, [&](std::size_t i) {
+		std::size_t count = 0;
+		forEachSuffix(table.at(i), caseSensitive, keys[i], [&count](uint32_t, uint32_t) { ++count; });
+		suffixBegin[i+1] = count;
+	});
+	for(std::size_t i(0); i < strCount; ++i) {
+		suffixBegin[i+1] += suffixBegin[i];
+	}
+
+	std::vector<SuffixEntry> entries(suffixBegin.back());
+	parallelFor(strCount, threadCount, [&](std::size_t i) {
+		std::string dummy;
+		std::size_t pos = suffixBegin[i];
+		forEachSuffix(table.at(i), caseSensitive, dummy, [&](uint32_t offset, uint32_t keyOffset) {
+			entries[pos] = SuffixEntry{narrow_check<uint32_t>(i), offset, keyOffset};
+			++pos;
+		});
+	});
+
+	auto smaller = [&keys](const SuffixEntry & a, const SuffixEntry & b) {
+		std::string_view ak( std::string_view(keys[a.strId]).substr(a.keyOffset) );
+		std::string_view bk( std::string_view(keys[b.strId]).substr(b.keyOffset) );
+		int cmp = ak.compare(bk);
+		if (cmp != 0) {
+			return cmp < 0;
+		}
+		return (a.strId == b.strId ? a.offset < b.offset : a.strId < b.strId);
+	};
+
+	//sort chunks in parallel and merge them pairwise
+	std::size_t chunkCount = std::min<std::size_t>(threadCount, std::max<std::size_t>(entries.size(), 1));
+	std::size_t chunkSize = (entries.size()+chunkCount-1)/chunkCount;
+	parallelFor(chunkCount, threadCount, [&](std::size_t i) {
+		auto begin = entries.begin()+std::min(i*chunkSize, entries.size());
+		auto end = entries.begin()+std::min((i+1)*chunkSize, entries.size());
+		std::sort(begin, end, smaller);
+	});
+	for(std::size_t width(chunkSize); width < entries.size(); width *= 2) {
+		std::size_t mergeCount = (entries.size()+2*width-1)/(2*width);
+		parallelFor(mergeCount, threadCount, [&](std::size_t i) {
+			auto begin = entries.begin()+std::min(2*i*width, entries.size());
+			auto mid = entries.begin()+std::min((2*i+1)*width, entries.size());
+			auto end = entries.begin()+std::min((2*i+2)*width, entries.size());
+			std::inplace_merge(begin, mid, end, smaller);
+		});
+	}
+
+	std::vector<uint32_t> tmp(entries.size());
+	dest.putUint8(SSERIALIZE_STATIC_STRING_TABLE_SUFFIX_INDEX_VERSION);
+	dest.putUint8(caseSensitive ? F_NONE : F_CASE_INSENSITIVE);
+	std::transform(entries.begin(), entries.end(), tmp.begin(), [](const SuffixEntry & e) { return e.strId; });
+	BoundedCompactUintArray::create(tmp, dest);
+	std::transform(entries.begin(), entries.end(), tmp.begin(), [](const SuffixEntry & e) { return e.offset; });
+	BoundedCompactUintArray::create(tmp, dest);
+	return dest;
+}
+
+}}//end namespace sserialize::Static
@@ -0,0 +1,244 @@
+#include <sserialize/Static/TieredItemIndexStore.h>
+#include <sserialize/containers/ItemIndexFactory.h>
+#include <sserialize/utility/exceptions.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace sserialize {
+namespace Static {
+namespace detail {
+
+TieredItemIndexStore::TieredItemIndexStore(const sserialize::Static::ItemIndexStore & backend) :
+TieredItemIndexStore(backend, Config())
+{}
+
+TieredItemIndexStore::TieredItemIndexStore(const sserialize::Static::ItemIndexStore & backend, const Config & cfg) :
+m_backend(backend),
+m_cfg(cfg),
+m_hotSlot(new std::atomic<uint32_t>[backend.size()]),
+m_accessCount(new std::atomic<uint32_t>[backend.size()]),
+m_hot(cfg.maxHotCount),
+m_hotCount(0),
+m_chunkUsage(0),
+m_arenaSize(0)
+{
+	if (!m_cfg.chunkSize) {
+		throw sserialize::ConfigurationException("TieredItemIndexStore", "chunkSize has to be larger than 0");
+	}
+	for(uint32_t i(0), s(size()); i < s; ++i) {
+		m_hotSlot[i].store(NotHot, std::memory_order_relaxed);
+		m_accessCount[i].store(0, std::memory_order_relaxed);
+	}
+	if (m_cfg.maxSmallIdxSize) {
+		for(uint32_t i(0), s(size()); i < s && hotCount() < m_cfg.maxHotCount; ++i) {
+			if (m_backend.idxSize(i) <= m_cfg.maxSmallIdxSize) {
+				promote(i);
+			}
+		}
+	}
+}
+
+TieredItemIndexStore::~TieredItemIndexStore() {}
+
+OffsetType TieredItemIndexStore::getSizeInBytes() const {
+	return m_backend.getSizeInBytes();
+}
+
+uint32_t TieredItemIndexStore::size() const {
+	return m_backend.size();
+}
+
+int TieredItemIndexStore::indexTypes() const {
+	return m_backend.indexTypes();
+}
+
+ItemIndex::Types TieredItemIndexStore::indexType(uint32_t pos) const {
+	return m_backend.indexType(pos);
+}
+
+uint32_t TieredItemIndexStore::compressionType() const {
+	return m_backend.compressionType();
+}
+
+UByteArrayAdapter::OffsetType TieredItemIndexStore::dataSize(uint32_t pos) const {
+	return m_backend.dataSize(pos);
+}
+
+UByteArrayAdapter TieredItemIndexStore::rawDataAt(uint32_t pos) const {
+	return m_backend.rawDataAt(pos);
+}
+
+ItemIndex TieredItemIndexStore::at(uint32_t pos) const {
+	if (pos >= size()) {
+		return ItemIndex();
+	}
+	uint32_t slot = m_hotSlot[pos].load(std::memory_order_acquire);
+	if (slot != NotHot) {
+		//hot hits are sampled to keep the counters of frequently used indexes out of the cache lines of all threads
+		thread_local uint32_t hotHits = 0;
+		if (++hotHits % HotHitSampleRate == 0) {
+			m_accessCount[pos].fetch_add(HotHitSampleRate, std::memory_order_relaxed);
+		}
+		const HotEntry & e = m_hot[slot];
+		return ItemIndex(e.data, e.type);
+	}
+	ItemIndex idx = m_backend.at(pos);
+	uint32_t count = m_accessCount[pos].fetch_add(1, std::memory_order_relaxed)+1;
+	if (m_cfg.promotionThreshold && count == m_cfg.promotionThreshold) {
+		doPromote(pos, idx);
+	}
+	return idx;
+}
+
+uint32_t TieredItemIndexStore::idxSize(uint32_t pos) const {
+	return m_backend.idxSize(pos);
+}
+
+std::ostream & TieredItemIndexStore::printStats(std::ostream & out) const {
+	return printStats(out, [](uint32_t) { return true; });
+}
+
+std::ostream & TieredItemIndexStore::printStats(std::ostream & out, std::function<bool(uint32_t)> filter) const {
+	out << "Static::TieredItemIndexStore::Stats->BEGIN" << std::endl;
+	out << "Hot indexes: " << hotCount() << std::endl;
+	out << "Arena size: " << arenaSize() << std::endl;
+	m_backend.printStats(out, filter);
+	out << "Static::TieredItemIndexStore::Stats->END" << std::endl;
+	return out;
+}
+
+SortedOffsetIndex & TieredItemIndexStore::getIndex() {
+	return m_backend.getIndex();
+}
+
+const UByteArrayAdapter & TieredItemIndexStore::getData() const {
+	return m_backend.getData();
+}
+
+RCPtrWrapper<HuffmanDecoder> TieredItemIndexStore::getHuffmanTree() const {
+	return m_backend.getHuffmanTree();
+}
+
+UByteArrayAdapter TieredItemIndexStore::getHuffmanTreeData() const {
+	return m_backend.getHuffmanTreeData();
+}
+
+bool TieredItemIndexStore::hasSummaries() const {
+	return m_backend.hasSummaries();
+}
+
+ItemIndexSummary TieredItemIndexStore::summary(uint32_t pos) const {
+	return m_backend.summary(pos);
+}
+
+bool TieredItemIndexStore::isHot(uint32_t pos) const {
+	return pos < size() && m_hotSlot[pos].load(std::memory_order_acquire) != NotHot;
+}
+
+uint32_t TieredItemIndexStore::hotCount() const {
+	return m_hotCount.load(std::memory_order_acquire);
+}
+
+UByteArrayAdapter::SizeType TieredItemIndexStore::arenaSize() const {
+	std::lock_guard<std::mutex> lck(m_promotionLock);
+	return m_arenaSize;
+}
+
+uint32_t TieredItemIndexStore::accessCount(uint32_t pos) const {
+	return m_accessCount[pos].load(std::memory_order_relaxed);
+}
+
+bool TieredItemIndexStore::promote(uint32_t pos) {
+	if (pos >= size()) {
+		return false;
+	}
+	if (isHot(pos)) {
+		return true;
+	}
+	return doPromote(pos, m_backend.at(pos));
+}
+
+void TieredItemIndexStore::writeProfile(std::ostream & out) const {
+	for(uint32_t i(0), s(size()); i < s; ++i) {
+		uint32_t count = accessCount(i);
+		if (count) {
+			out << i << ' ' << count << '\n';
+		}
+	}
+	out << std::flush;
+}
+
+uint32_t TieredItemIndexStore::loadProfile(std::istream & in) {
+	std::vector<std::pair<uint32_t, uint32_t>> profile;
+	uint32_t id, count;
+	while (in >> id >> count) {
+		if (id >= size()) {
+			throw sserialize::OutOfBoundsException("TieredItemIndexStore::loadProfile: index id " + std::to_string(id) + " is out of bounds");
+		}
+		//keep the counts so that a profile written afterwards still contains this index
+		m_accessCount[id].store(std::max(count, accessCount(id)), std::memory_order_relaxed);
+		profile.emplace_back(id, count);
+	}
+	//the hot tier is bounded, so the most frequently used indexes get promoted first
+	std::stable_sort(profile.begin(), profile.end(), [](const std::pair<uint32_t, uint32_t> & a, const std::pair<uint32_t, uint32_t> & b) {
+		return a.second > b.second;
+	});
+	uint32_t promoted = 0;
+	for(const std::pair<uint32_t, uint32_t> & x : profile) {
+		if (x.second < m_cfg.promotionThreshold) {
+			break;
+		}
+		if (!isHot(x.first) && promote(x.first)) {
+			++promoted;
+		}
+	}
+	return promoted;
+}
+
+bool TieredItemIndexStore::doPromote(uint32_t pos, const ItemIndex & idx) const {
+	std::vector<uint32_t> ids;
+	idx.putInto(ids);
+	std::vector<uint8_t> tmp;
+	UByteArrayAdapter tmpData(&tmp, false);
+	ItemIndex::Types type = ItemIndexFactory::create(ids, tmpData, m_backend.indexType(pos));
+	if (type == ItemIndex::T_NULL) {
+		return false;
+	}
+	
+	std::lock_guard<std::mutex> lck(m_promotionLock);
+	if (m_hotSlot[pos].load(std::memory_order_relaxed) != NotHot) {
+		return true;
+	}
+	uint32_t slot = m_hotCount.load(std::memory_order_relaxed);
+	if (slot >= m_cfg.maxHotCount || m_arenaSize + tmp.size() > m_cfg.maxArenaSize) {
+		return false;
+	}
+	UByteArrayAdapter::SizeType dataSize = tmp.size();
+	UByteArrayAdapter chunk;
+	UByteArrayAdapter::SizeType chunkOffset = 0;
+	if (dataSize > m_cfg.chunkSize) {
+		chunk = UByteArrayAdapter(new std::vector<uint8_t>(dataSize), true);
+	}
+	else {
+		if (!m_chunk.size() || m_chunkUsage + dataSize > m_chunk.size()) {
+			m_chunk = UByteArrayAdapter(new std::vector<uint8_t>(m_cfg.chunkSize), true);
+			m_chunkUsage = 0;
+		}
+		chunk = m_chunk;
+		chunkOffset = m_chunkUsage;
+		m_chunkUsage += dataSize;
+	}
+	chunk.putData(chunkOffset, tmp);
+	
+	HotEntry & e = m_hot[slot];
+	e.data = UByteArrayAdapter(chunk, chunkOffset, dataSize);
+	e.type = type;
+	m_arenaSize += dataSize;
+	m_hotCount.store(slot+1, std::memory_order_release);
+	//publish the entry
+	m_hotSlot[pos].store(slot, std::memory_order_release);
+	return true;
+}
+
+}}}//end namespace sserialize::Static::detail
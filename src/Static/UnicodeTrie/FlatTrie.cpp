@@ -1,11 +1,15 @@
 #include <sserialize/Static/UnicodeTrie/FlatTrie.h>
 #include <sserialize/strings/stringfunctions.h>
+#include <cstring>
 
 namespace sserialize {
 namespace Static {
 namespace UnicodeTrie {
 
 constexpr FlatTrieBase::SizeType FlatTrieBase::npos;
+constexpr uint32_t FlatTrieBase::DirectoryEntrySize;
+constexpr uint32_t FlatTrieBase::DirectoryPrefixLength;
+constexpr uint32_t FlatTrieBase::DefaultDirectorySampleRate;
 
 namespace detail {
 namespace FlatTrie {
@@ -98,16 +102,41 @@ Node::const_iterator Node::cend() const {
 
 }}//end namespace detail::FlatTrie
 
-FlatTrieBase::FlatTrieBase() {}
+FlatTrieBase::FlatTrieBase() :
+m_dirSampleRate(0),
+m_dirSize(0)
+{}
 
 FlatTrieBase::FlatTrieBase(const sserialize::UByteArrayAdapter & src) :
-Version(src, Version::NoConsume()),
 m_strData(src, 1+UByteArrayAdapter::OffsetTypeSerializedLength(), src.getOffset(1)),
-m_trie(src+(1+UByteArrayAdapter::OffsetTypeSerializedLength()+m_strData.size()))
-{}
+m_trie(src+(1+UByteArrayAdapter::OffsetTypeSerializedLength()+m_strData.size())),
+m_dirSampleRate(0),
+m_dirSize(0)
+{
+	uint8_t version = src.at(0);
+	if (version != 1 && version != SSERIALIZE_STATIC_UNICODE_TRIE_FLAT_TRIE_BASE_VERSION) {
+		throw sserialize::VersionMissMatchException("sserialize::Static::UnicodeTrie::FlatTrieBase", SSERIALIZE_STATIC_UNICODE_TRIE_FLAT_TRIE_BASE_VERSION, version);
+	}
+	if (version == SSERIALIZE_STATIC_UNICODE_TRIE_FLAT_TRIE_BASE_VERSION) {
+		UByteArrayAdapter tmp(src, 1+UByteArrayAdapter::OffsetTypeSerializedLength()+m_strData.size()+m_trie.getSizeInBytes());
+		m_dirSampleRate = tmp.getVlPackedUint32();
+		if (m_dirSampleRate) {
+			m_dirSize = (size()+m_dirSampleRate-1)/m_dirSampleRate;
+			tmp.shrinkToGetPtr();
+			tmp.resize(UByteArrayAdapter::OffsetType(m_dirSize)*DirectoryEntrySize);
+			if (m_dirSize) {
+				m_dir = tmp.asMemView();
+			}
+		}
+	}
+}
 
 UByteArrayAdapter::OffsetType FlatTrieBase::getSizeInBytes() const {
-	return 1+UByteArrayAdapter::OffsetTypeSerializedLength()+m_strData.size()+m_trie.getSizeInBytes();
+	UByteArrayAdapter::OffsetType result = 1+UByteArrayAdapter::OffsetTypeSerializedLength()+m_strData.size()+m_trie.getSizeInBytes();
+	if (m_dirSampleRate) {
+		result += psize_vu32(m_dirSampleRate) + UByteArrayAdapter::OffsetType(m_dirSize)*DirectoryEntrySize;
+	}
+	return result;
 }
 
 UByteArrayAdapter FlatTrieBase::data() const {
@@ -119,6 +148,11 @@ UByteArrayAdapter FlatTrieBase::data() const {
 }
 
 FlatTrieBase::SizeType FlatTrieBase::find(const std::string & str, bool prefixMatch) const {
+	SizeType lowerBound = 0;
+	return find(str, prefixMatch, lowerBound);
+}
+
+FlatTrieBase::SizeType FlatTrieBase::find(const std::string & str, bool prefixMatch, SizeType & lowerBound) const {
 // 	std::cout << "FlatTrie::find: searching for " << str << " with prefixMatch=" << (prefixMatch ? "true" : "false") << std::endl;
 	if (size() == SizeType(0)) {
 		return npos;
@@ -126,11 +160,17 @@ FlatTrieBase::SizeType FlatTrieBase::find(const std::string & str, bool prefixMa
 
 	SizeType left = 0;
 	SizeType right = size()-1;
+	if (m_dirSize) {
+		dirRange(str, left, right);
+	}
+	//both left and lowerBound point to strings that are smaller than str (or to the first string)
+	left = std::min(std::max(left, lowerBound), right);
+	lowerBound = left;
 	SizeType mid  = (right-left)/2 + left;
 
 	std::string::size_type lLcp = calcLcp(strData(left), str);
 	if (lLcp == str.size()) {//first is match
-		return 0;
+		return left;
 	}
 	std::string::size_type rLcp = calcLcp(strData(right), str);
 	std::string::size_type mLcp = 0;
@@ -143,6 +183,7 @@ FlatTrieBase::SizeType FlatTrieBase::find(const std::string & str, bool prefixMa
 			lLcp = mLcp;
 			mLcp = std::min(lLcp, rLcp);
 			left = mid;
+			lowerBound = mid;
 		}
 		else if (cmp == 1) {//mid is larger than str
 			rLcp = mLcp;
@@ -153,6 +194,9 @@ FlatTrieBase::SizeType FlatTrieBase::find(const std::string & str, bool prefixMa
 			break;
 		}
 	}
+	if (cmp == 0) {
+		lowerBound = mid;
+	}
 
 	if (cmp != 0) { //mid does not point to the equal element, the correct one might be either in left or right
 		if (lLcp == str.size()) {
@@ -175,6 +219,62 @@ FlatTrieBase::SizeType FlatTrieBase::find(const std::string & str, bool prefixMa
 	return npos;
 }
 
+int FlatTrieBase::dirCompare(SizeType pos, const std::string & str) const {
+	const uint8_t * entry = m_dir.data() + std::size_t(pos)*DirectoryEntrySize;
+	std::size_t entryLen = entry[0];
+	std::size_t strLen = std::min<std::size_t>(str.size(), DirectoryPrefixLength);
+	int cmp = ::memcmp(entry+1, str.data(), std::min(entryLen, strLen));
+	if (cmp) {
+		return cmp;
+	}
+	return (entryLen < strLen ? -1 : (entryLen > strLen ? 1 : 0));
+}
+
+//A sample whose prefix is smaller than the prefix of str is smaller than str and does not have str as prefix.
+//A sample whose prefix is larger is not smaller than str.
+//The first string not smaller than str is therefore enclosed by these two samples.
+void FlatTrieBase::dirRange(const std::string & str, SizeType & left, SizeType & right) const {
+	//first sample whose prefix is not smaller
+	SizeType lb = 0;
+	SizeType count = m_dirSize;
+	while (count > SizeType(0)) {
+		SizeType step = count/2;
+		if (dirCompare(lb+step, str) < 0) {
+			lb += step+1;
+			count -= step+1;
+		}
+		else {
+			count = step;
+		}
+	}
+	//first sample whose prefix is larger
+	SizeType ub = lb;
+	count = m_dirSize-lb;
+	while (count > SizeType(0)) {
+		SizeType step = count/2;
+		if (dirCompare(ub+step, str) <= 0) {
+			ub += step+1;
+			count -= step+1;
+		}
+		else {
+			count = step;
+		}
+	}
+	if (lb > SizeType(0)) {
+		left = (lb-1)*m_dirSampleRate;
+	}
+	if (ub < m_dirSize) {
+		right = ub*m_dirSampleRate;
+	}
+}
+
+void FlatTrieBase::putDirectoryEntry(UByteArrayAdapter & dest, const char * str, StringSizeType size) {
+	uint8_t entry[DirectoryEntrySize] = {0};
+	entry[0] = (uint8_t) std::min<StringSizeType>(size, DirectoryPrefixLength);
+	::memmove(entry+1, str, entry[0]);
+	dest.putData(entry, DirectoryEntrySize);
+}
+
 FlatTrieBase::SizeType FlatTrieBase::size() const {
 	return m_trie.size();
 }
@@ -216,6 +316,8 @@ std::ostream& FlatTrieBase::printStats(std::ostream& out) const {
 	out << "sserialize::Static::UnicodeTrie::FlatTrieBase::stats--BEGIN" << std::endl;
 	out << "total data size=" << m_strData.size() + m_trie.getSizeInBytes() << std::endl;
 	out << "string data size=" << m_strData.size() << std::endl;
+	out << "directory sample rate=" << m_dirSampleRate << std::endl;
+	out << "directory size=" << std::size_t(m_dirSize)*DirectoryEntrySize << std::endl;
 	m_trie.printStats(out);
 	out << "sserialize::Static::UnicodeTrie::FlatTrieBase::stats--END" << std::endl;
 	return out;
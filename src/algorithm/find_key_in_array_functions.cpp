@@ -0,0 +1,132 @@
+#include <sserialize/algorithm/find_key_in_array_functions.h>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+	#define SSERIALIZE_FIND_KEY_IN_ARRAY_X86_SIMD
+	#include <immintrin.h>
+#endif
+
+namespace sserialize {
+namespace detail {
+namespace FindKeyInArray {
+namespace {
+
+int32_t find_u8_scalar(const uint8_t * begin, uint32_t len, uint8_t key) {
+	for(uint32_t i(0); i < len; ++i) {
+		if (begin[i] == key) {
+			return (int32_t) i;
+		}
+	}
+	return -1;
+}
+
+int32_t find_u16_scalar(const uint8_t * begin, uint32_t len, uint16_t key) {
+	for(uint32_t i(0); i < len; ++i) {
+		if (up_u16(begin+2*i) == key) {
+			return (int32_t) i;
+		}
+	}
+	return -1;
+}
+
+#ifdef SSERIALIZE_FIND_KEY_IN_ARRAY_X86_SIMD
+
+//SSE2 is part of x86_64, only AVX2 needs a runtime check
+//All loads are unaligned and never read past the end of the array, the remainder is handled by the scalar loop
+
+int32_t find_u8_sse2(const uint8_t * begin, uint32_t len, uint8_t key) {
+	const __m128i k = _mm_set1_epi8((char) key);
+	uint32_t i(0);
+	for(; i+16 <= len; i += 16) {
+		__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin+i));
+		uint32_t mask = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(v, k));
+		if (mask) {
+			return (int32_t) (i + __builtin_ctz(mask));
+		}
+	}
+	int32_t pos = find_u8_scalar(begin+i, len-i, key);
+	return (pos < 0 ? pos : (int32_t)i+pos);
+}
+
+int32_t find_u16_sse2(const uint8_t * begin, uint32_t len, uint16_t key) {
+	const __m128i k = _mm_set1_epi16((short) key);
+	uint32_t i(0);
+	for(; i+8 <= len; i += 8) {
+		__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin+2*i));
+		uint32_t mask = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi16(v, k));
+		if (mask) {
+			return (int32_t) (i + __builtin_ctz(mask)/2);
+		}
+	}
+	int32_t pos = find_u16_scalar(begin+2*i, len-i, key);
+	return (pos < 0 ? pos : (int32_t)i+pos);
+}
+
+__attribute__((target("avx2")))
+int32_t find_u8_avx2(const uint8_t * begin, uint32_t len, uint8_t key) {
+	const __m256i k = _mm256_set1_epi8((char) key);
+	uint32_t i(0);
+	for(; i+32 <= len; i += 32) {
+		__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin+i));
+		uint32_t mask = (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, k));
+		if (mask) {
+			return (int32_t) (i + __builtin_ctz(mask));
+		}
+	}
+	int32_t pos = find_u8_sse2(begin+i, len-i, key);
+	return (pos < 0 ? pos : (int32_t)i+pos);
+}
+
+__attribute__((target("avx2")))
+int32_t find_u16_avx2(const uint8_t * begin, uint32_t len, uint16_t key) {
+	const __m256i k = _mm256_set1_epi16((short) key);
+	uint32_t i(0);
+	for(; i+16 <= len; i += 16) {
+		__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin+2*i));
+		uint32_t mask = (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi16(v, k));
+		if (mask) {
+			return (int32_t) (i + __builtin_ctz(mask)/2);
+		}
+	}
+	int32_t pos = find_u16_sse2(begin+2*i, len-i, key);
+	return (pos < 0 ? pos : (int32_t)i+pos);
+}
+
+bool hasAvx2() {
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2");
+}
+
+#endif
+
+typedef int32_t (*FindU8Func)(const uint8_t *, uint32_t, uint8_t);
+typedef int32_t (*FindU16Func)(const uint8_t *, uint32_t, uint16_t);
+
+FindU8Func selectFindU8() {
+#ifdef SSERIALIZE_FIND_KEY_IN_ARRAY_X86_SIMD
+	return (hasAvx2() ? &find_u8_avx2 : &find_u8_sse2);
+#else
+	return &find_u8_scalar;
+#endif
+}
+
+FindU16Func selectFindU16() {
+#ifdef SSERIALIZE_FIND_KEY_IN_ARRAY_X86_SIMD
+	return (hasAvx2() ? &find_u16_avx2 : &find_u16_sse2);
+#else
+	return &find_u16_scalar;
+#endif
+}
+
+}//end anonymous namespace
+
+int32_t find_u8(const uint8_t * begin, uint32_t len, uint8_t key) {
+	static const FindU8Func f = selectFindU8();
+	return f(begin, len, key);
+}
+
+int32_t find_u16(const uint8_t * begin, uint32_t len, uint16_t key) {
+	static const FindU16Func f = selectFindU16();
+	return f(begin, len, key);
+}
+
+}}}//end namespace sserialize::detail::FindKeyInArray
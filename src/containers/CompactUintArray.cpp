@@ -2,6 +2,7 @@
 #include <sserialize/storage/pack_unpack_functions.h>
 #include <sserialize/storage/SerializationInfo.h>
 #include <sserialize/utility/assert.h>
+#include <sserialize/utility/Bitpacking.h>
 #include <stdint.h>
 #include <iostream>
 
@@ -12,6 +13,18 @@ void CompactUintArrayPrivate::calcBegin(const SizeType pos, sserialize::UByteArr
 	initShift = (pos == 0 ? 0 : narrow_check<uint8_t>(sserialize::multiplyMod64(pos, bpn, 8)));
 }
 
+void CompactUintArrayPrivate::getRangeLsb(SizeType pos, SizeType count, value_type * dest, Bits bpn) const {
+	if (!count) {
+		return;
+	}
+	uint64_t bitBegin = static_cast<uint64_t>(pos)*bpn;
+	uint64_t bitEnd = bitBegin + static_cast<uint64_t>(count)*bpn;
+	UByteArrayAdapter::OffsetType byteBegin = bitBegin/8;
+	UByteArrayAdapter::OffsetType byteEnd = (bitEnd+7)/8;
+	const UByteArrayAdapter::MemoryView mem( m_data.getMemView(byteBegin, byteEnd-byteBegin) );
+	sserialize::unpack_lsb(bpn, mem.data(), mem.data()+mem.size(), bitBegin-byteBegin*8, bpn, dest, count);
+}
+
 CompactUintArrayPrivate::CompactUintArrayPrivate() : RefCountObject() {}
 
 CompactUintArrayPrivate::CompactUintArrayPrivate(const UByteArrayAdapter& adap) :
@@ -25,6 +38,12 @@ CompactUintArrayPrivate::Bits CompactUintArrayPrivate::bpn() const {
 	return 0;
 }
 
+void CompactUintArrayPrivate::getRange(SizeType pos, SizeType count, value_type * dest) const {
+	for(SizeType i(0); i < count; ++i) {
+		dest[i] = at(pos+i);
+	}
+}
+
 CompactUintArrayPrivateEmpty::CompactUintArrayPrivateEmpty(): CompactUintArrayPrivate() {}
 
 CompactUintArrayPrivateEmpty::~CompactUintArrayPrivateEmpty() {}
@@ -79,6 +98,10 @@ CompactUintArrayPrivateVarBits::value_type CompactUintArrayPrivateVarBits::at(co
 }
 
 
+void CompactUintArrayPrivateVarBits::getRange(SizeType pos, SizeType count, value_type * dest) const {
+	getRangeLsb(pos, count, dest, m_bpn);
+}
+
 //Idee: zunächst müssen alle betroffenen bits genullt werden.
 //anschließend den neuen wert mit einem ODER setzen
 CompactUintArrayPrivateVarBits::value_type CompactUintArrayPrivateVarBits::set(const SizeType pos, value_type value) {
@@ -157,6 +180,10 @@ uint64_t CompactUintArrayPrivateVarBits64::at(SizeType pos) const {
 	return (res & m_mask);
 }
 
+void CompactUintArrayPrivateVarBits64::getRange(SizeType pos, SizeType count, value_type * dest) const {
+	getRangeLsb(pos, count, dest, m_bpn);
+}
+
 CompactUintArrayPrivate::value_type CompactUintArrayPrivateVarBits64::set(const SizeType pos, value_type value) {
 	value = value & m_mask;
 	
@@ -212,6 +239,14 @@ CompactUintArrayPrivate::value_type CompactUintArrayPrivateU8::at(SizeType pos)
     return m_data.getUint8(pos);
 }
 
+void CompactUintArrayPrivateU8::getRange(SizeType pos, SizeType count, value_type * dest) const {
+	if (!count) {
+		return;
+	}
+	const UByteArrayAdapter::MemoryView mem( m_data.getMemView(pos, count) );
+	std::copy(mem.data(), mem.data()+count, dest);
+}
+
 CompactUintArrayPrivate::value_type CompactUintArrayPrivateU8::set(const SizeType pos, value_type value) {
 	m_data.putUint8(pos, (uint8_t)value);
 	return value;
@@ -399,6 +434,13 @@ CompactUintArray::value_type CompactUintArray::at64(SizeType pos) const {
 	return at(pos);
 }
 
+void CompactUintArray::getRange(SizeType pos, SizeType count, value_type * dest) const {
+	if (UNLIKELY_BRANCH(pos > m_maxCount || count > m_maxCount-pos)) {
+		throw sserialize::OutOfBoundsException("CompactUintArray::getRange: maxCount=" + std::to_string(m_maxCount) + ", pos=" + std::to_string(pos) + ", count=" + std::to_string(count));
+	}
+	priv()->getRange(pos, count, dest);
+}
+
 CompactUintArray::value_type CompactUintArray::set(const SizeType pos, const value_type value) {
 	if (UNLIKELY_BRANCH(pos >= m_maxCount)) {
 		throw sserialize::OutOfBoundsException("CompactUintArray::set: maxCount=" + std::to_string(m_maxCount) + ", pos=" + std::to_string(pos));
@@ -533,6 +575,9 @@ BoundedCompactUintArray & BoundedCompactUintArray::operator=(const BoundedCompac
 }
 
 UByteArrayAdapter::OffsetType  BoundedCompactUintArray::getSizeInBytes() const {
+	if (!m_size) { //create() only stores the header with size 0
+		return psize_vu64(0);
+	}
 	Bits bits = bpn();
 	uint64_t sb = (static_cast<uint64_t>(m_size) << 6) | (bits-1);
 	return psize_vu64(sb) + minStorageBytes(bits, m_size);
@@ -0,0 +1,103 @@
+#include <sserialize/containers/ItemIndexArena.h>
+#include <sserialize/containers/ItemIndexPrivates/ItemIndexPrivateArenaVector.h>
+#include <cstring>
+
+namespace sserialize {
+
+ItemIndexArena::ItemIndexArena(std::size_t initialSize) :
+m_res(initialSize)
+{}
+
+ItemIndexArena::~ItemIndexArena() {}
+
+void * ItemIndexArena::allocate(std::size_t bytes, std::size_t alignment) {
+	m_bytesAllocated += bytes;
+	return m_res.allocate(bytes, alignment);
+}
+
+uint32_t * ItemIndexArena::allocateIds(std::size_t count) {
+	if (!count) {
+		return nullptr;
+	}
+	return static_cast<uint32_t*>( allocate(sizeof(uint32_t)*count, alignof(uint32_t)) );
+}
+
+ItemIndex ItemIndexArena::make(const uint32_t * data, uint32_t size) {
+	++m_indexCount;
+	return ItemIndex( new(this) ItemIndexPrivateArenaVector(data, size) );
+}
+
+ItemIndex ItemIndexArena::create(const uint32_t * begin, const uint32_t * end) {
+	std::size_t size = end - begin;
+	uint32_t * data = allocateIds(size);
+	if (size) {
+		::memcpy(data, begin, sizeof(uint32_t)*size);
+	}
+	return make(data, (uint32_t) size);
+}
+
+ItemIndex ItemIndexArena::create(const std::vector<uint32_t> & ids) {
+	return create(ids.data(), ids.data()+ids.size());
+}
+
+template<typename TFunc>
+ItemIndex ItemIndexArena::setOp(const ItemIndex & a, const ItemIndex & b) {
+	m_first.resize(a.size());
+	m_second.resize(b.size());
+	a.putInto(m_first.data());
+	b.putInto(m_second.data());
+	
+	m_result.resize(TFunc::maxSize(a.priv(), b.priv()));
+	uint32_t * out = m_result.data();
+	std::vector<uint32_t>::const_iterator fIt(m_first.cbegin()), fEnd(m_first.cend()), sIt(m_second.cbegin()), sEnd(m_second.cend());
+	for(; fIt != fEnd && sIt != sEnd;) {
+		if (*fIt < *sIt) {
+			if (TFunc::pushFirstSmaller) {
+				*out = *fIt;
+				++out;
+			}
+			++fIt;
+		}
+		else if (*sIt < *fIt) {
+			if (TFunc::pushSecondSmaller) {
+				*out = *sIt;
+				++out;
+			}
+			++sIt;
+		}
+		else {
+			if (TFunc::pushEqual) {
+				*out = *fIt;
+				++out;
+			}
+			++fIt;
+			++sIt;
+		}
+	}
+	if (TFunc::pushFirstRemainder) {
+		out = std::copy(fIt, fEnd, out);
+	}
+	if (TFunc::pushSecondRemainder) {
+		out = std::copy(sIt, sEnd, out);
+	}
+	//merging into scratch space first keeps the arena from accumulating unused tails
+	return create(m_result.data(), out);
+}
+
+ItemIndex ItemIndexArena::intersect(const ItemIndex & a, const ItemIndex & b) {
+	return setOp<detail::ItemIndexImpl::IntersectOp>(a, b);
+}
+
+ItemIndex ItemIndexArena::unite(const ItemIndex & a, const ItemIndex & b) {
+	return setOp<detail::ItemIndexImpl::UniteOp>(a, b);
+}
+
+ItemIndex ItemIndexArena::difference(const ItemIndex & a, const ItemIndex & b) {
+	return setOp<detail::ItemIndexImpl::DifferenceOp>(a, b);
+}
+
+ItemIndex ItemIndexArena::symmetricDifference(const ItemIndex & a, const ItemIndex & b) {
+	return setOp<detail::ItemIndexImpl::SymmetricDifferenceOp>(a, b);
+}
+
+}//end namespace
@@ -27,6 +27,8 @@ m_idxTypes(sserialize::MM_SLOW_FILEBASED),
 m_hitCount(0),
 m_checkIndex(true),
 m_useDeduplication(true),
+m_summaries(false),
+m_offsetsCreationMode(Static::SortedOffsetIndexPrivate::CM_REGLINE),
 m_type(ItemIndex::T_RLE_DE),
 m_compressionType(Static::ItemIndexStore::IC_NONE),
 m_growSize(16*1024*1024),
@@ -46,6 +48,8 @@ m_idxSizes(sserialize::MM_SLOW_FILEBASED),
 m_hitCount(other.m_hitCount.load()),
 m_checkIndex(other.m_checkIndex),
 m_useDeduplication(other.m_useDeduplication),
+m_summaries(other.m_summaries),
+m_offsetsCreationMode(other.m_offsetsCreationMode),
 m_type(other.m_type),
 m_compressionType(other.m_compressionType),
 m_growSize(other.m_growSize),
@@ -68,6 +72,8 @@ ItemIndexFactory & ItemIndexFactory::operator=(ItemIndexFactory && other) {
 	m_hitCount.store(other.m_hitCount.load());
 	m_checkIndex = other.m_checkIndex;
 	m_useDeduplication = other.m_useDeduplication;
+	m_summaries = other.m_summaries;
+	m_offsetsCreationMode = other.m_offsetsCreationMode;
 	m_type = other.m_type;
 	m_compressionType = other.m_compressionType;
 	m_header = std::move(other.m_header);
@@ -280,7 +286,7 @@ OffsetType ItemIndexFactory::flush() {
 	std::cout << "Hit count was " << m_hitCount.load() << std::endl;
 	std::cout << "Size=" << m_idToOffsets.size() << std::endl;
 	m_header.resetPtrs();
-	m_header.putUint8(5); //Version
+	m_header.putUint8(m_summaries ? 8 : 5); //Version
 	m_header.putUint16(m_type);//type
 	m_header.putUint8(Static::ItemIndexStore::IndexCompressionType::IC_NONE);
 	m_header.putOffset(m_indexStore.tellPutPtr());
@@ -288,7 +294,7 @@ OffsetType ItemIndexFactory::flush() {
 
 	uint64_t oIBegin = m_indexStore.tellPutPtr();
 	std::cout << "Serializing offsets starting at " << oIBegin << "...";
-	if (! Static::SortedOffsetIndexPrivate::create(m_idToOffsets, m_indexStore) ) {
+	if (! Static::SortedOffsetIndexPrivate::create(m_idToOffsets, m_indexStore, m_offsetsCreationMode) ) {
 		std::cout << "ItemIndexFactory::serialize: failed to create Offsetindex." << std::endl;
 		return 0;
 	}
@@ -316,6 +322,18 @@ OffsetType ItemIndexFactory::flush() {
 		using MyIterator = sserialize::TransformIterator<decltype(tf), uint32_t, ItemIndexTypesContainer::const_iterator>;
 		CompactUintArray::create(MyIterator(tf, m_idxTypes.begin()), MyIterator(tf, m_idxTypes.end()), m_indexStore, bits);
 	}
+	if (m_summaries) {
+		std::cout << "Serializing summaries starting at " << m_indexStore.tellPutPtr() << "..." << std::flush;
+		std::vector<uint64_t> ranges, signatures;
+		ranges.reserve(m_idCounter);
+		signatures.reserve(m_idCounter);
+		for(uint32_t i(0), s(narrow_check<uint32_t>(m_idCounter)); i < s; ++i) {
+			ItemIndexSummary summary( ItemIndexSummary::create(indexById(i)) );
+			ranges.push_back(summary.range());
+			signatures.push_back(summary.signature());
+		}
+		m_indexStore << ranges << signatures;
+	}
 	std::cout << std::endl;
 	std::cout << "done." << std::endl;
 
@@ -609,12 +627,33 @@ UByteArrayAdapter::OffsetType ItemIndexFactory::compressWithVarUint(sserialize::
 	return dest.tellPutPtr()-beginOffset;
 }
 
+namespace {
+
+///Summaries of the source store are kept by the recompressors, this needs version 8
+void putSummaries(const sserialize::Static::ItemIndexStore & store, UByteArrayAdapter & dest) {
+	std::vector<uint64_t> ranges, signatures;
+	ranges.reserve(store.size());
+	signatures.reserve(store.size());
+	for(uint32_t i(0), s(store.size()); i < s; ++i) {
+		ItemIndexSummary summary( store.summary(i) );
+		ranges.push_back(summary.range());
+		signatures.push_back(summary.signature());
+	}
+	dest << ranges << signatures;
+}
+
+}//end anonymous namespace
+
 #define HEAP_ALLOC_MINI_LZO(var,size) \
     lzo_align_t __LZO_MMODEL var [ ((size) + (sizeof(lzo_align_t) - 1)) / sizeof(lzo_align_t) ]
 
 UByteArrayAdapter::OffsetType ItemIndexFactory::compressWithLZO(sserialize::Static::ItemIndexStore & store, UByteArrayAdapter & dest) {
+	if (store.compressionType() & (Static::ItemIndexStore::IndexCompressionType::IC_LZO | Static::ItemIndexStore::IndexCompressionType::IC_LZO_GROUPED)) {
+		throw sserialize::UnsupportedFeatureException("ItemIndexStore is already compressed with lzo");
+		return 0;
+	}
 	UByteArrayAdapter::OffsetType beginOffset = dest.tellPutPtr();
-	dest.putUint8(6);//version
+	dest.putUint8(store.hasSummaries() ? 8 : 6);//version
 	dest.putUint16(store.indexTypes());
 	dest.putUint8(Static::ItemIndexStore::IndexCompressionType::IC_LZO | store.compressionType());
 	dest.putOffset(0);
@@ -693,6 +732,114 @@ UByteArrayAdapter::OffsetType ItemIndexFactory::compressWithLZO(sserialize::Stat
 		uint32_t bits = sserialize::msb(sserialize::msb(uint32_t(store.indexTypes() - ItemIndex::T_MULTIPLE))) + 1;
 		CompactUintArray::create(MyIterator(deref, 0), MyIterator(deref, store.size()), dest, bits);
 	}
+	if (store.hasSummaries()) {
+		putSummaries(store, dest);
+	}
+	std::cout << "Total size: " << dest.tellPutPtr()-beginOffset << std::endl;
+	return dest.tellPutPtr()-beginOffset;
+}
+
+UByteArrayAdapter::OffsetType ItemIndexFactory::compressWithLZOGrouped(sserialize::Static::ItemIndexStore & store, UByteArrayAdapter & dest, UByteArrayAdapter::SizeType groupSize) {
+	if (store.compressionType() & (Static::ItemIndexStore::IndexCompressionType::IC_LZO | Static::ItemIndexStore::IndexCompressionType::IC_LZO_GROUPED)) {
+		throw sserialize::UnsupportedFeatureException("ItemIndexStore is already compressed with lzo");
+		return 0;
+	}
+	UByteArrayAdapter::OffsetType beginOffset = dest.tellPutPtr();
+	dest.putUint8(store.hasSummaries() ? 8 : 7);//version
+	dest.putUint16(store.indexTypes());
+	dest.putUint8(Static::ItemIndexStore::IndexCompressionType::IC_LZO_GROUPED | store.compressionType());
+	dest.putOffset(0);
+	UByteArrayAdapter::OffsetType destDataBeginOffset = dest.tellPutPtr();
+	std::vector<UByteArrayAdapter::OffsetType> newOffsets; //offsets into the uncompressed data
+	std::vector<UByteArrayAdapter::OffsetType> groupOffsets; //offsets into the compressed data
+	std::vector<uint32_t> groupBegin;
+	newOffsets.reserve(store.size());
+	
+	HEAP_ALLOC_MINI_LZO(wrkmem, LZO1X_1_MEM_COMPRESS);
+	
+	std::vector<uint8_t> inBuf;
+	std::vector<uint8_t> outBuf;
+	UByteArrayAdapter::OffsetType uncompressedSize = 0;
+	
+	auto flushGroup = [&](uint32_t groupId) {
+		groupOffsets.push_back(dest.tellPutPtr()-destDataBeginOffset);
+		outBuf.resize(inBuf.size() + inBuf.size()/16 + 64 + 3); //worst case expansion of lzo1x
+		lzo_uint outBufLen = outBuf.size();
+		int r = ::lzo1x_1_compress(inBuf.data(), inBuf.size(), outBuf.data(), &outBufLen, wrkmem);
+		if (r != LZO_E_OK) {
+			std::stringstream ss;
+			ss << "lzo1x_1_compress returned error " << r << " for group " << groupId;
+			throw sserialize::CreationException(ss.str());
+		}
+		dest.putData(outBuf.data(), outBufLen);
+		inBuf.clear();
+	};
+	
+	ProgressInfo pinfo;
+	pinfo.begin(store.size(), "Recompressing index with grouped lzo");
+	for(uint32_t i = 0; i < store.size(); ++i ) {
+		UByteArrayAdapter::MemoryView idxData( store.rawDataAt(i).asMemView() );
+		bool groupIsOpen = groupBegin.size() != groupOffsets.size();
+		//large indexes get their own group
+		if (groupIsOpen && idxData.size() >= groupSize) {
+			flushGroup(narrow_check<uint32_t>(groupBegin.size()-1));
+			groupIsOpen = false;
+		}
+		if (!groupIsOpen) {
+			groupBegin.push_back(i);
+		}
+		newOffsets.push_back(uncompressedSize);
+		uncompressedSize += idxData.size();
+		inBuf.insert(inBuf.end(), idxData.begin(), idxData.end());
+		if (inBuf.size() >= groupSize) {
+			flushGroup(narrow_check<uint32_t>(groupBegin.size()-1));
+		}
+		pinfo(i);
+	}
+	if (groupBegin.size() != groupOffsets.size()) {
+		flushGroup(narrow_check<uint32_t>(groupBegin.size()-1));
+	}
+	pinfo.end();
+	groupBegin.push_back(store.size());
+	SSERIALIZE_CHEAP_ASSERT_EQUAL(groupBegin.size(), groupOffsets.size()+1);
+	
+	std::cout << "Data section has a size of " << dest.tellPutPtr()-destDataBeginOffset << " with " << groupOffsets.size() << " groups" << std::endl;
+	dest.putOffset(beginOffset+4, dest.tellPutPtr()-destDataBeginOffset);
+	std::cout << "Creating offset index" << std::endl;
+	sserialize::Static::SortedOffsetIndexPrivate::create(newOffsets, dest);
+	std::cout << "Offset index created. Current size:" << dest.tellPutPtr()-beginOffset << std::endl;
+	
+	//add the index sizes table
+	{
+		sserialize::Static::ArrayCreator<uint32_t> ac(dest);
+		ac.reserveOffsets(store.size());
+		for(uint32_t i(0), s(store.size()); i < s; ++i) {
+			ac.put(store.idxSize(i));
+		}
+		ac.flush();
+	}
+	
+	if (store.compressionType() == Static::ItemIndexStore::IndexCompressionType::IC_HUFFMAN) {
+		UByteArrayAdapter htData = store.getHuffmanTreeData();
+		std::cout << "Adding huffman tree with size: " << htData.size() << std::endl;
+		dest.putData(htData);
+	}
+	//now add the group info
+	dest.putOffset(uncompressedSize);
+	BoundedCompactUintArray::create(groupBegin, dest);
+	sserialize::Static::SortedOffsetIndexPrivate::create(groupOffsets, dest);
+	//finally the index type info
+	if (store.indexTypes() & ItemIndex::T_MULTIPLE) {
+		auto deref = [&store](uint32_t pos) -> uint32_t {
+			return sserialize::msb( uint32_t(store.indexType(pos)) );
+		};
+		using MyIterator = sserialize::TransformIterator<decltype(deref), uint32_t, sserialize::RangeGenerator<uint32_t>::const_iterator>;
+		uint32_t bits = sserialize::msb(sserialize::msb(uint32_t(store.indexTypes() - ItemIndex::T_MULTIPLE))) + 1;
+		CompactUintArray::create(MyIterator(deref, 0), MyIterator(deref, store.size()), dest, bits);
+	}
+	if (store.hasSummaries()) {
+		putSummaries(store, dest);
+	}
 	std::cout << "Total size: " << dest.tellPutPtr()-beginOffset << std::endl;
 	return dest.tellPutPtr()-beginOffset;
 }
@@ -770,6 +917,14 @@ UByteArrayAdapter ItemIndexStoreFromFactory::getHuffmanTreeData() const {
 	return UByteArrayAdapter();
 }
 
+bool ItemIndexStoreFromFactory::hasSummaries() const {
+	return false;
+}
+
+ItemIndexSummary ItemIndexStoreFromFactory::summary(uint32_t /*pos*/) const {
+	return ItemIndexSummary();
+}
+
 }//end namespace detail
 
 }//end namespace
@@ -2,6 +2,7 @@
 #include <sserialize/containers/ItemIndexIteratorIntersecting.h>
 #include <sserialize/containers/ItemIndexIteratorSetOp.h>
 #include <sserialize/containers/ItemIndexPrivates/ItemIndexPrivateSimple.h>
+#include <algorithm>
 
 namespace sserialize {
 
@@ -18,14 +19,12 @@ m_cur(0)
 ItemIndexIteratorPrivateItemIndex::ItemIndexIteratorPrivateItemIndex(const ItemIndex& idx) :
 ItemIndexIteratorPrivate(),
 m_index(idx),
+m_it(m_index.cbegin()),
 m_pos(0),
 m_cur(0)
 {
-	if (idx.size()) {
-		m_cur = m_index.at(0);
-	}
-	else {
-		m_pos = 1; //move one beyond
+	if (m_index.size()) {
+		m_cur = *m_it;
 	}
 }
 
@@ -41,21 +40,19 @@ uint32_t ItemIndexIteratorPrivateItemIndex::operator*() const {
 
 void ItemIndexIteratorPrivateItemIndex::next() {
 	uint32_t idxSize = m_index.size();
-	if (m_pos+1 < idxSize) {
+	if (m_pos < idxSize) {
 		++m_pos;
-		m_cur = m_index.at(m_pos);
-	}
-	else {
-		m_pos = idxSize;
-		m_cur = 0;
+		++m_it;
 	}
+	m_cur = (m_pos < idxSize ? *m_it : 0);
 }
 
 void ItemIndexIteratorPrivateItemIndex::reset() {
 	m_pos = 0;
 	m_cur = 0;
+	m_it = m_index.cbegin();
 	if (m_index.size()) {
-		m_cur = m_index.at(0);
+		m_cur = *m_it;
 	}
 }
 
@@ -67,6 +64,7 @@ bool ItemIndexIteratorPrivateItemIndex::valid() const {
 ItemIndexIteratorPrivate* ItemIndexIteratorPrivateItemIndex::copy() const {
 	ItemIndexIteratorPrivateItemIndex * newIdx = new ItemIndexIteratorPrivateItemIndex();
 	newIdx->m_index = m_index;
+	newIdx->m_it = m_it;
 	newIdx->m_pos = m_pos;
 	newIdx->m_cur = m_cur;
 	return newIdx;
@@ -138,7 +136,12 @@ ItemIndexIterator& ItemIndexIterator::reset() {
 
 
 ItemIndex ItemIndexIterator::toItemIndex() const {
-	uint32_t tempStorageSize = ItemIndexPrivateSimple::storageSize(maxSize(), 4);
+	return toItemIndex(maxSize());
+}
+
+ItemIndex ItemIndexIterator::toItemIndex(uint32_t maxCount) const {
+	maxCount = std::min(maxCount, maxSize());
+	uint32_t tempStorageSize = ItemIndexPrivateSimple::storageSize(maxCount, 4);
 	UByteArrayAdapter tempStorage( UByteArrayAdapter::createCache(tempStorageSize, sserialize::MM_PROGRAM_MEMORY) );
 	if (tempStorage.size() == 0)
 		return ItemIndex();
@@ -148,7 +151,7 @@ ItemIndex ItemIndexIterator::toItemIndex() const {
 	RCPtrWrapper<ItemIndexIteratorPrivate> tempPriv( priv()->copy() );
 	
 	uint32_t pos = 0;
-	while (tempPriv->valid()) {
+	while (pos < maxCount && tempPriv->valid()) {
 		carr.set(pos, tempPriv->operator*());
 		tempPriv->next();
 		pos++;
@@ -157,6 +160,15 @@ ItemIndex ItemIndexIterator::toItemIndex() const {
 	return ItemIndex(tempStorage, sserialize::ItemIndex::T_SIMPLE);
 }
 
+uint32_t ItemIndexIterator::count() const {
+	RCPtrWrapper<ItemIndexIteratorPrivate> tempPriv( priv()->copy() );
+	uint32_t ret = 0;
+	for(; tempPriv->valid(); tempPriv->next()) {
+		++ret;
+	}
+	return ret;
+}
+
 }//end namespace
 
 sserialize::ItemIndexIterator operator+(const sserialize::ItemIndexIterator& first, const sserialize::ItemIndexIterator& second) {
@@ -0,0 +1,102 @@
+#include <sserialize/containers/ItemIndexPrivates/ItemIndexPrivateArenaVector.h>
+#include <sserialize/containers/ItemIndexArena.h>
+#include <sserialize/containers/DynamicBitSet.h>
+#include <algorithm>
+#include <cstring>
+
+namespace sserialize {
+namespace {
+
+//The arena is stored in front of the object since it has to stay alive until operator delete returns
+constexpr std::size_t ArenaHeaderSize = alignof(std::max_align_t) < sizeof(ItemIndexArena*) ? sizeof(ItemIndexArena*) : alignof(std::max_align_t);
+
+}//end anonymous namespace
+
+ItemIndexPrivateArenaVector::ItemIndexPrivateArenaVector(const uint32_t * data, uint32_t size) :
+ItemIndexPrivate(),
+m_data(data),
+m_size(size)
+{}
+
+ItemIndexPrivateArenaVector::~ItemIndexPrivateArenaVector() {}
+
+ItemIndex::Types ItemIndexPrivateArenaVector::type() const {
+	return ItemIndex::T_STL_VECTOR;
+}
+
+void * ItemIndexPrivateArenaVector::operator new(std::size_t size, ItemIndexArena * arena) {
+	char * mem = static_cast<char*>( arena->allocate(ArenaHeaderSize + size, alignof(std::max_align_t)) );
+	arena->rcInc();
+	*reinterpret_cast<ItemIndexArena**>(mem) = arena;
+	return mem + ArenaHeaderSize;
+}
+
+void ItemIndexPrivateArenaVector::operator delete(void * ptr, ItemIndexArena * /*arena*/) {
+	ItemIndexPrivateArenaVector::operator delete(ptr);
+}
+
+void ItemIndexPrivateArenaVector::operator delete(void * ptr) {
+	if (!ptr) {
+		return;
+	}
+	ItemIndexArena * arena = *reinterpret_cast<ItemIndexArena**>(static_cast<char*>(ptr) - ArenaHeaderSize);
+	arena->rcDec();
+}
+
+uint32_t ItemIndexPrivateArenaVector::at(uint32_t pos) const {
+	if (pos < m_size) {
+		return m_data[pos];
+	}
+	throw sserialize::OutOfBoundsException("ItemIndexPrivateArenaVector");
+	return 0;
+}
+
+uint32_t ItemIndexPrivateArenaVector::uncheckedAt(uint32_t pos) const {
+	return m_data[pos];
+}
+
+uint32_t ItemIndexPrivateArenaVector::first() const {
+	if (!m_size)
+		return 0;
+	return m_data[0];
+}
+
+uint32_t ItemIndexPrivateArenaVector::last() const {
+	if (!m_size)
+		return 0;
+	return m_data[m_size-1];
+}
+
+uint32_t ItemIndexPrivateArenaVector::find(uint32_t id) const {
+	const uint32_t * it = std::lower_bound(m_data, m_data+m_size, id);
+	if (it != m_data+m_size && *it == id) {
+		return (uint32_t)(it - m_data);
+	}
+	return npos;
+}
+
+uint32_t ItemIndexPrivateArenaVector::size() const {
+	return m_size;
+}
+
+sserialize::UByteArrayAdapter::SizeType ItemIndexPrivateArenaVector::getSizeInBytes() const {
+	return m_size*4;
+}
+
+uint8_t ItemIndexPrivateArenaVector::bpn() const {
+	return 32;
+}
+
+void ItemIndexPrivateArenaVector::putInto(DynamicBitSet & bitSet) const {
+	for(uint32_t i(0); i < m_size; ++i) {
+		bitSet.set(m_data[i]);
+	}
+}
+
+void ItemIndexPrivateArenaVector::putInto(uint32_t * dest) const {
+	if (m_size) {
+		::memcpy(dest, m_data, sizeof(uint32_t)*m_size);
+	}
+}
+
+}//end namespace
@@ -195,7 +195,7 @@ ItemIndexPrivate * ItemIndexPrivateSimple::fromBitSet(const DynamicBitSet & bitS
 	sserialize::UByteArrayAdapter::SizeType myDataSize = bitSetData.size()-1;
 	
 	//first find the first an last occurence of a bit
-	while (! bitSetData.at(dataOffset) && dataOffset <= myDataSize)
+	while (dataOffset <= myDataSize && ! bitSetData.at(dataOffset))
 		++dataOffset;
 	if (dataOffset > myDataSize)
 		return new ItemIndexPrivateEmpty();
@@ -0,0 +1,31 @@
+#include <sserialize/containers/ItemIndexSummary.h>
+#include <algorithm>
+
+namespace sserialize {
+
+bool ItemIndexSummary::disjoint(const ItemIndexSummary & other) const {
+	return empty() || other.empty() || m_last < other.m_first || other.m_last < m_first || !(m_signature & other.m_signature);
+}
+
+uint32_t ItemIndexSummary::estimateIntersectionSize(uint32_t mySize, const ItemIndexSummary & other, uint32_t otherSize) const {
+	if (disjoint(other)) {
+		return 0;
+	}
+	uint32_t overlapBegin = std::max(m_first, other.m_first);
+	uint32_t overlapEnd = std::min(m_last, other.m_last);
+	double overlap = double(overlapEnd - overlapBegin) + 1;
+	double myFraction = overlap / (double(m_last - m_first) + 1);
+	double otherFraction = overlap / (double(other.m_last - other.m_first) + 1);
+	double estimate = std::min(mySize*myFraction, otherSize*otherFraction);
+	return std::min<uint32_t>(uint32_t(estimate), std::min(mySize, otherSize));
+}
+
+bool ItemIndexSummary::operator==(const ItemIndexSummary & other) const {
+	return (empty() && other.empty()) || (m_first == other.m_first && m_last == other.m_last && m_signature == other.m_signature);
+}
+
+bool ItemIndexSummary::operator!=(const ItemIndexSummary & other) const {
+	return !operator==(other);
+}
+
+}//end namespace
@@ -131,14 +131,20 @@ void KeyValueObjectStore::sort() {
 	}
 }
 
-UByteArrayAdapter::OffsetType KeyValueObjectStore::serialize(sserialize::UByteArrayAdapter & dest) const {
+UByteArrayAdapter::OffsetType KeyValueObjectStore::serialize(sserialize::UByteArrayAdapter & dest, bool frontCoded) const {
 	UByteArrayAdapter::OffsetType dataBegin = dest.tellPutPtr();
 	dest.putUint8(0); //Version
 	sserialize::TimeMeasurer tm;
 	tm.begin();
 	std::cout << "KeyValueObjectStore::serialize: Serializing string tables..." << std::flush;
-	m_keyStringTable.serialize(dest);
-	m_valueStringTable.serialize(dest);
+	if (frontCoded) {
+		m_keyStringTable.serializeFrontCoded(dest);
+		m_valueStringTable.serializeFrontCoded(dest);
+	}
+	else {
+		m_keyStringTable.serialize(dest);
+		m_valueStringTable.serialize(dest);
+	}
 	tm.end();
 	std::cout << "took " << tm.elapsedSeconds() << " seconds" << std::endl;
 
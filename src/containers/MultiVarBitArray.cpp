@@ -2,6 +2,7 @@
 #include <numeric>
 #include <sserialize/containers/CompactUintArray.h>
 #include <sserialize/algorithm/utilmath.h>
+#include <sserialize/utility/Bitpacking.h>
 
 namespace sserialize {
 
@@ -99,6 +100,47 @@ MultiVarBitArrayPrivate::at(SizeType pos, uint32_t subPos) const {
 	
 }
 
+void MultiVarBitArrayPrivate::getRange(SizeType pos, SizeType count, uint32_t subPos, value_type * dest) const {
+	if (pos > m_size || count > m_size-pos || subPos >= bitConfigCount()) {
+		throw sserialize::OutOfBoundsException("MultiVarBitArrayPrivate::getRange: pos=" + std::to_string(pos) + ", count=" + std::to_string(count) + ", subPos=" + std::to_string(subPos) + " and size=" + std::to_string(m_size));
+	}
+	if (!count) {
+		return;
+	}
+	uint64_t stride = bitsPerEntry();
+	uint64_t bitBegin = stride*pos + (subPos > 0 ? m_bitSums[subPos-1] : 0);
+	uint64_t bitEnd = stride*(pos+count);
+	UByteArrayAdapter::OffsetType byteBegin = bitBegin/8;
+	UByteArrayAdapter::OffsetType byteEnd = (bitEnd+7)/8;
+	const UByteArrayAdapter::MemoryView mem( m_data.getMemView(byteBegin, byteEnd-byteBegin) );
+	sserialize::unpack_lsb(bitCount(subPos), mem.data(), mem.data()+mem.size(), bitBegin-byteBegin*8, stride, dest, count);
+}
+
+void MultiVarBitArrayPrivate::getRows(SizeType pos, SizeType count, value_type * dest) const {
+	if (pos > m_size || count > m_size-pos) {
+		throw sserialize::OutOfBoundsException("MultiVarBitArrayPrivate::getRows: pos=" + std::to_string(pos) + ", count=" + std::to_string(count) + " and size=" + std::to_string(m_size));
+	}
+	if (!count) {
+		return;
+	}
+	uint32_t fieldCount = bitConfigCount();
+	uint64_t stride = bitsPerEntry();
+	uint64_t bitBegin = stride*pos;
+	uint64_t bitEnd = stride*(pos+count);
+	UByteArrayAdapter::OffsetType byteBegin = bitBegin/8;
+	UByteArrayAdapter::OffsetType byteEnd = (bitEnd+7)/8;
+	const UByteArrayAdapter::MemoryView mem( m_data.getMemView(byteBegin, byteEnd-byteBegin) );
+	//decode column by column, this keeps the unpacker specialized for the bits of the field
+	std::vector<value_type> column(count);
+	for(uint32_t field(0); field < fieldCount; ++field) {
+		uint64_t fieldBegin = bitBegin-byteBegin*8 + (field > 0 ? m_bitSums[field-1] : 0);
+		sserialize::unpack_lsb(bitCount(field), mem.data(), mem.data()+mem.size(), fieldBegin, stride, column.data(), count);
+		for(SizeType i(0); i < count; ++i) {
+			dest[i*fieldCount+field] = column[i];
+		}
+	}
+}
+
 MultiVarBitArrayPrivate::value_type
 MultiVarBitArrayPrivate::set(SizeType pos, uint32_t subPos, value_type value) {
 	if (pos >= m_size) {
@@ -188,6 +230,14 @@ MultiVarBitArray::at(SizeType pos, uint32_t subPos) const {
 	return priv()->at(pos, subPos);
 }
 
+void MultiVarBitArray::getRange(SizeType pos, SizeType count, uint32_t subPos, value_type * dest) const {
+	priv()->getRange(pos, count, subPos, dest);
+}
+
+void MultiVarBitArray::getRows(SizeType pos, SizeType count, value_type * dest) const {
+	priv()->getRows(pos, count, dest);
+}
+
 MultiVarBitArray::value_type
 MultiVarBitArray::set(SizeType pos, uint32_t subPos, value_type value) {
 	return priv()->set(pos, subPos, value);
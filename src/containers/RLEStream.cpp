@@ -59,29 +59,60 @@ RLEStream::RLEStream(const UByteArrayAdapter& begin) :
 m_d(begin),
 m_curRleCount(0),
 m_curRleDiff(0),
-m_curId(0)
+m_curId(0),
+m_cpInterval(0)
 {
 	operator++();
 }
 
+RLEStream::RLEStream(const UByteArrayAdapter & d, CheckpointsTag) :
+m_curRleCount(0),
+m_curRleDiff(0),
+m_curId(0),
+m_cpInterval(0)
+{
+	UByteArrayAdapter::OffsetType offset = 0;
+	int len = 0;
+	uint32_t interval = d.getVlPackedUint32(offset, &len);
+	if (len < 0 || !interval) {
+		throw sserialize::CorruptDataException("RLEStream: invalid checkpoint interval");
+	}
+	offset += len;
+	uint32_t cpCount = d.getVlPackedUint32(offset, &len);
+	if (len < 0) {
+		throw sserialize::CorruptDataException("RLEStream: invalid checkpoint count");
+	}
+	offset += len;
+	m_cp = UByteArrayAdapter(d, offset, UByteArrayAdapter::OffsetType(cpCount)*CheckpointEntrySize);
+	m_d = UByteArrayAdapter(d, offset + m_cp.size());
+	m_d.resetPtrs();
+	m_cpInterval = interval;
+	operator++();
+}
+
 RLEStream::RLEStream() :
 m_curRleCount(0),
 m_curRleDiff(0),
-m_curId(0)
+m_curId(0),
+m_cpInterval(0)
 {}
 
 RLEStream::RLEStream(const RLEStream& other) :
 m_d(other.m_d),
 m_curRleCount(other.m_curRleCount),
 m_curRleDiff(other.m_curRleDiff),
-m_curId(other.m_curId)
+m_curId(other.m_curId),
+m_cp(other.m_cp),
+m_cpInterval(other.m_cpInterval)
 {}
 
 RLEStream::RLEStream(RLEStream&& other) :
 m_d(std::move(other.m_d)),
 m_curRleCount(other.m_curRleCount),
 m_curRleDiff(other.m_curRleDiff),
-m_curId(other.m_curId)
+m_curId(other.m_curId),
+m_cp(std::move(other.m_cp)),
+m_cpInterval(other.m_cpInterval)
 {}
 
 RLEStream& RLEStream::operator=(const RLEStream& other) {
@@ -89,6 +120,8 @@ RLEStream& RLEStream::operator=(const RLEStream& other) {
 	m_curRleCount = other.m_curRleCount;
 	m_curRleDiff = other.m_curRleDiff;
 	m_curId = other.m_curId;
+	m_cp = other.m_cp;
+	m_cpInterval = other.m_cpInterval;
 	return *this;
 }
 
@@ -97,6 +130,32 @@ RLEStream& RLEStream::operator=(RLEStream&& other) {
 	m_curRleCount = other.m_curRleCount;
 	m_curRleDiff = other.m_curRleDiff;
 	m_curId = other.m_curId;
+	m_cp = std::move(other.m_cp);
+	m_cpInterval = other.m_cpInterval;
+	return *this;
+}
+
+void RLEStream::reset(uint32_t value) {
+	m_curRleCount = 0;
+	m_curRleDiff = 0;
+	m_curId = value;
+}
+
+RLEStream & RLEStream::seek(uint32_t pos) {
+	uint32_t cpCount = narrow_check<uint32_t>(m_cp.size()/CheckpointEntrySize);
+	if (cpCount) {
+		uint32_t cp = std::min<uint32_t>(pos/m_cpInterval, cpCount-1);
+		m_d.setGetPtr(m_cp.getUint32(cp*CheckpointEntrySize));
+		reset(m_cp.getUint32(cp*CheckpointEntrySize+4));
+		pos -= cp*m_cpInterval;
+	}
+	else {
+		m_d.resetGetPtr();
+		reset(0);
+	}
+	for(operator++(); pos; --pos) {
+		operator++();
+	}
 	return *this;
 }
 
@@ -7,7 +7,9 @@ namespace Static {
 SortedOffsetIndex::SortedOffsetIndex() : MyParentClass(new SortedOffsetIndexPrivateEmpty()) {}
 
 SortedOffsetIndex::SortedOffsetIndex(const UByteArrayAdapter & data) :
-MyParentClass(new SortedOffsetIndexPrivate(data))
+MyParentClass(SortedOffsetIndexPrivate::isEliasFano(data) ?
+	static_cast<SortedOffsetIndexPrivate*>(new SortedOffsetIndexPrivateEliasFano(data)) :
+	new SortedOffsetIndexPrivate(data))
 {}
 
 SortedOffsetIndex::SortedOffsetIndex(UByteArrayAdapter & data, UByteArrayAdapter::ConsumeTag) :
@@ -42,4 +44,8 @@ UByteArrayAdapter::OffsetType SortedOffsetIndex::at(SizeType pos) const {
 	return priv()->at(pos);
 }
 
+SortedOffsetIndex::Types SortedOffsetIndex::type() const {
+	return priv()->type();
+}
+
 }}//end namespace
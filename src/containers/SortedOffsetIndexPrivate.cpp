@@ -2,6 +2,7 @@
 #include <sserialize/utility/exceptions.h>
 #include <sserialize/utility/log.h>
 #include <sserialize/storage/pack_unpack_functions.h>
+#include <sserialize/algorithm/utilmath.h>
 
 namespace sserialize {
 namespace Static {
@@ -149,6 +150,122 @@ UByteArrayAdapter::OffsetType SortedOffsetIndexPrivate::at(sserialize::SizeType
 	}
 }
 
+SortedOffsetIndexPrivate::Types SortedOffsetIndexPrivate::type() const {
+	return SortedOffsetIndex::T_REGLINE;
+}
+
+bool SortedOffsetIndexPrivate::isEliasFano(const UByteArrayAdapter & data) {
+	if (!data.size()) {
+		return false;
+	}
+	int len = 0;
+	uint64_t header = data.getVlPackedUint64(0, &len);
+	return len > 0 && header == SortedOffsetIndex::T_ELIAS_FANO;
+}
+
+UByteArrayAdapter::OffsetType SortedOffsetIndexPrivate::eliasFanoStorageSize(SizeType count, uint64_t maxValue) {
+	uint8_t lowBits = SortedOffsetIndexPrivateEliasFano::lowBits(count, maxValue);
+	uint64_t upperBitCount = (maxValue >> lowBits) + count;
+	uint64_t upperWordCount = upperBitCount/64 + 1;
+	SizeType sampleCount = (count+SelectSampleRate-1)/SelectSampleRate;
+	UByteArrayAdapter::OffsetType size = psize_vu64(SortedOffsetIndex::T_ELIAS_FANO) + psize_vu64(count) + 2 + psize_vu64(upperWordCount);
+	if (lowBits) {
+		size += CompactUintArray::minStorageBytes(lowBits, count);
+	}
+	size += CompactUintArray::minStorageBytes(CompactUintArray::minStorageBits(upperBitCount), sampleCount);
+	size += upperWordCount*SerializationInfo<uint64_t>::length;
+	return size;
+}
+
+SortedOffsetIndexPrivateEliasFano::SortedOffsetIndexPrivateEliasFano(const UByteArrayAdapter & d) :
+m_size(0),
+m_lowBits(0),
+m_headerSize(0),
+m_sampleCount(0)
+{
+	if (!isEliasFano(d)) {
+		throw sserialize::TypeMissMatchException("sserialize::SortedOffsetIndexPrivateEliasFano: data is not Elias-Fano encoded");
+	}
+	UByteArrayAdapter data(d);
+	data.resetGetPtr();
+	data.getVlPackedUint64();
+	m_size = narrow_check<SizeType>(data.getVlPackedUint64());
+	m_lowBits = data.getUint8();
+	uint8_t sampleBits = data.getUint8();
+	uint64_t upperWordCount = data.getVlPackedUint64();
+	m_headerSize = data.tellGetPtr();
+	if (m_size < 2 || m_lowBits > 63 || !sampleBits || sampleBits > 64) {
+		throw sserialize::CorruptDataException("sserialize::SortedOffsetIndexPrivateEliasFano: invalid header");
+	}
+	data.shrinkToGetPtr();
+	if (m_lowBits) {
+		m_lows = CompactUintArray(data, m_lowBits);
+		data += CompactUintArray::minStorageBytes(m_lowBits, m_size);
+	}
+	m_sampleCount = (m_size+SelectSampleRate-1)/SelectSampleRate;
+	m_samples = CompactUintArray(data, sampleBits);
+	data += CompactUintArray::minStorageBytes(sampleBits, m_sampleCount);
+	if (data.size() < upperWordCount*SerializationInfo<uint64_t>::length) {
+		throw sserialize::CorruptDataException("sserialize::SortedOffsetIndexPrivateEliasFano: not enough data for the upper bits");
+	}
+	m_upper = UByteArrayAdapter(data, 0, upperWordCount*SerializationInfo<uint64_t>::length);
+}
+
+SortedOffsetIndexPrivateEliasFano::~SortedOffsetIndexPrivateEliasFano() {}
+
+UByteArrayAdapter::OffsetType SortedOffsetIndexPrivateEliasFano::getSizeInBytes() const {
+	UByteArrayAdapter::OffsetType size = m_headerSize;
+	if (m_lowBits) {
+		size += CompactUintArray::minStorageBytes(m_lowBits, m_size);
+	}
+	size += CompactUintArray::minStorageBytes(m_samples.bpn(), m_sampleCount);
+	size += m_upper.size();
+	return size;
+}
+
+SortedOffsetIndexPrivate::SizeType SortedOffsetIndexPrivateEliasFano::size() const {
+	return m_size;
+}
+
+SortedOffsetIndexPrivate::Types SortedOffsetIndexPrivateEliasFano::type() const {
+	return SortedOffsetIndex::T_ELIAS_FANO;
+}
+
+uint8_t SortedOffsetIndexPrivateEliasFano::lowBits(SizeType count, uint64_t maxValue) {
+	uint64_t avgGap = maxValue/count;
+	if (!avgGap) {
+		return 0;
+	}
+	return uint8_t(CompactUintArray::minStorageBits(avgGap)-1);
+}
+
+uint64_t SortedOffsetIndexPrivateEliasFano::select1(SizeType pos) const {
+	uint64_t bit = m_samples.at64(pos/SelectSampleRate);
+	uint32_t remaining = pos % SelectSampleRate;
+	uint64_t wordPos = bit/64;
+	uint64_t word = m_upper.getUint64(wordPos*SerializationInfo<uint64_t>::length) & (~static_cast<uint64_t>(0) << (bit%64));
+	for(uint32_t c = popCount<uint64_t>(word); remaining >= c; c = popCount<uint64_t>(word)) {
+		remaining -= c;
+		++wordPos;
+		word = m_upper.getUint64(wordPos*SerializationInfo<uint64_t>::length);
+	}
+	for(; remaining; --remaining) {
+		word &= word-1;
+	}
+	return wordPos*64 + __builtin_ctzll(word);
+}
+
+UByteArrayAdapter::OffsetType SortedOffsetIndexPrivateEliasFano::at(SizeType pos) const {
+	if (pos >= m_size) {
+		throw OutOfBoundsException(pos, m_size);
+	}
+	uint64_t high = select1(pos) - pos;
+	if (m_lowBits) {
+		return (high << m_lowBits) | m_lows.at64(pos);
+	}
+	return high;
+}
+
 SortedOffsetIndexPrivateEmpty::SortedOffsetIndexPrivateEmpty() : SortedOffsetIndexPrivate() {}
 SortedOffsetIndexPrivateEmpty::~SortedOffsetIndexPrivateEmpty() {}
 UByteArrayAdapter::OffsetType SortedOffsetIndexPrivateEmpty::getSizeInBytes() const {
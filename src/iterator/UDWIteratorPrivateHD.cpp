@@ -2,16 +2,29 @@
 
 namespace sserialize {
 
-UDWIteratorPrivateHD::UDWIteratorPrivateHD() {}
+UDWIteratorPrivateHD::UDWIteratorPrivateHD() :
+m_bufferPos(0),
+m_bufferSize(0)
+{}
 
 UDWIteratorPrivateHD::UDWIteratorPrivateHD(const sserialize::MultiBitIterator & bitIterator, const RCPtrWrapper< sserialize::Static::HuffmanDecoder >& decoder) :
 m_bitIterator(bitIterator),
-m_decoder(decoder)
+m_decoder(decoder),
+m_bufferPos(0),
+m_bufferSize(0)
 {}
 
 UDWIteratorPrivateHD::~UDWIteratorPrivateHD() {}
 
 uint32_t UDWIteratorPrivateHD::next() {
+	if (m_bufferPos == m_bufferSize) {
+		m_bufferPos = 0;
+		m_bufferSize = m_decoder->decode(m_bitIterator, m_buffer.data(), BufferSize);
+	}
+	if (m_bufferPos < m_bufferSize) {
+		return m_buffer[m_bufferPos++];
+	}
+	//no complete code left, decode the padding as before
 	uint32_t v = m_bitIterator.get32();
 	int len = m_decoder->decode(v, v);
 	if (len > 0) {
@@ -21,15 +34,17 @@ uint32_t UDWIteratorPrivateHD::next() {
 }
 
 bool UDWIteratorPrivateHD::hasNext() {
-	return m_bitIterator.hasNext();
+	return m_bufferPos < m_bufferSize || m_bitIterator.hasNext();
 }
 
 void UDWIteratorPrivateHD::reset() {
 	m_bitIterator.reset();
+	m_bufferPos = 0;
+	m_bufferSize = 0;
 }
 
 UDWIteratorPrivate * UDWIteratorPrivateHD::copy() const {
-	return new UDWIteratorPrivateHD(m_bitIterator, m_decoder);
+	return new UDWIteratorPrivateHD(*this);
 }
 
 UByteArrayAdapter::OffsetType UDWIteratorPrivateHD::dataSize() const {
@@ -0,0 +1,296 @@
+#include <sserialize/search/CellTextCompleterDelta.h>
+#include <sserialize/strings/LevenshteinAutomaton.h>
+#include <sserialize/utility/exceptions.h>
+#include <sserialize/vendor/utf8.h>
+#include <algorithm>
+
+namespace sserialize {
+namespace {
+
+template<typename T>
+void sortUnique(std::vector<T> & v) {
+	std::sort(v.begin(), v.end());
+	v.erase(std::unique(v.begin(), v.end()), v.end());
+}
+
+void putStrings(UByteArrayAdapter & dest, const std::vector<std::string> & strs) {
+	dest.putVlPackedUint32((uint32_t) strs.size());
+	for(const std::string & x : strs) {
+		dest.putString(x);
+	}
+}
+
+void putCells(UByteArrayAdapter & dest, const std::vector<uint32_t> & cells) {
+	dest.putVlPackedUint32((uint32_t) cells.size());
+	for(uint32_t x : cells) {
+		dest.putVlPackedUint32(x);
+	}
+}
+
+void getStrings(UByteArrayAdapter & src, std::vector<std::string> & strs) {
+	strs.resize(src.getVlPackedUint32());
+	for(std::string & x : strs) {
+		x = src.getString();
+	}
+}
+
+void getCells(UByteArrayAdapter & src, std::vector<uint32_t> & cells) {
+	cells.resize(src.getVlPackedUint32());
+	for(uint32_t & x : cells) {
+		x = src.getVlPackedUint32();
+	}
+}
+
+template<typename T_STRING_INDEX, typename T_FUNC>
+void exactMatches(const T_STRING_INDEX & index, const std::string & qstr, T_FUNC fn) {
+	for(auto it(index.lower_bound(typename T_STRING_INDEX::value_type(qstr, 0))), end(index.end()); it != end && it->first == qstr; ++it) {
+		fn(it->second);
+	}
+}
+
+template<typename T_STRING_INDEX, typename T_FUNC>
+void prefixMatches(const T_STRING_INDEX & index, const std::string & qstr, T_FUNC fn) {
+	for(auto it(index.lower_bound(typename T_STRING_INDEX::value_type(qstr, 0))), end(index.end()); it != end && it->first.compare(0, qstr.size(), qstr) == 0; ++it) {
+		fn(it->second);
+	}
+}
+
+///Intersects @param la with the sorted strings of @param index, the states of the common prefix of consecutive strings are reused
+template<typename T_STRING_INDEX, typename T_FUNC>
+void fuzzyMatches(const T_STRING_INDEX & index, const LevenshteinAutomaton & la, bool prefixMatch, T_FUNC fn) {
+	//states[i] is the state after the first i code points of the current string, the first stateCount are valid
+	std::vector<LevenshteinAutomaton::State> states(1, la.start());
+	//accepted[i] is true if the first i code points are accepted as prefix
+	std::vector<uint8_t> accepted(1, prefixMatch && la.isMatch(states.front()));
+	std::size_t stateCount = 1;
+	std::vector<uint32_t> prev, cps;
+	for(const auto & x : index) {
+		cps.clear();
+		utf8::utf8to32(x.first.cbegin(), x.first.cend(), std::back_inserter(cps));
+		std::size_t lcp = std::mismatch(prev.cbegin(), prev.cend(), cps.cbegin(), cps.cend()).first - prev.cbegin();
+		stateCount = std::min(stateCount, lcp+1);
+		//stepping stops at the first accepted prefix or as soon as no extension can match
+		while (stateCount <= cps.size() && !accepted[stateCount-1] && la.canMatch(states[stateCount-1])) {
+			if (states.size() == stateCount) {
+				states.emplace_back();
+				accepted.emplace_back();
+			}
+			la.step(states[stateCount-1], cps[stateCount-1], states[stateCount]);
+			accepted[stateCount] = prefixMatch && la.isMatch(states[stateCount]);
+			++stateCount;
+		}
+		if (accepted[stateCount-1] || (stateCount == cps.size()+1 && la.isMatch(states[stateCount-1]))) {
+			fn(x.second);
+		}
+		prev.swap(cps);
+	}
+}
+
+}//end anonymous namespace
+
+CellTextCompleterDelta::CellTextCompleterDelta() {}
+
+CellTextCompleterDelta::CellTextCompleterDelta(const UByteArrayAdapter & d) {
+	UByteArrayAdapter tmp(d);
+	tmp.resetGetPtr();
+	uint8_t version = tmp.getUint8();
+	SSERIALIZE_VERSION_MISSMATCH_CHECK(SSERIALIZE_CELL_TEXT_COMPLETER_DELTA_VERSION, version, "sserialize::CellTextCompleterDelta");
+	uint32_t itemCount = tmp.getVlPackedUint32();
+	for(uint32_t i(0); i < itemCount; ++i) {
+		itemid_type itemId = tmp.getVlPackedUint32();
+		Item & item = m_items[itemId];
+		getCells(tmp, item.baseCells);
+		getCells(tmp, item.cells);
+		getStrings(tmp, item.exactStrings);
+		getStrings(tmp, item.suffixStrings);
+		addToIndex(itemId, item);
+	}
+}
+
+CellTextCompleterDelta::~CellTextCompleterDelta() {}
+
+std::vector<CellTextCompleterDelta::itemid_type> CellTextCompleterDelta::touchedItems() const {
+	std::vector<itemid_type> ret;
+	ret.reserve(m_items.size());
+	for(const auto & x : m_items) {
+		ret.push_back(x.first);
+	}
+	return ret;
+}
+
+void CellTextCompleterDelta::insert(itemid_type itemId, std::vector<cellid_type> cells, std::vector<std::string> exactStrings, std::vector<std::string> suffixStrings) {
+	update(itemId, std::vector<cellid_type>(), std::move(cells), std::move(exactStrings), std::move(suffixStrings));
+}
+
+void CellTextCompleterDelta::update(itemid_type itemId, std::vector<cellid_type> baseCells, std::vector<cellid_type> cells, std::vector<std::string> exactStrings, std::vector<std::string> suffixStrings) {
+	Item & item = m_items[itemId];
+	removeFromIndex(itemId, item);
+	item.baseCells = std::move(baseCells);
+	item.cells = std::move(cells);
+	item.exactStrings = std::move(exactStrings);
+	item.suffixStrings = std::move(suffixStrings);
+	sortUnique(item.baseCells);
+	sortUnique(item.cells);
+	addToIndex(itemId, item);
+}
+
+void CellTextCompleterDelta::remove(itemid_type itemId, std::vector<cellid_type> baseCells) {
+	update(itemId, std::move(baseCells), std::vector<cellid_type>(), std::vector<std::string>(), std::vector<std::string>());
+}
+
+void CellTextCompleterDelta::merge(const CellTextCompleterDelta & newer) {
+	for(const auto & x : newer.m_items) {
+		auto it = m_items.find(x.first);
+		std::vector<cellid_type> baseCells(it == m_items.end() ? x.second.baseCells : it->second.baseCells);
+		update(x.first, std::move(baseCells), x.second.cells, x.second.exactStrings, x.second.suffixStrings);
+	}
+}
+
+void CellTextCompleterDelta::addToIndex(itemid_type itemId, const Item & item) {
+	for(cellid_type cellId : item.baseCells) {
+		m_baseCells[cellId] += 1;
+	}
+	if (item.removed()) {
+		return;
+	}
+	for(const std::string & x : item.exactStrings) {
+		m_exactStrings.emplace(x, itemId);
+	}
+	for(const std::string & x : item.suffixStrings) {
+		for(std::string::const_iterator it(x.cbegin()), end(x.cend()); it != end; utf8::next(it, end)) {
+			m_suffixes.emplace(std::string(it, end), itemId);
+		}
+	}
+}
+
+void CellTextCompleterDelta::removeFromIndex(itemid_type itemId, const Item & item) {
+	for(cellid_type cellId : item.baseCells) {
+		auto it = m_baseCells.find(cellId);
+		if (--(it->second) == 0) {
+			m_baseCells.erase(it);
+		}
+	}
+	if (item.removed()) {
+		return;
+	}
+	for(const std::string & x : item.exactStrings) {
+		m_exactStrings.erase(StringIndex::value_type(x, itemId));
+	}
+	for(const std::string & x : item.suffixStrings) {
+		for(std::string::const_iterator it(x.cbegin()), end(x.cend()); it != end; utf8::next(it, end)) {
+			m_suffixes.erase(StringIndex::value_type(std::string(it, end), itemId));
+		}
+	}
+}
+
+void CellTextCompleterDelta::matchingItems(const std::string & qstr, sserialize::StringCompleter::QuerryType qt, std::vector<itemid_type> & dest) const {
+	using SC = sserialize::StringCompleter;
+	auto push = [&dest](itemid_type itemId) { dest.push_back(itemId); };
+	if (qt & SC::QT_FUZZY) {
+		sserialize::LevenshteinAutomaton la(qstr, sserialize::LevenshteinAutomaton::defaultMaxDistance(qstr));
+		if (qt & (SC::QT_EXACT | SC::QT_PREFIX | SC::QT_SUBSTRING)) {
+			fuzzyMatches(m_exactStrings, la, qt & (SC::QT_PREFIX | SC::QT_SUBSTRING), push);
+		}
+		if (qt & (SC::QT_SUFFIX | SC::QT_SUBSTRING)) {
+			fuzzyMatches(m_suffixes, la, qt & SC::QT_SUBSTRING, push);
+		}
+		return;
+	}
+	//case sensitivity is handled by the caller, strings and query are already normalized
+	if (qt & (SC::QT_PREFIX | SC::QT_SUBSTRING)) {
+		//prefixes of exact strings are part of the substring search as well
+		prefixMatches(m_exactStrings, qstr, push);
+	}
+	else if (qt & SC::QT_EXACT) {
+		exactMatches(m_exactStrings, qstr, push);
+	}
+	//a string contains qstr if one of its suffixes starts with it
+	if (qt & SC::QT_SUBSTRING) {
+		prefixMatches(m_suffixes, qstr, push);
+	}
+	else if (qt & SC::QT_SUFFIX) {
+		exactMatches(m_suffixes, qstr, push);
+	}
+}
+
+sserialize::CellQueryResult
+CellTextCompleterDelta::apply(const sserialize::CellQueryResult & base, const std::string & qstr, sserialize::StringCompleter::QuerryType qt) const {
+	if (!m_items.size() || (base.flags() & sserialize::CellQueryResult::FF_EMPTY)) {
+		return base;
+	}
+	//cells whose items are affected by the delta and the new matching items of each cell
+	std::vector<cellid_type> dirtyCells;
+	std::vector< std::pair<cellid_type, itemid_type> > added;
+	std::vector<itemid_type> matched;
+	matchingItems(qstr, qt, matched);
+	sortUnique(matched);
+	dirtyCells.reserve(m_baseCells.size());
+	for(const auto & x : m_baseCells) {
+		dirtyCells.push_back(x.first);
+	}
+	for(itemid_type itemId : matched) {
+		for(cellid_type cellId : m_items.at(itemId).cells) {
+			dirtyCells.push_back(cellId);
+			added.emplace_back(cellId, itemId);
+		}
+	}
+	if (!dirtyCells.size()) {
+		return base;
+	}
+	sortUnique(dirtyCells);
+	std::sort(added.begin(), added.end());
+
+	int flags = (base.flags() & ~sserialize::CellQueryResult::FF_MASK_CELL_ITEM_IDS) | sserialize::CellQueryResult::FF_CELL_GLOBAL_ITEM_IDS;
+	sserialize::CellQueryResult globalBase = base.convert(sserialize::CellQueryResult::FF_CELL_GLOBAL_ITEM_IDS);
+	sserialize::CellQueryResult dirty(sserialize::ItemIndex(dirtyCells), base.cellInfo(), base.idxStore(), flags);
+	sserialize::CellQueryResult baseDirty = globalBase / dirty;
+
+	std::vector<cellid_type> patchedCells;
+	std::vector<sserialize::ItemIndex> patchedIdx;
+	auto bIt = baseDirty.begin(), bEnd = baseDirty.end();
+	auto aIt = added.cbegin(), aEnd = added.cend();
+	std::vector<itemid_type> items;
+	for(cellid_type cellId : dirtyCells) {
+		items.clear();
+		if (bIt != bEnd && bIt.cellId() == cellId) {
+			sserialize::ItemIndex idx(bIt.items());
+			for(uint32_t i(0), s(idx.size()); i < s; ++i) {
+				itemid_type itemId = idx.at(i);
+				if (!m_items.count(itemId)) {
+					items.push_back(itemId);
+				}
+			}
+			++bIt;
+		}
+		for(; aIt != aEnd && aIt->first == cellId; ++aIt) {
+			items.push_back(aIt->second);
+		}
+		if (items.size()) {
+			sortUnique(items);
+			patchedCells.push_back(cellId);
+			patchedIdx.emplace_back(items);
+		}
+	}
+	sserialize::CellQueryResult patched(
+		sserialize::ItemIndex(),
+		sserialize::ItemIndex(patchedCells),
+		patchedIdx.cbegin(),
+		base.cellInfo(), base.idxStore(), flags
+	);
+	return ((globalBase - dirty) + patched).convert(base.flags());
+}
+
+UByteArrayAdapter & operator<<(UByteArrayAdapter & dest, const CellTextCompleterDelta & src) {
+	dest.putUint8(SSERIALIZE_CELL_TEXT_COMPLETER_DELTA_VERSION);
+	dest.putVlPackedUint32((uint32_t) src.size());
+	for(const auto & x : src.items()) {
+		dest.putVlPackedUint32(x.first);
+		putCells(dest, x.second.baseCells);
+		putCells(dest, x.second.cells);
+		putStrings(dest, x.second.exactStrings);
+		putStrings(dest, x.second.suffixStrings);
+	}
+	return dest;
+}
+
+}//end namespace
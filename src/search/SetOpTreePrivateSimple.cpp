@@ -143,8 +143,10 @@ ItemIndexIterator SetOpTreePrivateSimple::asItemIndexIterator() {
 			else {
 				intersectIt = m_strCompleter.partialComplete(it->str(), (sserialize::StringCompleter::QuerryType) it->qt());
 			}
-			if (intersectIt.maxSize() > 0)
-				intersectIts.push_back(intersectIt);
+			//same as doSetOperations(): one empty intersect string empties the whole result
+			if (intersectIt.maxSize() == 0)
+				return ItemIndexIterator();
+			intersectIts.push_back(intersectIt);
 		}
 		
 		for(std::vector<QueryStringDescription>::iterator it = m_diffStrings.begin(); it != m_diffStrings.end(); ++it) {
@@ -164,10 +166,10 @@ ItemIndexIterator SetOpTreePrivateSimple::asItemIndexIterator() {
 		if (diffIts.size()) {
 			return 
 				ItemIndexIterator::createTree(intersectIts.begin(), intersectIts.end(), &sserialize::createIntersectItemIndexIterator) -
-				ItemIndexIterator::createTree(diffIts.begin(), diffIts.end(), &sserialize::createIntersectItemIndexIterator);
+				ItemIndexIterator::createTree(diffIts.begin(), diffIts.end(), &sserialize::createMergeItemIndexIterator);
 		}
 		else {
-			ItemIndexIterator::createTree(intersectIts.begin(), intersectIts.end(), &sserialize::createIntersectItemIndexIterator);
+			return ItemIndexIterator::createTree(intersectIts.begin(), intersectIts.end(), &sserialize::createIntersectItemIndexIterator);
 		}
 	}
 	return ItemIndexIterator();
@@ -172,6 +172,14 @@ int CellQueryResult::flags() const {
 	return m_priv->flags();
 }
 
+const RCPtrWrapper<ItemIndexArena> & CellQueryResult::arena() const {
+	return m_priv->arena();
+}
+
+void CellQueryResult::setArena(const RCPtrWrapper<ItemIndexArena> & arena) {
+	m_priv->setArena(arena);
+}
+
 uint32_t CellQueryResult::cellCount() const {
 	return m_priv->cellCount();
 }
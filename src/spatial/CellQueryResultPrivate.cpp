@@ -146,6 +146,19 @@ void CellQueryResult::uncheckedSet(uint32_t pos, sserialize::ItemIndex && idx) {
 	new(m_idx+pos) sserialize::ItemIndex(std::move(idx));
 }
 
+const RCPtrWrapper<ItemIndexArena> & CellQueryResult::resultArena(const CellQueryResult * other) const {
+	return (m_arena.priv() ? m_arena : other->m_arena);
+}
+
+bool CellQueryResult::disjointPartials(uint32_t myPos, const CellQueryResult & other, uint32_t otherPos) const {
+	const CellDesc & myCD = m_desc[myPos];
+	const CellDesc & oCD = other.m_desc[otherPos];
+	if (myCD.fullMatch || myCD.fetched || oCD.fullMatch || oCD.fetched) {
+		return false;
+	}
+	return m_idxStore.disjoint(m_idx[myPos].idxPtr, other.m_idx[otherPos].idxPtr);
+}
+
 bool CellQueryResult::flagCheck(int first, int second) { 
 	return ((first | second) == first) &&
 		((first & sserialize::CellQueryResult::FF_EMPTY) != sserialize::CellQueryResult::FF_EMPTY) &&
@@ -242,6 +255,7 @@ CellQueryResult * CellQueryResult::intersect(const CellQueryResult * oPtr) const
 	const CellQueryResult & o = *oPtr;
 	CellQueryResult * rPtr = new CellQueryResult(m_ci, m_idxStore, m_flags);
 	CellQueryResult & r = *rPtr;
+	r.m_arena = resultArena(oPtr);
 	r.m_desc.reserve(std::min<std::size_t>(m_desc.size(), o.m_desc.size()));
 	r.m_idx = (IndexDesc*) malloc(sizeof(IndexDesc) * std::min<std::size_t>(m_desc.size(), o.m_desc.size()));
 	
@@ -267,10 +281,13 @@ CellQueryResult * CellQueryResult::intersect(const CellQueryResult * oPtr) const
 					r.m_idx[r.m_desc.size()].idxPtr = m_idx[myI].idxPtr;
 					r.m_desc.push_back(myCD);
 				}
+				else if (disjointPartials(myI, o, oI)) {
+					//empty intersection, no need to decode the indexes
+				}
 				else {
 					const sserialize::ItemIndex & myPIdx = idx(myI);
 					const sserialize::ItemIndex & oPIdx = o.idx(oI);
-					sserialize::ItemIndex res(myPIdx / oPIdx);
+					sserialize::ItemIndex res(r.m_arena ? r.m_arena->intersect(myPIdx, oPIdx) : myPIdx / oPIdx);
 					if (res.size()) {
 						r.uncheckedSet((uint32_t)r.m_desc.size(), res);
 						r.m_desc.push_back(CellDesc(0, 1, myCellId));
@@ -322,6 +339,7 @@ CellQueryResult * CellQueryResult::unite(const CellQueryResult * other) const {
 	const CellQueryResult & o = *other;
 	CellQueryResult * rPtr = new CellQueryResult(m_ci, m_idxStore, m_flags);
 	CellQueryResult & r = *rPtr;
+	r.m_arena = resultArena(other);
 	r.m_desc.reserve(m_desc.size() + o.m_desc.size());
 	r.m_idx = (IndexDesc*) malloc(sizeof(IndexDesc) * (m_desc.size() + o.m_desc.size()));
 	
@@ -366,7 +384,7 @@ CellQueryResult * CellQueryResult::unite(const CellQueryResult * other) const {
 				else {
 					const sserialize::ItemIndex & myPIdx = idx(myI);
 					const sserialize::ItemIndex & oPIdx = o.idx(oI);
-					sserialize::ItemIndex res(myPIdx + oPIdx);
+					sserialize::ItemIndex res(r.m_arena ? r.m_arena->unite(myPIdx, oPIdx) : myPIdx + oPIdx);
 					if (res.size() == m_ci->cellItemsCount(myCellId)) {
 						r.m_idx[r.m_desc.size()].idxPtr = m_ci->cellItemsPtr(myCellId);
 						r.m_desc.push_back(CellDesc(1, 0, myCellId));
@@ -447,6 +465,7 @@ CellQueryResult * CellQueryResult::diff(const CellQueryResult * other) const {
 	const CellQueryResult & o = *other;
 	CellQueryResult * rPtr = new CellQueryResult(m_ci, m_idxStore, m_flags);
 	CellQueryResult & r = *rPtr;
+	r.m_arena = resultArena(other);
 	r.m_desc.reserve(m_desc.size());
 	r.m_idx = (IndexDesc*) malloc(sizeof(IndexDesc) * m_desc.size());
 	
@@ -471,10 +490,17 @@ CellQueryResult * CellQueryResult::diff(const CellQueryResult * other) const {
 			++oI;
 			continue;
 		}
-		if (!oCD.fullMatch && (myCD.fetched || oCD.fetched || m_idx[myI].idxPtr != o.m_idx[oI].idxPtr)) {
+		if (disjointPartials(myI, o, oI)) {
+			//nothing to remove
+			if (m_idxStore.idxSize(m_idx[myI].idxPtr)) {
+				r.m_idx[r.m_desc.size()].idxPtr = m_idx[myI].idxPtr;
+				r.m_desc.push_back(myCD);
+			}
+		}
+		else if (!oCD.fullMatch && (myCD.fetched || oCD.fetched || m_idx[myI].idxPtr != o.m_idx[oI].idxPtr)) {
 			const sserialize::ItemIndex & myPIdx = idx(myI);
 			const sserialize::ItemIndex & oPIdx = o.idx(oI);
-			sserialize::ItemIndex res(myPIdx - oPIdx);
+			sserialize::ItemIndex res(r.m_arena ? r.m_arena->difference(myPIdx, oPIdx) : myPIdx - oPIdx);
 			if (res.size()) {
 				r.uncheckedSet((uint32_t)r.m_desc.size(), res);
 				r.m_desc.push_back(CellDesc(0, 1, myCellId));
@@ -505,6 +531,7 @@ CellQueryResult * CellQueryResult::symDiff(const CellQueryResult * other) const
 	const CellQueryResult & o = *other;
 	CellQueryResult * rPtr = new CellQueryResult(m_ci, m_idxStore, m_flags);
 	CellQueryResult & r = *rPtr;
+	r.m_arena = resultArena(other);
 	r.m_desc.reserve(m_desc.size() + o.m_desc.size());
 	r.m_idx = (IndexDesc*) malloc(sizeof(IndexDesc) * (m_desc.size() + o.m_desc.size()));
 	
@@ -542,7 +569,7 @@ CellQueryResult * CellQueryResult::symDiff(const CellQueryResult * other) const
 		if (ct != 0x3 && (myCD.fetched || oCD.fetched || m_idx[myI].idxPtr != o.m_idx[oI].idxPtr)) {
 			const sserialize::ItemIndex & myPIdx = idx(myI);
 			const sserialize::ItemIndex & oPIdx = o.idx(oI);
-			sserialize::ItemIndex res(myPIdx ^ oPIdx);
+			sserialize::ItemIndex res(r.m_arena ? r.m_arena->symmetricDifference(myPIdx, oPIdx) : myPIdx ^ oPIdx);
 			if (res.size()) {
 				r.uncheckedSet((uint32_t)r.m_desc.size(), res);
 				r.m_desc.push_back(CellDesc(0, 1, myCellId));
@@ -583,6 +610,7 @@ CellQueryResult * CellQueryResult::symDiff(const CellQueryResult * other) const
 
 CellQueryResult * CellQueryResult::allToFull() const {
 	CellQueryResult * rPtr = new CellQueryResult(m_ci, m_idxStore, m_flags);
+	rPtr->m_arena = m_arena;
 	
 	uint32_t totalSize = cellCount();
 	rPtr->m_desc.reserve(totalSize);
@@ -598,6 +626,7 @@ CellQueryResult * CellQueryResult::allToFull() const {
 CellQueryResult * CellQueryResult::removeEmpty(uint32_t emptyCellCount) const {
 	detail::CellQueryResult * rPtr = new detail::CellQueryResult(m_ci, m_idxStore, m_flags);
 	detail::CellQueryResult & r = *rPtr;
+	r.m_arena = m_arena;
 	
 	if (emptyCellCount > cellCount()) {
 		emptyCellCount = 0;
@@ -1,7 +1,15 @@
 #include <sserialize/strings/DiacriticRemover.h>
+#include <sserialize/strings/unicode_folding_functions.h>
+#include <sserialize/strings/unicode_case_functions.h>
 #include <sserialize/utility/exceptions.h>
 
 namespace sserialize {
+namespace {
+
+///the table is created from a specific ICU version, other versions may transliterate differently
+const bool useFoldingTable = (unicode_fold_icu_version_major() == U_ICU_VERSION_MAJOR_NUM);
+
+}//end anonymous namespace
 
 DiacriticRemover::DiacriticRemover(const DiacriticRemover& other) {
 	m_transLiterator = other.m_transLiterator->clone();
@@ -17,6 +25,11 @@ UErrorCode DiacriticRemover::init() {
 }
 
 void DiacriticRemover::transliterate(std::string& str) const {
+	std::string ret;
+	if (useFoldingTable && unicode_fold(str, false, ret)) {
+		str.swap(ret);
+		return;
+	}
 	icu::UnicodeString ustr( icu::UnicodeString::fromUTF8(str));
 	m_transLiterator->transliterate(ustr);
 	str.clear();
@@ -25,13 +38,25 @@ void DiacriticRemover::transliterate(std::string& str) const {
 }
 
 std::string DiacriticRemover::operator()(const std::string& str) const {
+	std::string ret;
+	if (useFoldingTable && unicode_fold(str, false, ret)) {
+		return ret;
+	}
 	icu::UnicodeString ustr( icu::UnicodeString::fromUTF8(str) );
 	m_transLiterator->transliterate(ustr);
-	std::string ret;
+	ret.clear();
 	icu::StringByteSink<std::string> retStr(&ret);
 	ustr.toUTF8(retStr);
 	return ret;
 }
 
+std::string DiacriticRemover::fold(const std::string& str) const {
+	std::string ret;
+	if (useFoldingTable && unicode_fold(str, true, ret)) {
+		return ret;
+	}
+	return unicode_to_lower((*this)(str));
+}
+
 
 }//end namespace
@@ -0,0 +1,67 @@
+#include <sserialize/strings/LevenshteinAutomaton.h>
+#include <sserialize/vendor/utf8.h>
+#include <algorithm>
+
+namespace sserialize {
+
+LevenshteinAutomaton::LevenshteinAutomaton() : m_maxDistance(0) {}
+
+LevenshteinAutomaton::LevenshteinAutomaton(const std::string & str, uint32_t maxDistance) :
+m_maxDistance(maxDistance)
+{
+	utf8::utf8to32(str.cbegin(), str.cend(), std::back_inserter(m_str));
+}
+
+LevenshteinAutomaton::~LevenshteinAutomaton() {}
+
+LevenshteinAutomaton::State LevenshteinAutomaton::start() const {
+	State state(m_str.size()+1);
+	for(uint32_t i(0), s((uint32_t) state.size()); i < s; ++i) {
+		state[i] = std::min(i, m_maxDistance+1);
+	}
+	return state;
+}
+
+void LevenshteinAutomaton::step(const State & state, uint32_t codePoint, State & next) const {
+	const uint32_t limit = m_maxDistance+1;
+	next.resize(state.size());
+	next[0] = std::min(state[0]+1, limit);
+	for(std::size_t i(1), s(state.size()); i < s; ++i) {
+		uint32_t replace = state[i-1] + (m_str[i-1] == codePoint ? 0 : 1);
+		uint32_t insert = state[i] + 1;
+		uint32_t remove = next[i-1] + 1;
+		next[i] = std::min(std::min(replace, insert), std::min(remove, limit));
+	}
+}
+
+bool LevenshteinAutomaton::canMatch(const State & state) const {
+	return *std::min_element(state.cbegin(), state.cend()) <= m_maxDistance;
+}
+
+bool LevenshteinAutomaton::matches(const std::string & str, bool prefixMatch) const {
+	State state(start()), next;
+	if (prefixMatch && isMatch(state)) {
+		return true;
+	}
+	for(std::string::const_iterator it(str.cbegin()), end(str.cend()); it != end && canMatch(state);) {
+		step(state, utf8::next(it, end), next);
+		state.swap(next);
+		if (prefixMatch && isMatch(state)) {
+			return true;
+		}
+	}
+	return isMatch(state);
+}
+
+uint32_t LevenshteinAutomaton::defaultMaxDistance(const std::string & str) {
+	auto cpCount = utf8::distance(str.cbegin(), str.cend());
+	if (cpCount <= 2) {
+		return 0;
+	}
+	else if (cpCount <= 5) {
+		return 1;
+	}
+	return 2;
+}
+
+}//end namespace
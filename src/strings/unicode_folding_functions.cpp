@@ -0,0 +1,58 @@
+#include <sserialize/strings/unicode_folding_functions.h>
+#include <sserialize/strings/unicode_folding_table.h>
+#include <sserialize/strings/unicode_case_functions.h>
+#include <sserialize/vendor/utf8.h>
+#include <algorithm>
+#include <iterator>
+
+namespace sserialize {
+
+bool unicode_fold(const std::string & str, bool toLower, std::string & dest) {
+	dest.clear();
+	dest.reserve(str.size());
+	auto out = std::back_inserter(dest);
+	std::string::const_iterator strIt(str.cbegin()), strEnd(str.cend());
+	while (strIt != strEnd) {
+		//ASCII is neither changed by the transliteration nor does it interact with other code points
+		if ((uint8_t)*strIt < 0x80) {
+			char c = *strIt;
+			if (toLower && c >= 'A' && c <= 'Z') {
+				c += 'a' - 'A';
+			}
+			dest.push_back(c);
+			++strIt;
+			continue;
+		}
+		uint32_t cp;
+		if (utf8::internal::validate_next(strIt, strEnd, cp) != utf8::internal::UTF8_OK) {
+			return false;
+		}
+		const uint32_t * tableEnd = unicode_folding_source_table + UNICODE_FOLDING_TABLE_SIZE;
+		const uint32_t * pos = std::lower_bound(unicode_folding_source_table, tableEnd, cp);
+		if (pos == tableEnd || *pos != cp) {
+			utf8::unchecked::append(toLower ? unicode32_to_lower(cp) : cp, out);
+			continue;
+		}
+		uint32_t target = unicode_folding_target_table[pos - unicode_folding_source_table];
+		if (target >> 31) {
+			return false;
+		}
+		const uint8_t * dIt = unicode_folding_data + (target & 0xFFFFFF);
+		const uint8_t * dEnd = dIt + ((target >> 24) & 0x7F);
+		if (toLower) {
+			while (dIt != dEnd) {
+				utf8::unchecked::append(unicode32_to_lower(utf8::unchecked::next(dIt)), out);
+			}
+		}
+		else {
+			dest.append(dIt, dEnd);
+		}
+	}
+	return true;
+}
+
+uint32_t unicode_fold_icu_version_major() {
+	return UNICODE_FOLDING_TABLE_ICU_VERSION_MAJOR;
+}
+
+}//end namespace
@@ -2,6 +2,25 @@
 #include <sserialize/utility/exceptions.h>
 
 namespace sserialize {
+namespace {
+
+typedef void (*LsbUnpackFunction)(const uint8_t *, const uint8_t *, uint64_t, uint64_t, uint64_t *, std::size_t);
+
+template<std::size_t... I>
+constexpr std::array<LsbUnpackFunction, sizeof...(I)> lsbUnpackers(std::index_sequence<I...>) {
+	return std::array<LsbUnpackFunction, sizeof...(I)>{{ &detail::bitpacking::LsbUnpacker<I>::template unpack<uint64_t*>... }};
+}
+
+constexpr std::array<LsbUnpackFunction, 65> LsbUnpackers = lsbUnpackers(std::make_index_sequence<65>{});
+
+}//end anonymous namespace
+
+void unpack_lsb(uint32_t bpn, const uint8_t * begin, const uint8_t * end, uint64_t bitPos, uint64_t stride, uint64_t * dest, std::size_t count) {
+	if (bpn > 64) {
+		throw sserialize::UnsupportedFeatureException("unpack_lsb: unsupported bits per number: " + std::to_string(bpn));
+	}
+	(*LsbUnpackers[bpn])(begin, end, bitPos, stride, dest, count);
+}
 	
 std::unique_ptr<BitpackingInterface> BitpackingInterface::instance(uint32_t bpn) {
 #define C(__BPN) case __BPN: return std::unique_ptr<BitpackingInterface>( new Bitpacking<__BPN>() );
@@ -0,0 +1,85 @@
+//Creates unicode_folding_table.h from the ICU data of the system
+//The table describes the result of the transliteration "NFD; [:Nonspacing Mark:] Remove; NFC;" for every code point
+//Usage: create_cpp_folding_table > unicode_folding_table.h
+
+#include <unicode/translit.h>
+#include <unicode/normalizer2.h>
+#include <unicode/uchar.h>
+#include <unicode/uversion.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+int main() {
+	UErrorCode status = U_ZERO_ERROR;
+	icu::Transliterator * trans = icu::Transliterator::createInstance("NFD; [:Nonspacing Mark:] Remove; NFC;", UTRANS_FORWARD, status);
+	if (U_FAILURE(status)) {
+		std::cerr << "Could not create transliterator: " << u_errorName(status) << std::endl;
+		return 1;
+	}
+	const icu::Normalizer2 * nfc = icu::Normalizer2::getNFCInstance(status);
+	if (U_FAILURE(status)) {
+		std::cerr << "Could not get NFC normalizer: " << u_errorName(status) << std::endl;
+		return 1;
+	}
+
+	std::vector<uint32_t> source;
+	std::vector<uint32_t> target;
+	std::string data;
+
+	for(UChar32 cp(0); cp <= 0x10FFFF; ++cp) {
+		if (U_IS_SURROGATE(cp)) {
+			continue;
+		}
+		icu::UnicodeString ustr(cp);
+		trans->transliterate(ustr);
+		std::string folded;
+		ustr.toUTF8String(folded);
+		//A code point may interact with its predecessor if it is not removed and does not start a new NFC segment
+		bool complex = folded.size() && !nfc->hasBoundaryBefore(cp);
+		bool identity = (ustr.length() == U16_LENGTH(cp) && ustr.char32At(0) == cp);
+		if (identity && !complex) {
+			continue;
+		}
+		if (folded.size() > 0x7F || data.size() > 0xFFFFFF) {
+			std::cerr << "Folding table overflow at code point " << cp << std::endl;
+			return 1;
+		}
+		source.push_back((uint32_t) cp);
+		target.push_back(((uint32_t)complex << 31) | ((uint32_t)folded.size() << 24) | (uint32_t)data.size());
+		data += folded;
+	}
+	delete trans;
+
+	std::cout << "//Generated by support/unicode_tools/create_cpp_folding_table.cpp from ICU " << U_ICU_VERSION << ", do not edit\n";
+	std::cout << "#ifndef UNICODE_FOLDING_TABLE_H\n#define UNICODE_FOLDING_TABLE_H\n#include <stdint.h>\n";
+	std::cout << "//the folding is only identical to the transliterator of this ICU major version\n";
+	std::cout << "#define UNICODE_FOLDING_TABLE_ICU_VERSION_MAJOR " << U_ICU_VERSION_MAJOR_NUM << "\n";
+	std::cout << "#define UNICODE_FOLDING_TABLE_SIZE " << source.size() << "\n";
+	std::cout << "#define UNICODE_FOLDING_DATA_SIZE " << data.size() << "\n";
+	std::cout << "//code points whose folding is not the identity or that may interact with their predecessor, sorted\n";
+	std::cout << "static const uint32_t unicode_folding_source_table[] = {\n";
+	std::cout << std::hex << std::uppercase << std::setfill('0');
+	for(uint32_t x : source) {
+		std::cout << "0x" << std::setw(6) << x << ",\n";
+	}
+	std::cout << "};\n";
+	std::cout << "//bits 0-23: offset into unicode_folding_data, bits 24-30: length in bytes, bit 31: interacts with its predecessor\n";
+	std::cout << "static const uint32_t unicode_folding_target_table[] = {\n";
+	for(uint32_t x : target) {
+		std::cout << "0x" << std::setw(8) << x << ",\n";
+	}
+	std::cout << "};\n";
+	std::cout << "//utf-8 encoded folded strings\n";
+	std::cout << "static const uint8_t unicode_folding_data[] = {";
+	for(std::size_t i(0); i < data.size(); ++i) {
+		if (i % 16 == 0) {
+			std::cout << "\n";
+		}
+		std::cout << "0x" << std::setw(2) << (uint32_t)(uint8_t)data[i] << ",";
+	}
+	std::cout << "\n};\n#endif\n";
+	return 0;
+}
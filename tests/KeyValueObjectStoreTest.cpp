@@ -1,6 +1,8 @@
 #include <iostream>
 #include <sserialize/containers/KeyValueObjectStore.h>
 #include <sserialize/Static/KeyValueObjectStore.h>
+#include <sserialize/Static/KeyValueObjectStoreInvertedIndex.h>
+#include <sserialize/containers/ItemIndexFactory.h>
 #include <sserialize/utility/log.h>
 #include <sserialize/iterator/RangeGenerator.h>
 #include <algorithm>
@@ -29,6 +31,7 @@ CPPUNIT_TEST( testStaticSize );
 CPPUNIT_TEST( testStaticEquality );
 CPPUNIT_TEST( testStaticFindKey );
 CPPUNIT_TEST( testStaticFindValue );
+CPPUNIT_TEST( testStaticInvertedIndex );
 CPPUNIT_TEST( testItemEquality );
 CPPUNIT_TEST_SUITE_END();
 private:
@@ -189,6 +192,38 @@ public:
 		}
 	}
 	
+	void testStaticInvertedIndex() {
+		serialize();
+		std::map< std::pair<std::string, std::string>, std::set<uint32_t> > pairItems;
+		std::map< std::string, std::set<uint32_t> > keyItems;
+		for(uint32_t i = 0; i < m_d->items.size(); ++i) {
+			KeyValueObjectStore::Item item = m_d->kv.at(i);
+			for(uint32_t j = 0; j < item.size(); ++j) {
+				KeyValuePair kv = item.at(j);
+				pairItems[kv].insert(i);
+				keyItems[kv.first].insert(i);
+			}
+		}
+		ItemIndexFactory idxFactory(true);
+		UByteArrayAdapter iiData(new std::vector<uint8_t>(), true);
+		Static::KeyValueObjectStoreInvertedIndex::create(m_d->skv, idxFactory, iiData, 4);
+		Static::KeyValueObjectStoreInvertedIndex ii(iiData, idxFactory.asItemIndexStore());
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("sizeInBytes", iiData.size(), ii.getSizeInBytes());
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("keyCount", (uint32_t) m_d->skv.keyStringTable().size(), ii.keyCount());
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("size", (uint32_t) pairItems.size(), ii.size());
+		for(const auto & x : pairItems) {
+			uint32_t keyId = m_d->skv.findKeyId(x.first.first);
+			uint32_t valueId = m_d->skv.findValueId(x.first.second);
+			CPPUNIT_ASSERT_MESSAGE(sserialize::toString("items of (", x.first.first, ", ", x.first.second, ")"), x.second == ii.items(keyId, valueId));
+			CPPUNIT_ASSERT_MESSAGE("items by string", x.second == ii.items(m_d->skv, x.first.first, x.first.second));
+		}
+		for(const auto & x : keyItems) {
+			CPPUNIT_ASSERT_MESSAGE(sserialize::toString("items of key ", x.first), x.second == ii.items(m_d->skv.findKeyId(x.first)));
+		}
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("missing pair", Static::KeyValueObjectStoreInvertedIndex::npos, ii.indexId(m_d->skv.findKeyId("0id"), m_d->skv.findValueId("not a value")));
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("missing key", Static::KeyValueObjectStoreInvertedIndex::npos, ii.indexId(ii.keyCount()));
+	}
+	
 	void testItemEquality() {
 		sserialize::UByteArrayAdapter d(new std::vector<uint8_t>(), true);
 		for(uint32_t startValues = 0; startValues < 1024*1024; startValues = (1+startValues)*2) {
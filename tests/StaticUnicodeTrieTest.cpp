@@ -3,11 +3,13 @@
 #include <sserialize/Static/ItemIndexStore.h>
 #include <sserialize/Static/UnicodeTrie/Trie.h>
 #include <sserialize/Static/UnicodeTrie/detail/SimpleNode.h>
+#include <sserialize/Static/UnicodeTrie/NodeCursor.h>
 #include <sserialize/strings/stringfunctions.h>
 #include "test_stringcompleter.h"
 #include "TestItemData.h"
 #include "StringCompleterTest.h"
 #include <cppunit/TestResult.h>
+#include <set>
 
 using namespace sserialize;
 
@@ -123,6 +125,9 @@ CPPUNIT_TEST( testCompletionSPCI );
 CPPUNIT_TEST( testTrieEquality );
 CPPUNIT_TEST( testIndexEquality );
 CPPUNIT_TEST( testConsistency );
+CPPUNIT_TEST( testCursor );
+CPPUNIT_TEST( testFindPayloadPtrs );
+CPPUNIT_TEST( testFuzzy );
 CPPUNIT_TEST_SUITE_END();
 private:
 
@@ -276,6 +281,142 @@ public:
 		m_trie.root()->apply(consistenyChecker);
 		CPPUNIT_ASSERT(ok);
 	}
+	
+	void testCursor() {
+		typedef Static::UnicodeTrie::NodeCursor<Static::UnicodeTrie::Node::NT_SIMPLE> MyCursor;
+		//walk both representations in depth-first order
+		std::vector<uint32_t> payloadPtrs;
+		std::vector< std::pair<MyStaticTrie::Node, MyCursor> > stack;
+		stack.emplace_back(m_sTrie.getRootNode(), m_sTrie.rootCursor<Static::UnicodeTrie::Node::NT_SIMPLE>());
+		while (stack.size()) {
+			MyStaticTrie::Node node = stack.back().first;
+			MyCursor cursor = stack.back().second;
+			stack.pop_back();
+			CPPUNIT_ASSERT_EQUAL_MESSAGE("str", node.str(), cursor.str());
+			CPPUNIT_ASSERT_EQUAL_MESSAGE("payloadPtr", node.payloadPtr(), cursor.payloadPtr());
+			CPPUNIT_ASSERT_EQUAL_MESSAGE("childSize", node.childSize(), cursor.childSize());
+			payloadPtrs.push_back(cursor.payloadPtr());
+			for(uint32_t i(node.childSize()); i > 0; --i) {
+				CPPUNIT_ASSERT_EQUAL_MESSAGE("childKey", node.childKey(i-1), cursor.childKey(i-1));
+				CPPUNIT_ASSERT_EQUAL_MESSAGE("find", node.find(node.childKey(i-1)), cursor.find(cursor.childKey(i-1)));
+				stack.emplace_back(node.child(i-1), cursor.child(i-1));
+			}
+		}
+		std::vector<uint32_t> visited;
+		std::string empty;
+		m_sTrie.forEachPayloadPtr(empty.cbegin(), empty.cend(), [&visited](uint32_t p) { visited.push_back(p); });
+		CPPUNIT_ASSERT_MESSAGE("forEachPayloadPtr", payloadPtrs == visited);
+		
+		for(const TestItemData & item : items()) {
+			for(std::string str : item.strs) {
+				if (T_CASE_IN_SENSITIVE) {
+					str = sserialize::unicode_to_lower(str);
+				}
+				for(std::size_t len(0); len <= str.size()+1; ++len) {
+					if (len < str.size() && (static_cast<uint8_t>(str[len]) & 0xC0) == 0x80) { //not a code point boundary
+						continue;
+					}
+					std::string q = (len <= str.size() ? str.substr(0, len) : str + "#");
+					for(bool prefixMatch : {false, true}) {
+						MyStaticTrie::Node node = m_sTrie.find(q.cbegin(), q.cend(), prefixMatch);
+						uint32_t want = (node.valid() ? node.payloadPtr() : MyStaticTrie::npos);
+						CPPUNIT_ASSERT_EQUAL_MESSAGE("findPayloadPtr(" + q + ")", want, m_sTrie.findPayloadPtr(q.cbegin(), q.cend(), prefixMatch));
+					}
+				}
+			}
+		}
+	}
+	
+	void testFuzzy() {
+		//all paths of the trie together with the payload of their end node
+		std::vector< std::pair<std::string, uint32_t> > paths;
+		std::vector< std::pair<MyStaticTrie::Node, std::string> > stack;
+		stack.emplace_back(m_sTrie.getRootNode(), std::string());
+		while (stack.size()) {
+			MyStaticTrie::Node node = stack.back().first;
+			std::string path = stack.back().second + node.str();
+			stack.pop_back();
+			paths.emplace_back(path, node.payloadPtr());
+			for(uint32_t i(0); i < node.childSize(); ++i) {
+				std::string childPath(path);
+				utf8::append(node.childKey(i), std::back_inserter(childPath));
+				stack.emplace_back(node.child(i), childPath);
+			}
+		}
+		std::vector<std::string> queries;
+		for(const TestItemData & item : items()) {
+			for(std::string str : item.strs) {
+				if (T_CASE_IN_SENSITIVE) {
+					str = sserialize::unicode_to_lower(str);
+				}
+				queries.push_back(str);
+				if (str.size() > 1 && static_cast<uint8_t>(str[0]) < 0x80) {
+					queries.push_back("x" + str.substr(1));
+				}
+			}
+		}
+		for(const std::string & q : queries) {
+			for(uint32_t maxDistance : {0, 1, 2}) {
+				LevenshteinAutomaton la(q, maxDistance);
+				std::set<uint32_t> got;
+				m_sTrie.fuzzyPayloadPtrs(la, false, [&got](uint32_t p, uint32_t) { got.insert(p); });
+				std::set<uint32_t> want;
+				for(const auto & x : paths) {
+					if (la.matches(x.first, false)) {
+						want.insert(x.second);
+					}
+				}
+				CPPUNIT_ASSERT_MESSAGE("exact fuzzy search for " + q, want == got);
+				//prefix: every path matching the query is below exactly one reported node
+				std::vector<std::string> reported;
+				m_sTrie.fuzzyPayloadPtrs(la, true, [&](uint32_t p, uint32_t) {
+					for(const auto & x : paths) {
+						if (x.second == p) {
+							reported.push_back(x.first);
+							break;
+						}
+					}
+				});
+				for(const auto & x : paths) {
+					uint32_t covered = 0;
+					for(const std::string & r : reported) {
+						covered += (x.first.compare(0, r.size(), r) == 0 ? 1 : 0);
+					}
+					CPPUNIT_ASSERT_EQUAL_MESSAGE("prefix fuzzy search for " + q + " covering " + x.first, uint32_t(la.matches(x.first, true) ? 1 : 0), covered);
+				}
+			}
+		}
+	}
+	
+	void testFindPayloadPtrs() {
+		std::vector<std::string> queries;
+		for(const TestItemData & item : items()) {
+			for(std::string str : item.strs) {
+				if (T_CASE_IN_SENSITIVE) {
+					str = sserialize::unicode_to_lower(str);
+				}
+				std::size_t half = str.size()/2;
+				while (half < str.size() && (static_cast<uint8_t>(str[half]) & 0xC0) == 0x80) {
+					++half;
+				}
+				queries.push_back(str.substr(0, half));
+				queries.push_back(str);
+				queries.push_back(str + "#");
+			}
+		}
+		std::vector<std::string> sortedQueries(queries);
+		std::sort(sortedQueries.begin(), sortedQueries.end());
+		for(bool prefixMatch : {false, true}) {
+			for(const std::vector<std::string> * qs : {&queries, &sortedQueries}) {
+				std::vector<uint32_t> payloadPtrs(qs->size());
+				m_sTrie.findPayloadPtrs(qs->cbegin(), qs->cend(), prefixMatch, payloadPtrs.begin());
+				for(std::size_t i(0), s(qs->size()); i < s; ++i) {
+					const std::string & q = qs->at(i);
+					CPPUNIT_ASSERT_EQUAL_MESSAGE("findPayloadPtrs(" + q + ")", m_sTrie.findPayloadPtr(q.cbegin(), q.cend(), prefixMatch), payloadPtrs.at(i));
+				}
+			}
+		}
+	}
 };
 
 int main(int argc, char ** argv) {
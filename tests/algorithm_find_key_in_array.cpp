@@ -0,0 +1,97 @@
+#include <sserialize/algorithm/find_key_in_array_functions.h>
+#include <sserialize/utility/printers.h>
+#include <algorithm>
+#include <deque>
+#include "TestBase.h"
+
+class TestFindKeyInArray: public sserialize::tests::TestBase {
+CPPUNIT_TEST_SUITE( TestFindKeyInArray );
+CPPUNIT_TEST( testUint8 );
+CPPUNIT_TEST( testUint16 );
+CPPUNIT_TEST( testUnaligned );
+CPPUNIT_TEST_SUITE_END();
+private:
+	template<typename T>
+	std::vector<T> randomKeys(uint32_t count, uint32_t maxKey) {
+		std::vector<T> keys;
+		while (keys.size() < count) {
+			T k = (T)(rand() % (maxKey+1));
+			if (std::find(keys.begin(), keys.end(), k) == keys.end()) {
+				keys.push_back(k);
+			}
+		}
+		return keys;
+	}
+	template<typename T>
+	int32_t expectedPos(const std::vector<T> & keys, T key) {
+		auto it = std::find(keys.begin(), keys.end(), key);
+		return (it == keys.end() ? -1 : (int32_t)(it - keys.begin()));
+	}
+public:
+	virtual void setUp() {}
+	virtual void tearDown() {}
+	void testUint8() {
+		for(uint32_t len(0); len < 256; ++len) {
+			std::vector<uint8_t> keys = randomKeys<uint8_t>(len, 0xFF);
+			std::vector<uint8_t> vd(keys.begin(), keys.end());
+			std::deque<uint8_t> dd(keys.begin(), keys.end());
+			sserialize::UByteArrayAdapter contiguous(&vd, false);
+			sserialize::UByteArrayAdapter nonContiguous(&dd, false);
+			for(uint32_t key(0); key < 256; ++key) {
+				int32_t expected = expectedPos<uint8_t>(keys, (uint8_t) key);
+				std::string msg = sserialize::toString("len=", len, " key=", key);
+				CPPUNIT_ASSERT_EQUAL_MESSAGE(msg, expected, (int32_t) sserialize::findKeyInArray<1>(contiguous, (uint8_t) len, (uint8_t) key));
+				CPPUNIT_ASSERT_EQUAL_MESSAGE(msg, expected, (int32_t) sserialize::findKeyInArray<1>(nonContiguous, (uint8_t) len, (uint8_t) key));
+			}
+		}
+	}
+	void testUint16() {
+		for(uint32_t len(0); len < 300; ++len) {
+			std::vector<uint16_t> keys = randomKeys<uint16_t>(len, 0x3FF);
+			std::vector<uint8_t> vd;
+			for(uint16_t k : keys) {
+				vd.push_back((uint8_t)(k & 0xFF));
+				vd.push_back((uint8_t)(k >> 8));
+			}
+			std::deque<uint8_t> dd(vd.begin(), vd.end());
+			sserialize::UByteArrayAdapter contiguous(&vd, false);
+			sserialize::UByteArrayAdapter nonContiguous(&dd, false);
+			for(uint32_t key(0); key < 0x400; ++key) {
+				int32_t expected = expectedPos<uint16_t>(keys, (uint16_t) key);
+				std::string msg = sserialize::toString("len=", len, " key=", key);
+				CPPUNIT_ASSERT_EQUAL_MESSAGE(msg, expected, (int32_t) sserialize::findKeyInArray_uint16<2>(contiguous, (uint16_t) len, (uint16_t) key));
+				CPPUNIT_ASSERT_EQUAL_MESSAGE(msg, expected, (int32_t) sserialize::findKeyInArray_uint16<2>(nonContiguous, (uint16_t) len, (uint16_t) key));
+			}
+		}
+	}
+	///arrays starting at odd addresses, keys whose bytes only match across key boundaries must not be found
+	void testUnaligned() {
+		using namespace sserialize::detail::FindKeyInArray;
+		std::vector<uint8_t> d(4+2*100);
+		for(uint32_t off(0); off < 4; ++off) {
+			for(uint32_t len(0); len < 100; ++len) {
+				for(uint32_t i(0); i < len; ++i) {
+					d[off+2*i] = (uint8_t) i;
+					d[off+2*i+1] = 0x80;
+				}
+				for(uint32_t i(0); i < len; ++i) {
+					CPPUNIT_ASSERT_EQUAL(int32_t(i), find_u16(d.data()+off, len, (uint16_t)(0x8000 | i)));
+					CPPUNIT_ASSERT_EQUAL(int32_t(2*i), find_u8(d.data()+off, 2*len, (uint8_t) i));
+				}
+				CPPUNIT_ASSERT_EQUAL(int32_t(-1), find_u16(d.data()+off, len, (uint16_t)(0x8000 | len)));
+				//spans the high byte of key i and the low byte of key i+1
+				CPPUNIT_ASSERT_EQUAL(int32_t(-1), find_u16(d.data()+off, len, 0x0180));
+			}
+		}
+	}
+};
+
+int main(int argc, char ** argv) {
+	sserialize::tests::TestBase::init(argc, argv);
+
+	srand( 0 );
+	CppUnit::TextUi::TestRunner runner;
+	runner.addTest(  TestFindKeyInArray::suite() );
+	bool ok = runner.run();
+	return ok ? 0 : 1;
+}
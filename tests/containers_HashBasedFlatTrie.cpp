@@ -4,6 +4,8 @@
 #include <sserialize/utility/printers.h>
 #include <sserialize/storage/Size.h>
 #include <sstream>
+#include <algorithm>
+#include <set>
 #include "TestBase.h"
 
 const char * inFileName = 0;
@@ -27,6 +29,12 @@ public:
 	void testParallelSerialization();
 	void testStaticNode();
 	void testStaticSearch();
+	void testDirectorySearch();
+	void testFindMany();
+	void testFuzzyFind();
+	void testParallelFinalize();
+	void testParallelInsert();
+	void testStringSpill();
 protected:
 	using SizeType = sserialize::Size;
 	using ValueType = sserialize::Size;
@@ -77,6 +85,12 @@ CPPUNIT_TEST( testSerialization );
 CPPUNIT_TEST( testStaticNode );
 CPPUNIT_TEST( testTrieEquality );
 CPPUNIT_TEST( testStaticSearch );
+CPPUNIT_TEST( testDirectorySearch );
+CPPUNIT_TEST( testFindMany );
+CPPUNIT_TEST( testFuzzyFind );
+CPPUNIT_TEST( testParallelFinalize );
+CPPUNIT_TEST( testParallelInsert );
+CPPUNIT_TEST( testStringSpill );
 // CPPUNIT_TEST( testParentChildRelation );
 CPPUNIT_TEST_SUITE_END();
 public:
@@ -88,7 +102,8 @@ public:
 			"C", "CD", "CE", //parent available with children 
 			"DAAAA", "DAAAB", "DAAABE", "DAAAC", //longer node string, but missing parent
 			"EAAAA", "EAAAAA", "EAAAAB", "EAAAAC", //longer node string, no missing parent
-			"FF", "FEG", "FEHI", "FEHJ" //multiple missing parents
+			"FF", "FEG", "FEHI", "FEHJ", //multiple missing parents
+			"GGGGGGGGGA", "GGGGGGGGGB", "GGGGGGGGGGC" //common prefix longer than the directory prefix
 		};
 		m_checkStrings = {
 			"",
@@ -102,7 +117,8 @@ public:
 			"F", "FE",
 			"FEG",
 			"FEH", "FEHI", "FEHJ",
-			"FF" //multiple missing parents
+			"FF", //multiple missing parents
+			"GGGGGGGGG", "GGGGGGGGGA", "GGGGGGGGGB", "GGGGGGGGGGC"
 		};
 		std::random_shuffle(m_testStrings.begin(), m_testStrings.end());
 	}
@@ -116,6 +132,8 @@ CPPUNIT_TEST( testSerialization );
 CPPUNIT_TEST( testStaticNode );
 // CPPUNIT_TEST( testTrieEquality ); //Trie would be too large
 CPPUNIT_TEST( testStaticSearch );
+CPPUNIT_TEST( testFindMany );
+CPPUNIT_TEST( testParallelFinalize );
 // CPPUNIT_TEST( testParentChildRelation );
 CPPUNIT_TEST_SUITE_END();
 public:
@@ -173,6 +191,7 @@ CPPUNIT_TEST( testParallelSerialization );
 CPPUNIT_TEST( testStaticNode );
 CPPUNIT_TEST( testStaticSearch );
 CPPUNIT_TEST( testSpecialStaticSearch );
+CPPUNIT_TEST( testParallelInsert );
 // CPPUNIT_TEST( testParentChildRelation );
 CPPUNIT_TEST_SUITE_END();
 public:
@@ -435,6 +454,210 @@ TestHashBasedFlatTrieBase::testStaticSearch() {
 		CPPUNIT_ASSERT_EQUAL_MESSAGE("search broken for" + str, ValueType(i), sft.at(str, false));
 	}
 }
+
+void
+TestHashBasedFlatTrieBase::testDirectorySearch() {
+	if (!numTestStrings())
+		return;
+	std::vector<std::string> queries;
+	for(std::size_t i(0), s(numTestStrings()); i < s; ++i) {
+		const std::string & str = testString(i);
+		for(std::size_t j(0); j <= str.size(); ++j) {
+			queries.push_back(str.substr(0, j));
+		}
+		queries.push_back(str + "A");
+		queries.push_back(str + "\xFF");
+	}
+	
+	m_ht.setDirectorySampleRate(0);
+	sserialize::UByteArrayAdapter plainOut(sserialize::UByteArrayAdapter::createCache(1, sserialize::MM_PROGRAM_MEMORY));
+	m_ht.append(plainOut, [](const MyT::NodePtr & n) { return n->value(); });
+	MyST plain(plainOut);
+	CPPUNIT_ASSERT_EQUAL_MESSAGE("no directory", uint32_t(0), plain.directorySampleRate());
+	
+	for(uint32_t sampleRate : {1, 2, 3, 5, 32}) {
+		m_ht.setDirectorySampleRate(sampleRate);
+		sserialize::UByteArrayAdapter hftOut(sserialize::UByteArrayAdapter::createCache(1, sserialize::MM_PROGRAM_MEMORY));
+		m_ht.append(hftOut, [](const MyT::NodePtr & n) { return n->value(); });
+		MyST sft(hftOut);
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("sample rate", sampleRate, sft.directorySampleRate());
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("size", plain.size(), sft.size());
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("sizeInBytes", hftOut.tellPutPtr(), sft.getSizeInBytes());
+		for(const std::string & q : queries) {
+			CPPUNIT_ASSERT_EQUAL_MESSAGE("exact search for " + q, plain.find(q, false), sft.find(q, false));
+			CPPUNIT_ASSERT_EQUAL_MESSAGE("prefix search for " + q, plain.find(q, true), sft.find(q, true));
+		}
+	}
+}
+void
+TestHashBasedFlatTrieBase::testFindMany() {
+	if (!numTestStrings())
+		return;
+	std::vector<std::string> queries;
+	for(std::size_t i(0), s(numTestStrings()); i < s; ++i) {
+		const std::string & str = testString(i);
+		queries.push_back(str.substr(0, str.size()/2));
+		queries.push_back(str);
+		queries.push_back(str + "A");
+	}
+	std::vector<std::string> sortedQueries(queries);
+	std::sort(sortedQueries.begin(), sortedQueries.end());
+	
+	sserialize::UByteArrayAdapter hftOut(sserialize::UByteArrayAdapter::createCache(1, sserialize::MM_PROGRAM_MEMORY));
+	m_ht.append(hftOut, [](const MyT::NodePtr & n) { return n->value(); });
+	MyST sft(hftOut);
+	for(bool prefixMatch : {false, true}) {
+		for(const std::vector<std::string> * qs : {&queries, &sortedQueries}) {
+			std::vector<MyST::SizeType> pos(qs->size());
+			sft.findMany(qs->cbegin(), qs->cend(), prefixMatch, pos.begin());
+			for(std::size_t i(0), s(qs->size()); i < s; ++i) {
+				CPPUNIT_ASSERT_EQUAL_MESSAGE("findMany for " + qs->at(i), sft.find(qs->at(i), prefixMatch), pos.at(i));
+			}
+		}
+	}
+}
+void
+TestHashBasedFlatTrieBase::testFuzzyFind() {
+	if (!numTestStrings())
+		return;
+	sserialize::UByteArrayAdapter hftOut(sserialize::UByteArrayAdapter::createCache(1, sserialize::MM_PROGRAM_MEMORY));
+	m_ht.append(hftOut, [](const MyT::NodePtr & n) { return n->value(); });
+	MyST sft(hftOut);
+	
+	std::vector<std::string> queries;
+	for(std::size_t i(0), s(std::min<std::size_t>(numTestStrings(), 100)); i < s; ++i) {
+		const std::string & str = testString(i);
+		queries.push_back(str);
+		if (str.size() > 1 && static_cast<uint8_t>(str[0]) < 0x80 && static_cast<uint8_t>(str[1]) < 0x80) {
+			queries.push_back(str.substr(1)); //deletion
+			queries.push_back("X" + str.substr(1)); //substitution
+			queries.push_back(str.substr(0, 1) + "X" + str.substr(1)); //insertion
+		}
+	}
+	for(const std::string & q : queries) {
+		for(uint32_t maxDistance : {0, 1, 2}) {
+			sserialize::LevenshteinAutomaton la(q, maxDistance);
+			//exact: exactly the strings within maxDistance
+			std::set<MyST::SizeType> got;
+			sft.fuzzyFind(la, false, [&got](MyST::SizeType pos, uint32_t) { got.insert(pos); });
+			std::set<MyST::SizeType> want;
+			for(MyST::SizeType i(0); i < sft.size(); ++i) {
+				if (la.matches(sft.strAt(i), false)) {
+					want.insert(i);
+				}
+			}
+			CPPUNIT_ASSERT_MESSAGE("exact fuzzy search for " + q, want == got);
+			//prefix: every matching string is below exactly one reported string
+			got.clear();
+			sft.fuzzyFind(la, true, [&got](MyST::SizeType pos, uint32_t) { got.insert(pos); });
+			for(MyST::SizeType i(0); i < sft.size(); ++i) {
+				std::string str = sft.strAt(i);
+				uint32_t covered = 0;
+				for(MyST::SizeType p : got) {
+					std::string pstr = sft.strAt(p);
+					covered += (str.compare(0, pstr.size(), pstr) == 0 ? 1 : 0);
+				}
+				CPPUNIT_ASSERT_EQUAL_MESSAGE("prefix fuzzy search for " + q + " covering " + str, uint32_t(la.matches(str, true) ? 1 : 0), covered);
+			}
+		}
+	}
+}
+void
+TestHashBasedFlatTrieBase::testParallelFinalize() {
+	//The nodes of the trie are the root, all inserted strings and the branching nodes.
+	//The branching nodes are the common prefixes of adjacent strings in sorted order.
+	auto strSmaller = [](const std::string & a, const std::string & b) {
+		return sserialize::unicodeIsSmaller(a, b);
+	};
+	std::vector<std::string> want;
+	for(std::size_t i(0), s(numTestStrings()); i < s; ++i) {
+		want.push_back(testString(i));
+	}
+	std::sort(want.begin(), want.end(), strSmaller);
+	want.erase(std::unique(want.begin(), want.end()), want.end());
+	want.emplace_back();
+	for(std::size_t i(1), s(want.size()-1); i < s; ++i) {
+		const std::string & a = want[i-1];
+		const std::string & b = want[i];
+		std::size_t len = std::mismatch(a.begin(), a.begin()+std::min(a.size(), b.size()), b.begin()).first - a.begin();
+		//do not split a code point
+		while (len && len < a.size() && (uint8_t(a[len]) & 0xC0) == 0x80) {
+			--len;
+		}
+		want.emplace_back(a, 0, len);
+	}
+	std::sort(want.begin(), want.end(), strSmaller);
+	want.erase(std::unique(want.begin(), want.end()), want.end());
+	
+	for(std::size_t threadCount : {1, 3, 8}) {
+		MyT ht;
+		for(std::size_t i(0), s(numTestStrings()); i < s; ++i) {
+			ht.insert(testString(i));
+		}
+		ht.finalize(threadCount);
+		CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("size with threadCount=", threadCount), want.size(), std::size_t(ht.size()));
+		MyT::const_iterator tIt(ht.begin());
+		for(std::size_t i(0), s(want.size()); i < s; ++i, ++tIt) {
+			CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("string ", i, " with threadCount=", threadCount), want[i], ht.toStr(tIt->first));
+		}
+	}
+}
+void
+TestHashBasedFlatTrieBase::testParallelInsert() {
+	//every string twice to exercise the deduplication
+	std::vector<std::string> strs;
+	for(std::size_t round(0); round < 2; ++round) {
+		for(std::size_t i(0), s(numTestStrings()); i < s; ++i) {
+			strs.push_back(testString(i));
+		}
+	}
+	for(std::size_t threadCount : {1, 3, 8}) {
+		for(bool incremental : {false, true}) {
+			MyT ht(sserialize::MM_PROGRAM_MEMORY, sserialize::MM_PROGRAM_MEMORY);
+			//some strings are already in the trie
+			if (incremental) {
+				for(std::size_t i(0), s(numTestStrings()); i < s; i += 2) {
+					ht.insert(testString(i));
+				}
+			}
+			ht.mt_insert(strs.begin(), strs.end(), threadCount);
+			std::string msg = sserialize::toString(" with threadCount=", threadCount, ", incremental=", incremental);
+			for(const std::string & str : strs) {
+				CPPUNIT_ASSERT_MESSAGE("count of " + str + msg, ht.count(str));
+			}
+			ht.finalize(threadCount);
+			CPPUNIT_ASSERT_EQUAL_MESSAGE("size" + msg, m_ht.size(), ht.size());
+			MyT::const_iterator rIt(m_ht.begin()), rEnd(m_ht.end());
+			MyT::const_iterator tIt(ht.begin());
+			for(; rIt != rEnd; ++rIt, ++tIt) {
+				CPPUNIT_ASSERT_EQUAL_MESSAGE("string" + msg, m_ht.toStr(rIt->first), ht.toStr(tIt->first));
+			}
+		}
+	}
+}
+void
+TestHashBasedFlatTrieBase::testStringSpill() {
+	MyT ht(sserialize::MM_PROGRAM_MEMORY, sserialize::MM_PROGRAM_MEMORY);
+	ht.setStringSpillThreshold(16, sserialize::MM_FILEBASED);
+	std::size_t strSize = 0;
+	for(std::size_t i(0), s(numTestStrings()); i < s; ++i) {
+		if (!ht.count(testString(i))) {
+			strSize += testString(i).size();
+		}
+		ht.insert(testString(i));
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("inserted string", testString(i), ht.toStr(ht.insert(testString(i))));
+	}
+	CPPUNIT_ASSERT_MESSAGE("spilled", strSize <= 16 || ht.stringStorageType() == sserialize::MM_FILEBASED);
+	CPPUNIT_ASSERT_MESSAGE("memory usage of strings", ht.memoryUsage().strings >= strSize);
+	CPPUNIT_ASSERT_MESSAGE("memory usage of nodes", ht.memoryUsage().nodes >= ht.size()*sizeof(MyT::HTValueStorage::value_type));
+	ht.finalize();
+	CPPUNIT_ASSERT_EQUAL_MESSAGE("size", m_ht.size(), ht.size());
+	MyT::const_iterator rIt(m_ht.begin()), rEnd(m_ht.end());
+	MyT::const_iterator tIt(ht.begin());
+	for(; rIt != rEnd; ++rIt, ++tIt) {
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("string", m_ht.toStr(rIt->first), ht.toStr(tIt->first));
+	}
+}
 //END Implementation of TestHashBasedFlatTrieBase
 
 int main(int argc, char ** argv) {
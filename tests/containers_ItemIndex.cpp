@@ -1,6 +1,7 @@
 #include "containers_ItemIndexBaseTest.h"
 #include <sserialize/containers/ItemIndexPrivates/ItemIndexPrivates.h>
 #include <sserialize/containers/ItemIndexFactory.h>
+#include <sserialize/containers/ItemIndexArena.h>
 #include <cppunit/TestResult.h>
 
 #define DEFAULT_ENABLED_TESTS 
@@ -95,6 +96,79 @@ public:
 	ItemIndexPrivateSerializedTest() : ItemIndexPrivateBaseTest(T_TYPE) {}
 };
 
+class ItemIndexPrivateArenaVectorTest: public ItemIndexPrivateBaseTest {
+CPPUNIT_TEST_SUITE( ItemIndexPrivateArenaVectorTest );
+CPPUNIT_TEST( testRandomEquality );
+CPPUNIT_TEST( testSpecialEquality );
+CPPUNIT_TEST( testIntersect );
+CPPUNIT_TEST( testUnite );
+CPPUNIT_TEST( testDifference );
+CPPUNIT_TEST( testSymmetricDifference );
+CPPUNIT_TEST( testDynamicBitSet );
+CPPUNIT_TEST( testPutIntoVector );
+CPPUNIT_TEST( testIterator );
+CPPUNIT_TEST( testRandomMaxSetEquality );
+CPPUNIT_TEST( testArenaSetOps );
+CPPUNIT_TEST( testArenaLifetime );
+CPPUNIT_TEST_SUITE_END();
+private:
+	sserialize::RCPtrWrapper<sserialize::ItemIndexArena> m_arena;
+protected:
+	virtual bool create(const std::set<uint32_t> & srcSet, sserialize::ItemIndex & idx) override {
+		idx = m_arena->create(srcSet.cbegin(), srcSet.cend());
+		return true;
+	}
+	virtual bool create(const std::vector<uint32_t> & srcSet, sserialize::ItemIndex & idx) override {
+		idx = m_arena->create(srcSet);
+		return true;
+	}
+public:
+	ItemIndexPrivateArenaVectorTest() : ItemIndexPrivateBaseTest(sserialize::ItemIndex::T_STL_VECTOR) {}
+	virtual void setUp() override {
+		ItemIndexPrivateBaseTest::setUp();
+		m_arena.reset(new sserialize::ItemIndexArena());
+	}
+	virtual void tearDown() override {
+		m_arena.reset(0);
+	}
+	void testArenaSetOps() {
+		for(uint32_t runs = 0; runs < TEST_RUNS; ++runs) {
+			std::set<uint32_t> a, b;
+			createOverLappingSets(a, b,  0xFF, 0xFF, 0xFF);
+			//the second operand is not part of the arena
+			sserialize::ItemIndex idxA( m_arena->create(a.cbegin(), a.cend()) );
+			sserialize::ItemIndex idxB( std::vector<uint32_t>(b.cbegin(), b.cend()) );
+			
+			std::vector<uint32_t> r;
+			std::set_intersection(a.cbegin(), a.cend(), b.cbegin(), b.cend(), std::back_inserter(r));
+			CPPUNIT_ASSERT_MESSAGE("intersect", m_arena->intersect(idxA, idxB) == r);
+			r.clear();
+			std::set_union(a.cbegin(), a.cend(), b.cbegin(), b.cend(), std::back_inserter(r));
+			CPPUNIT_ASSERT_MESSAGE("unite", m_arena->unite(idxA, idxB) == r);
+			r.clear();
+			std::set_difference(a.cbegin(), a.cend(), b.cbegin(), b.cend(), std::back_inserter(r));
+			CPPUNIT_ASSERT_MESSAGE("difference", m_arena->difference(idxA, idxB) == r);
+			r.clear();
+			std::set_symmetric_difference(a.cbegin(), a.cend(), b.cbegin(), b.cend(), std::back_inserter(r));
+			CPPUNIT_ASSERT_MESSAGE("symmetricDifference", m_arena->symmetricDifference(idxA, idxB) == r);
+		}
+	}
+	void testArenaLifetime() {
+		std::vector<uint32_t> src({1, 5, 7, 1000});
+		sserialize::ItemIndex idx;
+		{
+			sserialize::RCPtrWrapper<sserialize::ItemIndexArena> arena(new sserialize::ItemIndexArena(16));
+			idx = arena->create(src);
+			CPPUNIT_ASSERT_EQUAL(std::size_t(1), arena->indexCount());
+			CPPUNIT_ASSERT_EQUAL(sserialize::RefCountObject::RCBaseType(2), arena->rc());
+		}
+		//the index keeps the arena alive
+		CPPUNIT_ASSERT_MESSAGE("index unequal after arena went out of scope", idx == src);
+		CPPUNIT_ASSERT_EQUAL(uint32_t(2), idx.find(7));
+		CPPUNIT_ASSERT_EQUAL(sserialize::ItemIndex::npos, idx.find(8));
+	}
+};
+
 int main(int argc, char ** argv) {
 	sserialize::tests::TestBase::init(argc, argv);
 	
@@ -158,6 +232,9 @@ int main(int argc, char ** argv) {
 	if (selectedTests & sserialize::ItemIndex::T_FOR) {
 		runner.addTest(  ItemIndexPrivateSerializedTest<sserialize::ItemIndex::T_FOR>::suite() );
 	}
+	if (selectedTests & sserialize::ItemIndex::T_STL_VECTOR) {
+		runner.addTest(  ItemIndexPrivateArenaVectorTest::suite() );
+	}
 	
 	if (sserialize::tests::TestBase::popProtector()) {
 		runner.eventManager().popProtector();
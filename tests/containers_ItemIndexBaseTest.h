@@ -421,6 +421,16 @@ public:
 			CPPUNIT_ASSERT_MESSAGE("Index to bitset", realBitSet == bitSet);
 			CPPUNIT_ASSERT_MESSAGE(sserialize::toString("index from DynamicBitSet unequal in testrun=", i), realValues == idxFromBitSet);
 		}
+		{ //empty index, the bit set has storage but no bit set
+			DynamicBitSet bitSet;
+			std::set<uint32_t> realValues;
+			ItemIndex idx;
+			create(realValues, idx);
+			CPPUNIT_ASSERT_EQUAL_MESSAGE("empty size", uint32_t(0), idx.size());
+			idx.putInto(bitSet);
+			sserialize::ItemIndex idxFromBitSet = bitSet.toIndex(m_idxType);
+			CPPUNIT_ASSERT_EQUAL_MESSAGE("empty index from DynamicBitSet", uint32_t(0), idxFromBitSet.size());
+		}
 		for(uint32_t i = 0; i < 32; ++i) {
 			DynamicBitSet bitSet;
 			std::set<uint32_t> realValues;
@@ -1,10 +1,13 @@
 #include <stdlib.h>
 #include <vector>
+#include <thread>
+#include <atomic>
 #include <sserialize/algorithm/utilfuncs.h>
 #include <sserialize/containers/ItemIndexPrivates/ItemIndexPrivateRleDE.h>
 #include <sserialize/containers/ItemIndex.h>
 #include <sserialize/containers/ItemIndexFactory.h>
 #include <sserialize/Static/ItemIndexStore.h>
+#include <sserialize/Static/TieredItemIndexStore.h>
 #include <sserialize/utility/printers.h>
 #include "datacreationfuncs.h"
 #include "TestBase.h"
@@ -19,14 +22,33 @@ CPPUNIT_TEST( testIdxSize );
 CPPUNIT_TEST( testIdxFromId );
 CPPUNIT_TEST( testInitFromStatic );
 CPPUNIT_TEST( testSerializedEquality );
+CPPUNIT_TEST( testEliasFanoOffsets );
 CPPUNIT_TEST( testCompressionHuffman );
 CPPUNIT_TEST( testCompressionLZO );
+CPPUNIT_TEST( testCompressionLZOGrouped );
+CPPUNIT_TEST( testTieredStore );
+CPPUNIT_TEST( testTieredStoreFullHotTier );
+CPPUNIT_TEST( testTieredStoreProfileOrder );
+CPPUNIT_TEST( testSummaries );
 CPPUNIT_TEST( testCompressionVarUint );
 CPPUNIT_TEST_SUITE_END();
 private:
 	ItemIndexFactory m_idxFactory;
 	std::vector< std::set<uint32_t> > m_sets;
 	std::vector<uint32_t> m_setIds;
+private:
+	///Hot indexes have to be small, small indexes have to be hot as long as the hot tier is not full
+	void checkSmallIndexesHot(const Static::ItemIndexStore & sdb, const Static::detail::TieredItemIndexStore::Config & cfg, const Static::detail::TieredItemIndexStore * tiered) {
+		for(uint32_t i(0), s(sdb.size()); i < s; ++i) {
+			bool small = sdb.idxSize(i) <= cfg.maxSmallIdxSize;
+			if (tiered->isHot(i)) {
+				CPPUNIT_ASSERT_MESSAGE(sserialize::toString("hot index is small at ", i), small);
+			}
+			else if (tiered->hotCount() < cfg.maxHotCount) {
+				CPPUNIT_ASSERT_MESSAGE(sserialize::toString("small index is hot at ", i), !small);
+			}
+		}
+	}
 public:
 	ItemIndexFactoryTest() : m_idxFactory(true) {
 		m_idxFactory.setType(T_IDX_TYPE);
@@ -91,6 +113,21 @@ public:
 		}
 	}
 	
+	void testEliasFanoOffsets() {
+		m_idxFactory.setOffsetsCreationMode(Static::SortedOffsetIndexPrivate::CM_ELIAS_FANO);
+		CPPUNIT_ASSERT_MESSAGE("Serialization failed", m_idxFactory.flush());
+		
+		Static::ItemIndexStore sdb(m_idxFactory.getFlushedData());
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("ItemIndexFactory.getFlushedData().size() != ItemIndexStore.getSizeInBytes()", m_idxFactory.getFlushedData().size(), sdb.getSizeInBytes());
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("ItemIndexFactory.size() != ItemIndexStore.size()", m_idxFactory.size(), sdb.size());
+		if (sdb.size() > 1) {
+			CPPUNIT_ASSERT_EQUAL_MESSAGE("offset index type", Static::SortedOffsetIndex::T_ELIAS_FANO, sdb.getIndex().type());
+		}
+		for(size_t i = 0; i < m_sets.size(); ++i) {
+			CPPUNIT_ASSERT_MESSAGE(sserialize::toString("Index at ", i), m_sets[i] == sdb.at( m_setIds[i] ));
+		}
+	}
+	
 	void testCompressionVarUint() {
 		if(T_IDX_TYPE == ItemIndex::T_WAH) {
 		
@@ -167,6 +204,206 @@ public:
 		}
 	}
 	
+	void testCompressionLZOGrouped() {
+		
+		CPPUNIT_ASSERT_MESSAGE("Serialization failed", m_idxFactory.flush());
+
+		UByteArrayAdapter dataAdap( m_idxFactory.getFlushedData());
+		UByteArrayAdapter cmpDataAdap(new std::vector<uint8_t>(dataAdap.size(), 0), true);
+
+		Static::ItemIndexStore sdb(dataAdap);
+		UByteArrayAdapter::OffsetType s = sserialize::ItemIndexFactory::compressWithLZOGrouped(sdb, cmpDataAdap, 1024);
+		cmpDataAdap.shrinkStorage(cmpDataAdap.size()-s);
+		Static::ItemIndexStore csdb(cmpDataAdap);
+		
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("ItemIndexFactory.size() != ItemIndexStore.size()", m_idxFactory.size(), csdb.size());
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("ItemIndexStore.getSizeInBytes()", s, csdb.getSizeInBytes());
+		CPPUNIT_ASSERT_MESSAGE("compression type not set", csdb.compressionType() & Static::ItemIndexStore::IndexCompressionType::IC_LZO_GROUPED);
+
+		for(size_t i = 0; i < m_sets.size(); ++i) {
+			uint32_t idxId = m_setIds[i];
+			ItemIndex idx = csdb.at(idxId);
+			uint32_t realIndexSize =  (uint32_t) m_sets[i].size();
+			CPPUNIT_ASSERT_MESSAGE(sserialize::toString("Index at", i), m_sets[i] == idx);
+			CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("IndexIndexStore.idxSize at", i), realIndexSize, csdb.idxSize(idxId));
+			CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("IndexIndexStore.dataSize at", i), sdb.dataSize(idxId), csdb.dataSize(idxId));
+			CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("Index type at", i), sdb.indexType(idxId), csdb.indexType(idxId));
+		}
+		
+		//the decompressed group is cached, concurrent readers in different orders must not interfere
+		std::atomic<uint32_t> mismatches(0);
+		std::vector<std::thread> readers;
+		for(uint32_t t(0); t < 4; ++t) {
+			readers.emplace_back([&, t]() {
+				for(uint32_t round(0); round < 2; ++round) {
+					for(uint32_t i(0), s(csdb.size()); i < s; ++i) {
+						uint32_t idxId = (t % 2 ? s-i-1 : (i*(t+1)) % s);
+						if (sdb.at(idxId) != csdb.at(idxId)) {
+							++mismatches;
+						}
+					}
+				}
+			});
+		}
+		for(std::thread & x : readers) {
+			x.join();
+		}
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("concurrent reads", uint32_t(0), mismatches.load());
+	}
+	
+	void testSummaries() {
+		m_idxFactory.setSummaries(true);
+		CPPUNIT_ASSERT_MESSAGE("Serialization failed", m_idxFactory.flush());
+		m_idxFactory.setSummaries(false);
+
+		UByteArrayAdapter dataAdap( m_idxFactory.getFlushedData());
+		Static::ItemIndexStore sdb(dataAdap);
+		CPPUNIT_ASSERT_MESSAGE("store has no summaries", sdb.hasSummaries());
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("ItemIndexStore.getSizeInBytes()", dataAdap.size(), sdb.getSizeInBytes());
+		
+		UByteArrayAdapter cmpDataAdap(new std::vector<uint8_t>(dataAdap.size(), 0), true);
+		UByteArrayAdapter::OffsetType s = sserialize::ItemIndexFactory::compressWithLZOGrouped(sdb, cmpDataAdap, 1024);
+		cmpDataAdap.shrinkStorage(cmpDataAdap.size()-s);
+		Static::ItemIndexStore csdb(cmpDataAdap);
+		CPPUNIT_ASSERT_MESSAGE("compressed store has no summaries", csdb.hasSummaries());
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("compressed ItemIndexStore.getSizeInBytes()", s, csdb.getSizeInBytes());
+
+		for(size_t i = 0; i < m_sets.size(); ++i) {
+			uint32_t idxId = m_setIds[i];
+			ItemIndexSummary summary( ItemIndexSummary::create(m_sets[i].cbegin(), m_sets[i].cend()) );
+			CPPUNIT_ASSERT_MESSAGE(sserialize::toString("Summary at ", i), summary == sdb.summary(idxId));
+			CPPUNIT_ASSERT_MESSAGE(sserialize::toString("Compressed summary at ", i), summary == csdb.summary(idxId));
+			CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("Empty summary at ", i), m_sets[i].empty(), summary.empty());
+		}
+		//disjoint has to be conservative
+		for(size_t i = 0; i < m_sets.size(); i += 7) {
+			for(size_t j = 0; j < m_sets.size(); j += 5) {
+				uint32_t intersectionSize = (sdb.at(m_setIds[i]) / sdb.at(m_setIds[j])).size();
+				if (sdb.disjoint(m_setIds[i], m_setIds[j])) {
+					CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("Disjoint ", i, " ", j), uint32_t(0), intersectionSize);
+				}
+				uint32_t estimate = sdb.summary(m_setIds[i]).estimateIntersectionSize(sdb.idxSize(m_setIds[i]), sdb.summary(m_setIds[j]), sdb.idxSize(m_setIds[j]));
+				CPPUNIT_ASSERT(estimate <= std::min(sdb.idxSize(m_setIds[i]), sdb.idxSize(m_setIds[j])));
+			}
+		}
+		//disjoint ranges
+		std::vector<uint32_t> av({1, 2, 3}), bv({4, 5, 6});
+		ItemIndexSummary a( ItemIndexSummary::create(av.cbegin(), av.cend()) );
+		ItemIndexSummary b( ItemIndexSummary::create(bv.cbegin(), bv.cend()) );
+		CPPUNIT_ASSERT(a.disjoint(b));
+		CPPUNIT_ASSERT(!a.disjoint(a));
+		CPPUNIT_ASSERT_EQUAL(uint32_t(0), a.estimateIntersectionSize(3, b, 3));
+		CPPUNIT_ASSERT_EQUAL(uint32_t(3), a.estimateIntersectionSize(3, a, 3));
+	}
+	
+	void testTieredStore() {
+		CPPUNIT_ASSERT_MESSAGE("Serialization failed", m_idxFactory.flush());
+
+		Static::ItemIndexStore sdb(m_idxFactory.getFlushedData());
+		
+		Static::detail::TieredItemIndexStore::Config cfg;
+		cfg.promotionThreshold = 2;
+		cfg.maxSmallIdxSize = 16;
+		cfg.maxHotCount = sdb.size()/2;
+		cfg.chunkSize = 1024;
+		auto tieredPriv = new Static::detail::TieredItemIndexStore(sdb, cfg);
+		Static::ItemIndexStore tsdb(tieredPriv);
+		
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("size", sdb.size(), tsdb.size());
+		checkSmallIndexesHot(sdb, cfg, tieredPriv);
+		for(uint32_t round(0); round < 3; ++round) {
+			for(size_t i = 0; i < m_sets.size(); ++i) {
+				uint32_t idxId = m_setIds[i];
+				CPPUNIT_ASSERT_MESSAGE(sserialize::toString("Index at ", i, " in round ", round), m_sets[i] == tsdb.at(idxId));
+				CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("Index size at ", i), sdb.idxSize(idxId), tsdb.idxSize(idxId));
+			}
+		}
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("hot count", cfg.maxHotCount, tieredPriv->hotCount());
+		
+		std::stringstream profile;
+		tieredPriv->writeProfile(profile);
+		Static::detail::TieredItemIndexStore::Config profileCfg;
+		profileCfg.promotionThreshold = 2;
+		profileCfg.maxHotCount = cfg.maxHotCount;
+		auto profiledPriv = new Static::detail::TieredItemIndexStore(sdb, profileCfg);
+		Static::ItemIndexStore psdb(profiledPriv);
+		profiledPriv->loadProfile(profile);
+		for(uint32_t i(0), s(sdb.size()); i < s; ++i) {
+			if (tieredPriv->accessCount(i) >= profileCfg.promotionThreshold) {
+				CPPUNIT_ASSERT_MESSAGE(sserialize::toString("profiled index is hot at ", i), profiledPriv->isHot(i) || profiledPriv->hotCount() == profileCfg.maxHotCount);
+			}
+			CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("Profiled index at ", i), sdb.at(i), psdb.at(i));
+		}
+	}
+	
+	void testTieredStoreFullHotTier() {
+		CPPUNIT_ASSERT_MESSAGE("Serialization failed", m_idxFactory.flush());
+
+		Static::ItemIndexStore sdb(m_idxFactory.getFlushedData());
+		
+		//all indexes are small, but only a few fit into the hot tier
+		Static::detail::TieredItemIndexStore::Config cfg;
+		cfg.promotionThreshold = 1;
+		cfg.maxSmallIdxSize = std::numeric_limits<uint32_t>::max();
+		cfg.maxHotCount = 4;
+		cfg.chunkSize = 1024;
+		CPPUNIT_ASSERT_MESSAGE("store too small to fill the hot tier", sdb.size() > cfg.maxHotCount);
+		auto tieredPriv = new Static::detail::TieredItemIndexStore(sdb, cfg);
+		Static::ItemIndexStore tsdb(tieredPriv);
+		
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("hot count", cfg.maxHotCount, tieredPriv->hotCount());
+		checkSmallIndexesHot(sdb, cfg, tieredPriv);
+		for(size_t i = 0; i < m_sets.size(); ++i) {
+			uint32_t idxId = m_setIds[i];
+			CPPUNIT_ASSERT_MESSAGE(sserialize::toString("Index at ", i), m_sets[i] == tsdb.at(idxId));
+			CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("Index size at ", i), sdb.idxSize(idxId), tsdb.idxSize(idxId));
+		}
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("hot count after access", cfg.maxHotCount, tieredPriv->hotCount());
+	}
+	
+	void testTieredStoreProfileOrder() {
+		typedef Static::detail::TieredItemIndexStore TieredStore;
+		CPPUNIT_ASSERT_MESSAGE("Serialization failed", m_idxFactory.flush());
+
+		Static::ItemIndexStore sdb(m_idxFactory.getFlushedData());
+		CPPUNIT_ASSERT_MESSAGE("store too small", sdb.size() > 4);
+		
+		//accesses of hot indexes still end up in the profile
+		TieredStore::Config cfg;
+		cfg.promotionThreshold = 0;
+		auto tieredPriv = new TieredStore(sdb, cfg);
+		Static::ItemIndexStore tsdb(tieredPriv);
+		CPPUNIT_ASSERT(tieredPriv->promote(1));
+		for(uint32_t i(0); i < 2*TieredStore::HotHitSampleRate; ++i) {
+			CPPUNIT_ASSERT_EQUAL(sdb.at(1), tsdb.at(1));
+		}
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("hot hits", 2*TieredStore::HotHitSampleRate, tieredPriv->accessCount(1));
+		std::stringstream hotProfile;
+		tieredPriv->writeProfile(hotProfile);
+		uint32_t id = 0, count = 0;
+		CPPUNIT_ASSERT(hotProfile >> id >> count);
+		CPPUNIT_ASSERT_EQUAL(uint32_t(1), id);
+		CPPUNIT_ASSERT_EQUAL(2*TieredStore::HotHitSampleRate, count);
+		
+		//the profile is promoted in the order of decreasing counts, not in file order
+		std::stringstream profile;
+		profile << "4 2\n0 3\n3 10\n1 1\n2 7\n";
+		TieredStore::Config profileCfg;
+		profileCfg.promotionThreshold = 2;
+		profileCfg.maxHotCount = 2;
+		auto profiledPriv = new TieredStore(sdb, profileCfg);
+		Static::ItemIndexStore psdb(profiledPriv);
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("promoted", uint32_t(2), profiledPriv->loadProfile(profile));
+		CPPUNIT_ASSERT(profiledPriv->isHot(3));
+		CPPUNIT_ASSERT(profiledPriv->isHot(2));
+		CPPUNIT_ASSERT(!profiledPriv->isHot(0));
+		CPPUNIT_ASSERT(!profiledPriv->isHot(4));
+		CPPUNIT_ASSERT(!profiledPriv->isHot(1));
+		for(uint32_t i(0), s(sdb.size()); i < s; ++i) {
+			CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("Profiled index at ", i), sdb.at(i), psdb.at(i));
+		}
+	}
+	
 	void testVeryLargeItemIndexFactory() {
 	
 	}
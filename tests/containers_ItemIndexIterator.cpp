@@ -1,6 +1,7 @@
 #include <algorithm>
 #include <sserialize/containers/ItemIndexIterator.h>
 #include <sserialize/containers/ItemIndexIteratorSetOp.h>
+#include <sserialize/containers/ItemIndexFactory.h>
 #include <sserialize/algorithm/utilfuncs.h>
 #include "datacreationfuncs.h"
 #include "utilalgos.h"
@@ -99,6 +100,60 @@ public:
 	virtual void tearDown() {}
 };
 
+///leaf iterators of compressed indices decode sequentially
+template<int T_INDEX_TYPE>
+class ItemIndexIteratorCompressedTest: public ItemIndexIteratorTest {
+CPPUNIT_TEST_SUITE( ItemIndexIteratorCompressedTest );
+CPPUNIT_TEST( testEquality );
+CPPUNIT_TEST( testReset );
+CPPUNIT_TEST_SUITE_END();
+public:
+	virtual void setUp() {
+		srcRes() = createNumbersSet(1023);
+		indexRes() = ItemIndexIterator(ItemIndexFactory::create(srcRes(), T_INDEX_TYPE));
+	}
+	virtual void tearDown() {}
+	void testReset() {
+		ItemIndexIterator it(indexRes());
+		for(uint32_t i(0); i < 100 && it.valid(); ++i) {
+			++it;
+		}
+		it.reset();
+		CPPUNIT_ASSERT( it.toItemIndex() == srcRes() );
+		CPPUNIT_ASSERT( indexRes().toItemIndex() == srcRes() );
+	}
+};
+
+template<uint32_t T_SET_COUNT>
+class ItemIndexIteratorTreeTest: public ItemIndexIteratorTest {
+CPPUNIT_TEST_SUITE( ItemIndexIteratorTreeTest );
+CPPUNIT_TEST( testEquality );
+CPPUNIT_TEST( testPartial );
+CPPUNIT_TEST_SUITE_END();
+public:
+	virtual void setUp() {
+		std::vector<ItemIndexIterator> its;
+		srcRes().clear();
+		for(uint32_t i(0); i < T_SET_COUNT; ++i) {
+			std::set<uint32_t> s(createNumbersSet(1+rand()%100));
+			srcRes().insert(s.begin(), s.end());
+			its.push_back(ItemIndexIterator(ItemIndexFactory::create(s, ItemIndex::T_RLE_DE)));
+		}
+		indexRes() = ItemIndexIterator::createTree(its.begin(), its.end(), &createMergeItemIndexIterator);
+	}
+	virtual void tearDown() {}
+	void testPartial() {
+		CPPUNIT_ASSERT_EQUAL( (uint32_t) srcRes().size(), indexRes().count() );
+		for(uint32_t maxCount : std::vector<uint32_t>({0, 1, 7, 100, 0xFFFFFFFF})) {
+			ItemIndex idx = indexRes().toItemIndex(maxCount);
+			std::set<uint32_t>::const_iterator end(srcRes().begin());
+			std::advance(end, std::min<std::size_t>(maxCount, srcRes().size()));
+			CPPUNIT_ASSERT( idx == std::set<uint32_t>(srcRes().begin(), end) );
+		}
+		//neither of them advances the iterator
+		CPPUNIT_ASSERT( indexRes().toItemIndex() == srcRes() );
+	}
+};
 
 int main(int argc, char ** argv) {
 	sserialize::tests::TestBase::init(argc, argv);
@@ -126,6 +181,18 @@ int main(int argc, char ** argv) {
 	runner.addTest( ItemIndexIteratorInterSectingTest<9, 1034>::suite() );
 	runner.addTest( ItemIndexIteratorInterSectingTest<7, 57>::suite() );
 
+	runner.addTest( ItemIndexIteratorCompressedTest<ItemIndex::T_RLE_DE>::suite() );
+	runner.addTest( ItemIndexIteratorCompressedTest<ItemIndex::T_ELIAS_FANO>::suite() );
+	runner.addTest( ItemIndexIteratorCompressedTest<ItemIndex::T_PFOR>::suite() );
+	runner.addTest( ItemIndexIteratorCompressedTest<ItemIndex::T_FOR>::suite() );
+	runner.addTest( ItemIndexIteratorCompressedTest<ItemIndex::T_WAH>::suite() );
+
+	runner.addTest( ItemIndexIteratorTreeTest<0>::suite() );
+	runner.addTest( ItemIndexIteratorTreeTest<1>::suite() );
+	runner.addTest( ItemIndexIteratorTreeTest<2>::suite() );
+	runner.addTest( ItemIndexIteratorTreeTest<3>::suite() );
+	runner.addTest( ItemIndexIteratorTreeTest<7>::suite() );
+
 	bool ok = runner.run();
 	return ok ? 0 : 1;
 }
@@ -65,6 +65,8 @@ CPPUNIT_TEST( testLargestOffsetsSpecial );
 CPPUNIT_TEST( testFromFile );
 CPPUNIT_TEST( testRegularOffsets );
 CPPUNIT_TEST( testSpecialOffsets );
+CPPUNIT_TEST( testEliasFano );
+CPPUNIT_TEST( testAutoMode );
 CPPUNIT_TEST_SUITE_END();
 public:
 	virtual void setUp() {}
@@ -215,6 +217,53 @@ public:
 		}
 	}
 	
+	void testEliasFano() {
+		srand(0);
+		for(uint32_t i = 0; i < 512; i++) {
+			std::vector<uint64_t> realValues;
+			uint64_t value = rand() % 1000;
+			for(uint32_t j(0), s(rand() % 5000); j < s; ++j) {
+				//clustered offsets with some large jumps and duplicates
+				value += (j % 97 == 0 ? uint64_t(rand()) << (rand() % 20) : rand() % 300);
+				realValues.push_back(value);
+			}
+			UByteArrayAdapter dest(new std::vector<uint8_t>(), true);
+			CPPUNIT_ASSERT_MESSAGE("creation", Static::SortedOffsetIndexPrivate::create(realValues, dest, Static::SortedOffsetIndexPrivate::CM_ELIAS_FANO));
+			Static::SortedOffsetIndex idx(dest);
+			
+			CPPUNIT_ASSERT_EQUAL_MESSAGE("size", SizeType(realValues.size()), idx.size());
+			CPPUNIT_ASSERT_EQUAL_MESSAGE("sizeInBytes", (OffsetType)dest.size(), idx.getSizeInBytes());
+			if (realValues.size() > 1) {
+				CPPUNIT_ASSERT_EQUAL_MESSAGE("type", Static::SortedOffsetIndex::T_ELIAS_FANO, idx.type());
+				CPPUNIT_ASSERT_EQUAL_MESSAGE("storage size estimate", (OffsetType)dest.size(), Static::SortedOffsetIndexPrivate::eliasFanoStorageSize(realValues.size(), realValues.back()));
+			}
+			for(std::size_t j(0), s(realValues.size()); j < s; ++j) {
+				std::stringstream ss;
+				ss << "id at " << j;
+				CPPUNIT_ASSERT_EQUAL_MESSAGE(ss.str(), (OffsetType)realValues[j], idx.at(j));
+			}
+		}
+	}
+	
+	void testAutoMode() {
+		std::vector<uint64_t> regular, irregular;
+		for(uint64_t i(0); i < 100000; ++i) {
+			regular.push_back(i*8);
+			irregular.push_back(i*8 + (i > 50000 ? 10000000 : 0) + (i*i) % 7);
+		}
+		for(const std::vector<uint64_t> * values : {&regular, &irregular}) {
+			UByteArrayAdapter regDest(new std::vector<uint8_t>(), true);
+			UByteArrayAdapter efDest(new std::vector<uint8_t>(), true);
+			UByteArrayAdapter autoDest(new std::vector<uint8_t>(), true);
+			Static::SortedOffsetIndexPrivate::create(*values, regDest, Static::SortedOffsetIndexPrivate::CM_REGLINE);
+			Static::SortedOffsetIndexPrivate::create(*values, efDest, Static::SortedOffsetIndexPrivate::CM_ELIAS_FANO);
+			Static::SortedOffsetIndexPrivate::create(*values, autoDest, Static::SortedOffsetIndexPrivate::CM_AUTO);
+			CPPUNIT_ASSERT_EQUAL_MESSAGE("auto size", std::min(regDest.size(), efDest.size()), autoDest.size());
+			Static::SortedOffsetIndex idx(autoDest);
+			CPPUNIT_ASSERT(idx == *values);
+		}
+	}
+	
 	void testFromFile() {
 		if (!inFile.empty()) {
 			std::ifstream file;
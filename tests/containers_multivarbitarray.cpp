@@ -15,6 +15,8 @@ CPPUNIT_TEST_SUITE( MultiVarBitArrayTest );
 CPPUNIT_TEST( testSize );
 CPPUNIT_TEST( testBitCount );
 CPPUNIT_TEST( testEquality );
+CPPUNIT_TEST( testGetRange );
+CPPUNIT_TEST( testGetRows );
 CPPUNIT_TEST_SUITE_END();
 private:
 	using value_type = MultiVarBitArray::value_type;
@@ -71,6 +73,35 @@ public:
 		}
 	}
 	
+	void testGetRange() {
+		for(SizeType pos : {SizeType(0), SizeType(TValueCount/3), SizeType(TValueCount-1)}) {
+			SizeType count = std::min<SizeType>(TValueCount-pos, 257);
+			std::vector<value_type> buffer(count);
+			for(uint32_t j = 0; j < TSubValueCount; j++) {
+				m_arr.getRange(pos, count, j, buffer.data());
+				for(SizeType i = 0; i < count; i++) {
+					std::stringstream ss;
+					ss << "pos=" << pos+i << ", subpos=" << j;
+					CPPUNIT_ASSERT_EQUAL_MESSAGE(ss.str(), m_values[pos+i][j], buffer[i]);
+				}
+			}
+		}
+	}
+	
+	void testGetRows() {
+		SizeType pos = TValueCount/4;
+		SizeType count = TValueCount-pos;
+		std::vector<value_type> buffer(count*TSubValueCount);
+		m_arr.getRows(pos, count, buffer.data());
+		for(SizeType i = 0; i < count; i++) {
+			for(uint32_t j = 0; j < TSubValueCount; j++) {
+				std::stringstream ss;
+				ss << "pos=" << pos+i << ", subpos=" << j;
+				CPPUNIT_ASSERT_EQUAL_MESSAGE(ss.str(), m_values[pos+i][j], buffer[i*TSubValueCount+j]);
+			}
+		}
+	}
+	
 	void testSize() {
 		CPPUNIT_ASSERT_EQUAL_MESSAGE("size()", SizeType(TValueCount), m_arr.size());
 		CPPUNIT_ASSERT_EQUAL_MESSAGE("getSizeInBytes()", (UByteArrayAdapter::OffsetType) m_data.tellPutPtr()-4, m_arr.getSizeInBytes());
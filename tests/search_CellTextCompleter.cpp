@@ -4,6 +4,7 @@
 #include <sserialize/spatial/GeoHierarchy.h>
 #include <sserialize/Static/CellTextCompleter.h>
 #include <sserialize/search/OOMSACTCCreator.h>
+#include <sserialize/strings/LevenshteinAutomaton.h>
 
 //config stuff
 
@@ -27,6 +28,31 @@ cellid_type maxCells = 10;
 // sserialize::StringCompleter::SupportedQuerries supportedQuerries = sserialize::StringCompleter::SQ_SUFFIX;
 sserialize::StringCompleter::SupportedQuerries supportedQuerries = sserialize::StringCompleter::SQ_EPSP;
 
+/** Fuzzy match of @param qstr in @param str by plain dynamic programming over the code points.
+  * QT_SUFFIX and QT_SUBSTRING allow to skip a prefix of @param str, QT_PREFIX and QT_SUBSTRING a suffix.
+  */
+bool fuzzyMatches(const std::string & str, const std::string & qstr, sserialize::StringCompleter::QuerryType qt) {
+	using SC = sserialize::StringCompleter;
+	std::vector<uint32_t> s, q;
+	utf8::utf8to32(str.cbegin(), str.cend(), std::back_inserter(s));
+	utf8::utf8to32(qstr.cbegin(), qstr.cend(), std::back_inserter(q));
+	uint32_t maxDistance = sserialize::LevenshteinAutomaton::defaultMaxDistance(qstr);
+	bool freeBegin = qt & (SC::QT_SUFFIX | SC::QT_SUBSTRING);
+	bool freeEnd = qt & (SC::QT_PREFIX | SC::QT_SUBSTRING);
+	//d[j] is the distance of the first i code points of q to a substring of s ending at j
+	std::vector<uint32_t> d(s.size()+1), prev(s.size()+1);
+	for(std::size_t j(0); j <= s.size(); ++j) {
+		d[j] = (freeBegin ? 0 : (uint32_t) j);
+	}
+	for(std::size_t i(1); i <= q.size(); ++i) {
+		prev.swap(d);
+		d[0] = (uint32_t) i;
+		for(std::size_t j(1); j <= s.size(); ++j) {
+			d[j] = std::min(prev[j-1] + (q[i-1] == s[j-1] ? 0 : 1), std::min(prev[j], d[j-1]) + 1);
+		}
+	}
+	return (freeEnd ? *std::min_element(d.begin(), d.end()) : d.back()) <= maxDistance;
+}
 
 struct Item {
 	itemid_type id;
@@ -55,7 +81,7 @@ struct Item {
 	
 	bool matches(const std::string & qstr, sserialize::StringCompleter::QuerryType qt) const {
 		for(const auto & x : strs) {
-			if (sserialize::StringCompleter::matches(x, qstr, qt)) {
+			if (qt & sserialize::StringCompleter::QT_FUZZY ? fuzzyMatches(x, qstr, qt) : sserialize::StringCompleter::matches(x, qstr, qt)) {
 				return true;
 			}
 		}
@@ -407,37 +433,71 @@ public:
 		
 		//now do the test
 		for(uint32_t i(0), s((uint32_t) myTestStrings.size()); i < s; ++i) {
-			const std::string & qstr  = myTestStrings[i];
-			sserialize::CellQueryResult testCqr, realCqr;
-			std::vector<sserialize::ItemIndex> realPm;
-			std::string baseMessage = "strs[" + std::to_string(i) + "]=" + qstr + ",type=";
-			switch(it) {
-			case RegionArrangement::IT_ITEM:
-				testCqr = sctc().items<sserialize::CellQueryResult>(qstr, qt);
-				ra().find(qstr, qt, it, realCqr, realPm);
-				baseMessage += "items";
-				break;
-			case RegionArrangement::IT_REGION:
-				testCqr = sctc().regions<sserialize::CellQueryResult>(qstr, qt);
-				ra().find(qstr, qt, it, realCqr, realPm);
-				baseMessage += "regions";
-				break;
-			case RegionArrangement::IT_ALL:
-				testCqr = sctc().complete<sserialize::CellQueryResult>(qstr, qt);
-				ra().find(qstr, qt, it, realCqr, realPm);
-				baseMessage += "all";
-				break;
-			default:
-				std::runtime_error("Invalid type");
-			};
-			baseMessage += ",";
-			CPPUNIT_ASSERT_EQUAL_MESSAGE(baseMessage+"cqr.cellCount()", realCqr.cellCount(), testCqr.cellCount());
-			for(uint32_t i(0), s(realCqr.cellCount()); i < s; ++i) {
-				CPPUNIT_ASSERT_EQUAL_MESSAGE(baseMessage+"cellid at " + std::to_string(i), realCqr.cellId(i), testCqr.cellId(i));
-				CPPUNIT_ASSERT_EQUAL_MESSAGE(baseMessage+"fullMatch at " + std::to_string(i), realCqr.fullMatch(i), testCqr.fullMatch(i));
-				if (!realCqr.fullMatch(i)) {
-					CPPUNIT_ASSERT_EQUAL_MESSAGE(baseMessage+"pm index at " + std::to_string(i), realPm.at(realCqr.idxId(i)), testCqr.idx(i));
-				}
+			checkCompletion(myTestStrings[i], qt, it, "strs[" + std::to_string(i) + "]=" + myTestStrings[i] + ",type=");
+		}
+	}
+	
+	///Queries derived from the strings of the items with a single edit, a prefix, a suffix and a substring of each
+	void testFuzzyCompletion(sserialize::StringCompleter::QuerryType qt) {
+		if ((int(qt) & int(supportedQuerries) )== sserialize::StringCompleter::QT_NONE) {
+			return;
+		}
+		std::set<std::string> baseTestStrings;
+		for(const Item & item : ra().items) {
+			baseTestStrings.insert(item.strs.begin(), item.strs.end());
+		}
+		for(const Item & item : ra().regions) {
+			baseTestStrings.insert(item.strs.begin(), item.strs.end());
+		}
+		std::set<std::string> testStrings;
+		uint32_t step = std::max<uint32_t>(1, (uint32_t) baseTestStrings.size()/25);
+		uint32_t count = 0;
+		for(const std::string & str : baseTestStrings) {
+			if (count++ % step != 0 || str.size() < 3) {
+				continue;
+			}
+			std::vector<std::string> parts = {str, str.substr(0, 6), str.substr(str.size() > 6 ? str.size()-6 : 0), str.substr(str.size()/3, 6)};
+			for(std::string & x : parts) {
+				//replace the middle character by a two byte code point
+				x.replace(x.size()/2, 1, "\xC3\xBC");
+				testStrings.insert(x);
+			}
+		}
+		uint32_t i = 0;
+		for(const std::string & qstr : testStrings) {
+			checkCompletion(qstr, sserialize::StringCompleter::QuerryType(qt | sserialize::StringCompleter::QT_FUZZY), RegionArrangement::IT_ALL, "fuzzy strs[" + std::to_string(i++) + "]=" + qstr + ",type=");
+		}
+	}
+	
+	void checkCompletion(const std::string & qstr, sserialize::StringCompleter::QuerryType qt, RegionArrangement::ItemTypes it, std::string baseMessage) {
+		sserialize::CellQueryResult testCqr, realCqr;
+		std::vector<sserialize::ItemIndex> realPm;
+		switch(it) {
+		case RegionArrangement::IT_ITEM:
+			testCqr = sctc().items<sserialize::CellQueryResult>(qstr, qt);
+			ra().find(qstr, qt, it, realCqr, realPm);
+			baseMessage += "items";
+			break;
+		case RegionArrangement::IT_REGION:
+			testCqr = sctc().regions<sserialize::CellQueryResult>(qstr, qt);
+			ra().find(qstr, qt, it, realCqr, realPm);
+			baseMessage += "regions";
+			break;
+		case RegionArrangement::IT_ALL:
+			testCqr = sctc().complete<sserialize::CellQueryResult>(qstr, qt);
+			ra().find(qstr, qt, it, realCqr, realPm);
+			baseMessage += "all";
+			break;
+		default:
+			std::runtime_error("Invalid type");
+		};
+		baseMessage += ",";
+		CPPUNIT_ASSERT_EQUAL_MESSAGE(baseMessage+"cqr.cellCount()", realCqr.cellCount(), testCqr.cellCount());
+		for(uint32_t i(0), s(realCqr.cellCount()); i < s; ++i) {
+			CPPUNIT_ASSERT_EQUAL_MESSAGE(baseMessage+"cellid at " + std::to_string(i), realCqr.cellId(i), testCqr.cellId(i));
+			CPPUNIT_ASSERT_EQUAL_MESSAGE(baseMessage+"fullMatch at " + std::to_string(i), realCqr.fullMatch(i), testCqr.fullMatch(i));
+			if (!realCqr.fullMatch(i)) {
+				CPPUNIT_ASSERT_EQUAL_MESSAGE(baseMessage+"pm index at " + std::to_string(i), realPm.at(realCqr.idxId(i)), testCqr.idx(i));
 			}
 		}
 	}
@@ -495,6 +555,55 @@ public:
 	void testSubStringAll() {
 		testCompletion(sserialize::StringCompleter::QT_SUBSTRING, RegionArrangement::IT_ALL);
 	}
+	
+	void testFuzzyExactAll() {
+		testFuzzyCompletion(sserialize::StringCompleter::QT_EXACT);
+	}
+	
+	void testFuzzyPrefixAll() {
+		testFuzzyCompletion(sserialize::StringCompleter::QT_PREFIX);
+	}
+	
+	void testFuzzySuffixAll() {
+		testFuzzyCompletion(sserialize::StringCompleter::QT_SUFFIX);
+	}
+	
+	void testFuzzySubStringAll() {
+		testFuzzyCompletion(sserialize::StringCompleter::QT_SUBSTRING);
+	}
+	
+	void testCompleteInCell() {
+		std::set<std::string> testStrings;
+		for(const Item & item : ra().items) {
+			testStrings.insert(item.strs.begin(), item.strs.end());
+		}
+		for(const Item & item : ra().regions) {
+			testStrings.insert(item.strs.begin(), item.strs.end());
+		}
+		sserialize::StringCompleter::QuerryType qt = sserialize::StringCompleter::QT_EXACT;
+		for(const std::string & qstr : testStrings) {
+			sserialize::CellQueryResult cqr = sctc().complete<sserialize::CellQueryResult>(qstr, qt);
+			std::map<cellid_type, uint32_t> cell2Pos;
+			for(uint32_t i(0), s(cqr.cellCount()); i < s; ++i) {
+				cell2Pos[cqr.cellId(i)] = i;
+			}
+			for(cellid_type cellId(0), s(ra().ci->cellSize()); cellId < s; ++cellId) {
+				std::string msg = "qstr=" + qstr + ",cellId=" + std::to_string(cellId);
+				sserialize::CellQueryResult cellCqr = sctc().completeInCell<sserialize::CellQueryResult>(qstr, qt, cellId);
+				if (!cell2Pos.count(cellId)) {
+					CPPUNIT_ASSERT_EQUAL_MESSAGE(msg, uint32_t(0), cellCqr.cellCount());
+					continue;
+				}
+				uint32_t pos = cell2Pos.at(cellId);
+				CPPUNIT_ASSERT_EQUAL_MESSAGE(msg, uint32_t(1), cellCqr.cellCount());
+				CPPUNIT_ASSERT_EQUAL_MESSAGE(msg, cellId, cellCqr.cellId(0));
+				CPPUNIT_ASSERT_EQUAL_MESSAGE(msg, cqr.fullMatch(pos), cellCqr.fullMatch(0));
+				if (!cqr.fullMatch(pos)) {
+					CPPUNIT_ASSERT_EQUAL_MESSAGE(msg, cqr.idx(pos), cellCqr.idx(0));
+				}
+			}
+		}
+	}
 };
 
 
@@ -568,15 +677,22 @@ CPPUNIT_TEST( testSubStringItem );
 CPPUNIT_TEST( testSubStringRegion );
 CPPUNIT_TEST( testSubStringAll );
 
+CPPUNIT_TEST( testFuzzyExactAll );
+CPPUNIT_TEST( testFuzzyPrefixAll );
+CPPUNIT_TEST( testFuzzySuffixAll );
+CPPUNIT_TEST( testFuzzySubStringAll );
+
+CPPUNIT_TEST( testCompleteInCell );
 CPPUNIT_TEST_SUITE_END();
 private:
+	uint32_t m_checkpointInterval;
 	sserialize::Static::CellTextCompleter m_ctc;
-private:
+protected:
 	virtual const sserialize::Static::CellTextCompleter & sctc() override {
 		return m_ctc;
 	}
 public:
-	OOMCTCTest() : CTCBaseTest() {}
+	OOMCTCTest(uint32_t checkpointInterval = 0) : CTCBaseTest(), m_checkpointInterval(checkpointInterval) {}
 	virtual ~OOMCTCTest() {}
 	virtual void setUp() override{
 		sserialize::ItemIndexFactory idxFactory(true);
@@ -586,7 +702,7 @@ public:
 								ra().regions.begin(), ra().regions.end(),
 								OOM_SA_CTC_Traits(), OOM_SA_CTC_Traits(),
 								0xFFFFFFFF, 0, 2, 0, sserialize::MM_SLOW_FILEBASED, supportedQuerries,
-								idxFactory, dest);
+								idxFactory, dest, m_checkpointInterval);
 		idxFactory.flush();
 		sserialize::Static::ItemIndexStore idxStore(idxFactory.getFlushedData());
 		m_ctc = sserialize::Static::CellTextCompleter(dest, idxStore, ra().gh);
@@ -594,12 +710,30 @@ public:
 	virtual void tearDown() override {}
 };
 
+///Same as OOMCTCTest but the ptr streams of the payloads have checkpoints
+class OOMCTCCheckpointsTest: public OOMCTCTest {
+CPPUNIT_TEST_SUB_SUITE( OOMCTCCheckpointsTest, OOMCTCTest );
+CPPUNIT_TEST( testHasCheckpoints );
+CPPUNIT_TEST_SUITE_END();
+public:
+	OOMCTCCheckpointsTest() : OOMCTCTest(3) {}
+	virtual ~OOMCTCCheckpointsTest() {}
+	void testHasCheckpoints() {
+		for(const Item & item : ra().items) {
+			for(const std::string & str : item.strs) {
+				CPPUNIT_ASSERT_MESSAGE(str, sctc().trie().at(str, false).hasCheckpoints());
+			}
+		}
+	}
+};
+
 int main(int argc, char ** argv) {
 	sserialize::tests::TestBase::init(argc, argv);
 	
 	srand( 0 );
 	CppUnit::TextUi::TestRunner runner;
 	runner.addTest(  OOMCTCTest::suite() );
+	runner.addTest(  OOMCTCCheckpointsTest::suite() );
 	if (sserialize::tests::TestBase::popProtector()) {
 		runner.eventManager().popProtector();
 	}
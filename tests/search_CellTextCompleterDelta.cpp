@@ -0,0 +1,263 @@
+#include <sserialize/search/CellTextCompleterDelta.h>
+#include <sserialize/containers/ItemIndexFactory.h>
+#include <sserialize/Static/ItemIndexStore.h>
+#include <sserialize/strings/LevenshteinAutomaton.h>
+#include <sserialize/utility/printers.h>
+#include <set>
+#include "TestBase.h"
+
+using itemid_type = sserialize::CellTextCompleterDelta::itemid_type;
+using cellid_type = sserialize::CellTextCompleterDelta::cellid_type;
+using QuerryType = sserialize::StringCompleter::QuerryType;
+
+uint32_t cellCount = 20;
+uint32_t itemCount = 200;
+
+uint32_t editDistance(const std::string & a, const std::string & b) {
+	std::vector<uint32_t> prev(b.size()+1), cur(b.size()+1);
+	for(std::size_t j(0); j <= b.size(); ++j) {
+		prev[j] = (uint32_t) j;
+	}
+	for(std::size_t i(1); i <= a.size(); ++i) {
+		cur[0] = (uint32_t) i;
+		for(std::size_t j(1); j <= b.size(); ++j) {
+			cur[j] = std::min<uint32_t>(prev[j-1] + (a[i-1] == b[j-1] ? 0 : 1), std::min(prev[j], cur[j-1]) + 1);
+		}
+		prev.swap(cur);
+	}
+	return prev.back();
+}
+
+///Strings are used as exact and as suffix strings, so QT_FUZZY compares all substrings that qt allows with qstr
+bool fuzzyMatches(const std::string & str, const std::string & qstr, QuerryType qt) {
+	using SC = sserialize::StringCompleter;
+	uint32_t maxDistance = sserialize::LevenshteinAutomaton::defaultMaxDistance(qstr);
+	bool anySuffix = qt & (SC::QT_SUFFIX | SC::QT_SUBSTRING);
+	bool anyPrefix = qt & (SC::QT_PREFIX | SC::QT_SUBSTRING);
+	for(std::size_t begin(0); begin < str.size() || begin == 0; ++begin) {
+		for(std::size_t end(begin); end <= str.size(); ++end) {
+			bool allowed = (begin == 0 || anySuffix) && (end == str.size() || anyPrefix) && (begin == 0 || end == str.size() || (qt & SC::QT_SUBSTRING));
+			if (allowed && editDistance(str.substr(begin, end-begin), qstr) <= maxDistance) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+struct Item {
+	std::vector<cellid_type> cells;
+	std::vector<std::string> strs;
+	bool matches(const std::string & qstr, QuerryType qt) const {
+		for(const std::string & x : strs) {
+			if (qt & sserialize::StringCompleter::QT_FUZZY ? fuzzyMatches(x, qstr, qt) : sserialize::StringCompleter::matches(x, qstr, qt)) {
+				return true;
+			}
+		}
+		return false;
+	}
+};
+
+class CellInfo: public sserialize::interface::CQRCellInfoIface {
+public:
+	std::vector<uint32_t> itemsCount;
+	std::vector<uint32_t> itemsPtr;
+public:
+	virtual SizeType cellSize() const override { return (SizeType) itemsPtr.size(); }
+	virtual sserialize::spatial::GeoRect cellBoundary(CellId) const override { return sserialize::spatial::GeoRect(); }
+	virtual SizeType cellItemsCount(CellId cellId) const override { return itemsCount.at(cellId); }
+	virtual IndexId cellItemsPtr(CellId cellId) const override { return itemsPtr.at(cellId); }
+};
+
+class TestCellTextCompleterDelta: public sserialize::tests::TestBase {
+CPPUNIT_TEST_SUITE( TestCellTextCompleterDelta );
+CPPUNIT_TEST( testApply );
+CPPUNIT_TEST( testSerialization );
+CPPUNIT_TEST( testMerge );
+CPPUNIT_TEST_SUITE_END();
+private:
+	std::vector<Item> m_base;
+	sserialize::Static::ItemIndexStore m_idxStore;
+	sserialize::CellQueryResult::CellInfo m_ci;
+private:
+	static std::string randomString() {
+		std::string ret;
+		for(uint32_t i(0), s(1+rand()%4); i < s; ++i) {
+			ret += (char)('a' + rand()%4);
+		}
+		return ret;
+	}
+	static Item randomItem() {
+		Item item;
+		std::set<cellid_type> cells;
+		for(uint32_t i(0), s(1+rand()%3); i < s; ++i) {
+			cells.insert(rand() % cellCount);
+		}
+		item.cells.assign(cells.begin(), cells.end());
+		for(uint32_t i(0), s(1+rand()%3); i < s; ++i) {
+			item.strs.push_back(randomString());
+		}
+		return item;
+	}
+	std::vector<std::string> queries() const {
+		std::vector<std::string> ret;
+		for(char a('a'); a < 'e'; ++a) {
+			ret.emplace_back(1, a);
+			for(char b('a'); b < 'e'; ++b) {
+				ret.push_back(std::string(1, a) + b);
+			}
+		}
+		//long enough to allow edits in fuzzy queries
+		for(const char * x : {"abc", "bad", "cdd", "abcd", "dcba", "aabb"}) {
+			ret.emplace_back(x);
+		}
+		return ret;
+	}
+	///Result of the query on the items, like a static index created from them
+	sserialize::CellQueryResult cqr(const std::vector<Item> & items, const std::string & qstr, QuerryType qt) const {
+		std::vector< std::vector<itemid_type> > cellItems(cellCount), cellMatches(cellCount);
+		for(itemid_type itemId(0); itemId < items.size(); ++itemId) {
+			bool match = items[itemId].matches(qstr, qt);
+			for(cellid_type cellId : items[itemId].cells) {
+				cellItems[cellId].push_back(itemId);
+				if (match) {
+					cellMatches[cellId].push_back(itemId);
+				}
+			}
+		}
+		std::vector<uint32_t> fm, pm;
+		std::vector<sserialize::ItemIndex> pmIdx;
+		for(cellid_type cellId(0); cellId < cellCount; ++cellId) {
+			if (!cellMatches[cellId].size()) {
+				continue;
+			}
+			if (cellMatches[cellId].size() == cellItems[cellId].size()) {
+				fm.push_back(cellId);
+			}
+			else {
+				pm.push_back(cellId);
+				pmIdx.emplace_back(cellMatches[cellId]);
+			}
+		}
+		return sserialize::CellQueryResult(sserialize::ItemIndex(fm), sserialize::ItemIndex(pm), pmIdx.cbegin(), m_ci, m_idxStore, sserialize::CellQueryResult::FF_DEFAULTS);
+	}
+	void checkEqual(const std::vector<Item> & items, const sserialize::CellQueryResult & result, const std::string & qstr, QuerryType qt) {
+		std::vector< std::set<itemid_type> > want(cellCount);
+		for(itemid_type itemId(0); itemId < items.size(); ++itemId) {
+			if (items[itemId].matches(qstr, qt)) {
+				for(cellid_type cellId : items[itemId].cells) {
+					want[cellId].insert(itemId);
+				}
+			}
+		}
+		std::vector< std::set<itemid_type> > have(cellCount);
+		for(auto it(result.begin()), end(result.end()); it != end; ++it) {
+			sserialize::ItemIndex idx(it.items());
+			CPPUNIT_ASSERT_MESSAGE("empty cell in result", idx.size());
+			for(uint32_t i(0); i < idx.size(); ++i) {
+				have.at(it.cellId()).insert(idx.at(i));
+			}
+		}
+		for(cellid_type cellId(0); cellId < cellCount; ++cellId) {
+			CPPUNIT_ASSERT_MESSAGE(sserialize::toString("qstr=", qstr, " qt=", (int)qt, " cell=", cellId), want[cellId] == have[cellId]);
+		}
+	}
+	///Applies random changes to a copy of the base and records them in @param delta
+	std::vector<Item> randomChanges(const std::vector<Item> & base, sserialize::CellTextCompleterDelta & delta) {
+		std::vector<Item> items(base);
+		for(uint32_t i(0); i < itemCount/10; ++i) {
+			itemid_type itemId = rand() % base.size();
+			Item item = randomItem();
+			if (rand() % 3 == 0) {
+				item.cells.clear();
+				item.strs.clear();
+				delta.remove(itemId, base[itemId].cells);
+			}
+			else {
+				delta.update(itemId, base[itemId].cells, item.cells, item.strs, item.strs);
+			}
+			items[itemId] = item;
+		}
+		for(uint32_t i(0); i < itemCount/20; ++i) {
+			Item item = randomItem();
+			delta.insert((itemid_type) items.size(), item.cells, item.strs, item.strs);
+			items.push_back(item);
+		}
+		return items;
+	}
+	void checkAll(const std::vector<Item> & items, const sserialize::CellTextCompleterDelta & delta) {
+		std::vector<QuerryType> qts = {
+			sserialize::StringCompleter::QT_EXACT,
+			sserialize::StringCompleter::QT_PREFIX,
+			sserialize::StringCompleter::QT_SUFFIX,
+			sserialize::StringCompleter::QT_SUBSTRING,
+			QuerryType(sserialize::StringCompleter::QT_FUZZY | sserialize::StringCompleter::QT_EXACT),
+			QuerryType(sserialize::StringCompleter::QT_FUZZY | sserialize::StringCompleter::QT_PREFIX),
+			QuerryType(sserialize::StringCompleter::QT_FUZZY | sserialize::StringCompleter::QT_SUFFIX),
+			QuerryType(sserialize::StringCompleter::QT_FUZZY | sserialize::StringCompleter::QT_SUBSTRING)
+		};
+		for(QuerryType qt : qts) {
+			for(const std::string & qstr : queries()) {
+				checkEqual(items, delta.apply(cqr(m_base, qstr, qt), qstr, qt), qstr, qt);
+			}
+		}
+	}
+public:
+	virtual void setUp() {
+		srand(0);
+		m_base.clear();
+		for(uint32_t i(0); i < itemCount; ++i) {
+			m_base.push_back(randomItem());
+		}
+		std::vector< std::vector<itemid_type> > cellItems(cellCount);
+		for(itemid_type itemId(0); itemId < m_base.size(); ++itemId) {
+			for(cellid_type cellId : m_base[itemId].cells) {
+				cellItems[cellId].push_back(itemId);
+			}
+		}
+		sserialize::ItemIndexFactory idxFactory(true);
+		CellInfo * ci = new CellInfo();
+		for(const auto & x : cellItems) {
+			ci->itemsCount.push_back((uint32_t) x.size());
+			ci->itemsPtr.push_back(idxFactory.addIndex(x));
+		}
+		idxFactory.flush();
+		m_idxStore = sserialize::Static::ItemIndexStore(idxFactory.getFlushedData());
+		m_ci.reset(ci);
+	}
+	virtual void tearDown() {}
+	void testApply() {
+		sserialize::CellTextCompleterDelta empty;
+		checkAll(m_base, empty);
+		sserialize::CellTextCompleterDelta delta;
+		std::vector<Item> items = randomChanges(m_base, delta);
+		checkAll(items, delta);
+	}
+	void testSerialization() {
+		sserialize::CellTextCompleterDelta delta;
+		std::vector<Item> items = randomChanges(m_base, delta);
+		sserialize::UByteArrayAdapter d(sserialize::UByteArrayAdapter::createCache(0, sserialize::MM_PROGRAM_MEMORY));
+		d << delta;
+		sserialize::CellTextCompleterDelta loaded(d);
+		CPPUNIT_ASSERT(delta.touchedItems() == loaded.touchedItems());
+		checkAll(items, loaded);
+	}
+	void testMerge() {
+		sserialize::CellTextCompleterDelta first, second;
+		std::vector<Item> items = randomChanges(m_base, first);
+		//the second delta refers to the base patched by the first one
+		std::vector<Item> tmp = randomChanges(items, second);
+		first.merge(second);
+		checkAll(tmp, first);
+	}
+};
+
+int main(int argc, char ** argv) {
+	sserialize::tests::TestBase::init(argc, argv);
+
+	srand( 0 );
+	CppUnit::TextUi::TestRunner runner;
+	runner.addTest(  TestCellTextCompleterDelta::suite() );
+	bool ok = runner.run();
+	return ok ? 0 : 1;
+}
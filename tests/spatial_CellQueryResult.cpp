@@ -0,0 +1,129 @@
+#include <sserialize/spatial/CellQueryResult.h>
+#include <sserialize/containers/ItemIndexFactory.h>
+#include <sserialize/Static/ItemIndexStore.h>
+#include <sserialize/utility/printers.h>
+#include <set>
+#include "TestBase.h"
+
+uint32_t cellCount = 8;
+uint32_t cellSize = 100;
+
+class CellInfo: public sserialize::interface::CQRCellInfoIface {
+public:
+	std::vector<uint32_t> itemsPtr;
+public:
+	virtual SizeType cellSize() const override { return (SizeType) itemsPtr.size(); }
+	virtual sserialize::spatial::GeoRect cellBoundary(CellId) const override { return sserialize::spatial::GeoRect(); }
+	virtual SizeType cellItemsCount(CellId) const override { return ::cellSize; }
+	virtual IndexId cellItemsPtr(CellId cellId) const override { return itemsPtr.at(cellId); }
+};
+
+///Set operations on partial matched cells whose indexes are disjoint according to the summaries of the store
+class TestCellQueryResult: public sserialize::tests::TestBase {
+CPPUNIT_TEST_SUITE( TestCellQueryResult );
+CPPUNIT_TEST( testDisjointSummaries );
+CPPUNIT_TEST( testUnite );
+CPPUNIT_TEST( testIntersect );
+CPPUNIT_TEST( testDiff );
+CPPUNIT_TEST_SUITE_END();
+private:
+	typedef std::vector< std::set<uint32_t> > CellItems;
+private:
+	sserialize::ItemIndexFactory m_idxFactory;
+	sserialize::Static::ItemIndexStore m_idxStore;
+	sserialize::CellQueryResult::CellInfo m_ci;
+	//items of the first and the second query in each cell, the id ranges do not overlap
+	CellItems m_first;
+	CellItems m_second;
+	std::vector<uint32_t> m_firstPtrs;
+	std::vector<uint32_t> m_secondPtrs;
+private:
+	static std::set<uint32_t> range(uint32_t cellId, uint32_t begin, uint32_t end) {
+		std::set<uint32_t> ret;
+		for(uint32_t i(begin); i < end; ++i) {
+			ret.insert(cellId*::cellSize + i);
+		}
+		return ret;
+	}
+	sserialize::CellQueryResult cqr(const std::vector<uint32_t> & ptrs) const {
+		std::vector<uint32_t> cells;
+		for(uint32_t cellId(0); cellId < cellCount; ++cellId) {
+			cells.push_back(cellId);
+		}
+		return sserialize::CellQueryResult(sserialize::ItemIndex(), sserialize::ItemIndex(cells), ptrs.cbegin(), m_ci, m_idxStore, sserialize::CellQueryResult::FF_DEFAULTS);
+	}
+	void check(const CellItems & want, const sserialize::CellQueryResult & result) {
+		CellItems have(cellCount);
+		for(auto it(result.begin()), end(result.end()); it != end; ++it) {
+			sserialize::ItemIndex idx(it.items());
+			CPPUNIT_ASSERT_MESSAGE("empty cell in result", idx.size());
+			have.at(it.cellId()).insert(idx.begin(), idx.end());
+			CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("cell=", it.cellId()), idx.size() == ::cellSize, it.fullMatch());
+		}
+		for(uint32_t cellId(0); cellId < cellCount; ++cellId) {
+			CPPUNIT_ASSERT_MESSAGE(sserialize::toString("cell=", cellId), want[cellId] == have[cellId]);
+		}
+	}
+public:
+	TestCellQueryResult() : m_idxFactory(true) {}
+	virtual void setUp() {
+		m_first.clear();
+		m_second.clear();
+		m_firstPtrs.clear();
+		m_secondPtrs.clear();
+		CellInfo * ci = new CellInfo();
+		for(uint32_t cellId(0); cellId < cellCount; ++cellId) {
+			ci->itemsPtr.push_back(m_idxFactory.addIndex(range(cellId, 0, ::cellSize)));
+			//odd cells are covered completely by both queries
+			if (cellId % 2) {
+				m_first.push_back(range(cellId, 0, 50));
+				m_second.push_back(range(cellId, 50, 100));
+			}
+			else {
+				m_first.push_back(range(cellId, 0, 40));
+				m_second.push_back(range(cellId, 60, 90));
+			}
+			m_firstPtrs.push_back(m_idxFactory.addIndex(m_first.back()));
+			m_secondPtrs.push_back(m_idxFactory.addIndex(m_second.back()));
+		}
+		m_idxFactory.setSummaries(true);
+		CPPUNIT_ASSERT(m_idxFactory.flush());
+		m_idxStore = sserialize::Static::ItemIndexStore(m_idxFactory.getFlushedData());
+		m_ci.reset(ci);
+	}
+	virtual void tearDown() {}
+	void testDisjointSummaries() {
+		CPPUNIT_ASSERT(m_idxStore.hasSummaries());
+		for(uint32_t cellId(0); cellId < cellCount; ++cellId) {
+			CPPUNIT_ASSERT(m_idxStore.disjoint(m_firstPtrs[cellId], m_secondPtrs[cellId]));
+		}
+	}
+	void testUnite() {
+		CellItems want(cellCount);
+		for(uint32_t cellId(0); cellId < cellCount; ++cellId) {
+			want[cellId] = m_first[cellId];
+			want[cellId].insert(m_second[cellId].begin(), m_second[cellId].end());
+		}
+		check(want, cqr(m_firstPtrs) + cqr(m_secondPtrs));
+		check(want, cqr(m_secondPtrs) + cqr(m_firstPtrs));
+	}
+	void testIntersect() {
+		check(CellItems(cellCount), cqr(m_firstPtrs) / cqr(m_secondPtrs));
+		check(m_first, cqr(m_firstPtrs) / cqr(m_firstPtrs));
+	}
+	void testDiff() {
+		check(m_first, cqr(m_firstPtrs) - cqr(m_secondPtrs));
+		check(m_second, cqr(m_secondPtrs) - cqr(m_firstPtrs));
+		check(CellItems(cellCount), cqr(m_firstPtrs) - cqr(m_firstPtrs));
+	}
+};
+
+int main(int argc, char ** argv) {
+	sserialize::tests::TestBase::init(argc, argv);
+
+	srand( 0 );
+	CppUnit::TextUi::TestRunner runner;
+	runner.addTest(  TestCellQueryResult::suite() );
+	bool ok = runner.run();
+	return ok ? 0 : 1;
+}
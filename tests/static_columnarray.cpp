@@ -0,0 +1,117 @@
+#include <sserialize/Static/ColumnArray.h>
+#include <sserialize/utility/printers.h>
+#include <random>
+#include "TestBase.h"
+
+using namespace sserialize;
+
+enum class TestEnum : uint8_t { A=3, B=17, C=200 };
+
+template<uint32_t T_SIZE>
+class TestColumnArray: public sserialize::tests::TestBase {
+CPPUNIT_TEST_SUITE( TestColumnArray );
+CPPUNIT_TEST( testEq );
+CPPUNIT_TEST( testScan );
+CPPUNIT_TEST( testFilter );
+CPPUNIT_TEST( testFilterRange );
+CPPUNIT_TEST_SUITE_END();
+private:
+	typedef Static::ColumnArray<uint32_t, int64_t, TestEnum, uint16_t> MyArray;
+	typedef MyArray::value_type value_type;
+private:
+	std::vector<value_type> m_values;
+	UByteArrayAdapter m_data;
+	MyArray m_arr;
+public:
+	TestColumnArray() : m_data(new std::vector<uint8_t>(), true) {}
+	virtual void setUp() {
+		std::mt19937 gen(T_SIZE);
+		std::uniform_int_distribution<uint32_t> u32(1000, 100000);
+		std::uniform_int_distribution<int64_t> i64(-(int64_t(1) << 40), int64_t(1) << 40);
+		TestEnum enums[3] = {TestEnum::A, TestEnum::B, TestEnum::C};
+		m_values.clear();
+		for(uint32_t i(0); i < T_SIZE; ++i) {
+			m_values.emplace_back(u32(gen), i64(gen), enums[gen() % 3], uint16_t(7));
+		}
+		m_data = UByteArrayAdapter(new std::vector<uint8_t>(), true);
+		m_data.putUint8(0xFE);
+		MyArray::create(m_values, m_data);
+		m_data.putUint8(0xFE);
+		UByteArrayAdapter d(m_data, 1);
+		m_arr = MyArray(d, UByteArrayAdapter::ConsumeTag());
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("consumed size", UByteArrayAdapter::OffsetType(1), d.size());
+	}
+	virtual void tearDown() {}
+
+	void testEq() {
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("size", MyArray::SizeType(m_values.size()), m_arr.size());
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("sizeInBytes", m_data.size()-2, m_arr.getSizeInBytes());
+		for(uint32_t i(0); i < T_SIZE; ++i) {
+			CPPUNIT_ASSERT_MESSAGE(sserialize::toString("at ", i), m_values[i] == m_arr.at(i));
+			CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("get<1> at ", i), std::get<1>(m_values[i]), m_arr.get<1>(i));
+		}
+		CPPUNIT_ASSERT_THROW(m_arr.get<0>(T_SIZE), sserialize::OutOfBoundsException);
+	}
+
+	void testScan() {
+		uint32_t begin = T_SIZE/3;
+		uint32_t expected = begin;
+		m_arr.template scan<1>(begin, T_SIZE, [this, &expected](MyArray::SizeType pos, int64_t value) {
+			CPPUNIT_ASSERT_EQUAL_MESSAGE("scan position", MyArray::SizeType(expected), pos);
+			CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("scan at ", pos), std::get<1>(m_values[pos]), value);
+			++expected;
+		});
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("scan count", T_SIZE, expected);
+	}
+
+	void testFilter() {
+		auto pred = [](TestEnum v) { return v == TestEnum::B; };
+		std::vector<MyArray::SizeType> real, result;
+		for(uint32_t i(0); i < T_SIZE; ++i) {
+			if (pred(std::get<2>(m_values[i]))) {
+				real.push_back(i);
+			}
+		}
+		m_arr.template filter<2>(0, m_arr.size(), pred, std::back_inserter(result));
+		CPPUNIT_ASSERT_MESSAGE("filter", real == result);
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("count", MyArray::SizeType(real.size()), m_arr.template count<2>(pred));
+	}
+
+	void testFilterRange() {
+		std::vector< std::pair<int64_t, int64_t> > ranges = {
+			{-1000000, 1000000},
+			{0, int64_t(1) << 39},
+			{std::numeric_limits<int64_t>::min(), 0},
+			{int64_t(1) << 41, int64_t(1) << 42},
+			{5, -5}
+		};
+		for(const auto & r : ranges) {
+			std::vector<MyArray::SizeType> real, result;
+			for(uint32_t i(0); i < T_SIZE; ++i) {
+				int64_t v = std::get<1>(m_values[i]);
+				if (r.first <= v && v <= r.second) {
+					real.push_back(i);
+				}
+			}
+			m_arr.template filterRange<1>(0, m_arr.size(), r.first, r.second, std::back_inserter(result));
+			CPPUNIT_ASSERT_MESSAGE(sserialize::toString("filterRange [", r.first, ", ", r.second, "]"), real == result);
+		}
+		//constant column
+		std::vector<MyArray::SizeType> result;
+		m_arr.template filterRange<3>(0, m_arr.size(), 7, 7, std::back_inserter(result));
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("constant column", std::size_t(T_SIZE), result.size());
+	}
+};
+
+int main(int argc, char ** argv) {
+	sserialize::tests::TestBase::init(argc, argv);
+
+	srand( 0 );
+	CppUnit::TextUi::TestRunner runner;
+	runner.addTest( TestColumnArray<0>::suite() );
+	runner.addTest( TestColumnArray<1>::suite() );
+	runner.addTest( TestColumnArray<63>::suite() );
+	runner.addTest( TestColumnArray<10000>::suite() );
+	bool ok = runner.run();
+	return (ok ? 0 : 1);
+}
@@ -24,6 +24,7 @@ CPPUNIT_TEST( testNumbers );
 CPPUNIT_TEST( testStrings );
 CPPUNIT_TEST( testArrayInArray );
 CPPUNIT_TEST( testStringsRawPut );
+CPPUNIT_TEST( testStringsEliasFanoOffsets );
 CPPUNIT_TEST( testIterator );
 CPPUNIT_TEST( testAbstractArray );
 CPPUNIT_TEST( testAbstractArrayIterator );
@@ -75,6 +76,28 @@ public:
 		}
 	}
 	
+	void testStringsEliasFanoOffsets() {
+		std::deque<std::string> realValues = createStrings(33, TestMask & rand());
+		UByteArrayAdapter d(new std::vector<uint8_t>(), true);
+		Static::ArrayCreator<std::string> creator(d);
+		creator.setOffsetsCreationMode(Static::SortedOffsetIndexPrivate::CM_ELIAS_FANO);
+		for(const std::string & x : realValues) {
+			creator.put(x);
+		}
+		UByteArrayAdapter flushed(creator.flush());
+		sserialize::Static::Array<std::string> sd(flushed);
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("data size", flushed.size(), sd.getSizeInBytes());
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("size", (uint32_t)realValues.size(), (uint32_t)sd.size());
+		for(uint32_t i = 0, s = (uint32_t) realValues.size(); i < s; ++i) {
+			CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("at ", i), realValues[i], sd.at(i));
+		}
+		if (realValues.size() > 1) {
+			UByteArrayAdapter::OffsetType dataLen = flushed.getOffset(1);
+			Static::SortedOffsetIndex oIndex(UByteArrayAdapter(flushed, 1+UByteArrayAdapter::OffsetTypeSerializedLength()+dataLen));
+			CPPUNIT_ASSERT_EQUAL_MESSAGE("offset index type", Static::SortedOffsetIndex::T_ELIAS_FANO, oIndex.type());
+		}
+	}
+	
 	void testArrayInArray() {
 		std::deque< std::deque<uint32_t> > realValues = createDequeOfDequeNumbers(TestMask & rand(), TestMask & rand());
 		UByteArrayAdapter d(new std::vector<uint8_t>(), true);
@@ -1,4 +1,5 @@
 #include <sserialize/Static/Map.h>
+#include <sserialize/Static/EytzingerMap.h>
 #include <iostream>
 #include <stdio.h>
 #include <stdlib.h>
@@ -49,6 +50,60 @@ bool testMap(std::map<TKey, TValue> & realValues) {
 	return (smap == realValues);
 }
 
+template<typename TKey, typename TValue>
+bool testMapFind(std::map<TKey, TValue> & realValues, const std::vector<TKey> & missing) {
+	UByteArrayAdapter adap(new std::vector<uint8_t>(), true);
+	adap << realValues;
+	sserialize::Static::Map<TKey, TValue> smap(adap);
+	
+	UByteArrayAdapter eadap(new std::vector<uint8_t>(), true);
+	sserialize::Static::EytzingerMap<TKey, TValue>::create(realValues, eadap);
+	sserialize::Static::EytzingerMap<TKey, TValue> emap(eadap);
+	
+	std::vector<TKey> keys;
+	for(const auto & x : realValues) {
+		keys.push_back(x.first);
+	}
+	UByteArrayAdapter sadap(new std::vector<uint8_t>(), true);
+	sserialize::Static::EytzingerSet<TKey>::create(keys.begin(), keys.end(), sadap);
+	sserialize::Static::EytzingerSet<TKey> eset(sadap);
+	
+	if (emap.size() != realValues.size() || eset.size() != realValues.size() || emap.getSizeInBytes() != eadap.size()) {
+		return false;
+	}
+	uint32_t pos = 0;
+	for(const auto & x : realValues) {
+		if (smap.findPosition(x.first) != pos || smap.keyAt(pos) != x.first || smap.at(x.first) != x.second) {
+			return false;
+		}
+		if (!emap.contains(x.first) || emap.at(x.first) != x.second || emap.keyAt(emap.findPosition(x.first)) != x.first) {
+			return false;
+		}
+		if (eset.keyAt(eset.findPosition(x.first)) != x.first) {
+			return false;
+		}
+		++pos;
+	}
+	for(const TKey & key : missing) {
+		if (realValues.count(key)) {
+			continue;
+		}
+		if (smap.contains(key) || emap.contains(key) || eset.contains(key)) {
+			return false;
+		}
+		//lowerBound points to the smallest larger key
+		auto it = realValues.lower_bound(key);
+		auto lb = emap.lowerBound(key);
+		if ((it == realValues.end()) != (lb == emap.size())) {
+			return false;
+		}
+		if (it != realValues.end() && emap.keyAt(lb) != it->first) {
+			return false;
+		}
+	}
+	return true;
+}
+
 void fillMap(std::map<uint32_t, uint32_t> & map) {
 	//Fill the first
 	uint32_t rndNum;
@@ -95,6 +150,37 @@ int main() {
 	}
 
 
+	std::map<uint32_t, uint32_t> map3;
+	fillMap(map3);
+	std::deque<uint32_t> rndNumbers(createNumbers(1024));
+	std::vector<uint32_t> missingNumbers(rndNumbers.begin(), rndNumbers.end());
+	missingNumbers.push_back(0);
+	missingNumbers.push_back(std::numeric_limits<uint32_t>::max());
+	if (testMapFind(map3, missingNumbers)) {
+		std::cout << "Passed <uint32_t, uint32_t> find test" << std::endl;
+	}
+	else {
+		allOk = false;
+		std::cout << "Failed <uint32_t, uint32_t> find test" << std::endl;
+	}
+	
+	std::deque<std::string> missingStrs(createStrings(33, 1023));
+	if (testMapFind(map, std::vector<std::string>(missingStrs.begin(), missingStrs.end()))) {
+		std::cout << "Passed <std::string,uint32_t> find test" << std::endl;
+	}
+	else {
+		allOk = false;
+		std::cout << "Failed <std::string,uint32_t> find test" << std::endl;
+	}
+	
+	std::map<uint32_t, uint32_t> emptyMap;
+	if (testMapFind(emptyMap, missingNumbers)) {
+		std::cout << "Passed empty find test" << std::endl;
+	}
+	else {
+		allOk = false;
+		std::cout << "Failed empty find test" << std::endl;
+	}
 
 	if (allOk) {
 		std::cout << "PASSED all test." << std::endl;
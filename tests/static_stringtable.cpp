@@ -1,4 +1,8 @@
 #include <sserialize/Static/StringTable.h>
+#include <sserialize/Static/StringTableSuffixIndex.h>
+#include <sserialize/Static/FrontCodedStringTable.h>
+#include <sserialize/Static/StringTableHashIndex.h>
+#include <sserialize/strings/unicode_case_functions.h>
 #include <sserialize/utility/log.h>
 #include <sserialize/strings/stringfunctions.h>
 #include <random>
@@ -30,11 +34,15 @@ public:
 	}
 };
 
+template<bool T_FRONT_CODED>
 class TestSortedStringTable: public TestStringTable {
 CPPUNIT_TEST_SUITE( TestSortedStringTable );
 CPPUNIT_TEST( testEq );
+CPPUNIT_TEST( testInterface );
 CPPUNIT_TEST( testFind );
 CPPUNIT_TEST( testRange );
+CPPUNIT_TEST( testQuery );
+CPPUNIT_TEST( testHashIndex );
 CPPUNIT_TEST_SUITE_END();
 private:
 	sserialize::UByteArrayAdapter m_stableData;
@@ -57,10 +65,30 @@ public:
 		}
 		strs().insert(strs().end(), myStrs.cbegin(), myStrs.cend());
 		m_stableData = sserialize::UByteArrayAdapter(new std::vector<uint8_t>(), true);
-		sserialize::Static::SortedStringTable::create(strs().cbegin(), strs().cend(), m_stableData);
+		if (T_FRONT_CODED) {
+			sserialize::Static::FrontCodedStringTable::create(strs().cbegin(), strs().cend(), m_stableData, 7);
+		}
+		else {
+			sserialize::Static::SortedStringTable::create(strs().cbegin(), strs().cend(), m_stableData);
+		}
 		m_stable = sserialize::Static::SortedStringTable(m_stableData);
 	}
 	
+	///front coded tables are accessible through the StringTable interface as well
+	void testInterface() {
+		CPPUNIT_ASSERT_EQUAL(T_FRONT_CODED, stable().frontCoded());
+		CPPUNIT_ASSERT(std::equal(strs().cbegin(), strs().cend(), stable().cbegin(), stable().cend()));
+		for(uint32_t i = 0, s = (uint32_t) strs().size(); i < s; ++i) {
+			UByteArrayAdapter strData( stable().strDataAt(i) );
+			std::string str;
+			for(UByteArrayAdapter::OffsetType j(0); j < strData.size(); ++j) {
+				str += static_cast<char>(strData.at(j));
+			}
+			CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("string at", i), strs().at(i), str);
+			CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("string size at", i), (uint32_t) strs().at(i).size(), stable().strSize(i));
+		}
+	}
+	
 	void testConstructionParameters() {
 		CPPUNIT_ASSERT_MESSAGE("minimum size", m_stable.size() > strTableSize*2);
 	}
@@ -92,6 +120,157 @@ public:
 		r = m_stable.range("");
 		CPPUNIT_ASSERT_EQUAL_MESSAGE("All range search: Lower bound", Static::SortedStringTable::SizeType(0), r.first);
 		CPPUNIT_ASSERT_EQUAL_MESSAGE("All range search: Upper bound", m_stable.size(), r.second);
+		CPPUNIT_ASSERT(!m_stable.count("hjhkjadzofmaoihfdoannfojafojdsafhsafhskdafkdsafsafsafd"));
+	}
+	
+	void testQuery() {
+		std::vector<StringCompleter::QuerryType> qts = {StringCompleter::QT_EXACT, StringCompleter::QT_PREFIX, StringCompleter::QT_SUFFIX, StringCompleter::QT_SUBSTRING};
+		for(uint32_t i(0); i < 20; ++i) {
+			const std::string & str = strs().at(rand() % strs().size());
+			std::string q( str.substr(rand() % (str.size()+1), 1+rand() % 3) );
+			if (q.empty()) {
+				continue;
+			}
+			for(StringCompleter::QuerryType qt : qts) {
+				for(StringCompleter::QuerryType cqt : {StringCompleter::QT_CASE_SENSTIVE, StringCompleter::QT_CASE_INSENSITIVE}) {
+					StringCompleter::QuerryType fqt = StringCompleter::QuerryType(qt | cqt);
+					std::unordered_set<uint32_t> want;
+					std::string lq( cqt == StringCompleter::QT_CASE_INSENSITIVE ? sserialize::unicode_to_lower(q) : q );
+					for(uint32_t j(0), s(strs().size()); j < s; ++j) {
+						std::vector<uint8_t> strData(strs().at(j).begin(), strs().at(j).end());
+						if (Static::StringTable::match(lq, UByteArrayAdapter(&strData), fqt)) {
+							want.insert(j);
+						}
+					}
+					std::unordered_set<uint32_t> have( m_stable.find(q, fqt) );
+					CPPUNIT_ASSERT_MESSAGE(sserialize::toString("result for ", q, " with type ", fqt), want == have);
+					for(uint32_t j : want) {
+						CPPUNIT_ASSERT(m_stable.match(j, lq, fqt));
+					}
+				}
+			}
+		}
+	}
+	
+	void testHashIndex() {
+		sserialize::UByteArrayAdapter idxData(new std::vector<uint8_t>(), true);
+		sserialize::Static::StringTableHashIndex::create(m_stable, idxData);
+		sserialize::Static::StringTableHashIndex idx(idxData);
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("data size", idxData.size(), idx.getSizeInBytes());
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("size", m_stable.size(), idx.size());
+		
+		sserialize::UByteArrayAdapter fstableData(new std::vector<uint8_t>(), true);
+		sserialize::Static::FrequencyStringTable::create(strs().cbegin(), strs().cend(), fstableData);
+		sserialize::Static::FrequencyStringTable fstable(fstableData);
+		
+		m_stable.setHashIndex(idx);
+		fstable.setHashIndex(idx);
+		for(Static::SortedStringTable::SizeType i = 0, s = strs().size(); i < s; ++i) {
+			CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("string at", i), i, m_stable.find(strs().at(i)));
+			CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("string at", i), i, fstable.find(strs().at(i)));
+		}
+		for(uint32_t i(0); i < 1000; ++i) {
+			std::string str = createString(120) + "#";
+			CPPUNIT_ASSERT_EQUAL_MESSAGE(str, Static::SortedStringTable::npos, m_stable.find(str));
+			CPPUNIT_ASSERT_EQUAL_MESSAGE(str, Static::SortedStringTable::npos, fstable.find(str));
+		}
+		CPPUNIT_ASSERT_THROW(m_stable.setHashIndex(sserialize::Static::StringTableHashIndex()), sserialize::ConfigurationException);
+	}
+};
+
+class TestStringTableSuffixIndex: public sserialize::tests::TestBase {
+CPPUNIT_TEST_SUITE( TestStringTableSuffixIndex );
+CPPUNIT_TEST( testCaseSensitive );
+CPPUNIT_TEST( testCaseInsensitive );
+CPPUNIT_TEST_SUITE_END();
+private:
+	std::vector<std::string> m_strs;
+	sserialize::UByteArrayAdapter m_stableData;
+	sserialize::Static::StringTable m_stable;
+private:
+	static bool matches(const std::string & str, const std::string & q, StringCompleter::QuerryType qt) {
+		if (qt & StringCompleter::QT_EXACT) {
+			return str == q;
+		}
+		else if (qt & StringCompleter::QT_PREFIX) {
+			return sserialize::isPrefix(q, str);
+		}
+		else if (qt & StringCompleter::QT_SUFFIX) {
+			return str.size() >= q.size() && str.compare(str.size()-q.size(), q.size(), q) == 0;
+		}
+		else {
+			return str.find(q) != std::string::npos;
+		}
+	}
+	void check(bool caseSensitive) {
+		sserialize::UByteArrayAdapter idxData(new std::vector<uint8_t>(), true);
+		sserialize::Static::StringTableSuffixIndex::create(m_stable, idxData, caseSensitive, 3);
+		sserialize::Static::StringTableSuffixIndex idx(idxData, m_stable);
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("data size", idxData.size(), idx.getSizeInBytes());
+		CPPUNIT_ASSERT_EQUAL(caseSensitive, idx.caseSensitive());
+		
+		StringCompleter::QuerryType cqt = (caseSensitive ? StringCompleter::QT_CASE_SENSTIVE : StringCompleter::QT_CASE_INSENSITIVE);
+		StringCompleter::QuerryType otherCqt = (caseSensitive ? StringCompleter::QT_CASE_INSENSITIVE : StringCompleter::QT_CASE_SENSTIVE);
+		CPPUNIT_ASSERT(!idx.supports(StringCompleter::QuerryType(StringCompleter::QT_SUBSTRING | otherCqt)));
+		
+		std::vector<std::string> cmpStrs;
+		for(const std::string & str : m_strs) {
+			cmpStrs.push_back(caseSensitive ? str : sserialize::unicode_to_lower(str));
+		}
+		std::vector<std::string> queries = {"a", "ab", "Ab", "\xC3\xA4" "b", "\xC3\x84", "bbbbbbbbbbbbbbbbbbbbbbbbbbbbbb"};
+		for(uint32_t i(0); i < 100; ++i) {
+			const std::string & str = m_strs.at(rand() % m_strs.size());
+			std::size_t begin = rand() % (str.size()+1);
+			std::size_t len = rand() % 4;
+			//do not split code points
+			while (begin < str.size() && (static_cast<uint8_t>(str[begin]) & 0xC0) == 0x80) {
+				++begin;
+			}
+			while (begin+len < str.size() && (static_cast<uint8_t>(str[begin+len]) & 0xC0) == 0x80) {
+				++len;
+			}
+			queries.push_back(str.substr(begin, len));
+		}
+		std::vector<StringCompleter::QuerryType> qts = {StringCompleter::QT_EXACT, StringCompleter::QT_PREFIX, StringCompleter::QT_SUFFIX, StringCompleter::QT_SUBSTRING};
+		for(const std::string & q : queries) {
+			std::string cmpQ( caseSensitive ? q : sserialize::unicode_to_lower(q) );
+			for(StringCompleter::QuerryType qt : qts) {
+				StringCompleter::QuerryType fqt = StringCompleter::QuerryType(qt | cqt);
+				std::unordered_set<uint32_t> want;
+				if (q.size()) {
+					for(uint32_t j(0), s(cmpStrs.size()); j < s; ++j) {
+						if (matches(cmpStrs[j], cmpQ, qt)) {
+							want.insert(j);
+						}
+					}
+				}
+				std::unordered_set<uint32_t> have = idx.find(q, fqt);
+				CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("result size for ", q, " with type ", qt), want.size(), have.size());
+				CPPUNIT_ASSERT_MESSAGE(sserialize::toString("result for ", q, " with type ", qt), want == have);
+			}
+		}
+	}
+public:
+	virtual void setUp() {
+		std::vector<std::string> alphabet = {"a", "b", "A", "B", "c", "\xC3\xA4", "\xC3\x84"};
+		for(uint32_t i = 0; i < strTableSize; ++i) {
+			std::string str;
+			for(uint32_t j(0), s(rand() % 16); j < s; ++j) {
+				str += alphabet.at(rand() % alphabet.size());
+			}
+			m_strs.push_back(str);
+		}
+		m_stableData = sserialize::UByteArrayAdapter(new std::vector<uint8_t>(), true);
+		sserialize::Static::StringTable::create(m_strs.cbegin(), m_strs.cend(), m_stableData);
+		m_stable = sserialize::Static::StringTable(m_stableData);
+	}
+	
+	void testCaseSensitive() {
+		check(true);
+	}
+	
+	void testCaseInsensitive() {
+		check(false);
 	}
 };
 
@@ -101,8 +280,10 @@ int main(int argc, char ** argv) {
 	srand( 0 );
 	CppUnit::TextUi::TestRunner runner;
 	for(uint32_t i = 0; i < 10; ++i) {
-		runner.addTest( TestSortedStringTable::suite() );
+		runner.addTest( TestSortedStringTable<false>::suite() );
+		runner.addTest( TestSortedStringTable<true>::suite() );
 	}
+	runner.addTest( TestStringTableSuffixIndex::suite() );
 	bool ok = runner.run();
 	return (ok ? 0 : 1);
 }
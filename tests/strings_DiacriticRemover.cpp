@@ -0,0 +1,134 @@
+#include <sserialize/strings/DiacriticRemover.h>
+#include <sserialize/strings/unicode_folding_functions.h>
+#include <sserialize/strings/unicode_folding_table.h>
+#include <sserialize/strings/unicode_case_functions.h>
+#include <sserialize/utility/printers.h>
+#include <sserialize/vendor/utf8.h>
+#include <unicode/translit.h>
+#include <memory>
+#include "TestBase.h"
+
+class TestDiacriticRemover: public sserialize::tests::TestBase {
+CPPUNIT_TEST_SUITE( TestDiacriticRemover );
+CPPUNIT_TEST( testFastPath );
+CPPUNIT_TEST( testFallback );
+CPPUNIT_TEST( testTableCodePoints );
+CPPUNIT_TEST( testRandom );
+CPPUNIT_TEST_SUITE_END();
+private:
+	sserialize::DiacriticRemover m_dr;
+	std::unique_ptr<icu::Transliterator> m_icu;
+private:
+	std::string icuTransliterate(const std::string & str) {
+		icu::UnicodeString ustr( icu::UnicodeString::fromUTF8(str) );
+		m_icu->transliterate(ustr);
+		std::string ret;
+		ustr.toUTF8String(ret);
+		return ret;
+	}
+	void check(const std::string & str) {
+		std::string expected = icuTransliterate(str);
+		CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("transliterate: ", str), expected, m_dr(str));
+		std::string tmp(str);
+		m_dr.transliterate(tmp);
+		CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("transliterate in place: ", str), expected, tmp);
+		CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("fold: ", str), sserialize::unicode_to_lower(expected), m_dr.fold(str));
+		//the table itself only has to agree with the ICU it was created from
+		std::string folded;
+		if (sserialize::unicode_fold_icu_version_major() == U_ICU_VERSION_MAJOR_NUM && sserialize::unicode_fold(str, false, folded)) {
+			CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("table: ", str), expected, folded);
+		}
+	}
+public:
+	virtual void setUp() {
+		UErrorCode status = m_dr.init();
+		CPPUNIT_ASSERT_MESSAGE(sserialize::DiacriticRemover::errorName(status), !sserialize::DiacriticRemover::isFailure(status));
+		status = U_ZERO_ERROR;
+		m_icu.reset(icu::Transliterator::createInstance("NFD; [:Nonspacing Mark:] Remove; NFC;", UTRANS_FORWARD, status));
+		CPPUNIT_ASSERT(U_SUCCESS(status));
+	}
+	virtual void tearDown() {}
+	void testFastPath() {
+		std::vector<std::string> strs = {
+			"",
+			"Stuttgart",
+			"Baden-Württemberg",
+			"Ångström Čech Łódź Ørsted",
+			"Crème Brûlée à la Française",
+			"Hà Nội, Việt Nam",
+			"Ελληνικά Άγιος",
+			"Москва Йошкар-Ола",
+			"東京都",
+			"Straße ŒUVRE"
+		};
+		for(const std::string & str : strs) {
+			std::string dest;
+			CPPUNIT_ASSERT_MESSAGE(str, sserialize::unicode_fold(str, true, dest));
+			check(str);
+		}
+		std::string dest;
+		sserialize::unicode_fold("Baden-Württemberg", true, dest);
+		CPPUNIT_ASSERT_EQUAL(std::string("baden-wurttemberg"), dest);
+		sserialize::unicode_fold("Baden-Württemberg", false, dest);
+		CPPUNIT_ASSERT_EQUAL(std::string("Baden-Wurttemberg"), dest);
+	}
+	void testFallback() {
+		std::vector<std::string> strs = {
+			//Hangul jamo compose with their predecessor
+			"\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8",
+			//Tamil vowel sign AU composes from a spacing mark
+			"\xE0\xAF\x86\xE0\xAF\x97",
+			"\xE0\xAE\x95\xE0\xAF\x86\xE0\xAF\x97",
+			//invalid utf-8
+			"ab\xC3"
+		};
+		for(const std::string & str : strs) {
+			std::string dest;
+			CPPUNIT_ASSERT_MESSAGE(str, !sserialize::unicode_fold(str, true, dest));
+			check(str);
+		}
+	}
+	void testTableCodePoints() {
+		for(uint32_t i(0); i < UNICODE_FOLDING_TABLE_SIZE; ++i) {
+			std::string str;
+			utf8::append(unicode_folding_source_table[i], std::back_inserter(str));
+			check(str);
+			check("A" + str);
+			check(str + "e");
+		}
+	}
+	void testRandom() {
+		auto randomCodePoint = []() -> uint32_t {
+			switch (rand() % 4) {
+			case 0:
+				return 0x20 + rand() % 0x60;
+			case 1:
+				return unicode_folding_source_table[rand() % UNICODE_FOLDING_TABLE_SIZE];
+			case 2:
+				return 0xA0 + rand() % 0x2000;
+			default:
+			{
+				uint32_t cp = rand() % 0x30000;
+				return (cp >= 0xD800 && cp < 0xE000 ? 0x41 : cp);
+			}
+			}
+		};
+		for(uint32_t i(0); i < 100000; ++i) {
+			std::string str;
+			for(uint32_t j(0), s(1 + rand() % 8); j < s; ++j) {
+				utf8::append(randomCodePoint(), std::back_inserter(str));
+			}
+			check(str);
+		}
+	}
+};
+
+int main(int argc, char ** argv) {
+	sserialize::tests::TestBase::init(argc, argv);
+
+	srand( 0 );
+	CppUnit::TextUi::TestRunner runner;
+	runner.addTest(  TestDiacriticRemover::suite() );
+	bool ok = runner.run();
+	return ok ? 0 : 1;
+}
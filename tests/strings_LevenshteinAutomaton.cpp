@@ -0,0 +1,133 @@
+#include <sserialize/strings/LevenshteinAutomaton.h>
+#include <sserialize/utility/printers.h>
+#include <sserialize/vendor/utf8.h>
+#include <algorithm>
+#include <limits>
+#include "TestBase.h"
+
+typedef std::vector<uint32_t> CodePoints;
+
+CodePoints codePoints(const std::string & str) {
+	CodePoints ret;
+	utf8::utf8to32(str.cbegin(), str.cend(), std::back_inserter(ret));
+	return ret;
+}
+
+///plain dynamic programming edit distance of the first @param aSize code points of @param a and the first @param bSize of @param b
+uint32_t editDistance(const CodePoints & a, std::size_t aSize, const CodePoints & b, std::size_t bSize) {
+	std::vector< std::vector<uint32_t> > d(aSize+1, std::vector<uint32_t>(bSize+1));
+	for(std::size_t i(0); i <= aSize; ++i) {
+		d[i][0] = (uint32_t) i;
+	}
+	for(std::size_t j(0); j <= bSize; ++j) {
+		d[0][j] = (uint32_t) j;
+	}
+	for(std::size_t i(1); i <= aSize; ++i) {
+		for(std::size_t j(1); j <= bSize; ++j) {
+			d[i][j] = std::min(d[i-1][j-1] + (a[i-1] == b[j-1] ? 0 : 1), std::min(d[i-1][j], d[i][j-1]) + 1);
+		}
+	}
+	return d[aSize][bSize];
+}
+
+class TestLevenshteinAutomaton: public sserialize::tests::TestBase {
+CPPUNIT_TEST_SUITE( TestLevenshteinAutomaton );
+CPPUNIT_TEST( testStates );
+CPPUNIT_TEST( testMatches );
+CPPUNIT_TEST( testDefaultMaxDistance );
+CPPUNIT_TEST_SUITE_END();
+private:
+	///code points with 1 to 4 bytes in utf-8
+	static std::string randomString(uint32_t maxLength) {
+		static const std::vector<std::string> chars = {"a", "b", "c", "\xC3\xA4", "\xE2\x82\xAC", "\xF0\x9D\x84\x9E"};
+		std::string ret;
+		for(uint32_t i(0), s(rand() % (maxLength+1)); i < s; ++i) {
+			ret += chars[rand() % chars.size()];
+		}
+		return ret;
+	}
+public:
+	virtual void setUp() {}
+	virtual void tearDown() {}
+	///every state has to hold the clamped edit distances of the consumed input to all prefixes of the query
+	void testStates() {
+		for(uint32_t round(0); round < 200; ++round) {
+			std::string qstr = randomString(5);
+			CodePoints q = codePoints(qstr);
+			for(uint32_t maxDistance(0); maxDistance < 4; ++maxDistance) {
+				sserialize::LevenshteinAutomaton la(qstr, maxDistance);
+				CPPUNIT_ASSERT_EQUAL((uint32_t) q.size(), la.size());
+				for(uint32_t i(0); i < 10; ++i) {
+					std::string str = randomString(7);
+					CodePoints s = codePoints(str);
+					sserialize::LevenshteinAutomaton::State state(la.start()), next;
+					for(std::size_t consumed(0); ; ++consumed) {
+						std::string msg = sserialize::toString("qstr=", qstr, " str=", str, " k=", maxDistance, " consumed=", consumed);
+						uint32_t minDistance = std::numeric_limits<uint32_t>::max();
+						for(std::size_t j(0); j <= q.size(); ++j) {
+							uint32_t d = editDistance(s, consumed, q, j);
+							minDistance = std::min(minDistance, d);
+							CPPUNIT_ASSERT_EQUAL_MESSAGE(msg, std::min(d, maxDistance+1), state.at(j));
+						}
+						uint32_t d = editDistance(s, consumed, q, q.size());
+						CPPUNIT_ASSERT_EQUAL_MESSAGE(msg, std::min(d, maxDistance+1), la.distance(state));
+						CPPUNIT_ASSERT_EQUAL_MESSAGE(msg, d <= maxDistance, la.isMatch(state));
+						CPPUNIT_ASSERT_EQUAL_MESSAGE(msg, minDistance <= maxDistance, la.canMatch(state));
+						if (consumed == s.size()) {
+							break;
+						}
+						la.step(state, s[consumed], next);
+						state.swap(next);
+					}
+				}
+			}
+		}
+	}
+	void testMatches() {
+		for(uint32_t round(0); round < 500; ++round) {
+			std::string qstr = randomString(5);
+			CodePoints q = codePoints(qstr);
+			for(uint32_t maxDistance(0); maxDistance < 4; ++maxDistance) {
+				sserialize::LevenshteinAutomaton la(qstr, maxDistance);
+				for(uint32_t i(0); i < 20; ++i) {
+					std::string str = randomString(7);
+					CodePoints s = codePoints(str);
+					bool prefixMatch = false;
+					for(std::size_t j(0); j <= s.size(); ++j) {
+						prefixMatch = prefixMatch || editDistance(s, j, q, q.size()) <= maxDistance;
+					}
+					std::string msg = sserialize::toString("qstr=", qstr, " str=", str, " k=", maxDistance);
+					CPPUNIT_ASSERT_EQUAL_MESSAGE(msg, editDistance(s, s.size(), q, q.size()) <= maxDistance, la.matches(str, false));
+					CPPUNIT_ASSERT_EQUAL_MESSAGE(msg, prefixMatch, la.matches(str, true));
+				}
+			}
+		}
+		//a single multibyte code point is one edit
+		sserialize::LevenshteinAutomaton la("b\xC3\xA4r", 1);
+		CPPUNIT_ASSERT(la.matches("bar", false));
+		CPPUNIT_ASSERT(la.matches("b\xE2\x82\xACr", false));
+		CPPUNIT_ASSERT(la.matches("br", false));
+		CPPUNIT_ASSERT(!la.matches("b\xC3\xA4\xC3\xA4\xC3\xA4r", false));
+		CPPUNIT_ASSERT(la.matches("b\xC3\xA4\xC3\xA4rig", true));
+	}
+	void testDefaultMaxDistance() {
+		CPPUNIT_ASSERT_EQUAL(uint32_t(0), sserialize::LevenshteinAutomaton::defaultMaxDistance(""));
+		CPPUNIT_ASSERT_EQUAL(uint32_t(0), sserialize::LevenshteinAutomaton::defaultMaxDistance("ab"));
+		CPPUNIT_ASSERT_EQUAL(uint32_t(1), sserialize::LevenshteinAutomaton::defaultMaxDistance("abc"));
+		CPPUNIT_ASSERT_EQUAL(uint32_t(1), sserialize::LevenshteinAutomaton::defaultMaxDistance("abcde"));
+		CPPUNIT_ASSERT_EQUAL(uint32_t(2), sserialize::LevenshteinAutomaton::defaultMaxDistance("abcdef"));
+		//code points are counted, not bytes
+		CPPUNIT_ASSERT_EQUAL(uint32_t(0), sserialize::LevenshteinAutomaton::defaultMaxDistance("\xE2\x82\xAC\xE2\x82\xAC"));
+		CPPUNIT_ASSERT_EQUAL(uint32_t(1), sserialize::LevenshteinAutomaton::defaultMaxDistance("\xF0\x9D\x84\x9E\xC3\xA4\xC3\xA4\xC3\xA4"));
+	}
+};
+
+int main(int argc, char ** argv) {
+	sserialize::tests::TestBase::init(argc, argv);
+
+	srand( 0 );
+	CppUnit::TextUi::TestRunner runner;
+	runner.addTest(  TestLevenshteinAutomaton::suite() );
+	bool ok = runner.run();
+	return ok ? 0 : 1;
+}
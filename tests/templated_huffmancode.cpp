@@ -109,6 +109,21 @@ public:
 				uint32_t decoded = udwIt.next();
 				CPPUNIT_ASSERT_EQUAL_MESSAGE(printToString("at position ", i), real, decoded);
 			}
+			
+			//bulk decoding with odd chunk sizes
+			std::vector<uint32_t> bulk(testData.size()+1);
+			uint32_t bulkSize = 0;
+			for(uint32_t chunk = 1; bulkSize < testData.size(); chunk = chunk % 97 + 13) {
+				uint32_t n = decoder->decode(bitIt, bulk.data()+bulkSize, std::min<uint32_t>(chunk, uint32_t(bulk.size())-bulkSize));
+				if (!n) {
+					break;
+				}
+				bulkSize += n;
+			}
+			CPPUNIT_ASSERT_MESSAGE("bulk decoding decoded too few symbols", bulkSize >= testData.size());
+			for(uint32_t i = 0; i < testData.size(); ++i) {
+				CPPUNIT_ASSERT_EQUAL_MESSAGE(printToString("bulk at position ", i), testData[i], bulk[i]);
+			}
 		}
 	}
 };
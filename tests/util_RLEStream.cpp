@@ -10,6 +10,8 @@ CPPUNIT_TEST( testNegativeRle );
 CPPUNIT_TEST( testRandom );
 CPPUNIT_TEST( testMixed );
 CPPUNIT_TEST( testSpecial );
+CPPUNIT_TEST( testSeek );
+CPPUNIT_TEST( testCheckpoints );
 CPPUNIT_TEST_SUITE_END();
 public:
 	virtual void setUp() {}
@@ -97,6 +99,52 @@ public:
 			++rls;
 		}
 	}
+	void testSeek() {
+		sserialize::UByteArrayAdapter tmpData(new std::vector<uint8_t>(), true);
+		std::vector<uint32_t> real(10000);
+		sserialize::TestDataGenerator<std::vector<uint32_t>::iterator>::generate((uint32_t) real.size(), real.begin());
+		sserialize::RLEStream::create(real.begin(), real.end(), tmpData, 0);
+		tmpData.resetPtrs();
+		sserialize::RLEStream rls(tmpData);
+		CPPUNIT_ASSERT(!rls.hasCheckpoints());
+		for(uint32_t i : {uint32_t(0), uint32_t(1), uint32_t(4711), uint32_t(17), uint32_t(real.size()-1)}) {
+			rls.seek(i);
+			CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("At ", i), real[i], *rls);
+		}
+	}
+	void testCheckpoints() {
+		std::vector<uint32_t> real;
+		//runs crossing the checkpoints and random values
+		for(uint32_t i(0); i < 1000; ++i) {
+			real.push_back(i*3);
+		}
+		for(uint32_t i(0); i < 1000; ++i) {
+			real.push_back((uint32_t)rand());
+		}
+		for(uint32_t i(1000); i > 0; --i) {
+			real.push_back(i);
+		}
+		for(uint32_t interval : {1, 7, 64, 5000}) {
+			sserialize::UByteArrayAdapter tmpData(new std::vector<uint8_t>(), true);
+			sserialize::RLEStream::create(real.begin(), real.end(), tmpData, interval);
+			tmpData.resetPtrs();
+			sserialize::RLEStream rls(tmpData, sserialize::RLEStream::CheckpointsTag());
+			CPPUNIT_ASSERT_EQUAL(interval, rls.checkpointInterval());
+			for(std::size_t i(0), s(real.size()); i < s; ++i) {
+				CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("interval=", interval, " at ", i), real[i], *rls);
+				++rls;
+			}
+			for(uint32_t j(0); j < 1000; ++j) {
+				uint32_t pos = (uint32_t) (rand() % real.size());
+				rls.seek(pos);
+				CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("interval=", interval, " seek to ", pos), real[pos], *rls);
+				if (pos+1 < real.size()) {
+					++rls;
+					CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("interval=", interval, " after seek to ", pos), real[pos+1], *rls);
+				}
+			}
+		}
+	}
 };
 
 int main(int argc, char ** argv) {
@@ -6,6 +6,7 @@
 #include <stdlib.h>
 #include <time.h>
 #include <iostream>
+#include <random>
 #include "TestBase.h"
 
 using namespace sserialize;
@@ -18,6 +19,7 @@ CPPUNIT_TEST_SUITE( TestCompactUintArray );
 CPPUNIT_TEST( createAutoBitsTest );
 CPPUNIT_TEST( createManuBitsTest );
 CPPUNIT_TEST( boundedTest );
+CPPUNIT_TEST( getRangeTest );
 CPPUNIT_TEST( veryLargeTest );
 CPPUNIT_TEST( specialLargeTest );
 CPPUNIT_TEST_SUITE_END();
@@ -86,6 +88,33 @@ public:
 		}
 	}
 	
+	void getRangeTest() {
+		std::mt19937 gen(0);
+		std::vector<CompactUintArray::value_type> buffer;
+		for(uint32_t bits = 0; bits < 64; ++bits) {
+			UByteArrayAdapter d(new std::vector<uint8_t>(), true);
+			CompactUintArray::create(compSrcArrays[bits], d, bits+1);
+			d.resetPtrs();
+			CompactUintArray carr(d, bits+1);
+			uint32_t s = (uint32_t) compSrcArrays[bits].size();
+			std::uniform_int_distribution<uint32_t> posDist(0, s-1);
+			for(uint32_t round = 0; round < 100; ++round) {
+				uint32_t pos = posDist(gen);
+				uint32_t count = std::min<uint32_t>(s-pos, gen() % 300);
+				buffer.assign(count, 0);
+				carr.getRange(pos, count, buffer.data());
+				for(uint32_t i = 0; i < count; ++i) {
+					CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("bits=", bits+1, " at ", pos+i), compSrcArrays[bits][pos+i], buffer[i]);
+				}
+			}
+			//the last element has to be decodable without reading past the end of the data
+			buffer.assign(1, 0);
+			carr.getRange(s-1, 1, buffer.data());
+			CPPUNIT_ASSERT_EQUAL_MESSAGE(sserialize::toString("bits=", bits+1, " last"), compSrcArrays[bits][s-1], buffer[0]);
+			CPPUNIT_ASSERT_THROW(carr.getRange(s-1, 2, buffer.data()), sserialize::OutOfBoundsException);
+		}
+	}
+	
 	void veryLargeTest() {
 		for(uint32_t bits = 1; bits <= 64; ++bits) {
 			UByteArrayAdapter d(new std::vector<uint8_t>(), true);
@@ -0,0 +1,54 @@
+#include <sserialize/search/CellTextCompleterDelta.h>
+#include <sserialize/storage/MmappedFile.h>
+#include <iostream>
+#include <vector>
+
+void help() {
+	std::cout << "-o outFile inFile [inFile...]\nFolds the CellTextCompleter deltas given from oldest to newest into a single delta" << std::endl;
+}
+
+int main(int argc, char ** argv) {
+	std::string outFile;
+	std::vector<std::string> inFiles;
+	for(int i = 1; i < argc; ++i) {
+		std::string str(argv[i]);
+		if (str == "-o" && i+1 < argc) {
+			outFile = std::string(argv[i+1]);
+			++i;
+		}
+		else if (str == "-h" || str == "--help") {
+			help();
+			return 0;
+		}
+		else {
+			inFiles.push_back(str);
+		}
+	}
+	
+	if (outFile.empty() || inFiles.empty()) {
+		help();
+		return 1;
+	}
+	
+	if (sserialize::MmappedFile::fileExists(outFile)) {
+		std::cout << "out-file exists" << std::endl;
+		return 1;
+	}
+	
+	sserialize::CellTextCompleterDelta delta;
+	for(const std::string & inFile : inFiles) {
+		if (!sserialize::MmappedFile::fileExists(inFile)) {
+			std::cout << "In-file " << inFile << " does not exist" << std::endl;
+			return 1;
+		}
+		sserialize::CellTextCompleterDelta other(sserialize::UByteArrayAdapter::open(inFile));
+		std::cout << inFile << ": " << other.size() << " items" << std::endl;
+		delta.merge(other);
+	}
+	
+	sserialize::UByteArrayAdapter outFileData( sserialize::UByteArrayAdapter::createFile(1, outFile) );
+	outFileData << delta;
+	outFileData.resize(outFileData.tellPutPtr());
+	std::cout << outFile << ": " << delta.size() << " items" << std::endl;
+	return 0;
+}
@@ -9,6 +9,8 @@
 #include <sserialize/containers/SortedOffsetIndexPrivate.h>
 #include <sserialize/containers/ItemIndexFactory.h>
 #include <sserialize/mt/ThreadPool.h>
+#include <sserialize/stats/TimeMeasuerer.h>
+#include <mutex>
 
 using namespace std;
 using namespace sserialize;
@@ -113,6 +115,146 @@ bool doCheckIndex(const sserialize::Static::ItemIndexStore & indexStore) {
 	return state.ok;
 }
 
+struct VerifyStats {
+	uint64_t indexCount{0};
+	uint64_t itemCount{0};
+	uint64_t dataSize{0};
+	uint64_t errorCount{0};
+	VerifyStats & operator+=(const VerifyStats & o) {
+		indexCount += o.indexCount;
+		itemCount += o.itemCount;
+		dataSize += o.dataSize;
+		errorCount += o.errorCount;
+		return *this;
+	}
+};
+
+//Decodes every index and checks type info, decompression, size, ordering and summaries
+//Returns true, if no errors were found
+bool doVerify(const sserialize::Static::ItemIndexStore & indexStore, uint32_t threadCount, uint32_t maxReportedErrors = 100) {
+	constexpr uint32_t BlockSize = 1024;
+	struct State {
+		std::atomic<uint32_t> i{0};
+		std::mutex lock; //protects pinfo, stats and error output
+		sserialize::ProgressInfo pinfo;
+		VerifyStats stats;
+		///errors of all workers so far, stats only has the errors of finished workers
+		std::atomic<uint64_t> reportedErrors{0};
+		uint32_t maxReportedErrors;
+		sserialize::Static::ItemIndexStore store;
+		
+		void error(uint32_t pos, const std::string & what, VerifyStats & local) {
+			++local.errorCount;
+			if (reportedErrors.fetch_add(1, std::memory_order_relaxed) < maxReportedErrors) {
+				std::unique_lock<std::mutex> lck(lock);
+				std::cout << "Index " << pos << ": " << what << std::endl;
+			}
+		}
+	} state;
+	state.maxReportedErrors = maxReportedErrors;
+	state.store = indexStore;
+	
+	int storeTypes = indexStore.indexTypes();
+	//the raw data of a grouped store is only a serialized index if no other compression is applied on top
+	bool grouped = indexStore.compressionType() == sserialize::Static::ItemIndexStore::IC_LZO_GROUPED;
+	uint32_t storeSize = indexStore.size();
+	
+	sserialize::TimeMeasurer tm;
+	tm.begin();
+	state.pinfo.begin(storeSize, "Verifying index store");
+	sserialize::ThreadPool::execute([&state, storeTypes, grouped, storeSize]() {
+		VerifyStats local;
+		while (true) {
+			uint32_t blockBegin = state.i.fetch_add(BlockSize, std::memory_order_relaxed);
+			if (blockBegin >= storeSize) {
+				break;
+			}
+			uint32_t blockEnd = std::min<uint32_t>(blockBegin+BlockSize, storeSize);
+			for(uint32_t i(blockBegin); i < blockEnd; ++i) {
+				++local.indexCount;
+				ItemIndex::Types t = state.store.indexType(i);
+				if (sserialize::popCount(int(t)) != 1 || !(t & storeTypes)) {
+					state.error(i, "invalid index type " + std::to_string(int(t)), local);
+					continue;
+				}
+				try {
+					auto ds = state.store.dataSize(i);
+					local.dataSize += ds;
+					sserialize::ItemIndex idx;
+					if (grouped) { //avoid decompressing the group twice
+						UByteArrayAdapter raw(state.store.rawDataAt(i));
+						if (raw.size() != ds) {
+							state.error(i, "decompression failed", local);
+							continue;
+						}
+						idx = sserialize::ItemIndex(raw, t);
+					}
+					else {
+						idx = state.store.at(i);
+					}
+					uint32_t idxSize = state.store.idxSize(i);
+					if (idx.size() != idxSize) {
+						state.error(i, "size is " + std::to_string(idx.size()) + " but store says " + std::to_string(idxSize), local);
+					}
+					if (idx.size() && idx.type() != t) {
+						state.error(i, "decoded type does not match type info", local);
+					}
+					//corrupt data may yield an endless iterator, hence the iteration is bounded
+					uint32_t maxCount = std::max<uint32_t>(idx.size(), idxSize);
+					uint32_t count = 0;
+					uint32_t prev = 0;
+					uint64_t signature = 0;
+					for(auto it(idx.cbegin()), end(idx.cend()); it != end && count <= maxCount; ++it, ++count) {
+						uint32_t x = *it;
+						if (count && x <= prev) {
+							state.error(i, "not strictly ascending at position " + std::to_string(count), local);
+							count = idx.size();
+							break;
+						}
+						prev = x;
+						signature |= sserialize::ItemIndexSummary::signatureBit(x);
+					}
+					if (count != idx.size()) {
+						state.error(i, "iterated " + std::to_string(count) + " items but index has " + std::to_string(idx.size()), local);
+					}
+					else if (state.store.hasSummaries()) {
+						sserialize::ItemIndexSummary summary;
+						if (count) {
+							summary = sserialize::ItemIndexSummary(idx.front(), prev, signature);
+						}
+						if (summary != state.store.summary(i)) {
+							state.error(i, "summary does not match index", local);
+						}
+					}
+					local.itemCount += count;
+				}
+				catch (std::exception & e) {
+					state.error(i, std::string("decoding failed: ") + e.what(), local);
+				}
+			}
+			std::unique_lock<std::mutex> lck(state.lock, std::try_to_lock);
+			if (lck.owns_lock()) {
+				state.pinfo(std::min<uint32_t>(state.i.load(std::memory_order_relaxed), storeSize));
+			}
+		}
+		std::unique_lock<std::mutex> lck(state.lock);
+		state.stats += local;
+	}, threadCount, sserialize::ThreadPool::SingletonTaskTag());
+	state.pinfo.end();
+	tm.end();
+	
+	const VerifyStats & stats = state.stats;
+	double seconds = std::max<double>(tm.elapsedUseconds(), 1) / 1000000;
+	std::cout << "Verified " << stats.indexCount << " indexes with " << stats.itemCount << " items and " << stats.dataSize << " Bytes in " << seconds << " s\n";
+	std::cout << "Throughput: " << stats.indexCount/seconds << " indexes/s, " << stats.itemCount/seconds << " items/s, " << double(stats.dataSize)/(seconds*1024*1024) << " MiB/s\n";
+	std::cout << "Found " << stats.errorCount << " errors";
+	if (stats.errorCount > maxReportedErrors) {
+		std::cout << " (only the first " << maxReportedErrors << " were reported)";
+	}
+	std::cout << std::endl;
+	return stats.errorCount == 0;
+}
+
 inline void incAlphabet(std::unordered_map<uint32_t, uint32_t> & a, uint32_t v) {
 	if (a.count(v) == 0)
 		a[v] = 1;
@@ -245,6 +387,10 @@ UByteArrayAdapter::OffsetType recompressLZO(sserialize::Static::ItemIndexStore &
 	return sserialize::ItemIndexFactory::compressWithLZO(store, dest);
 }
 
+UByteArrayAdapter::OffsetType recompressLZOGrouped(sserialize::Static::ItemIndexStore & store, UByteArrayAdapter & dest, UByteArrayAdapter::SizeType groupSize) {
+	return sserialize::ItemIndexFactory::compressWithLZOGrouped(store, dest, groupSize);
+}
+
 UByteArrayAdapter::OffsetType recompressDataVarUint(sserialize::Static::ItemIndexStore & store, UByteArrayAdapter & dest) {
 	return sserialize::ItemIndexFactory::compressWithVarUint(store, dest);
 }
@@ -280,13 +426,16 @@ void printHelp() {
 	-rch\trecompress with huffmann \n \
 	-rcv\trecompress with varuint32 \n \
 	-rclzo\trecompress with lzo \n \
+	-rclzog num\trecompress with lzo, grouping indexes until a group has at least num bytes \n \
 	-cc\tcheck compressed/transformed \n \
 	-o filename\tout file name\n \
 	-eq filename\tequality test \n \
 	-ds\tdump stats \n \
 	-t type\ttransform to (rline|wah|de|rlede|simple|native|eliasfano|pfor) \n \
 	-nd\tdisable deduplication of item index store \n \
+	--summaries\tadd index summaries when transforming \n \
 	-c\tcheck item index store \n \
+	--verify\tdecode and verify every index and its summary in parallel (threads: -tc, default: all cores) \n \
 	-tc\tthread count (default: 1) \n \
 	--fsck (indexsizes) \
 	" << std::endl;
@@ -309,10 +458,15 @@ int main(int argc, char ** argv) {
 	bool recompressVar = false;
 	bool recompressVarShannon = false;
 	bool recompressWithLZO = false;
+	UByteArrayAdapter::SizeType lzoGroupSize = 0;
 	bool checkCompressed = false;
 	bool checkIndex = false;
+	bool verify = false;
+	bool verifyOk = true;
 	bool deduplication = true;
+	bool summaries = false;
 	uint32_t threadCount = 1;
+	bool threadCountSet = false;
 	std::string fsck;
 	std::string equalityTest;
 	int transform = ItemIndex::T_NULL;
@@ -343,12 +497,19 @@ int main(int argc, char ** argv) {
 		else if (curArg == "-rclzo") {
 			recompressWithLZO = true;
 		}
+		else if (curArg == "-rclzog" && i+1 < argc) {
+			lzoGroupSize = ::atoll(argv[i+1]);
+			++i;
+		}
 		else if (curArg == "-cc") {
 			checkCompressed = true;
 		}
 		else if (curArg == "-c") {
 			checkIndex = true;
 		}
+		else if (curArg == "--verify") {
+			verify = true;
+		}
 		else if (curArg == "-o" && i+1 < argc) {
 			outFileName = std::string(argv[i+1]);
 			i++;
@@ -369,8 +530,12 @@ int main(int argc, char ** argv) {
 		else if (curArg == "-nd") {
 			deduplication = false;
 		}
+		else if (curArg == "--summaries") {
+			summaries = true;
+		}
 		else if ((curArg == "-tc" || curArg == "--threadCount") && i+1 < argc) {
 			threadCount = ::atoi(argv[i+1]);
+			threadCountSet = true;
 			++i;
 		}
 		else if (curArg == "--fsck" && i+1 < argc) {
@@ -548,6 +713,27 @@ int main(int argc, char ** argv) {
 		}
 	}
 	
+	if (lzoGroupSize) {
+		std::string outFile;
+		if (outFileName.empty())
+			outFile = inFileName + ".lzogcmp";
+		else
+			outFile = outFileName;
+		UByteArrayAdapter outData(UByteArrayAdapter::createFile(adap.size(), outFile));
+		UByteArrayAdapter::OffsetType size =  recompressLZOGrouped(store, outData, lzoGroupSize);
+		if (size > 0)
+			outData.shrinkStorage(outData.size()-size);
+		else
+			outData.setDeleteOnClose(true);
+		if (checkCompressed) {
+			std::cout << "Checking compressed index for equality..." << std::endl;
+			sserialize::Static::ItemIndexStore cis(outData);
+			if (checkCompressedIndex(store, cis)) {
+				std::cout << "Compressed index is equal to uncompressed index." << std::endl;
+			}
+		}
+	}
+	
 	if (dumpStats) {
 		store.printStats(std::cout);
 	}
@@ -569,6 +755,16 @@ int main(int argc, char ** argv) {
 		}
 	}
 	
+	if (verify) {
+		verifyOk = doVerify(store, (threadCountSet ? threadCount : 0));
+		if (verifyOk) {
+			std::cout << "Verification of ItemIndexStore PASSED" << std::endl;
+		}
+		else {
+			std::cout << "Verification of ItemIndexStore FAILED" << std::endl;
+		}
+	}
+	
 	if (transform != ItemIndex::T_NULL) {
 		if (outFileName.empty()) {
 			outFileName = inFileName + ".";
@@ -584,6 +780,7 @@ int main(int argc, char ** argv) {
 		factory.setType(transform);
 		factory.setIndexFile(outData);
 		factory.setDeduplication(deduplication);
+		factory.setSummaries(summaries);
 		factory.setCheckIndex(checkCompressed);
 		std::cout << "Transforming index" << std::endl;
 		factory.insert(store, threadCount);
@@ -604,4 +801,5 @@ int main(int argc, char ** argv) {
 	#ifdef SSERIALIZE_UBA_OPTIONAL_REFCOUNTING
 		adap.enableRefCounting();
 	#endif
+	return (verifyOk ? 0 : 1);
 }